@@ -0,0 +1,194 @@
+#!/usr/bin/env python3
+#/***************************************************************************
+# *
+# *  @license
+# *  Copyright (C) Codeplay Software Limited
+# *  Licensed under the Apache License, Version 2.0 (the "License");
+# *  you may not use this file except in compliance with the License.
+# *  You may obtain a copy of the License at
+# *
+# *      http://www.apache.org/licenses/LICENSE-2.0
+# *
+# *  For your convenience, a copy of the License has been included in this
+# *  repository.
+# *
+# *  Unless required by applicable law or agreed to in writing, software
+# *  distributed under the License is distributed on an "AS IS" BASIS,
+# *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# *  See the License for the specific language governing permissions and
+# *  limitations under the License.
+# *
+# *  SYCL-BLAS: BLAS implementation using SYCL
+# *
+# *  @filename compare_runs.py
+# *
+# **************************************************************************/
+
+"""This tool compares two JSON outputs of the benchmarks (baseline and
+   contender), matching the benchmarks by name, and flags the ones that got
+   slower by more than a threshold with a Mann-Whitney U test across the
+   repetitions. The exit code is 1 if any regression is found.
+   See the documentation in README.md for more information.
+"""
+
+import argparse
+import json
+import math
+import sys
+
+
+def load_times(file_name, metric):
+    """Return a dictionary from benchmark name to the list of the values of
+       the metric over the repetitions, ignoring the aggregates and the
+       benchmarks that failed
+    """
+    with open(file_name) as f_read:
+        runs = json.load(f_read)["benchmarks"]
+    times = {}
+    for run in runs:
+        if run.get("run_type", "iteration") != "iteration":
+            continue
+        if run.get("error_occurred", False) or metric not in run:
+            continue
+        name = run.get("run_name", run["name"])
+        times.setdefault(name, []).append(float(run[metric]))
+    return times
+
+
+def median(values):
+    """Median of a non-empty list
+    """
+    ordered = sorted(values)
+    mid = len(ordered) // 2
+    if len(ordered) % 2:
+        return ordered[mid]
+    return 0.5 * (ordered[mid - 1] + ordered[mid])
+
+
+def mann_whitney_p_value(x, y):
+    """Two-sided p-value of the Mann-Whitney U test, with the normal
+       approximation corrected for ties and continuity
+    """
+    n_x, n_y = len(x), len(y)
+    n = n_x + n_y
+    values = sorted([(v, 0) for v in x] + [(v, 1) for v in y])
+    # Average ranks of the tied values
+    rank_sum_x = 0.0
+    tie_term = 0.0
+    i = 0
+    while i < n:
+        j = i
+        while j + 1 < n and values[j + 1][0] == values[i][0]:
+            j += 1
+        rank = 0.5 * (i + j) + 1
+        rank_sum_x += rank * sum(1 for k in range(i, j + 1)
+                                 if values[k][1] == 0)
+        ties = j - i + 1
+        tie_term += ties ** 3 - ties
+        i = j + 1
+    u_x = rank_sum_x - n_x * (n_x + 1) / 2
+    mean = n_x * n_y / 2
+    variance = n_x * n_y / 12 * ((n + 1) - tie_term / (n * (n - 1)))
+    if variance <= 0:
+        return 1.0
+    z = max(abs(u_x - mean) - 0.5, 0) / math.sqrt(variance)
+    return math.erfc(z / math.sqrt(2))
+
+
+def min_p_value(n_x, n_y):
+    """Smallest p-value the test can return for these sample sizes, reached
+       when the two samples do not overlap
+    """
+    return mann_whitney_p_value(range(n_x), range(n_x, n_x + n_y))
+
+
+def compare(baseline, contender, args):
+    """Return the rows of the comparison table and the number of regressions
+    """
+    rows = []
+    regressions = 0
+    for name in sorted(set(baseline) | set(contender)):
+        if name not in baseline or name not in contender:
+            status = "only baseline" if name in baseline else "only contender"
+            rows.append((name, "", "", "", "", status))
+            continue
+        base, cont = baseline[name], contender[name]
+        base_median, cont_median = median(base), median(cont)
+        change = cont_median / base_median - 1 if base_median > 0 else 0.0
+        # Without repetitions there is no noise estimate, and with too few
+        # the test can never reach the significance level, so only the
+        # threshold applies
+        enough = (min(len(base), len(cont)) >= args.min_repetitions and
+                  min_p_value(len(base), len(cont)) < args.alpha)
+        p_value = mann_whitney_p_value(base, cont) if enough else None
+        significant = p_value is None or p_value < args.alpha
+        if change > args.threshold and significant:
+            status = "REGRESSION"
+            regressions += 1
+        elif change < -args.threshold and significant:
+            status = "improvement"
+        else:
+            status = "ok"
+        rows.append((name, "{:.6g}".format(base_median),
+                     "{:.6g}".format(cont_median),
+                     "{:+.2f}%".format(100 * change),
+                     "-" if p_value is None else "{:.4f}".format(p_value),
+                     status))
+    return rows, regressions
+
+
+def main(args):
+    """Compare the two files and print the table
+    """
+    baseline = load_times(args.baseline, args.metric)
+    contender = load_times(args.contender, args.metric)
+    rows, regressions = compare(baseline, contender, args)
+    if min_p_value(args.min_repetitions, args.min_repetitions) >= args.alpha:
+        print("Warning: {} repetitions can never reach a p-value below {}, "
+              "the threshold alone applies to such benchmarks".format(
+                  args.min_repetitions, args.alpha), file=sys.stderr)
+
+    header = ("name", "baseline", "contender", "change", "p-value", "status")
+    widths = [max(len(str(r[c])) for r in rows + [header])
+              for c in range(len(header))]
+    for row in [header] + rows:
+        print("  ".join(str(v).ljust(w) for v, w in zip(row, widths)))
+    print("\n{} regression(s) above {:.1f}% in {}".format(
+        regressions, 100 * args.threshold, args.metric))
+    return 1 if regressions else 0
+
+
+def get_args(args_str=""):
+    """Parse the command line arguments (displays information if the -h or
+       --help option is used)
+    """
+    description = ("Tool to compare two JSON outputs of the benchmarks and "
+                   "flag the regressions")
+    parser = argparse.ArgumentParser(description=description)
+    parser.add_argument("baseline", metavar="baseline.json",
+                        help="Reference run")
+    parser.add_argument("contender", metavar="contender.json",
+                        help="Run to check for regressions")
+    parser.add_argument("-m", dest="metric", default="avg_event_time",
+                        metavar="metric",
+                        help="Time to compare, e.g avg_event_time (default), "
+                        "avg_overall_time or real_time")
+    parser.add_argument("-t", dest="threshold", type=float, default=0.05,
+                        metavar="threshold",
+                        help="Relative slowdown of the medians above which a "
+                        "benchmark is flagged (default 0.05)")
+    parser.add_argument("-a", dest="alpha", type=float, default=0.05,
+                        metavar="alpha",
+                        help="Significance level of the Mann-Whitney U test "
+                        "(default 0.05)")
+    parser.add_argument("-r", dest="min_repetitions", type=int, default=4,
+                        metavar="repetitions",
+                        help="Minimum number of repetitions on both sides to "
+                        "run the test, below which only the threshold "
+                        "applies (default 4)")
+    args = parser.parse_args(args_str) if args_str else parser.parse_args()
+    return args
+
+
+if __name__ == "__main__":
+    sys.exit(main(args=get_args()))
@@ -0,0 +1,176 @@
+#!/usr/bin/env python3
+#/***************************************************************************
+# *
+# *  @license
+# *  Copyright (C) Codeplay Software Limited
+# *  Licensed under the Apache License, Version 2.0 (the "License");
+# *  you may not use this file except in compliance with the License.
+# *  You may obtain a copy of the License at
+# *
+# *      http://www.apache.org/licenses/LICENSE-2.0
+# *
+# *  For your convenience, a copy of the License has been included in this
+# *  repository.
+# *
+# *  Unless required by applicable law or agreed to in writing, software
+# *  distributed under the License is distributed on an "AS IS" BASIS,
+# *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# *  See the License for the specific language governing permissions and
+# *  limitations under the License.
+# *
+# *  SYCL-BLAS: BLAS implementation using SYCL
+# *
+# *  @filename gemm_model.py
+# *
+# **************************************************************************/
+
+"""This tool calibrates the GEMM performance model of SYCL-BLAS: from JSON
+   outputs of bench_gemm or bench_gemm_batched run with a model, it fits for
+   each configuration the coefficients of
+     time = overhead + compute * model_compute_term
+                     + memory * model_memory_term
+   and writes them in the format read by blas::GemmModel::read.
+   See the documentation in README.md for more information.
+"""
+
+import argparse
+import itertools
+import json
+import sys
+
+FEATURES = ("overhead", "compute", "memory")
+
+
+def load_samples(file_names, metric):
+    """Return a dictionary from configuration name to the list of the
+       (features, time) samples of the runs, the configuration being the
+       last component of the benchmark name
+    """
+    samples = {}
+    for file_name in file_names:
+        with open(file_name) as f_read:
+            runs = json.load(f_read)["benchmarks"]
+        for run in runs:
+            if run.get("run_type", "iteration") != "iteration":
+                continue
+            if run.get("error_occurred", False):
+                continue
+            if "model_compute_term" not in run or metric not in run:
+                continue
+            config = run.get("run_name", run["name"]).split("/")[-1]
+            features = (1.0, float(run["model_compute_term"]),
+                        float(run["model_memory_term"]))
+            samples.setdefault(config, []).append(
+                (features, float(run[metric])))
+    return samples
+
+
+def solve(matrix, vector):
+    """Solve the linear system by Gaussian elimination with partial
+       pivoting, returning None if it is singular
+    """
+    n = len(vector)
+    a = [list(row) + [v] for row, v in zip(matrix, vector)]
+    for col in range(n):
+        pivot = max(range(col, n), key=lambda r: abs(a[r][col]))
+        if abs(a[pivot][col]) < 1e-300:
+            return None
+        a[col], a[pivot] = a[pivot], a[col]
+        for row in range(col + 1, n):
+            factor = a[row][col] / a[col][col]
+            for c in range(col, n + 1):
+                a[row][c] -= factor * a[col][c]
+    x = [0.0] * n
+    for row in reversed(range(n)):
+        x[row] = (a[row][n] - sum(a[row][c] * x[c]
+                                  for c in range(row + 1, n))) / a[row][row]
+    return x
+
+
+def fit(samples):
+    """Non-negative least squares fit of the coefficients on the relative
+       error, so that the small shapes weigh as much as the large ones.
+       Every subset of the features is solved by the normal equations and
+       the best one with non-negative coefficients is kept.
+    """
+    # Scale the features to avoid an ill-conditioned system
+    scales = [max(abs(f[i]) for f, _ in samples) or 1.0
+              for i in range(len(FEATURES))]
+    rows = [[f[i] / (scales[i] * t) for i in range(len(FEATURES))]
+            for f, t in samples]
+    best, best_error = None, None
+    for size in range(1, len(FEATURES) + 1):
+        for subset in itertools.combinations(range(len(FEATURES)), size):
+            matrix = [[sum(r[i] * r[j] for r in rows) for j in subset]
+                      for i in subset]
+            vector = [sum(r[i] for r in rows) for i in subset]
+            solution = solve(matrix, vector)
+            if solution is None or min(solution) < 0:
+                continue
+            coefficients = [0.0] * len(FEATURES)
+            for i, value in zip(subset, solution):
+                coefficients[i] = value
+            error = sum((sum(c * v for c, v in zip(coefficients, r)) - 1) ** 2
+                        for r in rows)
+            if best_error is None or error < best_error:
+                best, best_error = coefficients, error
+    if best is None:
+        return None, None
+    coefficients = [c / s for c, s in zip(best, scales)]
+    return coefficients, (best_error / len(rows)) ** 0.5
+
+
+def main(args):
+    """Fit every configuration with enough samples and write the model
+    """
+    samples = load_samples(args.runs, args.metric)
+    lines = []
+    for config in sorted(samples):
+        if len(samples[config]) < args.min_samples:
+            print("{}: {} sample(s), skipped".format(
+                config, len(samples[config])))
+            continue
+        coefficients, error = fit(samples[config])
+        if coefficients is None:
+            print("{}: no non-negative fit, skipped".format(config))
+            continue
+        print("{}: {} samples, relative RMS error {:.2f}%".format(
+            config, len(samples[config]), 100 * error))
+        lines.append("{} {}".format(
+            config, " ".join(repr(c) for c in coefficients)))
+    if not lines:
+        print("No configuration could be calibrated")
+        return 1
+    with open(args.output, "w") as f_write:
+        f_write.write("sycl-blas-gemm-model 1\n")
+        f_write.write("\n".join(lines) + "\n")
+    return 0
+
+
+def get_args(args_str=""):
+    """Parse the command line arguments (displays information if the -h or
+       --help option is used)
+    """
+    description = ("Tool to fit the coefficients of the GEMM performance "
+                   "model on benchmark runs")
+    parser = argparse.ArgumentParser(description=description)
+    parser.add_argument("runs", metavar="run.json", nargs="+",
+                        help="JSON outputs of the GEMM benchmarks run with "
+                        "--gemm-config or --gemm-model")
+    parser.add_argument("-o", dest="output", default="gemm_model.txt",
+                        metavar="filepath",
+                        help="Model file to write (default gemm_model.txt)")
+    parser.add_argument("-m", dest="metric", default="avg_event_time",
+                        metavar="metric",
+                        help="Time to fit, in nanoseconds, e.g "
+                        "avg_event_time (default) or avg_overall_time")
+    parser.add_argument("-s", dest="min_samples", type=int, default=6,
+                        metavar="samples",
+                        help="Minimum number of runs of a configuration to "
+                        "fit it (default 6)")
+    args = parser.parse_args(args_str) if args_str else parser.parse_args()
+    return args
+
+
+if __name__ == "__main__":
+    sys.exit(main(args=get_args()))
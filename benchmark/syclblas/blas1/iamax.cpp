@@ -83,7 +83,6 @@ void run(benchmark::State& state, blas::SB_Handle* sb_handle_ptr, index_t size,
 
   auto blas_method_def = [&]() -> std::vector<cl::sycl::event> {
     auto event = _iamax(sb_handle, size, inx, static_cast<index_t>(1), outI);
-    sb_handle.wait(event);
     return event;
   };
 
@@ -96,14 +95,15 @@ void run(benchmark::State& state, blas::SB_Handle* sb_handle_ptr, index_t size,
   // Measure
   for (auto _ : state) {
     // Run
-    std::tuple<double, double> times =
-        blas_benchmark::utils::timef(blas_method_def);
+    std::tuple<double, double> times = blas_benchmark::utils::time_submissions(
+        state, sb_handle, blas_method_def);
 
     // Report
     blas_benchmark::utils::update_counters(state, times);
   }
 
   blas_benchmark::utils::calc_avg_counters(state);
+  blas_benchmark::utils::calc_roofline_counters<scalar_t>(state);
 }
 
 template <typename scalar_t>
@@ -0,0 +1,131 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) 2016 Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename rot.cpp
+ *
+ **************************************************************************/
+
+#include "../utils.hpp"
+
+template <typename scalar_t>
+std::string get_name(int size) {
+  std::ostringstream str{};
+  str << "BM_Rot<" << blas_benchmark::utils::get_type_name<scalar_t>() << ">/";
+  str << size;
+  return str.str();
+}
+
+template <typename scalar_t>
+void run(benchmark::State& state, blas::SB_Handle* sb_handle_ptr, index_t size,
+         bool* success) {
+  // Google-benchmark counters are double.
+  double size_d = static_cast<double>(size);
+  state.counters["size"] = size_d;
+  state.counters["n_fl_ops"] = 6.0 * size_d;
+  state.counters["bytes_processed"] = 4.0 * size_d * sizeof(scalar_t);
+
+  blas::SB_Handle& sb_handle = *sb_handle_ptr;
+
+  // Create data
+  std::vector<scalar_t> v1 = blas_benchmark::utils::random_data<scalar_t>(size);
+  std::vector<scalar_t> v2 = blas_benchmark::utils::random_data<scalar_t>(size);
+
+  // Rotation of a random angle, so that the vectors keep their norm over the
+  // iterations.
+  const scalar_t angle = blas_benchmark::utils::random_scalar<scalar_t>(
+      scalar_t{0}, scalar_t{6.28});
+  const scalar_t c = std::cos(angle);
+  const scalar_t s = std::sin(angle);
+
+  auto inx = blas::make_sycl_iterator_buffer<scalar_t>(v1, size);
+  auto iny = blas::make_sycl_iterator_buffer<scalar_t>(v2, size);
+
+#ifdef BLAS_VERIFY_BENCHMARK
+  // Run a first time with a verification of the results
+  std::vector<scalar_t> x_ref = v1;
+  std::vector<scalar_t> y_ref = v2;
+  reference_blas::rot(size, x_ref.data(), 1, y_ref.data(), 1, c, s);
+  std::vector<scalar_t> x_temp = v1;
+  std::vector<scalar_t> y_temp = v2;
+  {
+    auto x_temp_gpu = blas::make_sycl_iterator_buffer<scalar_t>(x_temp, size);
+    auto y_temp_gpu = blas::make_sycl_iterator_buffer<scalar_t>(y_temp, size);
+    auto event = _rot(sb_handle, size, x_temp_gpu, static_cast<index_t>(1),
+                      y_temp_gpu, static_cast<index_t>(1), c, s);
+    sb_handle.wait(event);
+  }
+
+  std::ostringstream err_stream;
+  if (!utils::compare_vectors(x_temp, x_ref, err_stream, "") ||
+      !utils::compare_vectors(y_temp, y_ref, err_stream, "")) {
+    const std::string& err_str = err_stream.str();
+    state.SkipWithError(err_str.c_str());
+    *success = false;
+  };
+#endif
+
+  auto blas_method_def = [&]() -> std::vector<cl::sycl::event> {
+    auto event = _rot(sb_handle, size, inx, static_cast<index_t>(1), iny,
+                      static_cast<index_t>(1), c, s);
+    return event;
+  };
+
+  // Warmup
+  blas_benchmark::utils::warmup(blas_method_def);
+  sb_handle.wait();
+
+  blas_benchmark::utils::init_counters(state);
+
+  // Measure
+  for (auto _ : state) {
+    // Run
+    std::tuple<double, double> times = blas_benchmark::utils::time_submissions(
+        state, sb_handle, blas_method_def);
+
+    // Report
+    blas_benchmark::utils::update_counters(state, times);
+  }
+
+  blas_benchmark::utils::calc_avg_counters(state);
+  blas_benchmark::utils::calc_roofline_counters<scalar_t>(state);
+}
+
+template <typename scalar_t>
+void register_benchmark(blas_benchmark::Args& args,
+                        blas::SB_Handle* sb_handle_ptr, bool* success) {
+  auto blas1_params = blas_benchmark::utils::get_blas1_params(args);
+
+  for (auto size : blas1_params) {
+    auto BM_lambda = [&](benchmark::State& st, blas::SB_Handle* sb_handle_ptr,
+                         index_t size, bool* success) {
+      run<scalar_t>(st, sb_handle_ptr, size, success);
+    };
+    benchmark::RegisterBenchmark(get_name<scalar_t>(size).c_str(), BM_lambda,
+                                 sb_handle_ptr, size, success);
+  }
+}
+
+namespace blas_benchmark {
+void create_benchmark(blas_benchmark::Args& args,
+                      blas::SB_Handle* sb_handle_ptr, bool* success) {
+  BLAS_REGISTER_BENCHMARK(args, sb_handle_ptr, success);
+}
+}  // namespace blas_benchmark
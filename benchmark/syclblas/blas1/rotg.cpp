@@ -103,25 +103,26 @@ void run(benchmark::State& state, blas::SB_Handle* sb_handle_ptr,
   // Create a utility lambda describing the blas method that we want to run.
   auto blas_method_def = [&]() -> std::vector<cl::sycl::event> {
     auto event = _rotg(sb_handle, buf_a, buf_b, buf_c, buf_s);
-    sb_handle.wait(event);
     return event;
   };
 
   // Warm up to avoid benchmarking data transfer
   blas_benchmark::utils::warmup(blas_method_def);
+  sb_handle.wait();
 
   blas_benchmark::utils::init_counters(state);
 
   // Measure
   for (auto _ : state) {
-    std::tuple<double, double> times =
-        blas_benchmark::utils::timef(blas_method_def);
+    std::tuple<double, double> times = blas_benchmark::utils::time_submissions(
+        state, sb_handle, blas_method_def);
 
     // Report
     blas_benchmark::utils::update_counters(state, times);
   }
 
   blas_benchmark::utils::calc_avg_counters(state);
+  blas_benchmark::utils::calc_roofline_counters<scalar_t>(state);
 };
 
 template <typename scalar_t>
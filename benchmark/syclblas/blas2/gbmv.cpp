@@ -121,7 +121,6 @@ void run(benchmark::State& state, blas::SB_Handle* sb_handle_ptr, int ti,
   auto blas_method_def = [&]() -> std::vector<cl::sycl::event> {
     auto event = _gbmv(sb_handle, *t_str, m, n, kl, ku, alpha, m_a_gpu, lda,
                        v_x_gpu, incX, beta, v_y_gpu, incY);
-    sb_handle.wait(event);
     return event;
   };
 
@@ -134,14 +133,15 @@ void run(benchmark::State& state, blas::SB_Handle* sb_handle_ptr, int ti,
   // Measure
   for (auto _ : state) {
     // Run
-    std::tuple<double, double> times =
-        blas_benchmark::utils::timef(blas_method_def);
+    std::tuple<double, double> times = blas_benchmark::utils::time_submissions(
+        state, sb_handle, blas_method_def);
 
     // Report
     blas_benchmark::utils::update_counters(state, times);
   }
 
   blas_benchmark::utils::calc_avg_counters(state);
+  blas_benchmark::utils::calc_roofline_counters<scalar_t>(state);
 }
 
 template <typename scalar_t>
@@ -0,0 +1,150 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) 2016 Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename ger.cpp
+ *
+ **************************************************************************/
+
+#include "../utils.hpp"
+
+template <typename scalar_t>
+std::string get_name(index_t m, index_t n) {
+  std::ostringstream str{};
+  str << "BM_Ger<" << blas_benchmark::utils::get_type_name<scalar_t>() << ">/"
+      << m << "/" << n;
+  return str.str();
+}
+
+template <typename scalar_t>
+void run(benchmark::State& state, blas::SB_Handle* sb_handle_ptr, index_t m,
+         index_t n, scalar_t alpha, bool* success) {
+  // Standard test setup.
+  index_t lda = m;
+  index_t incX = 1;
+  index_t incY = 1;
+
+  // The counters are double. We convert m and n to double to avoid
+  // integer overflows for n_fl_ops and bytes_processed
+  double m_d = static_cast<double>(m);
+  double n_d = static_cast<double>(n);
+
+  state.counters["m"] = m_d;
+  state.counters["n"] = n_d;
+
+  {
+    double nflops_timesAlpha = m_d;
+    double nflops_XtimesYaddA = 2.0 * m_d * n_d;
+    state.counters["n_fl_ops"] = nflops_timesAlpha + nflops_XtimesYaddA;
+  }
+  {
+    double mem_readA = m_d * n_d;
+    double mem_writeA = m_d * n_d;
+    double mem_readX = m_d;
+    double mem_readY = n_d;
+    state.counters["bytes_processed"] =
+        (mem_readA + mem_writeA + mem_readX + mem_readY) * sizeof(scalar_t);
+  }
+
+  blas::SB_Handle& sb_handle = *sb_handle_ptr;
+
+  // Input vectors, matrix updated in place.
+  std::vector<scalar_t> m_a =
+      blas_benchmark::utils::random_data<scalar_t>(lda * n);
+  std::vector<scalar_t> v_x = blas_benchmark::utils::random_data<scalar_t>(m);
+  std::vector<scalar_t> v_y = blas_benchmark::utils::random_data<scalar_t>(n);
+
+  auto m_a_gpu = blas::make_sycl_iterator_buffer<scalar_t>(m_a, lda * n);
+  auto v_x_gpu = blas::make_sycl_iterator_buffer<scalar_t>(v_x, m);
+  auto v_y_gpu = blas::make_sycl_iterator_buffer<scalar_t>(v_y, n);
+
+#ifdef BLAS_VERIFY_BENCHMARK
+  // Run a first time with a verification of the results
+  std::vector<scalar_t> m_a_ref = m_a;
+  reference_blas::ger(m, n, alpha, v_x.data(), incX, v_y.data(), incY,
+                      m_a_ref.data(), lda);
+  std::vector<scalar_t> m_a_temp = m_a;
+  {
+    auto m_a_temp_gpu =
+        blas::make_sycl_iterator_buffer<scalar_t>(m_a_temp, lda * n);
+    auto event = _ger(sb_handle, m, n, alpha, v_x_gpu, incX, v_y_gpu, incY,
+                      m_a_temp_gpu, lda);
+    sb_handle.wait(event);
+  }
+
+  std::ostringstream err_stream;
+  if (!utils::compare_vectors(m_a_temp, m_a_ref, err_stream, "")) {
+    const std::string& err_str = err_stream.str();
+    state.SkipWithError(err_str.c_str());
+    *success = false;
+  };
+#endif
+
+  auto blas_method_def = [&]() -> std::vector<cl::sycl::event> {
+    auto event = _ger(sb_handle, m, n, alpha, v_x_gpu, incX, v_y_gpu, incY,
+                      m_a_gpu, lda);
+    return event;
+  };
+
+  // Warmup
+  blas_benchmark::utils::warmup(blas_method_def);
+  sb_handle.wait();
+
+  blas_benchmark::utils::init_counters(state);
+
+  // Measure
+  for (auto _ : state) {
+    // Run
+    std::tuple<double, double> times = blas_benchmark::utils::time_submissions(
+        state, sb_handle, blas_method_def);
+
+    // Report
+    blas_benchmark::utils::update_counters(state, times);
+  }
+
+  blas_benchmark::utils::calc_avg_counters(state);
+  blas_benchmark::utils::calc_roofline_counters<scalar_t>(state);
+}
+
+template <typename scalar_t>
+void register_benchmark(blas_benchmark::Args& args,
+                        blas::SB_Handle* sb_handle_ptr, bool* success) {
+  auto ger_params = blas_benchmark::utils::get_ger_params<scalar_t>(args);
+
+  for (auto p : ger_params) {
+    index_t m, n;
+    scalar_t alpha;
+    std::tie(m, n, alpha) = p;
+
+    auto BM_lambda = [&](benchmark::State& st, blas::SB_Handle* sb_handle_ptr,
+                         index_t m, index_t n, scalar_t alpha, bool* success) {
+      run<scalar_t>(st, sb_handle_ptr, m, n, alpha, success);
+    };
+    benchmark::RegisterBenchmark(get_name<scalar_t>(m, n).c_str(), BM_lambda,
+                                 sb_handle_ptr, m, n, alpha, success);
+  }
+}
+
+namespace blas_benchmark {
+void create_benchmark(blas_benchmark::Args& args,
+                      blas::SB_Handle* sb_handle_ptr, bool* success) {
+  BLAS_REGISTER_BENCHMARK(args, sb_handle_ptr, success);
+}
+}  // namespace blas_benchmark
@@ -0,0 +1,146 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) 2016 Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename spr.cpp
+ *
+ **************************************************************************/
+
+#include "../utils.hpp"
+
+template <typename scalar_t>
+std::string get_name(char uplo, index_t n) {
+  std::ostringstream str{};
+  str << "BM_Spr<" << blas_benchmark::utils::get_type_name<scalar_t>() << ">/"
+      << uplo << "/" << n;
+  return str.str();
+}
+
+template <typename scalar_t>
+void run(benchmark::State& state, blas::SB_Handle* sb_handle_ptr, char uplo,
+         index_t n, scalar_t alpha, bool* success) {
+  // Standard test setup.
+  index_t incX = 1;
+
+  // The counters are double. We convert n to double to avoid integer
+  // overflows for n_fl_ops and bytes_processed
+  double n_d = static_cast<double>(n);
+
+  state.counters["n"] = n_d;
+
+  // Only one triangle of A is read and written.
+  const double A_validVal = n_d * (n_d + 1) / 2;
+
+  {
+    double nflops_timesAlpha = n_d;
+    double nflops_XtimesXaddA = 2.0 * A_validVal;
+    state.counters["n_fl_ops"] = nflops_timesAlpha + nflops_XtimesXaddA;
+  }
+  {
+    double mem_readA = A_validVal;
+    double mem_writeA = A_validVal;
+    double mem_readX = n_d;
+    state.counters["bytes_processed"] =
+        (mem_readA + mem_writeA + mem_readX) * sizeof(scalar_t);
+  }
+
+  blas::SB_Handle& sb_handle = *sb_handle_ptr;
+
+  // Input vector, packed matrix updated in place.
+  const index_t size_ap = n * (n + 1) / 2;
+  std::vector<scalar_t> m_ap =
+      blas_benchmark::utils::random_data<scalar_t>(size_ap);
+  std::vector<scalar_t> v_x = blas_benchmark::utils::random_data<scalar_t>(n);
+
+  auto m_ap_gpu = blas::make_sycl_iterator_buffer<scalar_t>(m_ap, size_ap);
+  auto v_x_gpu = blas::make_sycl_iterator_buffer<scalar_t>(v_x, n);
+
+#ifdef BLAS_VERIFY_BENCHMARK
+  // Run a first time with a verification of the results
+  std::vector<scalar_t> m_ap_ref = m_ap;
+  reference_blas::spr(&uplo, n, alpha, v_x.data(), incX, m_ap_ref.data());
+  std::vector<scalar_t> m_ap_temp = m_ap;
+  {
+    auto m_ap_temp_gpu =
+        blas::make_sycl_iterator_buffer<scalar_t>(m_ap_temp, size_ap);
+    auto event = _spr(sb_handle, uplo, n, alpha, v_x_gpu, incX, m_ap_temp_gpu);
+    sb_handle.wait(event);
+  }
+
+  std::ostringstream err_stream;
+  if (!utils::compare_vectors(m_ap_temp, m_ap_ref, err_stream, "")) {
+    const std::string& err_str = err_stream.str();
+    state.SkipWithError(err_str.c_str());
+    *success = false;
+  };
+#endif
+
+  auto blas_method_def = [&]() -> std::vector<cl::sycl::event> {
+    auto event = _spr(sb_handle, uplo, n, alpha, v_x_gpu, incX, m_ap_gpu);
+    return event;
+  };
+
+  // Warmup
+  blas_benchmark::utils::warmup(blas_method_def);
+  sb_handle.wait();
+
+  blas_benchmark::utils::init_counters(state);
+
+  // Measure
+  for (auto _ : state) {
+    // Run
+    std::tuple<double, double> times = blas_benchmark::utils::time_submissions(
+        state, sb_handle, blas_method_def);
+
+    // Report
+    blas_benchmark::utils::update_counters(state, times);
+  }
+
+  blas_benchmark::utils::calc_avg_counters(state);
+  blas_benchmark::utils::calc_roofline_counters<scalar_t>(state);
+}
+
+template <typename scalar_t>
+void register_benchmark(blas_benchmark::Args& args,
+                        blas::SB_Handle* sb_handle_ptr, bool* success) {
+  auto spr_params = blas_benchmark::utils::get_syr_params<scalar_t>(args);
+
+  for (auto p : spr_params) {
+    char uplo;
+    index_t n;
+    scalar_t alpha;
+    std::tie(uplo, n, alpha) = p;
+
+    auto BM_lambda = [&](benchmark::State& st, blas::SB_Handle* sb_handle_ptr,
+                         char uplo, index_t n, scalar_t alpha, bool* success) {
+      run<scalar_t>(st, sb_handle_ptr, uplo, n, alpha, success);
+    };
+    benchmark::RegisterBenchmark(get_name<scalar_t>(uplo, n).c_str(),
+                                 BM_lambda, sb_handle_ptr, uplo, n, alpha,
+                                 success);
+  }
+}
+
+namespace blas_benchmark {
+void create_benchmark(blas_benchmark::Args& args,
+                      blas::SB_Handle* sb_handle_ptr, bool* success) {
+  BLAS_REGISTER_BENCHMARK(args, sb_handle_ptr, success);
+}
+}  // namespace blas_benchmark
@@ -0,0 +1,161 @@
+/**************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename tbsv.cpp
+ *
+ **************************************************************************/
+
+#include "../utils.hpp"
+
+template <typename scalar_t>
+std::string get_name(char uplo, char trans, char diag, index_t n, index_t k) {
+  std::ostringstream str{};
+  str << "BM_Tbsv<" << blas_benchmark::utils::get_type_name<scalar_t>() << ">/"
+      << uplo << "/" << trans << "/" << diag << "/" << n << "/" << k;
+  return str.str();
+}
+
+template <typename scalar_t>
+void run(benchmark::State& state, blas::SB_Handle* sb_handle_ptr, char uplo,
+         char trans, char diag, index_t n, index_t k, bool* success) {
+  // Standard test setup.
+  index_t lda = k + 1;
+  index_t incX = 1;
+
+  // The counters are double. We convert n and k to double to avoid integer
+  // overflows for n_fl_ops and bytes_processed
+  double n_d = static_cast<double>(n);
+  double k_d = static_cast<double>(k);
+
+  state.counters["n"] = n_d;
+  state.counters["k"] = k_d;
+
+  // Compute the number of A non-zero elements.
+  const double A_validVal = (k_d + 1.0) * n_d - 0.5 * k_d * (k_d + 1.0);
+
+  {
+    double nflops_AtimesX = 2.0 * (A_validVal - n_d);
+    double nflops_divDiag = (diag == 'n') ? n_d : 0;
+    state.counters["n_fl_ops"] = nflops_AtimesX + nflops_divDiag;
+  }
+  {
+    double mem_readA = A_validVal;
+    double mem_readX = n_d;
+    double mem_writeX = n_d;
+    state.counters["bytes_processed"] =
+        (mem_readA + mem_readX + mem_writeX) * sizeof(scalar_t);
+  }
+
+  blas::SB_Handle& sb_handle = *sb_handle_ptr;
+
+  // Input band matrix, right-hand side overwritten with the solution. The
+  // off-diagonals of a row sum to less than the diagonal.
+  std::vector<scalar_t> m_a(lda * n);
+  std::vector<scalar_t> v_x =
+      blas_benchmark::utils::random_data<scalar_t>(n);
+
+  const scalar_t bound = scalar_t{1} / static_cast<scalar_t>(k + 1);
+  for (scalar_t& e : m_a) {
+    e = blas_benchmark::utils::random_scalar<scalar_t>(-bound, bound);
+  }
+  const index_t diag_row = uplo == 'u' ? k : 0;
+  for (index_t j = 0; j < n; ++j) {
+    m_a[diag_row + j * lda] = blas_benchmark::utils::random_scalar<scalar_t>(
+        scalar_t{1}, scalar_t{2});
+  }
+
+  auto m_a_gpu = blas::make_sycl_iterator_buffer<scalar_t>(m_a, lda * n);
+  auto v_x_gpu = blas::make_sycl_iterator_buffer<scalar_t>(v_x, n);
+
+#ifdef BLAS_VERIFY_BENCHMARK
+  // Run a first time with a verification of the results
+  std::vector<scalar_t> v_x_ref = v_x;
+  reference_blas::tbsv(&uplo, &trans, &diag, n, k, m_a.data(), lda,
+                       v_x_ref.data(), incX);
+  std::vector<scalar_t> v_x_temp = v_x;
+  {
+    auto v_x_temp_gpu = blas::make_sycl_iterator_buffer<scalar_t>(v_x_temp, n);
+    auto event = _tbsv(sb_handle, uplo, trans, diag, n, k, m_a_gpu, lda,
+                       v_x_temp_gpu, incX);
+    sb_handle.wait();
+  }
+
+  std::ostringstream err_stream;
+  if (!utils::compare_vectors(v_x_temp, v_x_ref, err_stream, "")) {
+    const std::string& err_str = err_stream.str();
+    state.SkipWithError(err_str.c_str());
+    *success = false;
+  };
+#endif
+
+  auto blas_method_def = [&]() -> std::vector<cl::sycl::event> {
+    auto event = _tbsv(sb_handle, uplo, trans, diag, n, k, m_a_gpu, lda,
+                       v_x_gpu, incX);
+    return event;
+  };
+
+  // Warmup
+  blas_benchmark::utils::warmup(blas_method_def);
+  sb_handle.wait();
+
+  blas_benchmark::utils::init_counters(state);
+
+  // Measure
+  for (auto _ : state) {
+    // Run
+    std::tuple<double, double> times = blas_benchmark::utils::time_submissions(
+        state, sb_handle, blas_method_def);
+
+    // Report
+    blas_benchmark::utils::update_counters(state, times);
+  }
+
+  blas_benchmark::utils::calc_avg_counters(state);
+  blas_benchmark::utils::calc_roofline_counters<scalar_t>(state);
+}
+
+template <typename scalar_t>
+void register_benchmark(blas_benchmark::Args& args,
+                        blas::SB_Handle* sb_handle_ptr, bool* success) {
+  auto tbsv_params = blas_benchmark::utils::get_tbsv_params(args);
+
+  for (auto p : tbsv_params) {
+    char uplo, trans, diag;
+    index_t n, k;
+    std::tie(uplo, trans, diag, n, k) = p;
+
+    auto BM_lambda = [&](benchmark::State& st, blas::SB_Handle* sb_handle_ptr,
+                         char uplo, char trans, char diag, index_t n,
+                         index_t k, bool* success) {
+      run<scalar_t>(st, sb_handle_ptr, uplo, trans, diag, n, k, success);
+    };
+    benchmark::RegisterBenchmark(
+        get_name<scalar_t>(uplo, trans, diag, n, k).c_str(), BM_lambda,
+        sb_handle_ptr, uplo, trans, diag, n, k, success);
+  }
+}
+
+namespace blas_benchmark {
+void create_benchmark(blas_benchmark::Args& args,
+                      blas::SB_Handle* sb_handle_ptr, bool* success) {
+  BLAS_REGISTER_BENCHMARK(args, sb_handle_ptr, success);
+}
+}  // namespace blas_benchmark
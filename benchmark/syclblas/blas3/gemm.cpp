@@ -26,10 +26,15 @@
 #include "../utils.hpp"
 
 template <typename scalar_t>
-std::string get_name(std::string t1, std::string t2, int m, int k, int n) {
+std::string get_name(std::string t1, std::string t2, int m, int k, int n,
+                     std::string config) {
   std::ostringstream str{};
   str << "BM_Gemm<" << blas_benchmark::utils::get_type_name<scalar_t>() << ">/"
       << t1 << "/" << t2 << "/" << m << "/" << k << "/" << n;
+  // Configuration picked by the GEMM performance model, if any
+  if (!config.empty()) {
+    str << "/" << config;
+  }
   return str.str();
 }
 
@@ -85,7 +90,6 @@ void run(benchmark::State& state, blas::SB_Handle* sb_handle_ptr, int t1, int t2
   auto blas_method_def = [&]() -> std::vector<cl::sycl::event> {
     auto event = _gemm(sb_handle, *t_a, *t_b, m, n, k, alpha, a_gpu, lda, b_gpu,
                        ldb, beta, c_gpu, ldc);
-    sb_handle.wait(event);
     return event;
   };
 
@@ -98,8 +102,8 @@ void run(benchmark::State& state, blas::SB_Handle* sb_handle_ptr, int t1, int t2
   // Measure
   for (auto _ : state) {
     // Run
-    std::tuple<double, double> times =
-        blas_benchmark::utils::timef(blas_method_def);
+    std::tuple<double, double> times = blas_benchmark::utils::time_submissions(
+        state, sb_handle, blas_method_def);
 
     // Report
     blas_benchmark::utils::update_counters(state, times);
@@ -134,6 +138,10 @@ void run(benchmark::State& state, blas::SB_Handle* sb_handle_ptr, int t1, int t2
   }
 
   blas_benchmark::utils::calc_avg_counters(state);
+  blas_benchmark::utils::calc_roofline_counters<scalar_t>(state);
+  blas_benchmark::utils::calc_gemm_model_counters(
+      state, sb_handle,
+      blas_benchmark::utils::make_gemm_shape(m, n, k, index_t(1), beta));
 };
 
 template <typename scalar_t>
@@ -148,15 +156,21 @@ void register_benchmark(blas_benchmark::Args& args, blas::SB_Handle* sb_handle_p
     std::tie(t1s, t2s, m, k, n, alpha, beta) = p;
     int t1 = static_cast<int>(blas_benchmark::utils::to_transpose_enum(t1s));
     int t2 = static_cast<int>(blas_benchmark::utils::to_transpose_enum(t2s));
+    const auto shape =
+        blas_benchmark::utils::make_gemm_shape(m, n, k, index_t(1), beta);
+    blas_benchmark::utils::get_gemm_model_shapes().push_back(shape);
 
     auto BM_lambda = [&](benchmark::State& st, blas::SB_Handle* sb_handle_ptr, int t1,
                          int t2, index_t m, index_t k, index_t n,
                          scalar_t alpha, scalar_t beta, bool* success) {
       run<scalar_t>(st, sb_handle_ptr, t1, t2, m, k, n, alpha, beta, success);
     };
-    benchmark::RegisterBenchmark(get_name<scalar_t>(t1s, t2s, m, k, n).c_str(),
-                                 BM_lambda, sb_handle_ptr, t1, t2, m, k, n, alpha, beta,
-                                 success)
+    benchmark::RegisterBenchmark(
+        get_name<scalar_t>(
+            t1s, t2s, m, k, n,
+            blas_benchmark::utils::get_gemm_config_name(*sb_handle_ptr, shape))
+            .c_str(),
+        BM_lambda, sb_handle_ptr, t1, t2, m, k, n, alpha, beta, success)
         ->UseRealTime();
   }
 }
@@ -61,12 +61,16 @@ std::vector<scalar_t> interleaved_to_strided(const std::vector<scalar_t>& input,
 
 template <typename scalar_t>
 std::string get_name(std::string t1, std::string t2, int m, int k, int n,
-                     int batch_size, int batch_type) {
+                     int batch_size, int batch_type, std::string config) {
   std::ostringstream str{};
   str << "BM_GemmBatched<" << blas_benchmark::utils::get_type_name<scalar_t>()
       << ">/" << t1 << "/" << t2 << "/" << m << "/" << k << "/" << n << "/"
       << batch_size << "/"
       << blas_benchmark::utils::batch_type_to_str(batch_type);
+  // Configuration picked by the GEMM performance model, if any
+  if (!config.empty()) {
+    str << "/" << config;
+  }
   return str.str();
 }
 
@@ -180,7 +184,6 @@ void run(benchmark::State& state, blas::SB_Handle* sb_handle_ptr, int t1, int t2
     auto event =
         _gemm_batched(sb_handle, *t_a, *t_b, m, n, k, alpha, a_gpu, lda, b_gpu,
                       ldb, beta, c_gpu, ldc, batch_size, batch_type);
-    sb_handle.wait(event);
     return event;
   };
 
@@ -193,14 +196,21 @@ void run(benchmark::State& state, blas::SB_Handle* sb_handle_ptr, int t1, int t2
   // Measure
   for (auto _ : state) {
     // Run
-    std::tuple<double, double> times =
-        blas_benchmark::utils::timef(blas_method_def);
+    std::tuple<double, double> times = blas_benchmark::utils::time_submissions(
+        state, sb_handle, blas_method_def);
 
     // Report
     blas_benchmark::utils::update_counters(state, times);
   }
 
   blas_benchmark::utils::calc_avg_counters(state);
+  blas_benchmark::utils::calc_roofline_counters<scalar_t>(state);
+  // The performance model only covers strided batches
+  if (batch_type == blas::gemm_batch_type_t::strided) {
+    blas_benchmark::utils::calc_gemm_model_counters(
+        state, sb_handle,
+        blas_benchmark::utils::make_gemm_shape(m, n, k, batch_size, beta));
+  }
 };
 
 template <typename scalar_t>
@@ -217,6 +227,14 @@ void register_benchmark(blas_benchmark::Args& args, blas::SB_Handle* sb_handle_p
     std::tie(t1s, t2s, m, k, n, alpha, beta, batch_size, batch_type) = p;
     int t1 = static_cast<int>(blas_benchmark::utils::to_transpose_enum(t1s));
     int t2 = static_cast<int>(blas_benchmark::utils::to_transpose_enum(t2s));
+    std::string config;
+    if (batch_type == static_cast<int>(blas::gemm_batch_type_t::strided)) {
+      const auto shape =
+          blas_benchmark::utils::make_gemm_shape(m, n, k, batch_size, beta);
+      blas_benchmark::utils::get_gemm_model_shapes().push_back(shape);
+      config =
+          blas_benchmark::utils::get_gemm_config_name(*sb_handle_ptr, shape);
+    }
 
     auto BM_lambda = [&](benchmark::State& st, blas::SB_Handle* sb_handle_ptr, int t1,
                          int t2, index_t m, index_t k, index_t n,
@@ -226,7 +244,8 @@ void register_benchmark(blas_benchmark::Args& args, blas::SB_Handle* sb_handle_p
                     batch_type, success);
     };
     benchmark::RegisterBenchmark(
-        get_name<scalar_t>(t1s, t2s, m, k, n, batch_size, batch_type).c_str(),
+        get_name<scalar_t>(t1s, t2s, m, k, n, batch_size, batch_type, config)
+            .c_str(),
         BM_lambda, sb_handle_ptr, t1, t2, m, k, n, alpha, beta, batch_size, batch_type,
         success);
   }
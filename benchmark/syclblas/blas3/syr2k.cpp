@@ -0,0 +1,171 @@
+/**************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename syr2k.cpp
+ *
+ **************************************************************************/
+
+#include "../utils.hpp"
+
+template <typename scalar_t>
+std::string get_name(char uplo, char trans, index_t n, index_t k) {
+  std::ostringstream str{};
+  str << "BM_Syr2k<" << blas_benchmark::utils::get_type_name<scalar_t>() << ">/"
+      << uplo << "/" << trans << "/" << n << "/" << k;
+  return str.str();
+}
+
+template <typename scalar_t>
+void run(benchmark::State& state, blas::SB_Handle* sb_handle_ptr, char uplo,
+         char trans, index_t n, index_t k, scalar_t alpha, scalar_t beta,
+         bool* success) {
+  // Standard test setup.
+  const bool is_transposed = trans != 'n';
+  index_t lda = is_transposed ? k : n;
+  index_t ldb = lda;
+  index_t ldc = n;
+
+  blas::SB_Handle& sb_handle = *sb_handle_ptr;
+
+  const int sizeA = (is_transposed ? n : k) * lda;
+  const int sizeB = sizeA;
+  const int sizeC = n * ldc;
+
+  // Matrices
+  std::vector<scalar_t> a = blas_benchmark::utils::random_data<scalar_t>(sizeA);
+  std::vector<scalar_t> b = blas_benchmark::utils::random_data<scalar_t>(sizeB);
+  std::vector<scalar_t> c =
+      blas_benchmark::utils::const_data<scalar_t>(sizeC, 0);
+
+  auto a_gpu = blas::make_sycl_iterator_buffer<scalar_t>(a, sizeA);
+  auto b_gpu = blas::make_sycl_iterator_buffer<scalar_t>(b, sizeB);
+  auto c_gpu = blas::make_sycl_iterator_buffer<scalar_t>(c, sizeC);
+
+  a_gpu.get_buffer().set_final_data(nullptr);
+  b_gpu.get_buffer().set_final_data(nullptr);
+  c_gpu.get_buffer().set_final_data(nullptr);
+
+#ifdef BLAS_VERIFY_BENCHMARK
+  // Run once verifying the results against the reference blas implementation.
+  std::vector<scalar_t> c_ref = c;
+  std::vector<scalar_t> c_temp = c;
+
+  reference_blas::syr2k(&uplo, &trans, n, k, alpha, a.data(), lda, b.data(),
+                        ldb, beta, c_ref.data(), ldc);
+
+  {
+    auto c_temp_gpu = blas::make_sycl_iterator_buffer<scalar_t>(c_temp, sizeC);
+    _syr2k(sb_handle, uplo, trans, n, k, alpha, a_gpu, lda, b_gpu, ldb, beta,
+           c_temp_gpu, ldc);
+    auto event = blas::helper::copy_to_host(sb_handle.get_queue(), c_temp_gpu,
+                                            c_temp.data(), sizeC);
+    sb_handle.wait(event);
+  }
+
+  std::ostringstream err_stream;
+  if (!utils::compare_vectors(c_temp, c_ref, err_stream, "")) {
+    const std::string& err_str = err_stream.str();
+    state.SkipWithError(err_str.c_str());
+    *success = false;
+  };
+#endif
+
+  auto blas_method_def = [&]() -> std::vector<cl::sycl::event> {
+    auto event = _syr2k(sb_handle, uplo, trans, n, k, alpha, a_gpu, lda, b_gpu,
+                        ldb, beta, c_gpu, ldc);
+    return event;
+  };
+
+  // Warmup
+  blas_benchmark::utils::warmup(blas_method_def);
+  sb_handle.wait();
+
+  blas_benchmark::utils::init_counters(state);
+
+  // Measure
+  for (auto _ : state) {
+    // Run
+    std::tuple<double, double> times = blas_benchmark::utils::time_submissions(
+        state, sb_handle, blas_method_def);
+
+    // Report
+    blas_benchmark::utils::update_counters(state, times);
+  }
+
+  {
+    // The counters are double. We convert n and k to double to avoid integer
+    // overflows for n_fl_ops and bytes_processed
+    double n_d = static_cast<double>(n);
+    double k_d = static_cast<double>(k);
+
+    state.counters["n"] = n_d;
+    state.counters["k"] = k_d;
+
+    // Only the triangle of C is read and written
+    double triangle = n_d * (n_d + 1) / 2;
+    double mem_read = 2 * n_d * k_d + (beta != scalar_t{0} ? triangle : 0);
+    double mem_write = triangle;
+
+    double total_mem = (mem_read + mem_write) * sizeof(scalar_t);
+    state.counters["bytes_processed"] = total_mem;
+    state.SetBytesProcessed(state.iterations() * total_mem);
+
+    double nflops_AtimesB = 2 * n_d * (n_d + 1) * k_d;
+    double nflops_addBetaC = beta != scalar_t{0} ? 2 * triangle : 0;
+    double nflops = nflops_AtimesB + nflops_addBetaC;
+    state.counters["n_fl_ops"] = nflops;
+    state.SetItemsProcessed(state.iterations() * nflops);
+  }
+
+  blas_benchmark::utils::calc_avg_counters(state);
+  blas_benchmark::utils::calc_roofline_counters<scalar_t>(state);
+};
+
+template <typename scalar_t>
+void register_benchmark(blas_benchmark::Args& args,
+                        blas::SB_Handle* sb_handle_ptr, bool* success) {
+  auto syr2k_params = blas_benchmark::utils::get_syrk_params<scalar_t>(args);
+
+  for (auto p : syr2k_params) {
+    char uplo, trans;
+    index_t n, k;
+    scalar_t alpha, beta;
+    std::tie(uplo, trans, n, k, alpha, beta) = p;
+
+    auto BM_lambda = [&](benchmark::State& st, blas::SB_Handle* sb_handle_ptr,
+                         char uplo, char trans, index_t n, index_t k,
+                         scalar_t alpha, scalar_t beta, bool* success) {
+      run<scalar_t>(st, sb_handle_ptr, uplo, trans, n, k, alpha, beta,
+                    success);
+    };
+    benchmark::RegisterBenchmark(
+        get_name<scalar_t>(uplo, trans, n, k).c_str(), BM_lambda,
+        sb_handle_ptr, uplo, trans, n, k, alpha, beta, success)
+        ->UseRealTime();
+  }
+}
+
+namespace blas_benchmark {
+void create_benchmark(blas_benchmark::Args& args,
+                      blas::SB_Handle* sb_handle_ptr, bool* success) {
+  BLAS_REGISTER_BENCHMARK(args, sb_handle_ptr, success);
+}
+}  // namespace blas_benchmark
@@ -0,0 +1,191 @@
+/**************************************************************************
+ *
+ *  @license
+ *  Copyright (C) 2021 Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename trsm_batched.cpp
+ *
+ **************************************************************************/
+
+#include "../utils.hpp"
+
+template <typename scalar_t>
+std::string get_name(char side, char uplo, char trans, char diag, index_t m,
+                     index_t n, index_t batch_size) {
+  std::ostringstream str{};
+  str << "BM_TrsmBatched<" << blas_benchmark::utils::get_type_name<scalar_t>()
+      << ">/" << side << "/" << uplo << "/" << trans << "/" << diag << "/" << m
+      << "/" << n << "/" << batch_size;
+  return str.str();
+}
+
+template <typename scalar_t>
+void run(benchmark::State& state, blas::SB_Handle* sb_handle_ptr, char side,
+         char uplo, char trans, char diag, index_t m, index_t n, scalar_t alpha,
+         index_t batch_size, bool* success) {
+  // Standard test setup.
+  index_t lda = side == 'l' ? m : n;
+  index_t ldb = m;
+  index_t k = side == 'l' ? m : n;
+
+  blas::SB_Handle& sb_handle = *sb_handle_ptr;
+
+  const index_t stride_a = k * lda;
+  const index_t stride_b = n * ldb;
+  const int sizeA = stride_a * batch_size;
+  const int sizeB = stride_b * batch_size;
+
+  // Matrices
+  std::vector<scalar_t> a(sizeA);
+  std::vector<scalar_t> b = blas_benchmark::utils::random_data<scalar_t>(sizeB);
+
+  for (index_t batch = 0; batch < batch_size; ++batch) {
+    std::vector<scalar_t> a_batch(stride_a);
+    const scalar_t diagValue =
+        diag == 'u' ? scalar_t{1}
+                    : blas_benchmark::utils::random_scalar<scalar_t>(
+                          scalar_t{1}, scalar_t{10});
+    blas_benchmark::utils::fill_trsm_matrix(a_batch, k, lda, uplo, diagValue,
+                                            scalar_t{0});
+    std::copy(a_batch.begin(), a_batch.end(), a.begin() + batch * stride_a);
+  }
+
+  auto a_gpu = blas::make_sycl_iterator_buffer<scalar_t>(a, sizeA);
+  auto b_gpu = blas::make_sycl_iterator_buffer<scalar_t>(b, sizeB);
+
+  a_gpu.get_buffer().set_final_data(nullptr);
+  b_gpu.get_buffer().set_final_data(nullptr);
+
+#ifdef BLAS_VERIFY_BENCHMARK
+  // Run once verifying the results against the reference blas implementation.
+  std::vector<scalar_t> x_ref = b;
+  std::vector<scalar_t> b_temp = b;
+
+  for (index_t batch = 0; batch < batch_size; ++batch) {
+    reference_blas::trsm(&side, &uplo, &trans, &diag, m, n,
+                         static_cast<scalar_t>(alpha),
+                         a.data() + batch * stride_a, lda,
+                         x_ref.data() + batch * stride_b, ldb);
+  }
+
+  {
+    auto b_temp_gpu = blas::make_sycl_iterator_buffer<scalar_t>(b_temp, sizeB);
+    _trsm_batched(sb_handle, side, uplo, trans, diag, m, n, alpha, a_gpu, lda,
+                  stride_a, b_temp_gpu, ldb, stride_b, batch_size);
+    auto event = blas::helper::copy_to_host(sb_handle.get_queue(), b_temp_gpu,
+                                            b_temp.data(), sizeB);
+    sb_handle.wait(event);
+  }
+
+  std::ostringstream err_stream;
+  if (!utils::compare_vectors(b_temp, x_ref, err_stream, "")) {
+    const std::string& err_str = err_stream.str();
+    state.SkipWithError(err_str.c_str());
+    *success = false;
+  };
+#endif
+
+  auto blas_method_def = [&]() -> std::vector<cl::sycl::event> {
+    auto event =
+        _trsm_batched(sb_handle, side, uplo, trans, diag, m, n, alpha, a_gpu,
+                      lda, stride_a, b_gpu, ldb, stride_b, batch_size);
+    return event;
+  };
+
+  // Warmup
+  blas_benchmark::utils::warmup(blas_method_def);
+  sb_handle.wait();
+
+  blas_benchmark::utils::init_counters(state);
+
+  // Measure
+  for (auto _ : state) {
+    // Run
+    std::tuple<double, double> times = blas_benchmark::utils::time_submissions(
+        state, sb_handle, blas_method_def);
+
+    // Report
+    blas_benchmark::utils::update_counters(state, times);
+  }
+
+  {
+    // The counters are double. We convert m, n, k and the batch size to
+    // double to avoid integer overflows for n_fl_ops and bytes_processed
+    double m_d = static_cast<double>(m);
+    double n_d = static_cast<double>(n);
+    double k_d = static_cast<double>(k);
+    double batch_size_d = static_cast<double>(batch_size);
+
+    state.counters["m"] = m_d;
+    state.counters["k"] = k_d;
+    state.counters["n"] = n_d;
+    state.counters["batch_size"] = batch_size_d;
+
+    double mem_read = k_d * (k_d + 1) / 2 + m_d * n_d;
+    double mem_write = m_d * n_d;
+
+    double total_mem =
+        (mem_read + mem_write) * batch_size_d * sizeof(scalar_t);
+    state.counters["bytes_processed"] = total_mem;
+    state.SetBytesProcessed(state.iterations() * total_mem);
+
+    double nflops_AtimesB = 2 * k_d * (k_d + 1) / 2 * (side == 'l' ? n_d : m_d);
+    double nflops_timesAlpha = m_d * n_d;
+    double nflops = (nflops_AtimesB + nflops_timesAlpha) * batch_size_d;
+    state.counters["n_fl_ops"] = nflops;
+    state.SetItemsProcessed(state.iterations() * nflops);
+  }
+
+  blas_benchmark::utils::calc_avg_counters(state);
+  blas_benchmark::utils::calc_roofline_counters<scalar_t>(state);
+};
+
+template <typename scalar_t>
+void register_benchmark(blas_benchmark::Args& args,
+                        blas::SB_Handle* sb_handle_ptr, bool* success) {
+  auto trsm_batched_params =
+      blas_benchmark::utils::get_trsm_batched_params<scalar_t>(args);
+
+  for (auto p : trsm_batched_params) {
+    char side, uplo, trans, diag;
+    index_t m, n, batch_size;
+    scalar_t alpha;
+    std::tie(side, uplo, trans, diag, m, n, alpha, batch_size) = p;
+
+    auto BM_lambda = [&](benchmark::State& st, blas::SB_Handle* sb_handle_ptr,
+                         char side, char uplo, char trans, char diag, index_t m,
+                         index_t n, scalar_t alpha, index_t batch_size,
+                         bool* success) {
+      run<scalar_t>(st, sb_handle_ptr, side, uplo, trans, diag, m, n, alpha,
+                    batch_size, success);
+    };
+    benchmark::RegisterBenchmark(
+        get_name<scalar_t>(side, uplo, trans, diag, m, n, batch_size).c_str(),
+        BM_lambda, sb_handle_ptr, side, uplo, trans, diag, m, n, alpha,
+        batch_size, success)
+        ->UseRealTime();
+  }
+}
+
+namespace blas_benchmark {
+void create_benchmark(blas_benchmark::Args& args,
+                      blas::SB_Handle* sb_handle_ptr, bool* success) {
+  BLAS_REGISTER_BENCHMARK(args, sb_handle_ptr, success);
+}
+}  // namespace blas_benchmark
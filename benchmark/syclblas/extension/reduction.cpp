@@ -105,7 +105,6 @@ void run(benchmark::State& state, blas::SB_Handle* sb_handle_ptr, index_t rows,
   auto blas_method_def = [&]() -> std::vector<cl::sycl::event> {
     auto event = extension::_reduction<AddOperator, scalar_t>(
         sb_handle, mat_buffer, rows, vec_buffer, rows, cols, dim);
-    sb_handle.wait(event);
     return event;
   };
 
@@ -118,14 +117,15 @@ void run(benchmark::State& state, blas::SB_Handle* sb_handle_ptr, index_t rows,
   // Measure
   for (auto _ : state) {
     // Run
-    std::tuple<double, double> times =
-        blas_benchmark::utils::timef(blas_method_def);
+    std::tuple<double, double> times = blas_benchmark::utils::time_submissions(
+        state, sb_handle, blas_method_def);
 
     // Report
     blas_benchmark::utils::update_counters(state, times);
   }
 
   blas_benchmark::utils::calc_avg_counters(state);
+  blas_benchmark::utils::calc_roofline_counters<scalar_t>(state);
 };
 
 template <typename scalar_t>
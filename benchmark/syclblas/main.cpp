@@ -2,6 +2,9 @@
 #include <common/cli_device_selector.hpp>
 #include <common/print_queue_information.hpp>
 
+#include <algorithm>
+#include <limits>
+
 // Create a shared pointer to a sycl blas Handle, so that we don't keep
 // reconstructing it each time (which is slow). Although this won't be
 // cleaned up if RunSpecifiedBenchmarks exits badly, that's okay, as those
@@ -9,9 +12,139 @@
 std::unique_ptr<utils::cli_device_selector> cdsp;
 void free_device_selector() { cdsp.reset(); }
 
+class RooflineCopyKernel;
+template <typename scalar_t>
+class RooflineFmaKernel;
+
+// Best time in nanoseconds of the kernel submitted by submit, over a few runs
+template <typename submit_t>
+double best_kernel_time(submit_t submit) {
+  double best_time = std::numeric_limits<double>::max();
+  for (int i = 0; i < 5; ++i) {
+    auto event = submit();
+    event.wait();
+    best_time =
+        std::min(best_time, blas_benchmark::utils::time_event(event));
+  }
+  return best_time;
+}
+
+// Achievable bandwidth in GB/s, from a copy between two buffers larger than
+// the caches
+double measure_bandwidth(cl::sycl::queue& q) {
+  const size_t max_size =
+      q.get_device()
+          .template get_info<cl::sycl::info::device::max_mem_alloc_size>() /
+      sizeof(float);
+  const size_t size = std::min(max_size, size_t(1) << 25);
+  cl::sycl::buffer<float, 1> in{cl::sycl::range<1>(size)};
+  cl::sycl::buffer<float, 1> out{cl::sycl::range<1>(size)};
+  auto submit = [&]() {
+    return q.submit([&](cl::sycl::handler& cgh) {
+      auto in_acc = in.get_access<cl::sycl::access::mode::read>(cgh);
+      auto out_acc =
+          out.get_access<cl::sycl::access::mode::discard_write>(cgh);
+      cgh.parallel_for<RooflineCopyKernel>(
+          cl::sycl::range<1>(size),
+          [=](cl::sycl::id<1> id) { out_acc[id] = in_acc[id]; });
+    });
+  };
+  return 2.0 * size * sizeof(float) / best_kernel_time(submit);
+}
+
+// Achievable FLOP rate in GFLOP/s, from independent chains of multiply-adds
+// kept in registers
+template <typename scalar_t>
+double measure_flop_rate(cl::sycl::queue& q) {
+  constexpr int num_chains = 8;
+  constexpr int num_steps = 512;
+  auto device = q.get_device();
+  const size_t local_size = std::min(
+      size_t(256),
+      device.template get_info<cl::sycl::info::device::max_work_group_size>());
+  const size_t global_size =
+      local_size * 16 *
+      device.template get_info<cl::sycl::info::device::max_compute_units>();
+  cl::sycl::buffer<scalar_t, 1> out{cl::sycl::range<1>(global_size)};
+  auto submit = [&]() {
+    return q.submit([&](cl::sycl::handler& cgh) {
+      auto out_acc =
+          out.template get_access<cl::sycl::access::mode::discard_write>(cgh);
+      cgh.parallel_for<RooflineFmaKernel<scalar_t>>(
+          cl::sycl::nd_range<1>(global_size, local_size),
+          [=](cl::sycl::nd_item<1> id) {
+            const scalar_t a = scalar_t(0.999);
+            const scalar_t b = scalar_t(0.001);
+            scalar_t acc[num_chains];
+            for (int c = 0; c < num_chains; ++c) {
+              acc[c] = static_cast<scalar_t>(id.get_global_id(0) + c);
+            }
+            for (int step = 0; step < num_steps; ++step) {
+              for (int c = 0; c < num_chains; ++c) {
+                acc[c] = cl::sycl::fma(acc[c], a, b);
+              }
+            }
+            scalar_t sum = scalar_t(0);
+            for (int c = 0; c < num_chains; ++c) {
+              sum += acc[c];
+            }
+            out_acc[id.get_global_id(0)] = sum;
+          });
+    });
+  };
+  return 2.0 * num_chains * num_steps * global_size / best_kernel_time(submit);
+}
+
+// Takes the peaks of the device from the command line, measuring the missing
+// ones
+void set_device_peaks(const blas_benchmark::Args& args, cl::sycl::queue& q) {
+  auto& peaks = blas_benchmark::utils::get_device_peaks();
+  peaks.bandwidth =
+      args.peak_bandwidth > 0 ? args.peak_bandwidth : measure_bandwidth(q);
+  peaks.flop_rate =
+      args.peak_gflops > 0 ? args.peak_gflops : measure_flop_rate<float>(q);
+#ifdef BLAS_DATA_TYPE_DOUBLE
+  peaks.flop_rate_double = args.peak_gflops_fp64 > 0
+                               ? args.peak_gflops_fp64
+                               : measure_flop_rate<double>(q);
+#else
+  peaks.flop_rate_double = args.peak_gflops_fp64;
+#endif
+  std::cerr << "Peak bandwidth: " << peaks.bandwidth << " GB/s\n"
+            << "Peak FLOP rate: " << peaks.flop_rate << " GFLOP/s (fp32), "
+            << peaks.flop_rate_double << " GFLOP/s (fp64)" << std::endl;
+}
+
+// Performance model of the GEMM configurations, created when the command
+// line uses it
+std::unique_ptr<blas::GemmModel> gemm_model;
+
+void set_gemm_model(const blas_benchmark::Args& args,
+                    blas::SB_Handle& sb_handle) {
+  if (args.gemm_model.empty() && args.gemm_config < 0 &&
+      args.gemm_model_predictions.empty()) {
+    return;
+  }
+  const auto& peaks = blas_benchmark::utils::get_device_peaks();
+  gemm_model.reset(new blas::GemmModel(sb_handle.get_num_compute_units(),
+                                       sb_handle.get_work_group_size(),
+                                       peaks.flop_rate, peaks.bandwidth));
+  if (!args.gemm_model.empty()) {
+    std::ifstream file(args.gemm_model);
+    if (!file) {
+      std::cerr << "Cannot open " << args.gemm_model << std::endl;
+      exit(1);
+    }
+    gemm_model->read(file);
+  }
+  gemm_model->set_forced_config(args.gemm_config);
+  sb_handle.set_gemm_model(gemm_model.get());
+}
+
 int main(int argc, char** argv) {
   // Read the command-line arguments
   auto args = blas_benchmark::utils::parse_args(argc, argv);
+  blas_benchmark::utils::get_benchmark_args() = args;
 
   // Initialize googlebench
   benchmark::Initialize(&argc, argv);
@@ -41,17 +174,33 @@ int main(int argc, char** argv) {
 
   utils::print_queue_information(q);
 
+  set_device_peaks(args, q);
+
   // Create a sycl blas sb_handle from the queue
   blas::SB_Handle sb_handle(q);
 
+  set_gemm_model(args, sb_handle);
+
   // This will be set to false by a failing benchmark
   bool success = true;
 
   // Create the benchmarks
   blas_benchmark::create_benchmark(args, &sb_handle, &success);
 
+  if (!args.gemm_model_predictions.empty()) {
+    std::ofstream file(args.gemm_model_predictions);
+    gemm_model->write_predictions(
+        file, sb_handle.get_tuning_target(),
+        blas_benchmark::utils::get_gemm_model_shapes());
+  }
+
   // Run the benchmarks
-  benchmark::RunSpecifiedBenchmarks();
+  if (args.roofline_file.empty()) {
+    benchmark::RunSpecifiedBenchmarks();
+  } else {
+    blas_benchmark::utils::RooflineReporter reporter(args.roofline_file);
+    benchmark::RunSpecifiedBenchmarks(&reporter);
+  }
 
   return !success;
 }
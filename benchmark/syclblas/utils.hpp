@@ -2,7 +2,10 @@
 #define SYCL_UTILS_HPP
 
 #include <CL/sycl.hpp>
+#include <algorithm>
 #include <chrono>
+#include <fstream>
+#include <memory>
 #include <tuple>
 
 #include "sycl_blas.h"
@@ -36,6 +39,221 @@ inline double time_event<cl::sycl::event>(cl::sycl::event& e) {
   return static_cast<double>(end_time - start_time);
 }
 
+/**
+ * @fn get_benchmark_args
+ * @brief Command-line arguments of the benchmark, set once by main and read by
+ * time_submissions to select the latency or throughput mode.
+ */
+inline Args& get_benchmark_args() {
+  static Args args;
+  return args;
+}
+
+/**
+ * @fn time_submissions
+ * @brief Submits the calls of func and waits for them, returning the overall
+ * and event times per call in nanoseconds. In the latency mode each
+ * measurement is a single call. In the throughput mode it is num_calls calls
+ * submitted back to back before a single wait, so that the device is kept
+ * busy as in a serving loop. In both modes the host time spent in func before
+ * the wait is recorded as the enqueue time.
+ */
+template <typename function_t>
+inline std::tuple<double, double> time_submissions(
+    benchmark::State& state, blas::SB_Handle& sb_handle, function_t func) {
+  const Args& args = get_benchmark_args();
+  const int num_calls = (args.mode == "throughput") ? args.num_calls : 1;
+
+  std::vector<cl::sycl::event> events;
+  auto start = std::chrono::system_clock::now();
+  for (int i = 0; i < num_calls; ++i) {
+    events = blas::concatenate_vectors(events, func());
+  }
+  auto submitted = std::chrono::system_clock::now();
+  sb_handle.wait(events);
+  auto end = std::chrono::system_clock::now();
+
+  double enqueue_time = (submitted - start).count() / double(num_calls);
+  double overall_time = (end - start).count() / double(num_calls);
+  double event_time = time_events(events) / double(num_calls);
+
+  state.PauseTiming();
+  state.counters["num_calls"] = num_calls;
+  state.counters["total_enqueue_time"] += enqueue_time;
+  state.ResumeTiming();
+
+  return std::make_tuple(overall_time, event_time);
+}
+
+/**
+ * @brief Peak memory bandwidth (GB/s) and FLOP rates (GFLOP/s) of the device,
+ * set once by main from the command-line arguments or micro-kernels.
+ */
+struct DevicePeaks {
+  double bandwidth;
+  double flop_rate;
+  double flop_rate_double;
+};
+
+inline DevicePeaks& get_device_peaks() {
+  static DevicePeaks peaks{0, 0, 0};
+  return peaks;
+}
+
+template <typename scalar_t>
+inline double get_peak_flop_rate() {
+  return get_device_peaks().flop_rate;
+}
+
+template <>
+inline double get_peak_flop_rate<double>() {
+  return get_device_peaks().flop_rate_double;
+}
+
+/**
+ * @fn calc_roofline_counters
+ * @brief Relates the n_fl_ops and bytes_processed counters to the peaks of the
+ * device. The roofline time of a call is the larger of its compute and memory
+ * times at the peak rates, and percent_of_roofline is that time over the
+ * average event time.
+ */
+template <typename scalar_t>
+inline void calc_roofline_counters(benchmark::State& state) {
+  const double peak_bandwidth = get_device_peaks().bandwidth;
+  const double peak_flop_rate = get_peak_flop_rate<scalar_t>();
+  auto& counters = state.counters;
+  if (peak_bandwidth <= 0 || peak_flop_rate <= 0 ||
+      counters.find("n_fl_ops") == counters.end() ||
+      counters.find("bytes_processed") == counters.end()) {
+    return;
+  }
+  const double flops = counters["n_fl_ops"];
+  const double bytes = counters["bytes_processed"];
+  const double time = counters["avg_event_time"];
+  if (bytes <= 0 || time <= 0) {
+    return;
+  }
+  // Bytes and flops per nanosecond are GB/s and GFLOP/s
+  const double roofline_time =
+      std::max(flops / peak_flop_rate, bytes / peak_bandwidth);
+  counters["arithmetic_intensity"] = flops / bytes;
+  counters["achieved_gflops"] = flops / time;
+  counters["achieved_bandwidth"] = bytes / time;
+  counters["percent_of_roofline"] = 100.0 * roofline_time / time;
+}
+
+/**
+ * @fn make_gemm_shape
+ * @brief Shape of a GEMM as seen by blas::GemmModel.
+ */
+template <typename scalar_t>
+inline blas::GemmShape make_gemm_shape(index_t m, index_t n, index_t k,
+                                       index_t batch, scalar_t beta) {
+  return {static_cast<std::int64_t>(m), static_cast<std::int64_t>(n),
+          static_cast<std::int64_t>(k), static_cast<std::int64_t>(batch),
+          sizeof(scalar_t), beta == scalar_t{0}};
+}
+
+/**
+ * @fn get_gemm_model_shapes
+ * @brief Shapes of the registered GEMM benchmarks, whose predictions main
+ * writes when --gemm-model-predictions is given.
+ */
+inline std::vector<blas::GemmShape>& get_gemm_model_shapes() {
+  static std::vector<blas::GemmShape> shapes;
+  return shapes;
+}
+
+/**
+ * @fn get_gemm_config_name
+ * @brief Name of the configuration the GEMM model of the handle picks for
+ * the shape, empty without a model or for a target it does not cover.
+ */
+inline std::string get_gemm_config_name(blas::SB_Handle& sb_handle,
+                                        const blas::GemmShape& shape) {
+  const blas::GemmModel* model = sb_handle.get_gemm_model();
+  const auto configs = blas::get_gemm_model_configs(
+      sb_handle.get_tuning_target(), shape.element_size);
+  if (model == nullptr || configs.empty()) {
+    return "";
+  }
+  return configs[model->select(configs, shape)].name;
+}
+
+/**
+ * @fn calc_gemm_model_counters
+ * @brief Adds the configuration the GEMM model of the handle picks, its
+ * analytic terms and its predicted time, from which benchmark/gemm_model.py
+ * fits the coefficients of each configuration.
+ */
+inline void calc_gemm_model_counters(benchmark::State& state,
+                                     blas::SB_Handle& sb_handle,
+                                     const blas::GemmShape& shape) {
+  const blas::GemmModel* model = sb_handle.get_gemm_model();
+  const auto configs = blas::get_gemm_model_configs(
+      sb_handle.get_tuning_target(), shape.element_size);
+  if (model == nullptr || configs.empty()) {
+    return;
+  }
+  const int config = model->select(configs, shape);
+  const blas::GemmTerms terms = model->get_terms(configs[config], shape);
+  state.counters["gemm_config"] = config;
+  state.counters["model_waves"] = terms.waves;
+  state.counters["model_compute_term"] = terms.compute;
+  state.counters["model_memory_term"] = terms.memory;
+  state.counters["predicted_time"] = model->predict(configs[config], shape);
+}
+
+/**
+ * @brief Display reporter forwarding the runs to the one selected by
+ * --benchmark_format, and writing the roofline counters of each run to a CSV
+ * file. The peaks of the device are written first as comments.
+ */
+class RooflineReporter : public benchmark::BenchmarkReporter {
+ public:
+  explicit RooflineReporter(const std::string& file_name)
+      : reporter_(benchmark::CreateDefaultDisplayReporter()),
+        file_(file_name) {
+    const DevicePeaks& peaks = get_device_peaks();
+    file_ << "# peak_bandwidth," << peaks.bandwidth << "\n"
+          << "# peak_gflops," << peaks.flop_rate << "\n"
+          << "# peak_gflops_fp64," << peaks.flop_rate_double << "\n"
+          << "name,arithmetic_intensity,achieved_gflops,roofline_gflops,"
+             "percent_of_roofline\n";
+  }
+
+  bool ReportContext(const Context& context) override {
+    return reporter_->ReportContext(context);
+  }
+
+  void ReportRuns(const std::vector<Run>& runs) override {
+    reporter_->ReportRuns(runs);
+    for (const Run& run : runs) {
+      auto intensity = run.counters.find("arithmetic_intensity");
+      auto gflops = run.counters.find("achieved_gflops");
+      auto percent = run.counters.find("percent_of_roofline");
+      if (run.error_occurred || run.run_type != Run::RT_Iteration ||
+          intensity == run.counters.end() || gflops == run.counters.end() ||
+          percent == run.counters.end() || percent->second.value <= 0) {
+        continue;
+      }
+      file_ << run.benchmark_name() << "," << intensity->second.value << ","
+            << gflops->second.value << ","
+            << 100.0 * gflops->second.value / percent->second.value << ","
+            << percent->second.value << "\n";
+    }
+  }
+
+  void Finalize() override {
+    reporter_->Finalize();
+    file_.flush();
+  }
+
+ private:
+  std::unique_ptr<benchmark::BenchmarkReporter> reporter_;
+  std::ofstream file_;
+};
+
 }  // namespace utils
 }  // namespace blas_benchmark
 
@@ -0,0 +1,246 @@
+/**************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename trace_replay.cpp
+ *
+ **************************************************************************/
+
+#include "../utils.hpp"
+
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <stdexcept>
+
+template <typename scalar_t>
+std::string get_name(const std::string& trace_file) {
+  std::ostringstream str{};
+  str << "BM_TraceReplay<" << blas_benchmark::utils::get_type_name<scalar_t>()
+      << ">/" << trace_file.substr(trace_file.find_last_of("/\\") + 1);
+  return str.str();
+}
+
+template <typename scalar_t>
+using buffers_t = std::vector<blas::BufferIterator<scalar_t>>;
+
+// Throws if the call does not have the arguments the replay expects
+void check_call(const blas::TraceCall& call, size_t num_options,
+                size_t num_sizes, size_t num_scalars, size_t num_operands) {
+  if (call.options.size() != num_options || call.sizes.size() != num_sizes ||
+      call.scalars.size() != num_scalars ||
+      call.operands.size() != num_operands) {
+    throw std::runtime_error("Wrong number of arguments for " + call.routine);
+  }
+}
+
+// Name of the counter the time of the call is added to: the routine, its
+// options and its dimensions, so that the calls of the same shape are summed
+std::string get_signature(const blas::TraceCall& call) {
+  std::ostringstream str{};
+  str << call.routine << "_" << call.options << "_" << call.sizes[0] << "x"
+      << call.sizes[1];
+  if (call.routine == "gemm" || call.routine == "gemm_batched") {
+    str << "x" << call.sizes[2];
+  }
+  if (call.routine == "gemm_batched") {
+    str << "x" << call.sizes[6];
+  }
+  return str.str() + "_time";
+}
+
+// Theoretical FLOPs and bytes read and written by the call, in elements
+std::tuple<double, double> get_call_cost(const blas::TraceCall& call) {
+  std::vector<double> s(call.sizes.begin(), call.sizes.end());
+  if (call.routine == "gemm" || call.routine == "gemm_batched") {
+    const double batch = call.routine == "gemm" ? 1 : s[6];
+    return std::make_tuple(batch * 2 * s[0] * s[1] * s[2],
+                           batch * (s[0] * s[2] + s[2] * s[1] +
+                                    2 * s[0] * s[1]));
+  } else if (call.routine == "gemv") {
+    const bool trans = call.options[0] != 'n';
+    const double x_size = trans ? s[0] : s[1];
+    const double y_size = trans ? s[1] : s[0];
+    return std::make_tuple(2 * s[0] * s[1],
+                           s[0] * s[1] + x_size + 2 * y_size);
+  } else {
+    const double a_size = call.options[0] == 'l' ? s[0] : s[1];
+    return std::make_tuple(a_size * s[0] * s[1],
+                           a_size * (a_size + 1) / 2 + 2 * s[0] * s[1]);
+  }
+}
+
+// Submits the call on the buffers of the replay
+template <typename scalar_t>
+std::vector<cl::sycl::event> replay_call(blas::SB_Handle& sb_handle,
+                                         const blas::TraceCall& call,
+                                         buffers_t<scalar_t>& buffers) {
+  auto op = [&](size_t i) {
+    return buffers[call.operands[i].buffer] + call.operands[i].offset;
+  };
+  auto size = [&](size_t i) { return static_cast<index_t>(call.sizes[i]); };
+  auto scalar = [&](size_t i) {
+    return static_cast<scalar_t>(call.scalars[i]);
+  };
+  const std::string& o = call.options;
+  if (call.routine == "gemm") {
+    return _gemm(sb_handle, o[0], o[1], size(0), size(1), size(2), scalar(0),
+                 op(0), size(3), op(1), size(4), scalar(1), op(2), size(5));
+  } else if (call.routine == "gemm_batched") {
+    return _gemm_batched(sb_handle, o[0], o[1], size(0), size(1), size(2),
+                         scalar(0), op(0), size(3), op(1), size(4), scalar(1),
+                         op(2), size(5), size(6),
+                         o[2] == 's' ? blas::gemm_batch_type_t::strided
+                                     : blas::gemm_batch_type_t::interleaved);
+  } else if (call.routine == "gemv") {
+    return _gemv(sb_handle, o[0], size(0), size(1), scalar(0), op(0), size(2),
+                 op(1), size(3), scalar(1), op(2), size(4));
+  } else {
+    return _trsm(sb_handle, o[0], o[1], o[2], o[3], size(0), size(1),
+                 scalar(0), op(0), size(2), op(1), size(3));
+  }
+}
+
+template <typename scalar_t>
+void run(benchmark::State& state, blas::SB_Handle* sb_handle_ptr,
+         std::shared_ptr<blas::Trace> trace, bool* success) {
+  const auto& calls = trace->get_calls();
+
+  double n_fl_ops = 0, n_elements = 0;
+  for (const auto& call : calls) {
+    double call_fl_ops, call_elements;
+    std::tie(call_fl_ops, call_elements) = get_call_cost(call);
+    n_fl_ops += call_fl_ops;
+    n_elements += call_elements;
+  }
+  state.counters["trace_calls"] = calls.size();
+  state.counters["n_fl_ops"] = n_fl_ops;
+  state.counters["bytes_processed"] = n_elements * sizeof(scalar_t);
+
+  blas::SB_Handle& sb_handle = *sb_handle_ptr;
+
+  // One buffer per buffer of the trace, so that the calls alias each other
+  // as they did when the trace was captured
+  buffers_t<scalar_t> buffers;
+  for (const auto& buffer : trace->get_buffers()) {
+    std::vector<scalar_t> data =
+        blas_benchmark::utils::random_data<scalar_t>(buffer.count);
+    buffers.push_back(
+        blas::make_sycl_iterator_buffer<scalar_t>(data, buffer.count));
+  }
+
+  // The events of the last replay of each call, for the per-call breakdown
+  std::vector<std::vector<cl::sycl::event>> call_events(calls.size());
+  auto blas_method_def = [&]() -> std::vector<cl::sycl::event> {
+    std::vector<cl::sycl::event> events;
+    for (size_t i = 0; i < calls.size(); ++i) {
+      call_events[i] = replay_call<scalar_t>(sb_handle, calls[i], buffers);
+      events = blas::concatenate_vectors(events, call_events[i]);
+    }
+    return events;
+  };
+
+  std::vector<std::string> signatures;
+  for (const auto& call : calls) {
+    signatures.push_back(get_signature(call));
+  }
+  std::map<std::string, double> total_call_times;
+
+  // Warmup
+  blas_benchmark::utils::warmup(blas_method_def);
+  sb_handle.wait();
+
+  blas_benchmark::utils::init_counters(state);
+
+  // Measure
+  for (auto _ : state) {
+    // Run
+    std::tuple<double, double> times = blas_benchmark::utils::time_submissions(
+        state, sb_handle, blas_method_def);
+
+    // Report
+    blas_benchmark::utils::update_counters(state, times);
+    state.PauseTiming();
+    for (size_t i = 0; i < calls.size(); ++i) {
+      total_call_times[signatures[i]] +=
+          blas_benchmark::utils::time_events(call_events[i]);
+    }
+    state.ResumeTiming();
+  }
+
+  blas_benchmark::utils::calc_avg_counters(state);
+  blas_benchmark::utils::calc_roofline_counters<scalar_t>(state);
+  for (const auto& call_time : total_call_times) {
+    state.counters[call_time.first] = call_time.second / state.iterations();
+  }
+};
+
+template <typename scalar_t>
+void register_benchmark(blas_benchmark::Args& args,
+                        blas::SB_Handle* sb_handle_ptr, bool* success) {
+  if (args.trace_file.empty()) {
+    std::cerr << "A trace must be given with --trace-file" << std::endl;
+    *success = false;
+    return;
+  }
+  std::ifstream trace_stream(args.trace_file);
+  if (!trace_stream) {
+    std::cerr << "Cannot open " << args.trace_file << std::endl;
+    *success = false;
+    return;
+  }
+  auto trace =
+      std::make_shared<blas::Trace>(blas::Trace::read(trace_stream));
+
+  // A trace is replayed with the data type it was captured with
+  for (const auto& buffer : trace->get_buffers()) {
+    if (buffer.element_size != sizeof(scalar_t)) {
+      return;
+    }
+  }
+  for (const auto& call : trace->get_calls()) {
+    if (call.routine == "gemm") {
+      check_call(call, 2, 6, 2, 3);
+    } else if (call.routine == "gemm_batched") {
+      check_call(call, 3, 7, 2, 3);
+    } else if (call.routine == "gemv") {
+      check_call(call, 1, 5, 2, 3);
+    } else if (call.routine == "trsm") {
+      check_call(call, 4, 4, 1, 2);
+    } else {
+      throw std::runtime_error("Cannot replay " + call.routine);
+    }
+  }
+
+  auto BM_lambda = [&](benchmark::State& st, blas::SB_Handle* sb_handle_ptr,
+                       std::shared_ptr<blas::Trace> trace, bool* success) {
+    run<scalar_t>(st, sb_handle_ptr, trace, success);
+  };
+  benchmark::RegisterBenchmark(get_name<scalar_t>(args.trace_file).c_str(),
+                               BM_lambda, sb_handle_ptr, trace, success);
+}
+
+namespace blas_benchmark {
+void create_benchmark(blas_benchmark::Args& args,
+                      blas::SB_Handle* sb_handle_ptr, bool* success) {
+  BLAS_REGISTER_BENCHMARK(args, sb_handle_ptr, success);
+}
+}  // namespace blas_benchmark
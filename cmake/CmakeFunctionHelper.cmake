@@ -31,6 +31,19 @@ set(index_list "${BLAS_INDEX_TYPES}" )
 #The container type for SYCLbackend is BufferIterator<${data}>
 set(data_list "${BLAS_DATA_TYPES}")
 
+# Header recording the configuration the public headers depend on, so that
+# the library and the applications built against it always agree on it
+if(BLAS_ENABLE_COUNTERS)
+  set(SYCL_BLAS_COUNTERS_ENABLED ON)
+else()
+  set(SYCL_BLAS_COUNTERS_ENABLED OFF)
+endif()
+configure_file(${CMAKE_CURRENT_LIST_DIR}/sycl_blas_config.h.in
+  ${CMAKE_BINARY_DIR}/include/sycl_blas_config.h)
+
+# File the compilation records of BLAS_BUILD_REPORT are appended to
+set(SYCLBLAS_BUILD_REPORT_LOG "${PROJECT_BINARY_DIR}/build_report.log")
+
 # Converts a user specified type name into a C++ type
 function(cpp_type output data)
   if (${data} STREQUAL "half")
@@ -58,22 +71,32 @@ endfunction()
 
 function(set_target_compile_def in_target)
   #setting compiler flag for backend
-  message(STATUS "Adding ${TUNING_TARGET} backend to target ${in_target}")
-  if(${TUNING_TARGET} STREQUAL "INTEL_GPU")
-    target_compile_definitions(${in_target} PUBLIC INTEL_GPU=1)
-  elseif(${TUNING_TARGET} STREQUAL "AMD_GPU")
-    target_compile_definitions(${in_target} PUBLIC AMD_GPU=1)
-  elseif(${TUNING_TARGET} STREQUAL "ARM_GPU")
-    target_compile_definitions(${in_target} PUBLIC ARM_GPU=1)
-  elseif(${TUNING_TARGET} STREQUAL "RCAR")
-    target_compile_definitions(${in_target} PUBLIC RCAR=1)
-  elseif(${TUNING_TARGET} STREQUAL "POWER_VR")
-    target_compile_definitions(${in_target} PUBLIC POWER_VR=1)
-  elseif(${TUNING_TARGET} STREQUAL "NVIDIA_GPU")
-    target_compile_definitions(${in_target} PUBLIC NVIDIA_GPU=1)
+  foreach(tuning_target ${SYCLBLAS_TUNING_TARGETS})
+    message(STATUS "Adding ${tuning_target} backend to target ${in_target}")
+    if(${tuning_target} STREQUAL "INTEL_GPU")
+      target_compile_definitions(${in_target} PUBLIC INTEL_GPU=1)
+    elseif(${tuning_target} STREQUAL "AMD_GPU")
+      target_compile_definitions(${in_target} PUBLIC AMD_GPU=1)
+    elseif(${tuning_target} STREQUAL "ARM_GPU")
+      target_compile_definitions(${in_target} PUBLIC ARM_GPU=1)
+    elseif(${tuning_target} STREQUAL "RCAR")
+      target_compile_definitions(${in_target} PUBLIC RCAR=1)
+    elseif(${tuning_target} STREQUAL "POWER_VR")
+      target_compile_definitions(${in_target} PUBLIC POWER_VR=1)
+    elseif(${tuning_target} STREQUAL "NVIDIA_GPU")
+      target_compile_definitions(${in_target} PUBLIC NVIDIA_GPU=1)
+    else()
+      target_compile_definitions(${in_target} PUBLIC DEFAULT_CPU=1)
+    endif()
+  endforeach()
+  #setting the backend used when the device matches none of the targets
+  if(${TUNING_TARGET} MATCHES "^(INTEL_GPU|AMD_GPU|ARM_GPU|RCAR|POWER_VR|NVIDIA_GPU)$")
+    string(TOLOWER ${TUNING_TARGET} fallback_target)
   else()
-    target_compile_definitions(${in_target} PUBLIC DEFAULT_CPU=1)
+    set(fallback_target "default_cpu")
   endif()
+  target_compile_definitions(${in_target} PUBLIC
+    SYCLBLAS_FALLBACK_TUNING_TARGET=${fallback_target})
   #setting tall skinny support
   if(${GEMM_TALL_SKINNY_SUPPORT})
     message(STATUS "Tall and skinny Gemm support enabled for target ${in_target}")
@@ -93,15 +116,61 @@ function(set_target_compile_def in_target)
 endfunction()
 
 
+# Restricts the types a single routine is instantiated for. By default every
+# routine is generated for BLAS_DATA_TYPES and BLAS_INDEX_TYPES, and uses the
+# index types as increment types. The cache variables
+# BLAS_<ROUTINE>_DATA_TYPES, BLAS_<ROUTINE>_INDEX_TYPES and
+# BLAS_<ROUTINE>_INCREMENT_TYPES (e.g. BLAS_GEMM_LAUNCHER_DATA_TYPES) narrow
+# these lists for the routine <routine>. Calling a routine with a type that has
+# been trimmed results in an undefined symbol at link time.
+macro(select_routine_types func)
+  string(TOUPPER ${func} routine_name)
+  if(DEFINED BLAS_${routine_name}_DATA_TYPES)
+    check_routine_types(BLAS_${routine_name}_DATA_TYPES BLAS_DATA_TYPES)
+    set(data_list "${BLAS_${routine_name}_DATA_TYPES}")
+  endif()
+  if(DEFINED BLAS_${routine_name}_INDEX_TYPES)
+    check_routine_types(BLAS_${routine_name}_INDEX_TYPES BLAS_INDEX_TYPES)
+    set(index_list "${BLAS_${routine_name}_INDEX_TYPES}")
+  endif()
+  set(increment_list "${index_list}")
+  if(DEFINED BLAS_${routine_name}_INCREMENT_TYPES)
+    check_routine_types(BLAS_${routine_name}_INCREMENT_TYPES BLAS_INDEX_TYPES)
+    set(increment_list "${BLAS_${routine_name}_INCREMENT_TYPES}")
+  endif()
+endmacro()
+
+# Checks that the types selected for a routine are enabled for the library
+function(check_routine_types routine_types_var enabled_types_var)
+  foreach(type ${${routine_types_var}})
+    if(NOT ("${type}" IN_LIST ${enabled_types_var}))
+      message(FATAL_ERROR
+        "${routine_types_var} contains ${type} which is not in ${enabled_types_var}")
+    endif()
+  endforeach()
+endfunction()
+
+# Records the compilation time and object size of every source of the target
+# when BLAS_BUILD_REPORT is enabled. The records are summarised by the
+# build_report target added in build_library.
+function(set_target_build_report in_target)
+  if(BLAS_BUILD_REPORT)
+    set_target_properties(${in_target} PROPERTIES CXX_COMPILER_LAUNCHER
+      "${PYTHON_EXECUTABLE};${SYCLBLAS_SRC_GENERATOR}/build_report.py;record;${SYCLBLAS_BUILD_REPORT_LOG};${in_target}")
+  endif()
+endfunction()
+
+
 # blas unary function for generating source code
 function(generate_blas_unary_objects blas_level func)
 set(LOCATION "${SYCLBLAS_GENERATED_SRC}/${blas_level}/${func}/")
+select_routine_types(${func})
 foreach(data ${data_list})
   cpp_type(cpp_data ${data})
   set(container_list "BufferIterator<${cpp_data}>")
   foreach(index ${index_list})
     foreach(container0 ${container_list})
-      foreach(increment ${index_list})
+      foreach(increment ${increment_list})
         sanitize_file_name(file_name
           "${func}_${data}_${index}_${container0}_${increment}.cpp")
         add_custom_command(OUTPUT "${LOCATION}/${file_name}"
@@ -128,6 +197,7 @@ foreach(data ${data_list})
 endforeach(data)
 add_library(${func} OBJECT ${FUNC_SRC})
 set_target_compile_def(${func})
+set_target_build_report(${func})
 target_include_directories(${func} PRIVATE ${SYCLBLAS_SRC} ${SYCLBLAS_INCLUDE}
                            ${SYCLBLAS_COMMON_INCLUDE_DIR} ${THIRD_PARTIES_INCLUDE})
 message(STATUS "Adding SYCL to target ${func}")
@@ -138,6 +208,7 @@ endfunction(generate_blas_unary_objects)
 # blas binary function for generating source code
 function(generate_blas_binary_objects blas_level func)
 set(LOCATION "${SYCLBLAS_GENERATED_SRC}/${blas_level}/${func}/")
+select_routine_types(${func})
 foreach(data ${data_list})
   cpp_type(cpp_data ${data})
   set(container_list "BufferIterator<${cpp_data}>")
@@ -145,7 +216,7 @@ foreach(data ${data_list})
     foreach(container0 ${container_list})
       foreach(container1 ${container_list})
         set(container_names "${container0}_${container1}")
-        foreach(increment ${index_list})
+        foreach(increment ${increment_list})
           sanitize_file_name(file_name
             "${func}_${data}_${index}_${container_names}_${increment}.cpp")
           add_custom_command(OUTPUT "${LOCATION}/${file_name}"
@@ -174,6 +245,7 @@ foreach(data ${data_list})
 endforeach(data)
 add_library(${func} OBJECT ${FUNC_SRC})
 set_target_compile_def(${func})
+set_target_build_report(${func})
 target_include_directories(${func} PRIVATE ${SYCLBLAS_SRC} ${SYCLBLAS_INCLUDE}
                            ${SYCLBLAS_COMMON_INCLUDE_DIR} ${THIRD_PARTIES_INCLUDE})
 message(STATUS "Adding SYCL to target ${func}")
@@ -185,18 +257,10 @@ endfunction(generate_blas_binary_objects)
 function(generate_blas_reduction_objects blas_level func)
 set(LOCATION "${SYCLBLAS_GENERATED_SRC}/${blas_level}/${func}/")
 set(operator_list "AddOperator" "MinOperator" "MaxOperator" "ProductOperator" "AbsoluteAddOperator" "MeanOperator")
-string(FIND ${func} "_const" pos)
-if(pos)
-  string(REPLACE "_const" "" actualfunc ${func})
-endif()
+select_routine_types(${func})
 foreach(data ${data_list})
   cpp_type(cpp_data ${data})
-  set(container_list_in)
-  if(pos EQUAL -1)
-    list(APPEND container_list_in "BufferIterator<${cpp_data}>")
-  else()
-    list(APPEND container_list_in "BufferIterator<${cpp_data} const>")
-  endif()
+  set(container_list_in "BufferIterator<${cpp_data}>")
   set(container_list_out "BufferIterator<${cpp_data}>")
   foreach(index ${index_list})
     set(container_list "BufferIterator<${cpp_data}>")
@@ -204,7 +268,7 @@ foreach(data ${data_list})
       foreach(container0 ${container_list_in})
         foreach(container1 ${container_list_out})
           set(container_names "${container0}_${container1}")
-          foreach(increment ${index_list})
+          foreach(increment ${increment_list})
             sanitize_file_name(file_name
               "${func}_${operator}_${data}_${index}_${container0}_${increment}.cpp")
             add_custom_command(OUTPUT "${LOCATION}/${file_name}"
@@ -213,7 +277,7 @@ foreach(data ${data_list})
                 ${SYCLBLAS_SRC_GENERATOR}/gen
                 ${blas_level}
                 ${func}
-                ${SYCLBLAS_SRC}/interface/${blas_level}/${actualfunc}.cpp.in
+                ${SYCLBLAS_SRC}/interface/${blas_level}/${func}.cpp.in
                 ${cpp_data}
                 ${index}
                 ${increment}
@@ -221,7 +285,7 @@ foreach(data ${data_list})
                 ${container1}
                 ${operator}
                 ${file_name}
-              MAIN_DEPENDENCY ${SYCLBLAS_SRC}/interface/${blas_level}/${actualfunc}.cpp.in
+              MAIN_DEPENDENCY ${SYCLBLAS_SRC}/interface/${blas_level}/${func}.cpp.in
               DEPENDS ${SYCLBLAS_SRC_GENERATOR}/py_gen_blas_reduction.py
               WORKING_DIRECTORY ${PROJECT_BINARY_DIR}
               VERBATIM
@@ -235,6 +299,7 @@ foreach(data ${data_list})
 endforeach(data)
 add_library(${func} OBJECT ${FUNC_SRC})
 set_target_compile_def(${func})
+set_target_build_report(${func})
 target_include_directories(${func} PRIVATE ${SYCLBLAS_SRC} ${SYCLBLAS_INCLUDE}
                            ${SYCLBLAS_COMMON_INCLUDE_DIR} ${THIRD_PARTIES_INCLUDE})
 message(STATUS "Adding SYCL to target ${func}")
@@ -245,6 +310,7 @@ endfunction(generate_blas_reduction_objects)
 # blas special binary function for generating source code
 function(generate_blas_binary_special_objects blas_level func)
 set(LOCATION "${SYCLBLAS_GENERATED_SRC}/${blas_level}/${func}/")
+select_routine_types(${func})
 foreach(data ${data_list})
   cpp_type(cpp_data ${data})
   set(container_list_in "BufferIterator<${cpp_data}>")
@@ -254,7 +320,7 @@ foreach(data ${data_list})
     foreach(container0 ${container_list_in})
       foreach(container1 ${container_list_out})
         set(container_names "${container0}_${container1}")
-        foreach(increment ${index_list})
+        foreach(increment ${increment_list})
           sanitize_file_name(file_name
             "${func}_${data}_${index}_${container_names}_${increment}.cpp")
           add_custom_command(OUTPUT "${LOCATION}/${file_name}"
@@ -283,6 +349,7 @@ foreach(data ${data_list})
 endforeach(data)
 add_library(${func} OBJECT ${FUNC_SRC})
 set_target_compile_def(${func})
+set_target_build_report(${func})
 target_include_directories(${func} PRIVATE ${SYCLBLAS_SRC} ${SYCLBLAS_INCLUDE}
                            ${SYCLBLAS_COMMON_INCLUDE_DIR} ${THIRD_PARTIES_INCLUDE})
 message(STATUS "Adding SYCL to target ${func}")
@@ -294,18 +361,10 @@ endfunction(generate_blas_binary_special_objects)
 # blas ternary function for generating source code
 function(generate_blas_ternary_objects blas_level func)
 set(LOCATION "${SYCLBLAS_GENERATED_SRC}/${blas_level}/${func}/")
-string(FIND ${func} "_const" const_pos)
-if(const_pos)
-  string(REPLACE "_const" "" actualfunc ${func})
-endif()
+select_routine_types(${func})
 foreach(data ${data_list})
   cpp_type(cpp_data ${data})
-  set(container_list_in)
-  if(const_pos EQUAL -1)
-    list(APPEND container_list_in "BufferIterator<${cpp_data}>")
-  else()
-    list(APPEND container_list_in "BufferIterator<${cpp_data} const>")
-  endif()
+  set(container_list_in "BufferIterator<${cpp_data}>")
   set(container_list_out "BufferIterator<${cpp_data}>")
   foreach(index ${index_list})
     foreach(container0 ${container_list_in})
@@ -313,7 +372,7 @@ foreach(data ${data_list})
         foreach(container2 ${container_list_out})
           set(container_names
             "${container0}_${container1}_${container2}")
-          foreach(increment ${index_list})
+          foreach(increment ${increment_list})
             sanitize_file_name(file_name
               "${func}_${data}_${index}_${container_names}_${increment}.cpp")
             add_custom_command(OUTPUT "${LOCATION}/${file_name}"
@@ -322,7 +381,7 @@ foreach(data ${data_list})
                 ${SYCLBLAS_SRC_GENERATOR}/gen
                 ${blas_level}
                 ${func}
-                ${SYCLBLAS_SRC}/interface/${blas_level}/${actualfunc}.cpp.in
+                ${SYCLBLAS_SRC}/interface/${blas_level}/${func}.cpp.in
                 ${cpp_data}
                 ${index}
                 ${increment}
@@ -330,7 +389,7 @@ foreach(data ${data_list})
                 ${container1}
                 ${container2}
                 ${file_name}
-              MAIN_DEPENDENCY ${SYCLBLAS_SRC}/interface/${blas_level}/${actualfunc}.cpp.in
+              MAIN_DEPENDENCY ${SYCLBLAS_SRC}/interface/${blas_level}/${func}.cpp.in
               DEPENDS ${SYCLBLAS_SRC_GENERATOR}/py_gen_blas_ternary.py
               WORKING_DIRECTORY ${PROJECT_BINARY_DIR}
               VERBATIM
@@ -344,6 +403,7 @@ foreach(data ${data_list})
 endforeach(data)
 add_library(${func} OBJECT ${FUNC_SRC})
 set_target_compile_def(${func})
+set_target_build_report(${func})
 target_include_directories(${func} PRIVATE ${SYCLBLAS_SRC} ${SYCLBLAS_INCLUDE}
                            ${SYCLBLAS_COMMON_INCLUDE_DIR} ${THIRD_PARTIES_INCLUDE})
 message(STATUS "Adding SYCL to target ${func}")
@@ -354,6 +414,7 @@ endfunction(generate_blas_ternary_objects)
 # blas function for generating source code for the rotg operator (asynchronous version with containers)
 function(generate_blas_rotg_objects blas_level func)
   set(LOCATION "${SYCLBLAS_GENERATED_SRC}/${blas_level}/${func}/")
+  select_routine_types(${func})
   foreach (data ${data_list})
     cpp_type(cpp_data ${data})
     set(container_list_in_out "BufferIterator<${cpp_data}>")
@@ -390,6 +451,7 @@ function(generate_blas_rotg_objects blas_level func)
   endforeach (data)
   add_library(${func} OBJECT ${FUNC_SRC})
   set_target_compile_def(${func})
+  set_target_build_report(${func})
   target_include_directories(${func} PRIVATE ${SYCLBLAS_SRC} ${SYCLBLAS_INCLUDE}
           ${SYCLBLAS_COMMON_INCLUDE_DIR} ${THIRD_PARTIES_INCLUDE})
   message(STATUS "Adding SYCL to target ${func}")
@@ -400,6 +462,7 @@ endfunction(generate_blas_rotg_objects)
 # blas function for generating source code for the rotg operator (synchronous version)
 function(generate_blas_rotg_return_objects blas_level func)
   set(LOCATION "${SYCLBLAS_GENERATED_SRC}/${blas_level}/${func}/")
+  select_routine_types(${func})
   foreach (data ${data_list})
     cpp_type(cpp_data ${data})
     set(container_list "BufferIterator<${cpp_data}>")
@@ -423,6 +486,7 @@ function(generate_blas_rotg_return_objects blas_level func)
   endforeach (data)
   add_library(${func} OBJECT ${FUNC_SRC})
   set_target_compile_def(${func})
+  set_target_build_report(${func})
   target_include_directories(${func} PRIVATE ${SYCLBLAS_SRC} ${SYCLBLAS_INCLUDE}
           ${SYCLBLAS_COMMON_INCLUDE_DIR} ${THIRD_PARTIES_INCLUDE})
   message(STATUS "Adding SYCL to target ${func}")
@@ -432,6 +496,7 @@ endfunction(generate_blas_rotg_return_objects)
 # blas function for generating source code for the rotg operator (asynchronous version with containers)
 function(generate_blas_rotmg_objects blas_level func)
   set(LOCATION "${SYCLBLAS_GENERATED_SRC}/${blas_level}/${func}/")
+  select_routine_types(${func})
   foreach (data ${data_list})
     cpp_type(cpp_data ${data})
     set(container_list_in_out "BufferIterator<${cpp_data}>")
@@ -470,6 +535,7 @@ function(generate_blas_rotmg_objects blas_level func)
   endforeach (data)
   add_library(${func} OBJECT ${FUNC_SRC})
   set_target_compile_def(${func})
+  set_target_build_report(${func})
   target_include_directories(${func} PRIVATE ${SYCLBLAS_SRC} ${SYCLBLAS_INCLUDE}
           ${SYCLBLAS_COMMON_INCLUDE_DIR} ${THIRD_PARTIES_INCLUDE})
   message(STATUS "Adding SYCL to target ${func}")
@@ -479,6 +545,7 @@ endfunction(generate_blas_rotmg_objects)
 # blas gemm function for generating source code
 function(generate_blas_gemm_objects blas_level func)
 set(LOCATION "${SYCLBLAS_GENERATED_SRC}/${blas_level}/${func}/")
+select_routine_types(${func})
 set(gemm_sources "")
 
 # Generates a file for a new GEMM configuration
@@ -534,6 +601,10 @@ function(add_gemm_configuration
                           "${jm_m}_${jm_n}_${jm_k}_${jm_in_type}_${jm_out_type}_"
                           "${wg_size}_${cache_line_size}.cpp")
             sanitize_file_name(file_name "${file_name}")
+            if("${LOCATION}/${file_name}" IN_LIST gemm_sources)
+              # Already requested by another tuning target
+              continue()
+            endif()
             add_custom_command(OUTPUT "${LOCATION}/${file_name}"
               COMMAND ${PYTHON_EXECUTABLE} ${SYCLBLAS_SRC_GENERATOR}/py_gen_blas_gemm_launcher.py
                 ${PROJECT_SOURCE_DIR}/external/
@@ -585,7 +656,8 @@ function(add_gemm_configuration
     endforeach(trans_b)
   endforeach(trans_a)
 endfunction()
-if(${TUNING_TARGET} STREQUAL "INTEL_GPU")
+foreach(tuning_target ${SYCLBLAS_TUNING_TARGETS})
+if(${tuning_target} STREQUAL "INTEL_GPU")
   set(supported_types
     "float"
     "double"
@@ -646,7 +718,7 @@ if(${TUNING_TARGET} STREQUAL "INTEL_GPU")
       "${data}" 64 "false" "false" "false"
       64 4 4 4 4 1 1 1 1 4 4 1 1 1 float float "no_local" "standard" "full" 4 "interleaved" "false")
   endforeach()
-elseif(${TUNING_TARGET} STREQUAL "RCAR") # need investigation
+elseif(${tuning_target} STREQUAL "RCAR") # need investigation
   set(supported_types
     "float"
   )
@@ -661,7 +733,7 @@ elseif(${TUNING_TARGET} STREQUAL "RCAR") # need investigation
       "${data}" 64 "false" "false" "false"
       64 4 4 4 4 1 1 1 1 4 4 1 1 1 float float "no_local" "standard" "full" 4 "interleaved" "false")
   endforeach()
-elseif(${TUNING_TARGET} STREQUAL "ARM_GPU")
+elseif(${tuning_target} STREQUAL "ARM_GPU")
   set(supported_types
     "float"
     "half"
@@ -726,7 +798,7 @@ elseif(${TUNING_TARGET} STREQUAL "ARM_GPU")
       "${data}" 64 "false" "false" "false"
       64 2 2 4 4 1 1 1 1 4 4 1 1 1 float float "no_local" "standard" "full" 2 "interleaved" "false")
   endforeach()
-elseif(${TUNING_TARGET} STREQUAL "POWER_VR" AND NOT IMGDNN_DIR)
+elseif(${tuning_target} STREQUAL "POWER_VR" AND NOT IMGDNN_DIR)
   set(supported_types
     "float"
     "half"
@@ -751,7 +823,7 @@ elseif(${TUNING_TARGET} STREQUAL "POWER_VR" AND NOT IMGDNN_DIR)
       "${data}" 64 "false" "false" "false"
       64 4 4 4 4 1 1 1 1 4 4 1 1 1 float float "no_local" "standard" "full" 4 "interleaved" "false")
   endforeach()
-elseif(${TUNING_TARGET} STREQUAL "AMD_GPU")  # need investigation
+elseif(${tuning_target} STREQUAL "AMD_GPU")  # need investigation
   set(supported_types
     "float"
     "double"
@@ -791,7 +863,7 @@ elseif(${TUNING_TARGET} STREQUAL "AMD_GPU")  # need investigation
       "${data}" 64 "false" "false" "false"
       64 4 4 4 4 1 1 1 1 4 4 1 1 1 float float "no_local" "standard" "full" 4 "interleaved" "false")
   endforeach()
-elseif(${TUNING_TARGET} STREQUAL "NVIDIA_GPU")
+elseif(${tuning_target} STREQUAL "NVIDIA_GPU")
  set(supported_types
     "float"
     "double"
@@ -842,6 +914,16 @@ else() # default cpu backend
       add_gemm_configuration(
         "${data}"  64 "false" "false" "false"
         64 8 8 8 8 1 1 1 1 1 1 1 1 1 float float "no_local" "standard" "partial" 1 "strided" "false" "false")
+      # Cache blocked kernel used when the device is a CPU
+      if("${data}" STREQUAL "double")
+        add_gemm_configuration(
+          "${data}"  1 "false" "false" "false"
+          256 4 4 8 8 1 1 1 1 1 1 1 1 1 float float "local" "cache_blocked" "full" 4 "strided" "false" "false")
+      else()
+        add_gemm_configuration(
+          "${data}"  1 "false" "false" "false"
+          256 8 4 8 8 1 1 1 1 1 1 1 1 1 float float "local" "cache_blocked" "full" 8 "strided" "false" "false")
+      endif()
     endif()
 
     add_gemm_configuration(
@@ -849,8 +931,10 @@ else() # default cpu backend
       64 2 2 4 4 1 1 1 1 4 4 1 1 1 float float "no_local" "standard" "full" 4 "interleaved" "false" "false")
   endforeach()
 endif()
+endforeach(tuning_target)
 add_library(${func} OBJECT ${gemm_sources})
 set_target_compile_def(${func})
+set_target_build_report(${func})
 # The blas library depends on FindComputeCpp
 target_include_directories(${func} PRIVATE ${SYCLBLAS_SRC} ${SYCLBLAS_INCLUDE}
                            ${SYCLBLAS_COMMON_INCLUDE_DIR} ${THIRD_PARTIES_INCLUDE})
@@ -875,22 +959,40 @@ function (build_library LIB_NAME ENABLE_EXTENSIONS)
                 $<TARGET_OBJECTS:nrm2>
                 $<TARGET_OBJECTS:nrm2_return>
                 $<TARGET_OBJECTS:rot>
+                $<TARGET_OBJECTS:rot_batched>
+                $<TARGET_OBJECTS:lasr>
                 $<TARGET_OBJECTS:rotm>
                 $<TARGET_OBJECTS:rotmg>
+                $<TARGET_OBJECTS:rotmg_return>
+                $<TARGET_OBJECTS:rotmg_batched>
                 $<TARGET_OBJECTS:rotg>
                 $<TARGET_OBJECTS:rotg_return>
+                $<TARGET_OBJECTS:rotg_batched>
                 $<TARGET_OBJECTS:scal>
                 $<TARGET_OBJECTS:swap>
                 $<TARGET_OBJECTS:gbmv>
                 $<TARGET_OBJECTS:gemv>
                 $<TARGET_OBJECTS:ger>
+                $<TARGET_OBJECTS:gerk>
                 $<TARGET_OBJECTS:symv>
                 $<TARGET_OBJECTS:syr>
                 $<TARGET_OBJECTS:syr2>
                 $<TARGET_OBJECTS:trmv>
+                $<TARGET_OBJECTS:sbmv>
+                $<TARGET_OBJECTS:spmv>
+                $<TARGET_OBJECTS:spr>
+                $<TARGET_OBJECTS:tbmv>
+                $<TARGET_OBJECTS:tpmv>
+                $<TARGET_OBJECTS:trsv>
+                $<TARGET_OBJECTS:tbsv>
+                $<TARGET_OBJECTS:tpsv>
                 $<TARGET_OBJECTS:gemm_launcher>
                 $<TARGET_OBJECTS:gemm>
-                $<TARGET_OBJECTS:trsm>)
+                $<TARGET_OBJECTS:trsm>
+                $<TARGET_OBJECTS:syrk>
+                $<TARGET_OBJECTS:syr2k>
+                $<TARGET_OBJECTS:trmm>
+                $<TARGET_OBJECTS:symm>)
 
   if (${ENABLE_EXTENSIONS})
     list(APPEND LIB_SRCS $<TARGET_OBJECTS:reduction>)
@@ -898,14 +1000,14 @@ function (build_library LIB_NAME ENABLE_EXTENSIONS)
 
   add_library(${LIB_NAME} ${LIB_SRCS})
 
-  if(BLAS_ENABLE_CONST_INPUT)
-    set(CONST_SRCS $<TARGET_OBJECTS:gemv_const>
-                   $<TARGET_OBJECTS:gemm_const>)
-
-    if(${ENABLE_EXTENSIONS})
-      list(APPEND CONST_SRCS $<TARGET_OBJECTS:reduction_const>)
-    endif()
-
-    target_sources(${LIB_NAME} PRIVATE ${CONST_SRCS})
+  if(BLAS_BUILD_REPORT)
+    add_custom_target(build_report
+      COMMAND ${PYTHON_EXECUTABLE} ${SYCLBLAS_SRC_GENERATOR}/build_report.py
+        summarize ${SYCLBLAS_BUILD_REPORT_LOG} $<TARGET_FILE:${LIB_NAME}>
+        ${PROJECT_BINARY_DIR}/build_report.json
+      DEPENDS ${LIB_NAME}
+      WORKING_DIRECTORY ${PROJECT_BINARY_DIR}
+      VERBATIM
+    )
   endif()
 endfunction(build_library)
@@ -68,6 +68,18 @@ endif()
 SET(TUNING_TARGET "DEFAULT_CPU" CACHE STRING "Default Platform 'DEFAULT_CPU'")
 message(STATUS "${TUNING_TARGET} is chosen as a tuning target")
 
+# TUNING_TARGETS adds further tuning targets to the same build. The GEMM
+# configurations of every listed target are instantiated and the backend is
+# selected at SB_Handle construction from the device vendor and type, falling
+# back to TUNING_TARGET when the device matches none of them
+SET(TUNING_TARGETS "" CACHE STRING
+    "Additional platforms to tune for, e.g. 'INTEL_GPU;NVIDIA_GPU'")
+set(SYCLBLAS_TUNING_TARGETS ${TUNING_TARGET} ${TUNING_TARGETS})
+list(REMOVE_DUPLICATES SYCLBLAS_TUNING_TARGETS)
+if(TUNING_TARGETS)
+  message(STATUS "${SYCLBLAS_TUNING_TARGETS} are chosen as tuning targets")
+endif()
+
 if(DEFINED TARGET)
   message(FATAL_ERROR
             "\nSetting the TARGET CMake variable is no longer supported. "
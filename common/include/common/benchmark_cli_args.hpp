@@ -12,6 +12,16 @@ typedef struct {
   std::string program_name;
   std::string device;
   std::string csv_param;
+  std::string mode;
+  int num_calls;
+  double peak_bandwidth;
+  double peak_gflops;
+  double peak_gflops_fp64;
+  std::string roofline_file;
+  std::string trace_file;
+  std::string gemm_model;
+  int gemm_config;
+  std::string gemm_model_predictions;
 } Args;
 
 namespace utils {
@@ -24,6 +34,12 @@ namespace utils {
 static inline Args parse_args(int argc, char** argv) {
   Args args;
   args.program_name = std::string(argv[0]);
+  args.mode = "latency";
+  args.num_calls = 32;
+  args.peak_bandwidth = 0;
+  args.peak_gflops = 0;
+  args.peak_gflops_fp64 = 0;
+  args.gemm_config = -1;
   bool show_help = false;
 
   auto parser =
@@ -31,12 +47,46 @@ static inline Args parse_args(int argc, char** argv) {
       clara::Opt(args.device, "device")["--device"](
           "Select a device (best effort) for running the benchmark.") |
       clara::Opt(args.csv_param, "filepath")["--csv-param"](
-          "Select which CSV file to read the benchmark parameters from");
+          "Select which CSV file to read the benchmark parameters from") |
+      clara::Opt(args.mode, "latency|throughput")["--mode"](
+          "Wait for each call before the next one (latency, default) or "
+          "submit --num-calls calls back to back (throughput)") |
+      clara::Opt(args.num_calls, "calls")["--num-calls"](
+          "Number of calls submitted without waiting in the throughput mode") |
+      clara::Opt(args.peak_bandwidth, "GB/s")["--peak-bandwidth"](
+          "Peak memory bandwidth of the device, measured at startup if not "
+          "given") |
+      clara::Opt(args.peak_gflops, "GFLOP/s")["--peak-gflops"](
+          "Peak single precision FLOP rate of the device, measured at startup "
+          "if not given") |
+      clara::Opt(args.peak_gflops_fp64, "GFLOP/s")["--peak-gflops-fp64"](
+          "Peak double precision FLOP rate of the device, measured at startup "
+          "if not given") |
+      clara::Opt(args.roofline_file, "filepath")["--roofline-file"](
+          "Write the arithmetic intensity and FLOP rate of each benchmark to "
+          "a CSV file, to plot them against the roofline of the device") |
+      clara::Opt(args.trace_file, "filepath")["--trace-file"](
+          "Select which trace to replay (trace replay benchmark only)") |
+      clara::Opt(args.gemm_model, "filepath")["--gemm-model"](
+          "Choose the GEMM configurations with the performance model "
+          "calibrated in the given file") |
+      clara::Opt(args.gemm_config, "index")["--gemm-config"](
+          "Force the standard GEMM configuration of the given index, to "
+          "calibrate the performance model") |
+      clara::Opt(args.gemm_model_predictions,
+                 "filepath")["--gemm-model-predictions"](
+          "Write the predictions of the GEMM performance model for the "
+          "benchmarked shapes to a CSV file");
 
   auto res = parser.parse(clara::Args(argc, argv));
   if (!res) {
     std::cerr << "Error in command line: " << res.errorMessage() << std::endl;
     exit(1);
+  } else if ((args.mode != "latency" && args.mode != "throughput") ||
+             args.num_calls < 1) {
+    std::cerr << "Error in command line: invalid mode or number of calls"
+              << std::endl;
+    exit(1);
   } else if (show_help) {
     std::cout << parser << std::endl;
   }
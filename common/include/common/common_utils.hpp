@@ -44,10 +44,38 @@ template <typename scalar_t>
 using trsm_param_t =
     std::tuple<char, char, char, char, index_t, index_t, scalar_t>;
 
+template <typename scalar_t>
+using trsm_batched_param_t =
+    std::tuple<char, char, char, char, index_t, index_t, scalar_t, index_t>;
+
+template <typename scalar_t>
+using symm_param_t =
+    std::tuple<char, char, index_t, index_t, scalar_t, scalar_t>;
+
+template <typename scalar_t>
+using syrk_param_t =
+    std::tuple<char, char, index_t, index_t, scalar_t, scalar_t>;
+
 template <typename scalar_t>
 using gbmv_param_t = std::tuple<std::string, index_t, index_t, index_t, index_t,
                                 scalar_t, scalar_t>;
 
+using trsv_param_t = std::tuple<char, char, char, index_t>;
+
+using tbsv_param_t = std::tuple<char, char, char, index_t, index_t>;
+
+template <typename scalar_t>
+using ger_param_t = std::tuple<index_t, index_t, scalar_t>;
+
+template <typename scalar_t>
+using syr_param_t = std::tuple<char, index_t, scalar_t>;
+
+template <typename scalar_t>
+using symv_param_t = std::tuple<char, index_t, scalar_t, scalar_t>;
+
+template <typename scalar_t>
+using sbmv_param_t = std::tuple<char, index_t, index_t, scalar_t, scalar_t>;
+
 namespace blas_benchmark {
 
 namespace utils {
@@ -426,6 +454,140 @@ static inline std::vector<trsm_param_t<scalar_t>> get_trsm_params(Args& args) {
   }
 }
 
+/**
+ * @fn get_symm_params
+ * @brief Returns a vector containing the symm benchmark parameters, either
+ * read from a file according to the command-line args, or the default ones.
+ */
+template <typename scalar_t>
+static inline std::vector<symm_param_t<scalar_t>> get_symm_params(Args& args) {
+  if (args.csv_param.empty()) {
+    warning_no_csv();
+    std::vector<symm_param_t<scalar_t>> symm_default;
+    constexpr index_t dmin = 64, dmax = 1024;
+    for (char side : {'l', 'r'}) {
+      for (char uplo : {'u', 'l'}) {
+        for (index_t m = dmin; m <= dmax; m *= 2) {
+          for (index_t n = dmin; n <= dmax; n *= 2) {
+            symm_default.push_back(std::make_tuple(side, uplo, m, n,
+                                                   scalar_t{1}, scalar_t{0}));
+          }
+        }
+      }
+    }
+    return symm_default;
+  } else {
+    return parse_csv_file<symm_param_t<scalar_t>>(
+        args.csv_param, [&](std::vector<std::string>& v) {
+          if (v.size() != 6) {
+            throw std::runtime_error(
+                "invalid number of parameters (6 expected)");
+          }
+          try {
+            return std::make_tuple(v[0][0], v[1][0], str_to_int<index_t>(v[2]),
+                                   str_to_int<index_t>(v[3]),
+                                   str_to_scalar<scalar_t>(v[4]),
+                                   str_to_scalar<scalar_t>(v[5]));
+          } catch (...) {
+            throw std::runtime_error("invalid parameter");
+          }
+        });
+  }
+}
+
+/**
+ * @fn get_syrk_params
+ * @brief Returns a vector containing the syrk and syr2k benchmark parameters,
+ * either read from a file according to the command-line args, or the default
+ * ones.
+ */
+template <typename scalar_t>
+static inline std::vector<syrk_param_t<scalar_t>> get_syrk_params(Args& args) {
+  if (args.csv_param.empty()) {
+    warning_no_csv();
+    std::vector<syrk_param_t<scalar_t>> syrk_default;
+    constexpr index_t dmin = 64, dmax = 1024;
+    for (char uplo : {'u', 'l'}) {
+      for (char trans : {'n', 't'}) {
+        for (index_t n = dmin; n <= dmax; n *= 2) {
+          for (index_t k = dmin; k <= dmax; k *= 2) {
+            syrk_default.push_back(std::make_tuple(uplo, trans, n, k,
+                                                   scalar_t{1}, scalar_t{0}));
+          }
+        }
+      }
+    }
+    return syrk_default;
+  } else {
+    return parse_csv_file<syrk_param_t<scalar_t>>(
+        args.csv_param, [&](std::vector<std::string>& v) {
+          if (v.size() != 6) {
+            throw std::runtime_error(
+                "invalid number of parameters (6 expected)");
+          }
+          try {
+            return std::make_tuple(v[0][0], v[1][0], str_to_int<index_t>(v[2]),
+                                   str_to_int<index_t>(v[3]),
+                                   str_to_scalar<scalar_t>(v[4]),
+                                   str_to_scalar<scalar_t>(v[5]));
+          } catch (...) {
+            throw std::runtime_error("invalid parameter");
+          }
+        });
+  }
+}
+
+/**
+ * @fn get_trsm_batched_params
+ * @brief Returns a vector containing the trsm_batched benchmark parameters,
+ * either read from a file according to the command-line args, or the default
+ * ones. The batch size column is optional so that the trsm CSV files can be
+ * used as they are.
+ */
+template <typename scalar_t>
+static inline std::vector<trsm_batched_param_t<scalar_t>>
+get_trsm_batched_params(Args& args) {
+  constexpr index_t default_batch_size = 128;
+  if (args.csv_param.empty()) {
+    warning_no_csv();
+    std::vector<trsm_batched_param_t<scalar_t>> trsm_batched_default;
+    constexpr index_t dmin = 4, dmax = 64;
+    for (char side : {'l', 'r'}) {
+      for (char uplo : {'u', 'l'}) {
+        for (char trans : {'n', 't'}) {
+          for (char diag : {'u', 'n'}) {
+            for (index_t m = dmin; m <= dmax; m *= 2) {
+              for (index_t n = dmin; n <= dmax; n *= 2) {
+                trsm_batched_default.push_back(
+                    std::make_tuple(side, uplo, trans, diag, m, n, scalar_t{1},
+                                    default_batch_size));
+              }
+            }
+          }
+        }
+      }
+    }
+    return trsm_batched_default;
+  } else {
+    return parse_csv_file<trsm_batched_param_t<scalar_t>>(
+        args.csv_param, [&](std::vector<std::string>& v) {
+          if (v.size() != 7 && v.size() != 8) {
+            throw std::runtime_error(
+                "invalid number of parameters (7 or 8 expected)");
+          }
+          try {
+            return std::make_tuple(
+                v[0][0], v[1][0], v[2][0], v[3][0], str_to_int<index_t>(v[4]),
+                str_to_int<index_t>(v[5]), str_to_scalar<scalar_t>(v[6]),
+                v.size() == 8 ? str_to_int<index_t>(v[7])
+                              : default_batch_size);
+          } catch (...) {
+            throw std::runtime_error("invalid parameter");
+          }
+        });
+  }
+}
+
 /**
  * @fn get_gbmv_params
  * @brief Returns a vector containing the gbmv benchmark parameters, either
@@ -473,6 +635,231 @@ static inline std::vector<gbmv_param_t<scalar_t>> get_gbmv_params(Args& args) {
   }
 }
 
+/**
+ * @fn get_trsv_params
+ * @brief Returns a vector containing the trsv benchmark parameters, either
+ * read from a file according to the command-line args, or the default ones.
+ */
+static inline std::vector<trsv_param_t> get_trsv_params(Args& args) {
+  if (args.csv_param.empty()) {
+    warning_no_csv();
+    std::vector<trsv_param_t> trsv_default;
+    constexpr index_t dmin = 64, dmax = 1024;
+    for (char uplo : {'u', 'l'}) {
+      for (char trans : {'n', 't'}) {
+        for (char diag : {'u', 'n'}) {
+          for (index_t n = dmin; n <= dmax; n *= 2) {
+            trsv_default.push_back(std::make_tuple(uplo, trans, diag, n));
+          }
+        }
+      }
+    }
+    return trsv_default;
+  } else {
+    return parse_csv_file<trsv_param_t>(
+        args.csv_param, [&](std::vector<std::string>& v) {
+          if (v.size() != 4) {
+            throw std::runtime_error(
+                "invalid number of parameters (4 expected)");
+          }
+          try {
+            return std::make_tuple(v[0][0], v[1][0], v[2][0],
+                                   str_to_int<index_t>(v[3]));
+          } catch (...) {
+            throw std::runtime_error("invalid parameter");
+          }
+        });
+  }
+}
+
+/**
+ * @fn get_tbsv_params
+ * @brief Returns a vector containing the tbsv benchmark parameters, either
+ * read from a file according to the command-line args, or the default ones.
+ */
+static inline std::vector<tbsv_param_t> get_tbsv_params(Args& args) {
+  if (args.csv_param.empty()) {
+    warning_no_csv();
+    std::vector<tbsv_param_t> tbsv_default;
+    constexpr index_t dmin = 64, dmax = 1024;
+    constexpr index_t kmin = 1;
+    for (char uplo : {'u', 'l'}) {
+      for (char trans : {'n', 't'}) {
+        for (char diag : {'u', 'n'}) {
+          for (index_t n = dmin; n <= dmax; n *= 2) {
+            for (index_t k = kmin; k <= n / 4; k *= 4) {
+              tbsv_default.push_back(std::make_tuple(uplo, trans, diag, n, k));
+            }
+          }
+        }
+      }
+    }
+    return tbsv_default;
+  } else {
+    return parse_csv_file<tbsv_param_t>(
+        args.csv_param, [&](std::vector<std::string>& v) {
+          if (v.size() != 5) {
+            throw std::runtime_error(
+                "invalid number of parameters (5 expected)");
+          }
+          try {
+            return std::make_tuple(v[0][0], v[1][0], v[2][0],
+                                   str_to_int<index_t>(v[3]),
+                                   str_to_int<index_t>(v[4]));
+          } catch (...) {
+            throw std::runtime_error("invalid parameter");
+          }
+        });
+  }
+}
+
+/**
+ * @fn get_ger_params
+ * @brief Returns a vector containing the ger benchmark parameters, either
+ * read from a file according to the command-line args, or the default ones.
+ */
+template <typename scalar_t>
+static inline std::vector<ger_param_t<scalar_t>> get_ger_params(Args& args) {
+  if (args.csv_param.empty()) {
+    warning_no_csv();
+    std::vector<ger_param_t<scalar_t>> ger_default;
+    constexpr index_t dmin = 64, dmax = 1024;
+    for (index_t m = dmin; m <= dmax; m *= 2) {
+      for (index_t n = dmin; n <= dmax; n *= 2) {
+        ger_default.push_back(std::make_tuple(m, n, scalar_t{1}));
+      }
+    }
+    return ger_default;
+  } else {
+    return parse_csv_file<ger_param_t<scalar_t>>(
+        args.csv_param, [&](std::vector<std::string>& v) {
+          if (v.size() != 3) {
+            throw std::runtime_error(
+                "invalid number of parameters (3 expected)");
+          }
+          try {
+            return std::make_tuple(str_to_int<index_t>(v[0]),
+                                   str_to_int<index_t>(v[1]),
+                                   str_to_scalar<scalar_t>(v[2]));
+          } catch (...) {
+            throw std::runtime_error("invalid parameter");
+          }
+        });
+  }
+}
+
+/**
+ * @fn get_syr_params
+ * @brief Returns a vector containing the syr, syr2 and spr benchmark
+ * parameters, either read from a file according to the command-line args, or
+ * the default ones.
+ */
+template <typename scalar_t>
+static inline std::vector<syr_param_t<scalar_t>> get_syr_params(Args& args) {
+  if (args.csv_param.empty()) {
+    warning_no_csv();
+    std::vector<syr_param_t<scalar_t>> syr_default;
+    constexpr index_t dmin = 64, dmax = 1024;
+    for (char uplo : {'u', 'l'}) {
+      for (index_t n = dmin; n <= dmax; n *= 2) {
+        syr_default.push_back(std::make_tuple(uplo, n, scalar_t{1}));
+      }
+    }
+    return syr_default;
+  } else {
+    return parse_csv_file<syr_param_t<scalar_t>>(
+        args.csv_param, [&](std::vector<std::string>& v) {
+          if (v.size() != 3) {
+            throw std::runtime_error(
+                "invalid number of parameters (3 expected)");
+          }
+          try {
+            return std::make_tuple(v[0][0], str_to_int<index_t>(v[1]),
+                                   str_to_scalar<scalar_t>(v[2]));
+          } catch (...) {
+            throw std::runtime_error("invalid parameter");
+          }
+        });
+  }
+}
+
+/**
+ * @fn get_symv_params
+ * @brief Returns a vector containing the symv and spmv benchmark parameters,
+ * either read from a file according to the command-line args, or the default
+ * ones.
+ */
+template <typename scalar_t>
+static inline std::vector<symv_param_t<scalar_t>> get_symv_params(Args& args) {
+  if (args.csv_param.empty()) {
+    warning_no_csv();
+    std::vector<symv_param_t<scalar_t>> symv_default;
+    constexpr index_t dmin = 64, dmax = 1024;
+    for (char uplo : {'u', 'l'}) {
+      for (index_t n = dmin; n <= dmax; n *= 2) {
+        symv_default.push_back(
+            std::make_tuple(uplo, n, scalar_t{1}, scalar_t{0}));
+      }
+    }
+    return symv_default;
+  } else {
+    return parse_csv_file<symv_param_t<scalar_t>>(
+        args.csv_param, [&](std::vector<std::string>& v) {
+          if (v.size() != 4) {
+            throw std::runtime_error(
+                "invalid number of parameters (4 expected)");
+          }
+          try {
+            return std::make_tuple(v[0][0], str_to_int<index_t>(v[1]),
+                                   str_to_scalar<scalar_t>(v[2]),
+                                   str_to_scalar<scalar_t>(v[3]));
+          } catch (...) {
+            throw std::runtime_error("invalid parameter");
+          }
+        });
+  }
+}
+
+/**
+ * @fn get_sbmv_params
+ * @brief Returns a vector containing the sbmv benchmark parameters, either
+ * read from a file according to the command-line args, or the default ones.
+ */
+template <typename scalar_t>
+static inline std::vector<sbmv_param_t<scalar_t>> get_sbmv_params(Args& args) {
+  if (args.csv_param.empty()) {
+    warning_no_csv();
+    std::vector<sbmv_param_t<scalar_t>> sbmv_default;
+    constexpr index_t dmin = 64, dmax = 1024;
+    constexpr index_t kmin = 1;
+    for (char uplo : {'u', 'l'}) {
+      for (index_t n = dmin; n <= dmax; n *= 2) {
+        for (index_t k = kmin; k <= n / 4; k *= 4) {
+          sbmv_default.push_back(
+              std::make_tuple(uplo, n, k, scalar_t{1}, scalar_t{0}));
+        }
+      }
+    }
+    return sbmv_default;
+  } else {
+    return parse_csv_file<sbmv_param_t<scalar_t>>(
+        args.csv_param, [&](std::vector<std::string>& v) {
+          if (v.size() != 5) {
+            throw std::runtime_error(
+                "invalid number of parameters (5 expected)");
+          }
+          try {
+            return std::make_tuple(v[0][0], str_to_int<index_t>(v[1]),
+                                   str_to_int<index_t>(v[2]),
+                                   str_to_scalar<scalar_t>(v[3]),
+                                   str_to_scalar<scalar_t>(v[4]));
+          } catch (...) {
+            throw std::runtime_error("invalid parameter");
+          }
+        });
+  }
+}
+
 /**
  * @fn get_type_name
  * @brief Returns a string with the given type. The C++ specification doesn't
@@ -568,6 +955,25 @@ static inline void fill_trsm_matrix(std::vector<scalar_t>& A, size_t k,
   }
 }
 
+/**
+ * @fn to_row_major
+ * @brief Copies a rows x cols column-major matrix with leading dimension ld to
+ * row-major storage with leading dimension row_ld, the elements outside the
+ * matrix being set to zero.
+ */
+template <typename scalar_t>
+static inline std::vector<scalar_t> to_row_major(
+    const std::vector<scalar_t>& A, size_t rows, size_t cols, size_t ld,
+    size_t row_ld) {
+  std::vector<scalar_t> row_major(rows * row_ld, scalar_t{0});
+  for (size_t i = 0; i < rows; ++i) {
+    for (size_t j = 0; j < cols; ++j) {
+      row_major[i * row_ld + j] = A[i + j * ld];
+    }
+  }
+  return row_major;
+}
+
 /**
  * @fn const_data
  * @brief Generates a vector of constant values, of a given length.
@@ -702,6 +1108,13 @@ static inline void calc_avg_counters(benchmark::State& state) {
       state.counters["total_event_time"] / state.iterations();
   state.counters["avg_overall_time"] =
       state.counters["total_overall_time"] / state.iterations();
+  // Only reported by the benchmarks that time the submission separately
+  if (state.counters.find("total_enqueue_time") != state.counters.end()) {
+    state.counters["avg_enqueue_time"] =
+        state.counters["total_enqueue_time"] / state.iterations();
+    state.counters["calls_per_second"] =
+        1e9 / state.counters["avg_overall_time"];
+  }
 }
 
 }  // namespace utils
@@ -288,6 +288,72 @@ void symv(const char *uplo, const int n, const scalar_t alpha,
   func(CblasColMajor, c_uplo(*uplo), n, alpha, a, lda, x, incX, beta, y, incY);
 }
 
+template <typename scalar_t>
+void sbmv(const char *uplo, const int n, const int k, const scalar_t alpha,
+          const scalar_t *a, const int lda, const scalar_t *x, const int incX,
+          const scalar_t beta, scalar_t *y, const int incY) {
+  auto func = blas_system_function<scalar_t>(&cblas_ssbmv, &cblas_dsbmv);
+  func(CblasColMajor, c_uplo(*uplo), n, k, alpha, a, lda, x, incX, beta, y,
+       incY);
+}
+
+template <typename scalar_t>
+void spmv(const char *uplo, const int n, const scalar_t alpha,
+          const scalar_t *ap, const scalar_t *x, const int incX,
+          const scalar_t beta, scalar_t *y, const int incY) {
+  auto func = blas_system_function<scalar_t>(&cblas_sspmv, &cblas_dspmv);
+  func(CblasColMajor, c_uplo(*uplo), n, alpha, ap, x, incX, beta, y, incY);
+}
+
+template <typename scalar_t>
+void spr(const char *uplo, const int n, const scalar_t alpha, const scalar_t *x,
+         const int incX, scalar_t *ap) {
+  auto func = blas_system_function<scalar_t>(&cblas_sspr, &cblas_dspr);
+  func(CblasColMajor, c_uplo(*uplo), n, alpha, x, incX, ap);
+}
+
+template <typename scalar_t>
+void tbmv(const char *uplo, const char *trans, const char *diag, const int n,
+          const int k, const scalar_t *a, const int lda, scalar_t *x,
+          const int incX) {
+  auto func = blas_system_function<scalar_t>(&cblas_stbmv, &cblas_dtbmv);
+  func(CblasColMajor, c_uplo(*uplo), c_trans(*trans), c_diag(*diag), n, k, a,
+       lda, x, incX);
+}
+
+template <typename scalar_t>
+void tpmv(const char *uplo, const char *trans, const char *diag, const int n,
+          const scalar_t *ap, scalar_t *x, const int incX) {
+  auto func = blas_system_function<scalar_t>(&cblas_stpmv, &cblas_dtpmv);
+  func(CblasColMajor, c_uplo(*uplo), c_trans(*trans), c_diag(*diag), n, ap, x,
+       incX);
+}
+
+template <typename scalar_t>
+void trsv(const char *uplo, const char *trans, const char *diag, const int n,
+          const scalar_t *a, const int lda, scalar_t *x, const int incX) {
+  auto func = blas_system_function<scalar_t>(&cblas_strsv, &cblas_dtrsv);
+  func(CblasColMajor, c_uplo(*uplo), c_trans(*trans), c_diag(*diag), n, a, lda,
+       x, incX);
+}
+
+template <typename scalar_t>
+void tbsv(const char *uplo, const char *trans, const char *diag, const int n,
+          const int k, const scalar_t *a, const int lda, scalar_t *x,
+          const int incX) {
+  auto func = blas_system_function<scalar_t>(&cblas_stbsv, &cblas_dtbsv);
+  func(CblasColMajor, c_uplo(*uplo), c_trans(*trans), c_diag(*diag), n, k, a,
+       lda, x, incX);
+}
+
+template <typename scalar_t>
+void tpsv(const char *uplo, const char *trans, const char *diag, const int n,
+          const scalar_t *ap, scalar_t *x, const int incX) {
+  auto func = blas_system_function<scalar_t>(&cblas_stpsv, &cblas_dtpsv);
+  func(CblasColMajor, c_uplo(*uplo), c_trans(*trans), c_diag(*diag), n, ap, x,
+       incX);
+}
+
 // =======
 // Level 3
 // =======
@@ -309,6 +375,41 @@ void trsm(const char *side, const char *uplo, const char *trans,
        c_diag(*diag), m, n, alpha, A, lda, B, ldb);
 }
 
+template <typename scalar_t>
+void syrk(const char *uplo, const char *trans, int n, int k, scalar_t alpha,
+          const scalar_t a[], int lda, scalar_t beta, scalar_t c[], int ldc) {
+  auto func = blas_system_function<scalar_t>(&cblas_ssyrk, &cblas_dsyrk);
+  func(CblasColMajor, c_uplo(*uplo), c_trans(*trans), n, k, alpha, a, lda,
+       beta, c, ldc);
+}
+
+template <typename scalar_t>
+void syr2k(const char *uplo, const char *trans, int n, int k, scalar_t alpha,
+           const scalar_t a[], int lda, const scalar_t b[], int ldb,
+           scalar_t beta, scalar_t c[], int ldc) {
+  auto func = blas_system_function<scalar_t>(&cblas_ssyr2k, &cblas_dsyr2k);
+  func(CblasColMajor, c_uplo(*uplo), c_trans(*trans), n, k, alpha, a, lda, b,
+       ldb, beta, c, ldc);
+}
+
+template <typename scalar_t>
+void trmm(const char *side, const char *uplo, const char *trans,
+          const char *diag, int m, int n, scalar_t alpha, const scalar_t A[],
+          int lda, scalar_t B[], int ldb) {
+  auto func = blas_system_function<scalar_t>(&cblas_strmm, &cblas_dtrmm);
+  func(CblasColMajor, c_side(*side), c_uplo(*uplo), c_trans(*trans),
+       c_diag(*diag), m, n, alpha, A, lda, B, ldb);
+}
+
+template <typename scalar_t>
+void symm(const char *side, const char *uplo, int m, int n, scalar_t alpha,
+          const scalar_t a[], int lda, const scalar_t b[], int ldb,
+          scalar_t beta, scalar_t c[], int ldc) {
+  auto func = blas_system_function<scalar_t>(&cblas_ssymm, &cblas_dsymm);
+  func(CblasColMajor, c_side(*side), c_uplo(*uplo), m, n, alpha, a, lda, b,
+       ldb, beta, c, ldc);
+}
+
 }  // namespace reference_blas
 
 #endif /* end of include guard: SYSTEM_REFERENCE_BLAS_HPP */
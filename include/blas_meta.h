@@ -27,6 +27,7 @@
 #define SYCL_BLAS_META_H
 
 #include <CL/sycl.hpp>
+#include <cstdint>
 #include <type_traits>
 #include <utility>
 
@@ -41,9 +42,42 @@ enum class access_layout { row_major, col_major };
 
 struct row_major {
   static constexpr bool is_col_major() { return false; }
+  template <typename index_t>
+  static constexpr index_t offset(index_t i, index_t j, index_t, index_t ld) {
+    return j + ld * i;
+  }
 };
 struct col_major {
   static constexpr bool is_col_major() { return true; }
+  template <typename index_t>
+  static constexpr index_t offset(index_t i, index_t j, index_t, index_t ld) {
+    return i + ld * j;
+  }
+};
+
+/**
+ * @brief Packed storage of the upper or the lower triangle of a square matrix
+ * of order n: the stored part of each column follows the previous one without
+ * padding, as the AP argument of the netlib packed routines. Only elements of
+ * the stored triangle can be evaluated and the leading dimension is unused.
+ * The offset of the column is computed in 64 bits, as j * (j + 1) overflows a
+ * 32-bit index once n is about 46k while the offset itself still fits.
+ */
+struct packed_upper {
+  static constexpr bool is_col_major() { return true; }
+  template <typename index_t>
+  static constexpr index_t offset(index_t i, index_t j, index_t, index_t) {
+    const std::int64_t col = j;
+    return i + static_cast<index_t>(col * (col + 1) / 2);
+  }
+};
+struct packed_lower {
+  static constexpr bool is_col_major() { return true; }
+  template <typename index_t>
+  static constexpr index_t offset(index_t i, index_t j, index_t n, index_t) {
+    const std::int64_t col = j;
+    return i + static_cast<index_t>(col * (2 * std::int64_t{n} - col - 1) / 2);
+  }
 };
 
 template <access_layout layout>
@@ -69,6 +103,22 @@ enum class transpose_type : char {
   Conjugate = 'c'
 };
 
+/**
+ * @enum tuning_target_t
+ * @brief The device classes the GEMM backends are tuned for. A build can
+ * contain several of them (see TUNING_TARGETS), the SB_Handle records the one
+ * matching its device.
+ */
+enum class tuning_target_t : int {
+  default_cpu = 0,
+  intel_gpu = 1,
+  amd_gpu = 2,
+  arm_gpu = 3,
+  power_vr = 4,
+  rcar = 5,
+  nvidia_gpu = 6
+};
+
 // choosing value at compile-time
 template <bool Conds, typename val_t, val_t value_one_t, val_t value_two_t>
 struct Choose {
@@ -99,6 +149,24 @@ struct RebindType {
   using type = RemoveAll<element_t> *;
 };
 
+/// \struct KernelContainer
+/// \brief Maps a container to the container type the kernels of the library
+/// are instantiated for. Containers that only differ in how the user may
+/// access them (e.g. read-only buffers) are converted so that they share the
+/// kernels of a single container type.
+/// \tparam container_t : the container given by the user
+template <typename container_t>
+struct KernelContainer {
+  using type = container_t;
+  static inline type get(container_t container) { return container; }
+};
+
+template <typename container_t>
+inline typename KernelContainer<container_t>::type as_kernel_container(
+    container_t container) {
+  return KernelContainer<container_t>::get(container);
+}
+
 template <typename index_t>
 inline bool is_power_of_2(index_t ind) {
   return ind > 0 && !(ind & (ind - 1));
@@ -131,6 +199,24 @@ static inline index_t get_power_of_two(index_t wGSize, bool rounUp) {
 
 #define SYCL_BLAS_INLINE SYCL_BLAS_ALWAYS_INLINE inline
 
+// SYCL 2020 specialization constants. Neither ComputeCpp nor hipSYCL provide
+// them, kernels relying on them fall back to ordinary kernel arguments there.
+#if defined(SYCL_LANGUAGE_VERSION) && SYCL_LANGUAGE_VERSION >= 202001 && \
+    !defined(__COMPUTECPP__) && !defined(__HIPSYCL__)
+#define SYCL_BLAS_SPEC_CONSTANTS 1
+#else
+#define SYCL_BLAS_SPEC_CONSTANTS 0
+#endif
+
+// SYCL 2020 sub-group collectives (reduce_over_group, permute_group_by_xor).
+// Reductions fall back to the work-group tree in local memory without them.
+#if defined(SYCL_LANGUAGE_VERSION) && SYCL_LANGUAGE_VERSION >= 202001 && \
+    !defined(__COMPUTECPP__) && !defined(__HIPSYCL__)
+#define SYCL_BLAS_SUBGROUPS 1
+#else
+#define SYCL_BLAS_SUBGROUPS 0
+#endif
+
 template <typename index_t>
 static SYCL_BLAS_INLINE index_t roundUp(index_t x, index_t y) {
   return ((x + y - 1) / y) * y;
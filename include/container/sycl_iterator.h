@@ -374,6 +374,23 @@ template <typename element_t, typename U>
 struct RebindType<element_t, BufferIterator<U>> {
   using type = BufferIterator<element_t>;
 };
+/*
+ * a read-only buffer iterator shares the kernels of BufferIterator<element_t>:
+ * the buffer is reinterpreted as non-const, which does not copy its data. The
+ * routines taking it only bind it through make_input_matrix_view and
+ * make_input_vector_view, i.e. with access::mode::read, so the caller's
+ * read-only buffer is never accessed for writing
+ */
+template <typename element_t>
+struct KernelContainer<BufferIterator<element_t const>> {
+  using type = BufferIterator<element_t>;
+  static inline type get(BufferIterator<element_t const> container) {
+    auto buff = container.get_buffer();
+    return type{buff.template reinterpret<element_t>(
+                    cl::sycl::range<1>(buff.get_count())),
+                container.get_offset()};
+  }
+};
 
 }  // end namespace blas
 
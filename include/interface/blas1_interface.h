@@ -25,6 +25,7 @@
 #ifndef SYCL_BLAS_BLAS1_INTERFACE_H
 #define SYCL_BLAS_BLAS1_INTERFACE_H
 #include "blas_meta.h"
+#include "sb_handle/counters.h"
 
 namespace blas {
 namespace internal {
@@ -202,6 +203,75 @@ typename sb_handle_t::event_t _rot(sb_handle_t &sb_handle, index_t _N,
                                    container_1_t _vy, increment_t _incy,
                                    element_t _cos, element_t _sin);
 
+/**
+ * \brief Applies a batch of independent plane rotations to a column major
+ * matrix A in one kernel, e.g. for the sweeps of a Jacobi eigenvalue solver.
+ * Rotation k acts on the rows (side 'l') or the columns (side 'r')
+ * _pairs[2k] and _pairs[2k + 1] of A as rot does on x and y, with the cosine
+ * _c[k] and the sine _s[k]. The pairs of the batch must be disjoint.
+ * @tparam sb_handle_t SB_Handle type
+ * @tparam container_0_t Buffer Iterator
+ * @tparam container_1_t Buffer Iterator
+ * @tparam container_2_t Buffer Iterator
+ * @tparam container_3_t Buffer Iterator of an integer type
+ * @tparam index_t Index type
+ * @param sb_handle SB_Handle
+ * @param _side 'l' to rotate pairs of rows, 'r' to rotate pairs of columns
+ * @param _M Number of rows of A
+ * @param _N Number of columns of A
+ * @param _batch_size Number of rotations
+ * @param _mA[in, out] Buffer holding the matrix A
+ * @param _lda Leading dimension of A
+ * @param _c Buffer holding the cosines of the rotations
+ * @param _s Buffer holding the sines of the rotations
+ * @param _pairs Buffer holding the indices of the rows or columns of each
+ * rotation
+ * @return Vector of events to wait for.
+ */
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename container_3_t, typename index_t>
+typename sb_handle_t::event_t _rot_batched(
+    sb_handle_t &sb_handle, char _side, index_t _M, index_t _N,
+    index_t _batch_size, container_0_t _mA, index_t _lda, container_1_t _c,
+    container_2_t _s, container_3_t _pairs);
+
+/**
+ * \brief Applies a sequence of plane rotations to a column major matrix A, as
+ * LAPACK's lasr does. With z the number of rows (side 'l') or columns (side
+ * 'r') of A, rotation j for j in [0, z - 1) acts on the rows or columns
+ * (j, j + 1) for the variable pivot 'v', (0, j + 1) for the top pivot 't' and
+ * (j, z - 1) for the bottom pivot 'b', as rot does on x and y with the cosine
+ * _c[j] and the sine _s[j]. The rotations are applied in increasing order of
+ * j for the forward direction 'f' and in decreasing order for the backward
+ * direction 'b'.
+ *
+ * Each work item applies the whole sequence to one column (side 'l') or one
+ * row (side 'r') of A, streamed through local memory in tiles.
+ * @tparam sb_handle_t SB_Handle type
+ * @tparam container_0_t Buffer Iterator
+ * @tparam container_1_t Buffer Iterator
+ * @tparam container_2_t Buffer Iterator
+ * @tparam index_t Index type
+ * @param sb_handle SB_Handle
+ * @param _side 'l' to combine rows, 'r' to combine columns
+ * @param _pivot 'v', 't' or 'b'
+ * @param _direct 'f' or 'b'
+ * @param _M Number of rows of A
+ * @param _N Number of columns of A
+ * @param _c Buffer holding the z - 1 cosines
+ * @param _s Buffer holding the z - 1 sines
+ * @param _mA[in, out] Buffer holding the matrix A
+ * @param _lda Leading dimension of A
+ * @return Vector of events to wait for.
+ */
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename index_t>
+typename sb_handle_t::event_t _lasr(sb_handle_t &sb_handle, char _side,
+                                    char _pivot, char _direct, index_t _M,
+                                    index_t _N, container_0_t _c,
+                                    container_1_t _s, container_2_t _mA,
+                                    index_t _lda);
+
 /**
  * @brief Performs a modified Givens rotation of points.
  * Given two vectors x and y and a modified Givens transformation matrix, each
@@ -276,11 +346,71 @@ typename sb_handle_t::event_t _rotm(sb_handle_t &sb_handle, index_t _N,
  */
 template <typename sb_handle_t, typename container_0_t, typename container_1_t,
           typename container_2_t, typename container_3_t,
-          typename container_4_t>
+          typename container_4_t,
+          typename std::enable_if<!is_sycl_scalar<container_0_t>::value,
+                                  bool>::type = true>
 typename sb_handle_t::event_t _rotmg(sb_handle_t &sb_handle, container_0_t _d1,
                                      container_1_t _d2, container_2_t _x1,
                                      container_3_t _y1, container_4_t _param);
 
+/**
+ * \brief Synchronous version of rotmg, computed on the host without any
+ * device work.
+ * @tparam sb_handle_t SB_Handle type
+ * @tparam scalar_t Scalar type
+ * @param sb_handle SB_Handle
+ * @param d1[in,out] On entry, scaling factor for the x-coordinate. On exit,
+ * the re-scaled d1.
+ * @param d2[in,out] On entry, scaling factor for the y-coordinate. On exit,
+ * the re-scaled d2.
+ * @param x1[in,out] On entry, x-coordinate. On exit, the re-scaled x1.
+ * @param y1[in] y-coordinate of the point.
+ * @param param[out] Array of 5 elements with the following layout: [flag,
+ * h11, h21, h12, h22].
+ */
+template <
+    typename sb_handle_t, typename scalar_t,
+    typename std::enable_if<is_sycl_scalar<scalar_t>::value, bool>::type = true>
+void _rotmg(sb_handle_t &sb_handle, scalar_t &d1, scalar_t &d2, scalar_t &x1,
+            scalar_t y1, scalar_t *param);
+
+/**
+ * \brief Computes N modified Givens transformations at once on the device,
+ * e.g. for the sweeps of a QR or SVD. The i-th transformation reads the i-th
+ * elements of d1, d2, x1 and y1 and writes its parameters [flag, h11, h21,
+ * h12, h22] at i * _param_stride in param.
+ * @tparam sb_handle_t SB_Handle type
+ * @tparam container_0_t Buffer Iterator
+ * @tparam container_1_t Buffer Iterator
+ * @tparam container_2_t Buffer Iterator
+ * @tparam container_3_t Buffer Iterator
+ * @tparam container_4_t Buffer Iterator
+ * @tparam index_t Index type
+ * @tparam increment_t Increment type
+ * @param sb_handle SB_Handle
+ * @param _N Number of transformations.
+ * @param _d1[in,out] Buffer holding the scaling factors for the x-coordinates
+ * @param _incd1 Stride of d1
+ * @param _d2[in,out] Buffer holding the scaling factors for the y-coordinates
+ * @param _incd2 Stride of d2
+ * @param _x1[in,out] Buffer holding the x-coordinates
+ * @param _incx1 Stride of x1
+ * @param _y1[in] Buffer holding the y-coordinates
+ * @param _incy1 Stride of y1
+ * @param _param[out] Buffer holding the parameters of the transformations
+ * @param _param_stride Distance between the parameters of two consecutive
+ * transformations, at least 5
+ * @return Vector of events to wait for.
+ */
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename container_3_t,
+          typename container_4_t, typename index_t, typename increment_t>
+typename sb_handle_t::event_t _rotmg_batched(
+    sb_handle_t &sb_handle, index_t _N, container_0_t _d1, increment_t _incd1,
+    container_1_t _d2, increment_t _incd2, container_2_t _x1,
+    increment_t _incx1, container_3_t _y1, increment_t _incy1,
+    container_4_t _param, index_t _param_stride);
+
 /**
  * \brief Given the Cartesian coordinates (a, b) of a point, the rotg routines
  * return the parameters c, s, r, and z associated with the Givens rotation.
@@ -307,7 +437,8 @@ typename sb_handle_t::event_t _rotg(sb_handle_t &sb_handle, container_0_t a,
                                     container_3_t s);
 
 /**
- * \brief Synchronous version of rotg.
+ * \brief Synchronous version of rotg, computed on the host without any
+ * device work.
  * Given the Cartesian coordinates (a, b) of a point, the rotg routines
  * return the parameters c, s, r, and z associated with the Givens rotation.
  * @tparam sb_handle_t SB_Handle type
@@ -324,6 +455,39 @@ template <
 void _rotg(sb_handle_t &sb_handle, scalar_t &a, scalar_t &b, scalar_t &c,
            scalar_t &s);
 
+/**
+ * \brief Computes N Givens rotations at once on the device, e.g. for the
+ * sweeps of a QR or SVD. The i-th rotation reads and writes the i-th elements
+ * of a, b, c and s as rotg does.
+ * @tparam sb_handle_t SB_Handle type
+ * @tparam container_0_t Buffer Iterator
+ * @tparam container_1_t Buffer Iterator
+ * @tparam container_2_t Buffer Iterator
+ * @tparam container_3_t Buffer Iterator
+ * @tparam index_t Index type
+ * @tparam increment_t Increment type
+ * @param sb_handle SB_Handle
+ * @param _N Number of rotations.
+ * @param a[in, out] On entry, buffer holding the x-coordinates of the points.
+ * On exit, the scalars r.
+ * @param _inca Stride of a
+ * @param b[in, out] On entry, buffer holding the y-coordinates of the points.
+ * On exit, the scalars z.
+ * @param _incb Stride of b
+ * @param c[out] Buffer holding the parameters c.
+ * @param _incc Stride of c
+ * @param s[out] Buffer holding the parameters s.
+ * @param _incs Stride of s
+ * @return Vector of events to wait for.
+ */
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename container_3_t, typename index_t,
+          typename increment_t>
+typename sb_handle_t::event_t _rotg_batched(
+    sb_handle_t &sb_handle, index_t _N, container_0_t a, increment_t _inca,
+    container_1_t b, increment_t _incb, container_2_t c, increment_t _incc,
+    container_3_t s, increment_t _incs);
+
 /**
  * \brief Computes the inner product of two vectors with double precision
  * accumulation (synchronous version that returns the result directly)
@@ -426,6 +590,7 @@ typename sb_handle_t::event_t _axpy(sb_handle_t &sb_handle, index_t _N,
                                     element_t _alpha, container_0_t _vx,
                                     increment_t _incx, container_1_t _vy,
                                     increment_t _incy) {
+  internal::CounterScope counter_scope(sb_handle, "axpy");
   return internal::_axpy(sb_handle, _N, _alpha, _vx, _incx, _vy, _incy);
 }
 
@@ -443,6 +608,7 @@ template <typename sb_handle_t, typename index_t, typename container_0_t,
 typename sb_handle_t::event_t _copy(sb_handle_t &sb_handle, index_t _N,
                                     container_0_t _vx, increment_t _incx,
                                     container_1_t _vy, increment_t _incy) {
+  internal::CounterScope counter_scope(sb_handle, "copy");
   return internal::_copy(sb_handle, _N, _vx, _incx, _vy, _incy);
 }
 
@@ -470,6 +636,7 @@ typename sb_handle_t::event_t _dot(sb_handle_t &sb_handle, index_t _N,
                                    container_0_t _vx, increment_t _incx,
                                    container_1_t _vy, increment_t _incy,
                                    container_2_t _rs) {
+  internal::CounterScope counter_scope(sb_handle, "dot");
   return internal::_dot(sb_handle, _N, _vx, _incx, _vy, _incy, _rs);
 }
 
@@ -499,6 +666,7 @@ typename sb_handle_t::event_t _sdsdot(sb_handle_t &sb_handle, index_t _N,
                                       float sb, container_0_t _vx,
                                       increment_t _incx, container_1_t _vy,
                                       increment_t _incy, container_2_t _rs) {
+  internal::CounterScope counter_scope(sb_handle, "sdsdot");
   return internal::_sdsdot(sb_handle, _N, sb, _vx, _incx, _vy, _incy, _rs);
 }
 
@@ -513,6 +681,7 @@ template <typename sb_handle_t, typename container_0_t, typename container_1_t,
 typename sb_handle_t::event_t _asum(sb_handle_t &sb_handle, index_t _N,
                                     container_0_t _vx, increment_t _incx,
                                     container_1_t _rs) {
+  internal::CounterScope counter_scope(sb_handle, "asum");
   return internal::_asum(sb_handle, _N, _vx, _incx, _rs);
 }
 
@@ -526,6 +695,7 @@ template <typename sb_handle_t, typename container_t, typename ContainerI,
 typename sb_handle_t::event_t _iamax(sb_handle_t &sb_handle, index_t _N,
                                      container_t _vx, increment_t _incx,
                                      ContainerI _rs) {
+  internal::CounterScope counter_scope(sb_handle, "iamax");
   return internal::_iamax(sb_handle, _N, _vx, _incx, _rs);
 }
 
@@ -539,6 +709,7 @@ template <typename sb_handle_t, typename container_t, typename ContainerI,
 typename sb_handle_t::event_t _iamin(sb_handle_t &sb_handle, index_t _N,
                                      container_t _vx, increment_t _incx,
                                      ContainerI _rs) {
+  internal::CounterScope counter_scope(sb_handle, "iamin");
   return internal::_iamin(sb_handle, _N, _vx, _incx, _rs);
 }
 
@@ -556,6 +727,7 @@ template <typename sb_handle_t, typename container_0_t, typename container_1_t,
 typename sb_handle_t::event_t _swap(sb_handle_t &sb_handle, index_t _N,
                                     container_0_t _vx, increment_t _incx,
                                     container_1_t _vy, increment_t _incy) {
+  internal::CounterScope counter_scope(sb_handle, "swap");
   return internal::_swap(sb_handle, _N, _vx, _incx, _vy, _incy);
 }
 
@@ -570,6 +742,7 @@ template <typename sb_handle_t, typename element_t, typename container_0_t,
 typename sb_handle_t::event_t _scal(sb_handle_t &sb_handle, index_t _N,
                                     element_t _alpha, container_0_t _vx,
                                     increment_t _incx) {
+  internal::CounterScope counter_scope(sb_handle, "scal");
   return internal::_scal(sb_handle, _N, _alpha, _vx, _incx);
 }
 
@@ -584,6 +757,7 @@ template <typename sb_handle_t, typename container_0_t, typename container_1_t,
 typename sb_handle_t::event_t _nrm2(sb_handle_t &sb_handle, index_t _N,
                                     container_0_t _vx, increment_t _incx,
                                     container_1_t _rs) {
+  internal::CounterScope counter_scope(sb_handle, "nrm2");
   return internal::_nrm2(sb_handle, _N, _vx, _incx, _rs);
 }
 
@@ -607,9 +781,87 @@ typename sb_handle_t::event_t _rot(sb_handle_t &sb_handle, index_t _N,
                                    container_0_t _vx, increment_t _incx,
                                    container_1_t _vy, increment_t _incy,
                                    element_t _cos, element_t _sin) {
+  internal::CounterScope counter_scope(sb_handle, "rot");
   return internal::_rot(sb_handle, _N, _vx, _incx, _vy, _incy, _cos, _sin);
 }
 
+/**
+ * \brief Applies a batch of independent plane rotations to a column major
+ * matrix A in one kernel, e.g. for the sweeps of a Jacobi eigenvalue solver.
+ * Rotation k acts on the rows (side 'l') or the columns (side 'r')
+ * _pairs[2k] and _pairs[2k + 1] of A as rot does on x and y, with the cosine
+ * _c[k] and the sine _s[k]. The pairs of the batch must be disjoint.
+ * @tparam sb_handle_t SB_Handle type
+ * @tparam container_0_t Buffer Iterator
+ * @tparam container_1_t Buffer Iterator
+ * @tparam container_2_t Buffer Iterator
+ * @tparam container_3_t Buffer Iterator of an integer type
+ * @tparam index_t Index type
+ * @param sb_handle SB_Handle
+ * @param _side 'l' to rotate pairs of rows, 'r' to rotate pairs of columns
+ * @param _M Number of rows of A
+ * @param _N Number of columns of A
+ * @param _batch_size Number of rotations
+ * @param _mA[in, out] Buffer holding the matrix A
+ * @param _lda Leading dimension of A
+ * @param _c Buffer holding the cosines of the rotations
+ * @param _s Buffer holding the sines of the rotations
+ * @param _pairs Buffer holding the indices of the rows or columns of each
+ * rotation
+ * @return Vector of events to wait for.
+ */
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename container_3_t, typename index_t>
+typename sb_handle_t::event_t _rot_batched(
+    sb_handle_t &sb_handle, char _side, index_t _M, index_t _N,
+    index_t _batch_size, container_0_t _mA, index_t _lda, container_1_t _c,
+    container_2_t _s, container_3_t _pairs) {
+  internal::CounterScope counter_scope(sb_handle, "rot_batched");
+  return internal::_rot_batched(sb_handle, _side, _M, _N, _batch_size, _mA,
+                                _lda, _c, _s, _pairs);
+}
+
+/**
+ * \brief Applies a sequence of plane rotations to a column major matrix A, as
+ * LAPACK's lasr does. With z the number of rows (side 'l') or columns (side
+ * 'r') of A, rotation j for j in [0, z - 1) acts on the rows or columns
+ * (j, j + 1) for the variable pivot 'v', (0, j + 1) for the top pivot 't' and
+ * (j, z - 1) for the bottom pivot 'b', as rot does on x and y with the cosine
+ * _c[j] and the sine _s[j]. The rotations are applied in increasing order of
+ * j for the forward direction 'f' and in decreasing order for the backward
+ * direction 'b'.
+ *
+ * Each work item applies the whole sequence to one column (side 'l') or one
+ * row (side 'r') of A, streamed through local memory in tiles.
+ * @tparam sb_handle_t SB_Handle type
+ * @tparam container_0_t Buffer Iterator
+ * @tparam container_1_t Buffer Iterator
+ * @tparam container_2_t Buffer Iterator
+ * @tparam index_t Index type
+ * @param sb_handle SB_Handle
+ * @param _side 'l' to combine rows, 'r' to combine columns
+ * @param _pivot 'v', 't' or 'b'
+ * @param _direct 'f' or 'b'
+ * @param _M Number of rows of A
+ * @param _N Number of columns of A
+ * @param _c Buffer holding the z - 1 cosines
+ * @param _s Buffer holding the z - 1 sines
+ * @param _mA[in, out] Buffer holding the matrix A
+ * @param _lda Leading dimension of A
+ * @return Vector of events to wait for.
+ */
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename index_t>
+typename sb_handle_t::event_t _lasr(sb_handle_t &sb_handle, char _side,
+                                    char _pivot, char _direct, index_t _M,
+                                    index_t _N, container_0_t _c,
+                                    container_1_t _s, container_2_t _mA,
+                                    index_t _lda) {
+  internal::CounterScope counter_scope(sb_handle, "lasr");
+  return internal::_lasr(sb_handle, _side, _pivot, _direct, _M, _N, _c, _s,
+                         _mA, _lda);
+}
+
 /**
  * @brief Performs a modified Givens rotation of points.
  * Given two vectors x and y and a modified Givens transformation matrix, each
@@ -648,6 +900,7 @@ typename sb_handle_t::event_t _rotm(sb_handle_t &sb_handle, index_t _N,
                                     container_0_t _vx, increment_t _incx,
                                     container_1_t _vy, increment_t _incy,
                                     container_2_t _param) {
+  internal::CounterScope counter_scope(sb_handle, "rotm");
   return internal::_rotm(sb_handle, _N, _vx, _incx, _vy, _incy, _param);
 }
 
@@ -686,13 +939,81 @@ typename sb_handle_t::event_t _rotm(sb_handle_t &sb_handle, index_t _N,
  */
 template <typename sb_handle_t, typename container_0_t, typename container_1_t,
           typename container_2_t, typename container_3_t,
-          typename container_4_t>
+          typename container_4_t,
+          typename std::enable_if<!is_sycl_scalar<container_0_t>::value,
+                                  bool>::type = true>
 typename sb_handle_t::event_t _rotmg(sb_handle_t &sb_handle, container_0_t _d1,
                                      container_1_t _d2, container_2_t _x1,
                                      container_3_t _y1, container_4_t _param) {
+  internal::CounterScope counter_scope(sb_handle, "rotmg");
   return internal::_rotmg(sb_handle, _d1, _d2, _x1, _y1, _param);
 }
 
+/**
+ * \brief Synchronous version of rotmg, computed on the host without any
+ * device work.
+ * @tparam sb_handle_t SB_Handle type
+ * @tparam scalar_t Scalar type
+ * @param sb_handle SB_Handle
+ * @param d1[in,out] On entry, scaling factor for the x-coordinate. On exit,
+ * the re-scaled d1.
+ * @param d2[in,out] On entry, scaling factor for the y-coordinate. On exit,
+ * the re-scaled d2.
+ * @param x1[in,out] On entry, x-coordinate. On exit, the re-scaled x1.
+ * @param y1[in] y-coordinate of the point.
+ * @param param[out] Array of 5 elements with the following layout: [flag,
+ * h11, h21, h12, h22].
+ */
+template <
+    typename sb_handle_t, typename scalar_t,
+    typename std::enable_if<is_sycl_scalar<scalar_t>::value, bool>::type = true>
+void _rotmg(sb_handle_t &sb_handle, scalar_t &d1, scalar_t &d2, scalar_t &x1,
+            scalar_t y1, scalar_t *param) {
+  internal::CounterScope counter_scope(sb_handle, "rotmg");
+  internal::_rotmg(sb_handle, d1, d2, x1, y1, param);
+}
+
+/**
+ * \brief Computes N modified Givens transformations at once on the device,
+ * e.g. for the sweeps of a QR or SVD. The i-th transformation reads the i-th
+ * elements of d1, d2, x1 and y1 and writes its parameters [flag, h11, h21,
+ * h12, h22] at i * _param_stride in param.
+ * @tparam sb_handle_t SB_Handle type
+ * @tparam container_0_t Buffer Iterator
+ * @tparam container_1_t Buffer Iterator
+ * @tparam container_2_t Buffer Iterator
+ * @tparam container_3_t Buffer Iterator
+ * @tparam container_4_t Buffer Iterator
+ * @tparam index_t Index type
+ * @tparam increment_t Increment type
+ * @param sb_handle SB_Handle
+ * @param _N Number of transformations.
+ * @param _d1[in,out] Buffer holding the scaling factors for the x-coordinates
+ * @param _incd1 Stride of d1
+ * @param _d2[in,out] Buffer holding the scaling factors for the y-coordinates
+ * @param _incd2 Stride of d2
+ * @param _x1[in,out] Buffer holding the x-coordinates
+ * @param _incx1 Stride of x1
+ * @param _y1[in] Buffer holding the y-coordinates
+ * @param _incy1 Stride of y1
+ * @param _param[out] Buffer holding the parameters of the transformations
+ * @param _param_stride Distance between the parameters of two consecutive
+ * transformations, at least 5
+ * @return Vector of events to wait for.
+ */
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename container_3_t,
+          typename container_4_t, typename index_t, typename increment_t>
+typename sb_handle_t::event_t _rotmg_batched(
+    sb_handle_t &sb_handle, index_t _N, container_0_t _d1, increment_t _incd1,
+    container_1_t _d2, increment_t _incd2, container_2_t _x1,
+    increment_t _incx1, container_3_t _y1, increment_t _incy1,
+    container_4_t _param, index_t _param_stride) {
+  internal::CounterScope counter_scope(sb_handle, "rotmg_batched");
+  return internal::_rotmg_batched(sb_handle, _N, _d1, _incd1, _d2, _incd2, _x1,
+                                  _incx1, _y1, _incy1, _param, _param_stride);
+}
+
 /**
  * \brief Given the Cartesian coordinates (a, b) of a point, the rotg routines
  * return the parameters c, s, r, and z associated with the Givens rotation.
@@ -717,11 +1038,13 @@ template <typename sb_handle_t, typename container_0_t, typename container_1_t,
 typename sb_handle_t::event_t _rotg(sb_handle_t &sb_handle, container_0_t a,
                                     container_1_t b, container_2_t c,
                                     container_3_t s) {
+  internal::CounterScope counter_scope(sb_handle, "rotg");
   return internal::_rotg(sb_handle, a, b, c, s);
 }
 
 /**
- * \brief Synchronous version of rotg.
+ * \brief Synchronous version of rotg, computed on the host without any
+ * device work.
  * Given the Cartesian coordinates (a, b) of a point, the rotg routines
  * return the parameters c, s, r, and z associated with the Givens rotation.
  * @tparam sb_handle_t SB_Handle type
@@ -737,9 +1060,47 @@ template <
     typename std::enable_if<is_sycl_scalar<scalar_t>::value, bool>::type = true>
 void _rotg(sb_handle_t &sb_handle, scalar_t &a, scalar_t &b, scalar_t &c,
            scalar_t &s) {
+  internal::CounterScope counter_scope(sb_handle, "rotg");
   internal::_rotg(sb_handle, a, b, c, s);
 }
 
+/**
+ * \brief Computes N Givens rotations at once on the device, e.g. for the
+ * sweeps of a QR or SVD. The i-th rotation reads and writes the i-th elements
+ * of a, b, c and s as rotg does.
+ * @tparam sb_handle_t SB_Handle type
+ * @tparam container_0_t Buffer Iterator
+ * @tparam container_1_t Buffer Iterator
+ * @tparam container_2_t Buffer Iterator
+ * @tparam container_3_t Buffer Iterator
+ * @tparam index_t Index type
+ * @tparam increment_t Increment type
+ * @param sb_handle SB_Handle
+ * @param _N Number of rotations.
+ * @param a[in, out] On entry, buffer holding the x-coordinates of the points.
+ * On exit, the scalars r.
+ * @param _inca Stride of a
+ * @param b[in, out] On entry, buffer holding the y-coordinates of the points.
+ * On exit, the scalars z.
+ * @param _incb Stride of b
+ * @param c[out] Buffer holding the parameters c.
+ * @param _incc Stride of c
+ * @param s[out] Buffer holding the parameters s.
+ * @param _incs Stride of s
+ * @return Vector of events to wait for.
+ */
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename container_3_t, typename index_t,
+          typename increment_t>
+typename sb_handle_t::event_t _rotg_batched(
+    sb_handle_t &sb_handle, index_t _N, container_0_t a, increment_t _inca,
+    container_1_t b, increment_t _incb, container_2_t c, increment_t _incc,
+    container_3_t s, increment_t _incs) {
+  internal::CounterScope counter_scope(sb_handle, "rotg_batched");
+  return internal::_rotg_batched(sb_handle, _N, a, _inca, b, _incb, c, _incc, s,
+                                 _incs);
+}
+
 /**
  * \brief Computes the inner product of two vectors with double precision
  * accumulation (synchronous version that returns the result directly)
@@ -765,6 +1126,7 @@ typename ValueType<container_0_t>::type _dot(sb_handle_t &sb_handle, index_t _N,
                                              increment_t _incx,
                                              container_1_t _vy,
                                              increment_t _incy) {
+  internal::CounterScope counter_scope(sb_handle, "dot_return");
   return internal::_dot(sb_handle, _N, _vx, _incx, _vy, _incy);
 }
 
@@ -793,6 +1155,7 @@ template <typename sb_handle_t, typename container_0_t, typename container_1_t,
 typename ValueType<container_0_t>::type _sdsdot(
     sb_handle_t &sb_handle, index_t _N, float sb, container_0_t _vx,
     increment_t _incx, container_1_t _vy, increment_t _incy) {
+  internal::CounterScope counter_scope(sb_handle, "sdsdot_return");
   return internal::_sdsdot(sb_handle, _N, sb, _vx, _incx, _vy, _incy);
 }
 
@@ -805,6 +1168,7 @@ template <typename sb_handle_t, typename container_t, typename index_t,
           typename increment_t>
 index_t _iamax(sb_handle_t &sb_handle, index_t _N, container_t _vx,
                increment_t _incx) {
+  internal::CounterScope counter_scope(sb_handle, "iamax_return");
   return internal::_iamax(sb_handle, _N, _vx, _incx);
 }
 
@@ -817,6 +1181,7 @@ template <typename sb_handle_t, typename container_t, typename index_t,
           typename increment_t>
 index_t _iamin(sb_handle_t &sb_handle, index_t _N, container_t _vx,
                increment_t _incx) {
+  internal::CounterScope counter_scope(sb_handle, "iamin_return");
   return internal::_iamin(sb_handle, _N, _vx, _incx);
 }
 
@@ -832,6 +1197,7 @@ template <typename sb_handle_t, typename container_t, typename index_t,
 typename ValueType<container_t>::type _asum(sb_handle_t &sb_handle, index_t _N,
                                             container_t _vx,
                                             increment_t _incx) {
+  internal::CounterScope counter_scope(sb_handle, "asum_return");
   return internal::_asum(sb_handle, _N, _vx, _incx);
 }
 
@@ -847,6 +1213,7 @@ template <typename sb_handle_t, typename container_t, typename index_t,
 typename ValueType<container_t>::type _nrm2(sb_handle_t &sb_handle, index_t _N,
                                             container_t _vx,
                                             increment_t _incx) {
+  internal::CounterScope counter_scope(sb_handle, "nrm2_return");
   return internal::_nrm2(sb_handle, _N, _vx, _incx);
 }
 
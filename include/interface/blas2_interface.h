@@ -27,6 +27,11 @@
 #define SYCL_BLAS_BLAS2_INTERFACE_H
 
 #include "operations/blas2_trees.h"
+#include "sb_handle/counters.h"
+#include "sb_handle/trace.h"
+
+#include <cctype>
+#include <stdexcept>
 namespace blas {
 namespace internal {
 /*!
@@ -80,6 +85,21 @@ typename SB_Handle::event_t _gemv_impl(SB_Handle& sb_handle, index_t _M,
                                        element_t _beta, container_t2 _vy,
                                        increment_t _incy);
 
+/*!
+ * @brief Prototype for the internal implementation of the GEMV operation on
+ * CPU devices. See documentation in the blas2_interface.hpp file for details.
+ */
+template <uint32_t block_size, uint32_t vector_size, transpose_type trn,
+          typename SB_Handle, typename index_t, typename element_t,
+          typename container_t0, typename container_t1, typename increment_t,
+          typename container_t2>
+typename SB_Handle::event_t _gemv_cpu_impl(SB_Handle& sb_handle, index_t _M,
+                                           index_t _N, element_t _alpha,
+                                           container_t0 _mA, index_t _lda,
+                                           container_t1 _vx, increment_t _incx,
+                                           element_t _beta, container_t2 _vy,
+                                           increment_t _incy);
+
 /*!
  @brief Generalised matrix vector product with a triangular symmetric matrix.
 
@@ -218,6 +238,35 @@ typename sb_handle_t::event_t _syr2(
     index_t _lda             // >max(1, _N) The first dimension of _mA
 );
 
+/*!
+ @brief Rank-k update of a rectangular matrix by k pairs of vectors.
+
+ Sum of k generalised vector products with a rectangular non-symmetric matrix,
+ i.e. computing the mathematical operation:
+
+ A = alpha*X*YT + A
+
+ where the k columns of X and Y are the vectors x and y of k calls to ger. The
+ update is made in a single pass over A, instead of one per pair of vectors.
+
+ */
+template <typename sb_handle_t, typename index_t, typename element_t,
+          typename container_0_t, typename container_1_t,
+          typename container_2_t>
+typename sb_handle_t::event_t _gerk(
+    sb_handle_t& sb_handle,  // sb_handle_t (sycl, parallel, serial, etc)
+    index_t _M,              // The rows of matrix A
+    index_t _N,              // The cols of matrix A
+    index_t _K,              // The number of pairs of vectors
+    element_t _alpha,        // Scalar alpha
+    container_0_t _mX,       // (_ldx, _K) The vectors x as columns
+    index_t _ldx,            // >max(1, _M) The first dimension of _mX
+    container_1_t _mY,       // (_ldy, _K) The vectors y as columns
+    index_t _ldy,            // >max(1, _N) The first dimension of _mY
+    container_2_t _mA,       // (_lda, _N) The output matrix
+    index_t _lda             // >max(1, _M) The first dimension of _mA
+);
+
 /**
  * @brief Generalised matrix vector product with band matrices.
  *
@@ -258,6 +307,264 @@ typename sb_handle_t::event_t _gbmv(sb_handle_t& sb_handle, char _trans,
                                     element_t _beta, container_2_t _vy,
                                     increment_t _incy);
 
+/**
+ * @brief Symmetric band matrix vector product followed by a sum.
+ *
+ * Matrix vector product with a symmetric band matrix, followed by a vector
+ * sum, i.e. computing the mathematical operation:
+ *
+ * y = alpha*A*x + beta*y
+ *
+ * See the netlib blas interface documentation for more details of the
+ * interface.
+ *
+ * @param sb_handle SB_handle
+ * @param _Uplo Whether the upper or the lower triangle of A is stored ('u',
+ *              'l')
+ * @param _N Order of A
+ * @param _K Number of A super-diagonals (and sub-diagonals)
+ * @param _alpha Scalar parameter alpha
+ * @param _mA Buffer (_lda, _N) containing the _Uplo triangle of A in the band
+ *            matrix format of gbmv, with _KL = 0 or _KU = 0
+ * @param _lda Leading dimension of _mA, at least (_K + 1)
+ * @param _vx Buffer containing x of at least (1+(_N-1)*abs(_incx)) elements
+ * @param _incx Increment for _vx (nonzero)
+ * @param _beta Scalar parameter beta
+ * @param _vy Buffer containing y of at least (1+(_N-1)*abs(_incy)) elements
+ * @param _incy Increment for _vy (nonzero)
+ */
+template <typename sb_handle_t, typename index_t, typename element_t,
+          typename container_0_t, typename container_1_t, typename increment_t,
+          typename container_2_t>
+typename sb_handle_t::event_t _sbmv(sb_handle_t& sb_handle, char _Uplo,
+                                    index_t _N, index_t _K, element_t _alpha,
+                                    container_0_t _mA, index_t _lda,
+                                    container_1_t _vx, increment_t _incx,
+                                    element_t _beta, container_2_t _vy,
+                                    increment_t _incy);
+
+/**
+ * @brief Triangular band matrix vector product.
+ *
+ * Matrix vector product with a triangular band matrix, i.e. computing the
+ * mathematical operation:
+ *
+ * x = op(A)*x
+ *
+ * See the netlib blas interface documentation for more details of the
+ * interface.
+ *
+ * @param sb_handle SB_handle
+ * @param _Uplo Whether A is upper or lower triangular ('u', 'l')
+ * @param _trans Transposition operation applied to A ('n', 't', 'c')
+ * @param _Diag Whether A is unit triangular ('u', 'n')
+ * @param _N Order of A
+ * @param _K Number of A super-diagonals (or sub-diagonals)
+ * @param _mA Buffer (_lda, _N) containing A in the band matrix format of
+ *            gbmv, with _KL = 0 or _KU = 0
+ * @param _lda Leading dimension of _mA, at least (_K + 1)
+ * @param _vx Buffer containing x of at least (1+(_N-1)*abs(_incx)) elements,
+ *            overwritten with the result
+ * @param _incx Increment for _vx (nonzero)
+ */
+template <typename sb_handle_t, typename index_t, typename container_0_t,
+          typename container_1_t, typename increment_t>
+typename sb_handle_t::event_t _tbmv(sb_handle_t& sb_handle, char _Uplo,
+                                    char _trans, char _Diag, index_t _N,
+                                    index_t _K, container_0_t _mA,
+                                    index_t _lda, container_1_t _vx,
+                                    increment_t _incx);
+
+/**
+ * @brief Symmetric packed matrix vector product followed by a sum.
+ *
+ * Matrix vector product with a symmetric matrix in packed storage, followed
+ * by a vector sum, i.e. computing the mathematical operation:
+ *
+ * y = alpha*A*x + beta*y
+ *
+ * See the netlib blas interface documentation for more details of the
+ * interface.
+ *
+ * @param sb_handle SB_handle
+ * @param _Uplo Whether the upper or the lower triangle of A is stored ('u',
+ *              'l')
+ * @param _N Order of A
+ * @param _alpha Scalar parameter alpha
+ * @param _mAP Buffer containing the _N*(_N+1)/2 elements of the _Uplo
+ *             triangle of A, packed column by column
+ * @param _vx Buffer containing x of at least (1+(_N-1)*abs(_incx)) elements
+ * @param _incx Increment for _vx (nonzero)
+ * @param _beta Scalar parameter beta
+ * @param _vy Buffer containing y of at least (1+(_N-1)*abs(_incy)) elements
+ * @param _incy Increment for _vy (nonzero)
+ */
+template <typename sb_handle_t, typename index_t, typename element_t,
+          typename container_0_t, typename container_1_t, typename increment_t,
+          typename container_2_t>
+typename sb_handle_t::event_t _spmv(sb_handle_t& sb_handle, char _Uplo,
+                                    index_t _N, element_t _alpha,
+                                    container_0_t _mAP, container_1_t _vx,
+                                    increment_t _incx, element_t _beta,
+                                    container_2_t _vy, increment_t _incy);
+
+/**
+ * @brief Triangular packed matrix vector product.
+ *
+ * Matrix vector product with a triangular matrix in packed storage, i.e.
+ * computing the mathematical operation:
+ *
+ * x = op(A)*x
+ *
+ * See the netlib blas interface documentation for more details of the
+ * interface.
+ *
+ * @param sb_handle SB_handle
+ * @param _Uplo Whether A is upper or lower triangular ('u', 'l')
+ * @param _trans Transposition operation applied to A ('n', 't', 'c')
+ * @param _Diag Whether A is unit triangular ('u', 'n')
+ * @param _N Order of A
+ * @param _mAP Buffer containing the _N*(_N+1)/2 elements of the triangle of
+ *             A, packed column by column
+ * @param _vx Buffer containing x of at least (1+(_N-1)*abs(_incx)) elements,
+ *            overwritten with the result
+ * @param _incx Increment for _vx (nonzero)
+ */
+template <typename sb_handle_t, typename index_t, typename container_0_t,
+          typename container_1_t, typename increment_t>
+typename sb_handle_t::event_t _tpmv(sb_handle_t& sb_handle, char _Uplo,
+                                    char _trans, char _Diag, index_t _N,
+                                    container_0_t _mAP, container_1_t _vx,
+                                    increment_t _incx);
+
+/**
+ * @brief Triangular solve with a vector.
+ *
+ * Solves the system of equations op(A)*x = b for a triangular matrix A, i.e.
+ * computing the mathematical operation:
+ *
+ * x = inv(op(A))*b
+ *
+ * The diagonal is solved by blocks in local memory, the contribution of each
+ * solved block being subtracted from the next blocks in the same launch.
+ * There is no check for singularity.
+ *
+ * See the netlib blas interface documentation for more details of the
+ * interface.
+ *
+ * @param sb_handle SB_handle
+ * @param _Uplo Whether A is upper or lower triangular ('u', 'l')
+ * @param _trans Transposition operation applied to A ('n', 't', 'c')
+ * @param _Diag Whether A is unit triangular ('u', 'n')
+ * @param _N Order of A
+ * @param _mA Buffer (_lda, _N) containing A
+ * @param _lda Leading dimension of _mA, at least _N
+ * @param _vx Buffer containing b of at least (1+(_N-1)*abs(_incx)) elements,
+ *            overwritten with the solution x
+ * @param _incx Increment for _vx (nonzero)
+ */
+template <typename sb_handle_t, typename index_t, typename container_0_t,
+          typename container_1_t, typename increment_t>
+typename sb_handle_t::event_t _trsv(sb_handle_t& sb_handle, char _Uplo,
+                                    char _trans, char _Diag, index_t _N,
+                                    container_0_t _mA, index_t _lda,
+                                    container_1_t _vx, increment_t _incx);
+
+/**
+ * @brief Triangular band solve with a vector.
+ *
+ * Solves the system of equations op(A)*x = b for a triangular band matrix A,
+ * i.e. computing the mathematical operation:
+ *
+ * x = inv(op(A))*b
+ *
+ * Same algorithm as _trsv, every solved block only updating the blocks within
+ * the band. There is no check for singularity.
+ *
+ * See the netlib blas interface documentation for more details of the
+ * interface.
+ *
+ * @param sb_handle SB_handle
+ * @param _Uplo Whether A is upper or lower triangular ('u', 'l')
+ * @param _trans Transposition operation applied to A ('n', 't', 'c')
+ * @param _Diag Whether A is unit triangular ('u', 'n')
+ * @param _N Order of A
+ * @param _K Number of A super-diagonals (or sub-diagonals)
+ * @param _mA Buffer (_lda, _N) containing A in the band matrix format of
+ *            gbmv, with _KL = 0 or _KU = 0
+ * @param _lda Leading dimension of _mA, at least (_K + 1)
+ * @param _vx Buffer containing b of at least (1+(_N-1)*abs(_incx)) elements,
+ *            overwritten with the solution x
+ * @param _incx Increment for _vx (nonzero)
+ */
+template <typename sb_handle_t, typename index_t, typename container_0_t,
+          typename container_1_t, typename increment_t>
+typename sb_handle_t::event_t _tbsv(sb_handle_t& sb_handle, char _Uplo,
+                                    char _trans, char _Diag, index_t _N,
+                                    index_t _K, container_0_t _mA,
+                                    index_t _lda, container_1_t _vx,
+                                    increment_t _incx);
+
+/**
+ * @brief Triangular packed solve with a vector.
+ *
+ * Solves the system of equations op(A)*x = b for a triangular matrix A in
+ * packed storage, i.e. computing the mathematical operation:
+ *
+ * x = inv(op(A))*b
+ *
+ * Same algorithm as _trsv, the blocks of A being read from the packed
+ * triangle. There is no check for singularity.
+ *
+ * See the netlib blas interface documentation for more details of the
+ * interface.
+ *
+ * @param sb_handle SB_handle
+ * @param _Uplo Whether A is upper or lower triangular ('u', 'l')
+ * @param _trans Transposition operation applied to A ('n', 't', 'c')
+ * @param _Diag Whether A is unit triangular ('u', 'n')
+ * @param _N Order of A
+ * @param _mAP Buffer containing the _N*(_N+1)/2 elements of the triangle of
+ *             A, packed column by column
+ * @param _vx Buffer containing b of at least (1+(_N-1)*abs(_incx)) elements,
+ *            overwritten with the solution x
+ * @param _incx Increment for _vx (nonzero)
+ */
+template <typename sb_handle_t, typename index_t, typename container_0_t,
+          typename container_1_t, typename increment_t>
+typename sb_handle_t::event_t _tpsv(sb_handle_t& sb_handle, char _Uplo,
+                                    char _trans, char _Diag, index_t _N,
+                                    container_0_t _mAP, container_1_t _vx,
+                                    increment_t _incx);
+
+/**
+ * @brief Symmetric rank 1 update of a packed matrix.
+ *
+ * Generalised vector squaring followed by a sum with a symmetric matrix in
+ * packed storage, i.e. computing the mathematical operation:
+ *
+ * A = alpha*x*xT + A
+ *
+ * See the netlib blas interface documentation for more details of the
+ * interface.
+ *
+ * @param sb_handle SB_handle
+ * @param _Uplo Whether the upper or the lower triangle of A is stored ('u',
+ *              'l')
+ * @param _N Order of A
+ * @param _alpha Scalar parameter alpha
+ * @param _vx Buffer containing x of at least (1+(_N-1)*abs(_incx)) elements
+ * @param _incx Increment for _vx (nonzero)
+ * @param _mAP Buffer containing the _N*(_N+1)/2 elements of the _Uplo
+ *             triangle of A, packed column by column, updated in place
+ */
+template <typename sb_handle_t, typename index_t, typename element_t,
+          typename container_0_t, typename increment_t, typename container_1_t>
+typename sb_handle_t::event_t _spr(sb_handle_t& sb_handle, char _Uplo,
+                                   index_t _N, element_t _alpha,
+                                   container_0_t _vx, increment_t _incx,
+                                   container_1_t _mAP);
+
 }  // namespace internal
 
 /*!
@@ -295,8 +602,47 @@ typename sb_handle_t::event_t inline _gemv(
     // finished, y is overwritten with the updated vector.
     increment_t _incy  // The increment for elements in y (nonzero).
 ) {
-  return internal::_gemv(sb_handle, _trans, _M, _N, _alpha, _mA, _lda, _vx,
-                         _incx, _beta, _vy, _incy);
+  internal::CounterScope counter_scope(sb_handle, "gemv");
+  if (sb_handle.get_trace() != nullptr) {
+    internal::trace_call(
+        sb_handle, "gemv", std::string{_trans},
+        internal::make_trace_sizes(_M, _N, _lda, _incx, _incy),
+        {static_cast<double>(_alpha), static_cast<double>(_beta)},
+        as_kernel_container(_mA), as_kernel_container(_vx), _vy);
+  }
+  return internal::_gemv(sb_handle, _trans, _M, _N, _alpha,
+                         as_kernel_container(_mA), _lda,
+                         as_kernel_container(_vx), _incx, _beta, _vy, _incy);
+}
+
+/*!
+ @brief Generalised matrix vector product with a matrix stored in the given
+ layout.
+
+ A row-major M x N matrix is the transpose of the column-major N x M matrix
+ held in the same memory, so it is handed to the column-major kernels with
+ the opposite transposition. There are no row-major kernels: the call runs
+ exactly the column-major GEMV of the swapped problem.
+ */
+template <typename sb_handle_t, typename index_t, typename element_t,
+          typename container_0_t, typename container_1_t, typename increment_t,
+          typename container_2_t>
+typename sb_handle_t::event_t inline _gemv(
+    sb_handle_t& sb_handle, access_layout layout, char _trans, index_t _M,
+    index_t _N, element_t _alpha, container_0_t _mA, index_t _lda,
+    container_1_t _vx, increment_t _incx, element_t _beta, container_2_t _vy,
+    increment_t _incy) {
+  internal::CounterScope counter_scope(sb_handle, "gemv");
+  if (layout == access_layout::col_major) {
+    return _gemv(sb_handle, _trans, _M, _N, _alpha, _mA, _lda, _vx, _incx,
+                 _beta, _vy, _incy);
+  }
+  _trans = tolower(_trans);
+  if (_trans != 'n' && _trans != 't' && _trans != 'c') {
+    throw std::invalid_argument("Erroneous parameter");
+  }
+  return _gemv(sb_handle, _trans == 'n' ? 't' : 'n', _N, _M, _alpha, _mA,
+               _lda, _vx, _incx, _beta, _vy, _incy);
 }
 
 /*!
@@ -324,6 +670,7 @@ typename sb_handle_t::event_t inline _trmv(
     container_1_t _vx,       // (1 + (_N-1)*abs(_incx)), output vector X
     increment_t _incx        // !=0 The increment for the elements of X
 ) {
+  internal::CounterScope counter_scope(sb_handle, "trmv");
   return internal::_trmv(sb_handle, _Uplo, _trans, _Diag, _N, _mA, _lda, _vx,
                          _incx);
 }
@@ -358,6 +705,7 @@ typename sb_handle_t::event_t inline _symv(
     container_2_t _vy,       // (1 + (_N-1)*abs(_incy)), output vector Y
     increment_t _incy        // !=0 The increment for the elements of Y
 ) {
+  internal::CounterScope counter_scope(sb_handle, "symv");
   return internal::_symv(sb_handle, _Uplo, _N, _alpha, _mA, _lda, _vx, _incx,
                          _beta, _vy, _incy);
 }
@@ -391,10 +739,33 @@ typename sb_handle_t::event_t inline _ger(
     container_2_t _mA,       // (_lda, n) array containing A, the output
     index_t _lda             // >max(1, m), Leading dimension of A
 ) {
+  internal::CounterScope counter_scope(sb_handle, "ger");
   return internal::_ger(sb_handle, _M, _N, _alpha, _vx, _incx, _vy, _incy, _mA,
                         _lda);
 }
 
+/*!
+ @brief Generalised vector product followed by a sum with a matrix stored in
+ the given layout.
+
+ With row-major storage the column-major kernel sees A^T, which is updated
+ with alpha*y*xT. There are no row-major kernels: the call runs exactly the
+ column-major GER of the swapped problem.
+ */
+template <typename sb_handle_t, typename index_t, typename element_t,
+          typename container_0_t, typename increment_t, typename container_1_t,
+          typename container_2_t>
+typename sb_handle_t::event_t inline _ger(
+    sb_handle_t& sb_handle, access_layout layout, index_t _M, index_t _N,
+    element_t _alpha, container_0_t _vx, increment_t _incx, container_1_t _vy,
+    increment_t _incy, container_2_t _mA, index_t _lda) {
+  internal::CounterScope counter_scope(sb_handle, "ger");
+  if (layout == access_layout::col_major) {
+    return _ger(sb_handle, _M, _N, _alpha, _vx, _incx, _vy, _incy, _mA, _lda);
+  }
+  return _ger(sb_handle, _N, _M, _alpha, _vy, _incy, _vx, _incx, _mA, _lda);
+}
+
 /*!
  @brief Generalised vector product sum.
 
@@ -420,6 +791,7 @@ typename sb_handle_t::event_t inline _syr(
     container_1_t _mA,       // (_lda, _N) The output matrix
     index_t _lda             // >max(1, _N) The first dimension of _mA
 ) {
+  internal::CounterScope counter_scope(sb_handle, "syr");
   return internal::_syr(sb_handle, _Uplo, _N, _alpha, _vx, _incx, _mA, _lda);
 }
 
@@ -452,10 +824,44 @@ typename sb_handle_t::event_t inline _syr2(
     container_2_t _mA,       // (_lda, _N) The output matrix
     index_t _lda             // >max(1, _N) The first dimension of _mA
 ) {
+  internal::CounterScope counter_scope(sb_handle, "syr2");
   return internal::_syr2(sb_handle, _Uplo, _N, _alpha, _vx, _incx, _vy, _incy,
                          _mA, _lda);
 }
 
+/*!
+ @brief Rank-k update of a rectangular matrix by k pairs of vectors.
+
+ Sum of k generalised vector products with a rectangular non-symmetric matrix,
+ i.e. computing the mathematical operation:
+
+ A = alpha*X*YT + A
+
+ where the k columns of X and Y are the vectors x and y of k calls to ger. The
+ update is made in a single pass over A, instead of one per pair of vectors.
+
+ */
+template <typename sb_handle_t, typename index_t, typename element_t,
+          typename container_0_t, typename container_1_t,
+          typename container_2_t>
+typename sb_handle_t::event_t inline _gerk(
+    sb_handle_t& sb_handle,  // sb_handle_t (sycl, parallel, serial, etc)
+    index_t _M,              // The rows of matrix A
+    index_t _N,              // The cols of matrix A
+    index_t _K,              // The number of pairs of vectors
+    element_t _alpha,        // Scalar alpha
+    container_0_t _mX,       // (_ldx, _K) The vectors x as columns
+    index_t _ldx,            // >max(1, _M) The first dimension of _mX
+    container_1_t _mY,       // (_ldy, _K) The vectors y as columns
+    index_t _ldy,            // >max(1, _N) The first dimension of _mY
+    container_2_t _mA,       // (_lda, _N) The output matrix
+    index_t _lda             // >max(1, _M) The first dimension of _mA
+) {
+  internal::CounterScope counter_scope(sb_handle, "gerk");
+  return internal::_gerk(sb_handle, _M, _N, _K, _alpha, _mX, _ldx, _mY, _ldy,
+                         _mA, _lda);
+}
+
 /**
  * @brief Generalised matrix vector product with band matrices.
  *
@@ -495,10 +901,296 @@ typename sb_handle_t::event_t inline _gbmv(sb_handle_t& sb_handle, char _trans,
                                            container_1_t _vx, increment_t _incx,
                                            element_t _beta, container_2_t _vy,
                                            increment_t _incy) {
+  internal::CounterScope counter_scope(sb_handle, "gbmv");
   return internal::_gbmv(sb_handle, _trans, _M, _N, _KL, _KU, _alpha, _mA, _lda,
                          _vx, _incx, _beta, _vy, _incy);
 }
 
+/**
+ * @brief Symmetric band matrix vector product followed by a sum.
+ *
+ * Matrix vector product with a symmetric band matrix, followed by a vector
+ * sum, i.e. computing the mathematical operation:
+ *
+ * y = alpha*A*x + beta*y
+ *
+ * See the netlib blas interface documentation for more details of the
+ * interface.
+ *
+ * @param sb_handle SB_handle
+ * @param _Uplo Whether the upper or the lower triangle of A is stored ('u',
+ *              'l')
+ * @param _N Order of A
+ * @param _K Number of A super-diagonals (and sub-diagonals)
+ * @param _alpha Scalar parameter alpha
+ * @param _mA Buffer (_lda, _N) containing the _Uplo triangle of A in the band
+ *            matrix format of gbmv, with _KL = 0 or _KU = 0
+ * @param _lda Leading dimension of _mA, at least (_K + 1)
+ * @param _vx Buffer containing x of at least (1+(_N-1)*abs(_incx)) elements
+ * @param _incx Increment for _vx (nonzero)
+ * @param _beta Scalar parameter beta
+ * @param _vy Buffer containing y of at least (1+(_N-1)*abs(_incy)) elements
+ * @param _incy Increment for _vy (nonzero)
+ */
+template <typename sb_handle_t, typename index_t, typename element_t,
+          typename container_0_t, typename container_1_t, typename increment_t,
+          typename container_2_t>
+typename sb_handle_t::event_t inline _sbmv(
+    sb_handle_t& sb_handle, char _Uplo, index_t _N, index_t _K,
+    element_t _alpha, container_0_t _mA, index_t _lda, container_1_t _vx,
+    increment_t _incx, element_t _beta, container_2_t _vy, increment_t _incy) {
+  internal::CounterScope counter_scope(sb_handle, "sbmv");
+  return internal::_sbmv(sb_handle, _Uplo, _N, _K, _alpha, _mA, _lda, _vx,
+                         _incx, _beta, _vy, _incy);
+}
+
+/**
+ * @brief Triangular band matrix vector product.
+ *
+ * Matrix vector product with a triangular band matrix, i.e. computing the
+ * mathematical operation:
+ *
+ * x = op(A)*x
+ *
+ * See the netlib blas interface documentation for more details of the
+ * interface.
+ *
+ * @param sb_handle SB_handle
+ * @param _Uplo Whether A is upper or lower triangular ('u', 'l')
+ * @param _trans Transposition operation applied to A ('n', 't', 'c')
+ * @param _Diag Whether A is unit triangular ('u', 'n')
+ * @param _N Order of A
+ * @param _K Number of A super-diagonals (or sub-diagonals)
+ * @param _mA Buffer (_lda, _N) containing A in the band matrix format of
+ *            gbmv, with _KL = 0 or _KU = 0
+ * @param _lda Leading dimension of _mA, at least (_K + 1)
+ * @param _vx Buffer containing x of at least (1+(_N-1)*abs(_incx)) elements,
+ *            overwritten with the result
+ * @param _incx Increment for _vx (nonzero)
+ */
+template <typename sb_handle_t, typename index_t, typename container_0_t,
+          typename container_1_t, typename increment_t>
+typename sb_handle_t::event_t inline _tbmv(sb_handle_t& sb_handle, char _Uplo,
+                                           char _trans, char _Diag, index_t _N,
+                                           index_t _K, container_0_t _mA,
+                                           index_t _lda, container_1_t _vx,
+                                           increment_t _incx) {
+  internal::CounterScope counter_scope(sb_handle, "tbmv");
+  return internal::_tbmv(sb_handle, _Uplo, _trans, _Diag, _N, _K, _mA, _lda,
+                         _vx, _incx);
+}
+
+/**
+ * @brief Symmetric packed matrix vector product followed by a sum.
+ *
+ * Matrix vector product with a symmetric matrix in packed storage, followed
+ * by a vector sum, i.e. computing the mathematical operation:
+ *
+ * y = alpha*A*x + beta*y
+ *
+ * See the netlib blas interface documentation for more details of the
+ * interface.
+ *
+ * @param sb_handle SB_handle
+ * @param _Uplo Whether the upper or the lower triangle of A is stored ('u',
+ *              'l')
+ * @param _N Order of A
+ * @param _alpha Scalar parameter alpha
+ * @param _mAP Buffer containing the _N*(_N+1)/2 elements of the _Uplo
+ *             triangle of A, packed column by column
+ * @param _vx Buffer containing x of at least (1+(_N-1)*abs(_incx)) elements
+ * @param _incx Increment for _vx (nonzero)
+ * @param _beta Scalar parameter beta
+ * @param _vy Buffer containing y of at least (1+(_N-1)*abs(_incy)) elements
+ * @param _incy Increment for _vy (nonzero)
+ */
+template <typename sb_handle_t, typename index_t, typename element_t,
+          typename container_0_t, typename container_1_t, typename increment_t,
+          typename container_2_t>
+typename sb_handle_t::event_t inline _spmv(
+    sb_handle_t& sb_handle, char _Uplo, index_t _N, element_t _alpha,
+    container_0_t _mAP, container_1_t _vx, increment_t _incx, element_t _beta,
+    container_2_t _vy, increment_t _incy) {
+  internal::CounterScope counter_scope(sb_handle, "spmv");
+  return internal::_spmv(sb_handle, _Uplo, _N, _alpha, _mAP, _vx, _incx,
+                         _beta, _vy, _incy);
+}
+
+/**
+ * @brief Triangular packed matrix vector product.
+ *
+ * Matrix vector product with a triangular matrix in packed storage, i.e.
+ * computing the mathematical operation:
+ *
+ * x = op(A)*x
+ *
+ * See the netlib blas interface documentation for more details of the
+ * interface.
+ *
+ * @param sb_handle SB_handle
+ * @param _Uplo Whether A is upper or lower triangular ('u', 'l')
+ * @param _trans Transposition operation applied to A ('n', 't', 'c')
+ * @param _Diag Whether A is unit triangular ('u', 'n')
+ * @param _N Order of A
+ * @param _mAP Buffer containing the _N*(_N+1)/2 elements of the triangle of
+ *             A, packed column by column
+ * @param _vx Buffer containing x of at least (1+(_N-1)*abs(_incx)) elements,
+ *            overwritten with the result
+ * @param _incx Increment for _vx (nonzero)
+ */
+template <typename sb_handle_t, typename index_t, typename container_0_t,
+          typename container_1_t, typename increment_t>
+typename sb_handle_t::event_t inline _tpmv(
+    sb_handle_t& sb_handle, char _Uplo, char _trans, char _Diag, index_t _N,
+    container_0_t _mAP, container_1_t _vx, increment_t _incx) {
+  internal::CounterScope counter_scope(sb_handle, "tpmv");
+  return internal::_tpmv(sb_handle, _Uplo, _trans, _Diag, _N, _mAP, _vx,
+                         _incx);
+}
+
+/**
+ * @brief Triangular solve with a vector.
+ *
+ * Solves the system of equations op(A)*x = b for a triangular matrix A, i.e.
+ * computing the mathematical operation:
+ *
+ * x = inv(op(A))*b
+ *
+ * The diagonal is solved by blocks in local memory, the contribution of each
+ * solved block being subtracted from the next blocks in the same launch.
+ * There is no check for singularity.
+ *
+ * See the netlib blas interface documentation for more details of the
+ * interface.
+ *
+ * @param sb_handle SB_handle
+ * @param _Uplo Whether A is upper or lower triangular ('u', 'l')
+ * @param _trans Transposition operation applied to A ('n', 't', 'c')
+ * @param _Diag Whether A is unit triangular ('u', 'n')
+ * @param _N Order of A
+ * @param _mA Buffer (_lda, _N) containing A
+ * @param _lda Leading dimension of _mA, at least _N
+ * @param _vx Buffer containing b of at least (1+(_N-1)*abs(_incx)) elements,
+ *            overwritten with the solution x
+ * @param _incx Increment for _vx (nonzero)
+ */
+template <typename sb_handle_t, typename index_t, typename container_0_t,
+          typename container_1_t, typename increment_t>
+typename sb_handle_t::event_t inline _trsv(sb_handle_t& sb_handle, char _Uplo,
+                                           char _trans, char _Diag, index_t _N,
+                                           container_0_t _mA, index_t _lda,
+                                           container_1_t _vx,
+                                           increment_t _incx) {
+  internal::CounterScope counter_scope(sb_handle, "trsv");
+  return internal::_trsv(sb_handle, _Uplo, _trans, _Diag, _N, _mA, _lda, _vx,
+                         _incx);
+}
+
+/**
+ * @brief Triangular band solve with a vector.
+ *
+ * Solves the system of equations op(A)*x = b for a triangular band matrix A,
+ * i.e. computing the mathematical operation:
+ *
+ * x = inv(op(A))*b
+ *
+ * Same algorithm as _trsv, every solved block only updating the blocks within
+ * the band. There is no check for singularity.
+ *
+ * See the netlib blas interface documentation for more details of the
+ * interface.
+ *
+ * @param sb_handle SB_handle
+ * @param _Uplo Whether A is upper or lower triangular ('u', 'l')
+ * @param _trans Transposition operation applied to A ('n', 't', 'c')
+ * @param _Diag Whether A is unit triangular ('u', 'n')
+ * @param _N Order of A
+ * @param _K Number of A super-diagonals (or sub-diagonals)
+ * @param _mA Buffer (_lda, _N) containing A in the band matrix format of
+ *            gbmv, with _KL = 0 or _KU = 0
+ * @param _lda Leading dimension of _mA, at least (_K + 1)
+ * @param _vx Buffer containing b of at least (1+(_N-1)*abs(_incx)) elements,
+ *            overwritten with the solution x
+ * @param _incx Increment for _vx (nonzero)
+ */
+template <typename sb_handle_t, typename index_t, typename container_0_t,
+          typename container_1_t, typename increment_t>
+typename sb_handle_t::event_t inline _tbsv(sb_handle_t& sb_handle, char _Uplo,
+                                           char _trans, char _Diag, index_t _N,
+                                           index_t _K, container_0_t _mA,
+                                           index_t _lda, container_1_t _vx,
+                                           increment_t _incx) {
+  internal::CounterScope counter_scope(sb_handle, "tbsv");
+  return internal::_tbsv(sb_handle, _Uplo, _trans, _Diag, _N, _K, _mA, _lda,
+                         _vx, _incx);
+}
+
+/**
+ * @brief Triangular packed solve with a vector.
+ *
+ * Solves the system of equations op(A)*x = b for a triangular matrix A in
+ * packed storage, i.e. computing the mathematical operation:
+ *
+ * x = inv(op(A))*b
+ *
+ * Same algorithm as _trsv, the blocks of A being read from the packed
+ * triangle. There is no check for singularity.
+ *
+ * See the netlib blas interface documentation for more details of the
+ * interface.
+ *
+ * @param sb_handle SB_handle
+ * @param _Uplo Whether A is upper or lower triangular ('u', 'l')
+ * @param _trans Transposition operation applied to A ('n', 't', 'c')
+ * @param _Diag Whether A is unit triangular ('u', 'n')
+ * @param _N Order of A
+ * @param _mAP Buffer containing the _N*(_N+1)/2 elements of the triangle of
+ *             A, packed column by column
+ * @param _vx Buffer containing b of at least (1+(_N-1)*abs(_incx)) elements,
+ *            overwritten with the solution x
+ * @param _incx Increment for _vx (nonzero)
+ */
+template <typename sb_handle_t, typename index_t, typename container_0_t,
+          typename container_1_t, typename increment_t>
+typename sb_handle_t::event_t inline _tpsv(
+    sb_handle_t& sb_handle, char _Uplo, char _trans, char _Diag, index_t _N,
+    container_0_t _mAP, container_1_t _vx, increment_t _incx) {
+  internal::CounterScope counter_scope(sb_handle, "tpsv");
+  return internal::_tpsv(sb_handle, _Uplo, _trans, _Diag, _N, _mAP, _vx,
+                         _incx);
+}
+
+/**
+ * @brief Symmetric rank 1 update of a packed matrix.
+ *
+ * Generalised vector squaring followed by a sum with a symmetric matrix in
+ * packed storage, i.e. computing the mathematical operation:
+ *
+ * A = alpha*x*xT + A
+ *
+ * See the netlib blas interface documentation for more details of the
+ * interface.
+ *
+ * @param sb_handle SB_handle
+ * @param _Uplo Whether the upper or the lower triangle of A is stored ('u',
+ *              'l')
+ * @param _N Order of A
+ * @param _alpha Scalar parameter alpha
+ * @param _vx Buffer containing x of at least (1+(_N-1)*abs(_incx)) elements
+ * @param _incx Increment for _vx (nonzero)
+ * @param _mAP Buffer containing the _N*(_N+1)/2 elements of the _Uplo
+ *             triangle of A, packed column by column, updated in place
+ */
+template <typename sb_handle_t, typename index_t, typename element_t,
+          typename container_0_t, typename increment_t, typename container_1_t>
+typename sb_handle_t::event_t inline _spr(sb_handle_t& sb_handle, char _Uplo,
+                                          index_t _N, element_t _alpha,
+                                          container_0_t _vx, increment_t _incx,
+                                          container_1_t _mAP) {
+  internal::CounterScope counter_scope(sb_handle, "spr");
+  return internal::_spr(sb_handle, _Uplo, _N, _alpha, _vx, _incx, _mAP);
+}
+
 }  // namespace blas
 
 #endif  // SYCL_BLAS_BLAS2_INTERFACE
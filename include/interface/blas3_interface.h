@@ -27,6 +27,11 @@
 #define SYCL_BLAS_BLAS3_INTERFACE_H
 
 #include "operations/blas3_trees.h"
+#include "sb_handle/counters.h"
+#include "sb_handle/trace.h"
+
+#include <cctype>
+#include <stdexcept>
 
 namespace blas {
 namespace internal {
@@ -57,6 +62,41 @@ typename sb_handle_t::event_t _gemm_batched(
     index_t _ldc, index_t batch_size,
     gemm_batch_type_t batch_type = gemm_batch_type_t::strided);
 
+/*!
+ * @brief GEMM with a single kernel specialized at JIT time for the problem
+ * shape (see GemmSpecialized). The batch_size matrices of each operand are
+ * stored one after the other, as in the strided _gemm_batched.
+ */
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t>
+typename sb_handle_t::event_t _gemm_specialized(
+    sb_handle_t& sb_handle, char _TransA, char _TransB, index_t _M, index_t _N,
+    index_t _K, element_t _alpha, container_0_t a_, index_t _lda,
+    container_1_t b_, index_t _ldb, element_t _beta, container_2_t _C,
+    index_t _ldc, index_t batch_size);
+
+/*!
+ * @brief Packs op(B) into the panel-major layout of GemmPackB.
+ */
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename index_t>
+typename sb_handle_t::event_t _gemm_pack_b(sb_handle_t& sb_handle,
+                                           char _TransB, index_t _K,
+                                           index_t _N, container_0_t b_,
+                                           index_t _ldb,
+                                           container_1_t packed_b);
+
+/*!
+ * @brief GEMM reading B from the buffer written by _gemm_pack_b (see
+ * GemmPacked).
+ */
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t>
+typename sb_handle_t::event_t _gemm_packed(
+    sb_handle_t& sb_handle, char _TransA, index_t _M, index_t _N, index_t _K,
+    element_t _alpha, container_0_t a_, index_t _lda, container_1_t packed_b,
+    element_t _beta, container_2_t _C, index_t _ldc);
+
 template <typename sb_handle_t, typename container_0_t, typename container_1_t,
           typename element_t, typename index_t>
 typename sb_handle_t::event_t _trsm(sb_handle_t& sb_handle, char side,
@@ -64,6 +104,47 @@ typename sb_handle_t::event_t _trsm(sb_handle_t& sb_handle, char side,
                                     index_t N, element_t alpha, container_0_t A,
                                     index_t lda, container_1_t B, index_t ldb);
 
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename element_t, typename index_t>
+typename sb_handle_t::event_t _trsm_batched(
+    sb_handle_t& sb_handle, char side, char uplo, char trans, char diag,
+    index_t M, index_t N, element_t alpha, container_0_t A, index_t lda,
+    index_t stride_a, container_1_t B, index_t ldb, index_t stride_b,
+    index_t batch_size);
+
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename element_t, typename index_t>
+typename sb_handle_t::event_t _syrk(sb_handle_t& sb_handle, char uplo,
+                                    char trans, index_t N, index_t K,
+                                    element_t alpha, container_0_t A,
+                                    index_t lda, element_t beta,
+                                    container_1_t C, index_t ldc);
+
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t>
+typename sb_handle_t::event_t _syr2k(sb_handle_t& sb_handle, char uplo,
+                                     char trans, index_t N, index_t K,
+                                     element_t alpha, container_0_t A,
+                                     index_t lda, container_1_t B, index_t ldb,
+                                     element_t beta, container_2_t C,
+                                     index_t ldc);
+
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename element_t, typename index_t>
+typename sb_handle_t::event_t _trmm(sb_handle_t& sb_handle, char side,
+                                    char uplo, char trans, char diag, index_t M,
+                                    index_t N, element_t alpha, container_0_t A,
+                                    index_t lda, container_1_t B, index_t ldb);
+
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t>
+typename sb_handle_t::event_t _symm(sb_handle_t& sb_handle, char side,
+                                    char uplo, index_t M, index_t N,
+                                    element_t alpha, container_0_t A,
+                                    index_t lda, container_1_t B, index_t ldb,
+                                    element_t beta, container_2_t C,
+                                    index_t ldc);
+
 }  // namespace internal
 
 template <typename sb_handle_t, typename container_0_t, typename container_1_t,
@@ -75,8 +156,47 @@ typename sb_handle_t::event_t _gemm(sb_handle_t& sb_handle, char _TransA,
                                     container_1_t b_, index_t _ldb,
                                     element_t _beta, container_2_t _C,
                                     index_t _ldc) {
-  return internal::_gemm(sb_handle, _TransA, _TransB, _M, _N, _K, _alpha, a_,
-                         _lda, b_, _ldb, _beta, _C, _ldc);
+  internal::CounterScope counter_scope(sb_handle, "gemm");
+  if (sb_handle.get_trace() != nullptr) {
+    internal::trace_call(
+        sb_handle, "gemm", std::string{_TransA, _TransB},
+        internal::make_trace_sizes(_M, _N, _K, _lda, _ldb, _ldc),
+        {static_cast<double>(_alpha), static_cast<double>(_beta)},
+        as_kernel_container(a_), as_kernel_container(b_), _C);
+  }
+  return internal::_gemm(sb_handle, _TransA, _TransB, _M, _N, _K, _alpha,
+                         as_kernel_container(a_), _lda,
+                         as_kernel_container(b_), _ldb, _beta, _C, _ldc);
+}
+
+/**
+ * @brief GEMM on matrices stored in the given layout.
+ *
+ * A row-major matrix is the transpose of the column-major matrix held in the
+ * same memory, so C = op(A) * op(B) is computed as C^T = op(B)^T * op(A)^T by
+ * the column-major kernels, which read the operands in place.
+ *
+ * There are no row-major kernels: a row-major call runs exactly the
+ * column-major GEMM of the swapped problem (N x M, with A and B exchanged),
+ * including its tile configuration, and performs like that call.
+ */
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t>
+typename sb_handle_t::event_t _gemm(sb_handle_t& sb_handle,
+                                    access_layout layout, char _TransA,
+                                    char _TransB, index_t _M, index_t _N,
+                                    index_t _K, element_t _alpha,
+                                    container_0_t a_, index_t _lda,
+                                    container_1_t b_, index_t _ldb,
+                                    element_t _beta, container_2_t _C,
+                                    index_t _ldc) {
+  internal::CounterScope counter_scope(sb_handle, "gemm");
+  if (layout == access_layout::col_major) {
+    return _gemm(sb_handle, _TransA, _TransB, _M, _N, _K, _alpha, a_, _lda, b_,
+                 _ldb, _beta, _C, _ldc);
+  }
+  return _gemm(sb_handle, _TransB, _TransA, _N, _M, _K, _alpha, b_, _ldb, a_,
+               _lda, _beta, _C, _ldc);
 }
 
 template <typename sb_handle_t, typename container_0_t, typename container_1_t,
@@ -87,9 +207,100 @@ typename sb_handle_t::event_t _gemm_batched(
     container_1_t b_, index_t _ldb, element_t _beta, container_2_t _C,
     index_t _ldc, index_t batch_size,
     gemm_batch_type_t batch_type = gemm_batch_type_t::strided) {
+  internal::CounterScope counter_scope(sb_handle, "gemm_batched");
+  if (sb_handle.get_trace() != nullptr) {
+    internal::trace_call(
+        sb_handle, "gemm_batched",
+        std::string{_TransA, _TransB,
+                    batch_type == gemm_batch_type_t::strided ? 's' : 'i'},
+        internal::make_trace_sizes(_M, _N, _K, _lda, _ldb, _ldc, batch_size),
+        {static_cast<double>(_alpha), static_cast<double>(_beta)},
+        as_kernel_container(a_), as_kernel_container(b_), _C);
+  }
   return internal::_gemm_batched(sb_handle, _TransA, _TransB, _M, _N, _K,
-                                 _alpha, a_, _lda, b_, _ldb, _beta, _C, _ldc,
-                                 batch_size, batch_type);
+                                 _alpha, as_kernel_container(a_), _lda,
+                                 as_kernel_container(b_), _ldb, _beta, _C,
+                                 _ldc, batch_size, batch_type);
+}
+
+/*!
+ * @brief GEMM through a kernel whose work group shape, sizes and leading
+ * dimensions are specialization constants. With SYCL implementations that
+ * support them, the kernel is compiled at run time for the shapes actually
+ * used instead of relying on the configurations instantiated in the library.
+ */
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t>
+typename sb_handle_t::event_t _gemm_specialized(
+    sb_handle_t& sb_handle, char _TransA, char _TransB, index_t _M, index_t _N,
+    index_t _K, element_t _alpha, container_0_t a_, index_t _lda,
+    container_1_t b_, index_t _ldb, element_t _beta, container_2_t _C,
+    index_t _ldc, index_t batch_size = 1) {
+  internal::CounterScope counter_scope(sb_handle, "gemm_specialized");
+  return internal::_gemm_specialized(sb_handle, _TransA, _TransB, _M, _N, _K,
+                                     _alpha, as_kernel_container(a_), _lda,
+                                     as_kernel_container(b_), _ldb, _beta, _C,
+                                     _ldc, batch_size);
+}
+
+/**
+ * @brief Number of elements of the buffer _gemm_pack_b needs for a K x N
+ * matrix: the columns are padded to a multiple of gemm_packed_panel_cols.
+ */
+template <typename index_t>
+inline index_t _gemm_packed_b_size(index_t _K, index_t _N) {
+  return ((_N - 1) / gemm_packed_panel_cols + 1) * gemm_packed_panel_cols * _K;
+}
+
+/**
+ * @brief Packs the K x N matrix op(B) once, so that it can be reused by any
+ * number of _gemm_packed calls.
+ *
+ * The columns of op(B) are grouped into panels of gemm_packed_panel_cols
+ * columns, the last one padded with zeros, and each panel is stored row by
+ * row. packed_b must hold _gemm_packed_b_size(K, N) elements and, for the
+ * vector loads of _gemm_packed to be aligned, start at an offset multiple of
+ * gemm_packed_panel_cols.
+ *
+ * @param _TransB Whether B is transposed ('n', 't' or 'c')
+ * @param _K Number of rows of op(B)
+ * @param _N Number of columns of op(B)
+ * @param b_ Container of B
+ * @param _ldb Leading dimension of B
+ * @param packed_b Container the packed matrix is written to
+ */
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename index_t>
+typename sb_handle_t::event_t _gemm_pack_b(sb_handle_t& sb_handle,
+                                           char _TransB, index_t _K,
+                                           index_t _N, container_0_t b_,
+                                           index_t _ldb,
+                                           container_1_t packed_b) {
+  internal::CounterScope counter_scope(sb_handle, "gemm_pack_b");
+  return internal::_gemm_pack_b(sb_handle, _TransB, _K, _N,
+                                as_kernel_container(b_), _ldb, packed_b);
+}
+
+/**
+ * @brief Computes C = alpha * op(A) * B + beta * C with B packed by
+ * _gemm_pack_b.
+ *
+ * Rows of the packed panels are read with aligned vector loads and without
+ * bounds checks. _K and _N must be the sizes B was packed with, and
+ * std::invalid_argument is thrown if packed_b does not start at an offset
+ * multiple of gemm_packed_panel_cols.
+ */
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t>
+typename sb_handle_t::event_t _gemm_packed(
+    sb_handle_t& sb_handle, char _TransA, index_t _M, index_t _N, index_t _K,
+    element_t _alpha, container_0_t a_, index_t _lda, container_1_t packed_b,
+    element_t _beta, container_2_t _C, index_t _ldc) {
+  internal::CounterScope counter_scope(sb_handle, "gemm_packed");
+  return internal::_gemm_packed(sb_handle, _TransA, _M, _N, _K, _alpha,
+                                as_kernel_container(a_), _lda,
+                                as_kernel_container(packed_b), _beta, _C,
+                                _ldc);
 }
 
 template <typename sb_handle_t, typename container_0_t, typename container_1_t,
@@ -100,9 +311,149 @@ typename sb_handle_t::event_t inline _trsm(sb_handle_t& sb_handle, char side,
                                            element_t alpha, container_0_t A,
                                            index_t lda, container_1_t B,
                                            index_t ldb) {
+  internal::CounterScope counter_scope(sb_handle, "trsm");
+  if (sb_handle.get_trace() != nullptr) {
+    internal::trace_call(sb_handle, "trsm",
+                         std::string{side, uplo, trans, diag},
+                         internal::make_trace_sizes(M, N, lda, ldb),
+                         {static_cast<double>(alpha)}, as_kernel_container(A),
+                         B);
+  }
   return internal::_trsm(sb_handle, side, uplo, trans, diag, M, N, alpha, A,
                          lda, B, ldb);
 }
 
+/**
+ * @brief Triangle Solve with Multiple Right Hand Sides on matrices stored in
+ * the given layout.
+ *
+ * With row-major storage the column-major kernels see A^T and B^T, so
+ * op(A) * X = alpha * B is solved as X^T * op(A^T) = alpha * B^T: the side and
+ * the stored triangle are swapped while the transposition is kept.
+ *
+ * There are no row-major kernels: a row-major call runs exactly the
+ * column-major TRSM of the swapped problem and performs like that call.
+ */
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename element_t, typename index_t>
+typename sb_handle_t::event_t inline _trsm(sb_handle_t& sb_handle,
+                                           access_layout layout, char side,
+                                           char uplo, char trans, char diag,
+                                           index_t M, index_t N,
+                                           element_t alpha, container_0_t A,
+                                           index_t lda, container_1_t B,
+                                           index_t ldb) {
+  internal::CounterScope counter_scope(sb_handle, "trsm");
+  if (layout == access_layout::col_major) {
+    return _trsm(sb_handle, side, uplo, trans, diag, M, N, alpha, A, lda, B,
+                 ldb);
+  }
+  side = tolower(side);
+  uplo = tolower(uplo);
+  if ((side != 'l' && side != 'r') || (uplo != 'l' && uplo != 'u')) {
+    throw std::invalid_argument("Erroneous parameter");
+  }
+  return _trsm(sb_handle, side == 'l' ? 'r' : 'l', uplo == 'l' ? 'u' : 'l',
+               trans, diag, N, M, alpha, A, lda, B, ldb);
+}
+
+/**
+ * @brief Strided batched Triangle Solve with Multiple Right Hand Sides.
+ *
+ * Solves batch_size independent TRSM problems. The i-th matrix A starts
+ * i*stride_a elements after A and the i-th matrix B starts i*stride_b
+ * elements after B. See _trsm for the meaning of the other parameters.
+ */
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename element_t, typename index_t>
+typename sb_handle_t::event_t inline _trsm_batched(
+    sb_handle_t& sb_handle, char side, char uplo, char trans, char diag,
+    index_t M, index_t N, element_t alpha, container_0_t A, index_t lda,
+    index_t stride_a, container_1_t B, index_t ldb, index_t stride_b,
+    index_t batch_size) {
+  internal::CounterScope counter_scope(sb_handle, "trsm_batched");
+  return internal::_trsm_batched(sb_handle, side, uplo, trans, diag, M, N,
+                                 alpha, A, lda, stride_a, B, ldb, stride_b,
+                                 batch_size);
+}
+
+/**
+ * @brief Symmetric Rank-K update.
+ *
+ * Computes C = alpha*A*A^T + beta*C (trans = 'n') or C = alpha*A^T*A + beta*C
+ * (trans = 't' or 'c'), where only the triangle of C given by uplo is read and
+ * written. See the netlib blas interface documentation for more details.
+ */
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename element_t, typename index_t>
+typename sb_handle_t::event_t inline _syrk(sb_handle_t& sb_handle, char uplo,
+                                           char trans, index_t N, index_t K,
+                                           element_t alpha, container_0_t A,
+                                           index_t lda, element_t beta,
+                                           container_1_t C, index_t ldc) {
+  internal::CounterScope counter_scope(sb_handle, "syrk");
+  return internal::_syrk(sb_handle, uplo, trans, N, K, alpha, A, lda, beta, C,
+                         ldc);
+}
+
+/**
+ * @brief Symmetric Rank-2K update.
+ *
+ * Computes C = alpha*A*B^T + alpha*B*A^T + beta*C (trans = 'n') or
+ * C = alpha*A^T*B + alpha*B^T*A + beta*C (trans = 't' or 'c'), where only the
+ * triangle of C given by uplo is read and written. See the netlib blas
+ * interface documentation for more details.
+ */
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t>
+typename sb_handle_t::event_t inline _syr2k(
+    sb_handle_t& sb_handle, char uplo, char trans, index_t N, index_t K,
+    element_t alpha, container_0_t A, index_t lda, container_1_t B,
+    index_t ldb, element_t beta, container_2_t C, index_t ldc) {
+  internal::CounterScope counter_scope(sb_handle, "syr2k");
+  return internal::_syr2k(sb_handle, uplo, trans, N, K, alpha, A, lda, B, ldb,
+                          beta, C, ldc);
+}
+
+/**
+ * @brief Triangular Matrix Multiplication.
+ *
+ * Computes B = alpha*op(A)*B (side = 'l') or B = alpha*B*op(A) (side = 'r'),
+ * where A is a unit or non-unit, upper or lower triangular matrix of which only
+ * the triangle given by uplo is read. See the netlib blas interface
+ * documentation for more details.
+ */
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename element_t, typename index_t>
+typename sb_handle_t::event_t inline _trmm(sb_handle_t& sb_handle, char side,
+                                           char uplo, char trans, char diag,
+                                           index_t M, index_t N,
+                                           element_t alpha, container_0_t A,
+                                           index_t lda, container_1_t B,
+                                           index_t ldb) {
+  internal::CounterScope counter_scope(sb_handle, "trmm");
+  return internal::_trmm(sb_handle, side, uplo, trans, diag, M, N, alpha, A,
+                         lda, B, ldb);
+}
+
+/**
+ * @brief Symmetric Matrix Multiplication.
+ *
+ * Computes C = alpha*A*B + beta*C (side = 'l') or C = alpha*B*A + beta*C
+ * (side = 'r'), where A is a symmetric matrix of which only the triangle given
+ * by uplo is read. See the netlib blas interface documentation for more
+ * details.
+ */
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t>
+typename sb_handle_t::event_t inline _symm(
+    sb_handle_t& sb_handle, char side, char uplo, index_t M, index_t N,
+    element_t alpha, container_0_t A, index_t lda, container_1_t B,
+    index_t ldb, element_t beta, container_2_t C, index_t ldc) {
+  internal::CounterScope counter_scope(sb_handle, "symm");
+  return internal::_symm(sb_handle, side, uplo, M, N, alpha, A, lda, B, ldb,
+                         beta, C, ldc);
+}
+
 }  // namespace blas
 #endif  // SYCL_BLAS_BLAS3_INTERFACE
@@ -0,0 +1,333 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename gemm_model.h
+ *
+ **************************************************************************/
+
+#ifndef SYCL_BLAS_GEMM_MODEL_H
+#define SYCL_BLAS_GEMM_MODEL_H
+
+#include "blas_meta.h"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <istream>
+#include <limits>
+#include <map>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace blas {
+
+/*!
+ * @brief Standard GEMM configuration of a backend: the rows and columns of C
+ * computed by each work item and the shape of the work group, as in the Tile
+ * of its Gemm_Launcher, whether the operands go through local memory, and
+ * whether the kernel runs a single work item per work group and at most one
+ * work group per compute unit, which walks over the tiles of C (the cache
+ * blocked CPU GEMM).
+ */
+struct GemmConfig {
+  std::string name;
+  int item_rows;
+  int item_cols;
+  int wg_rows;
+  int wg_cols;
+  bool local_memory;
+  bool one_item_per_unit;
+};
+
+struct GemmShape {
+  std::int64_t m;
+  std::int64_t n;
+  std::int64_t k;
+  std::int64_t batch;
+  size_t element_size;
+  bool beta_zero;
+};
+
+/*!
+ * @brief Analytic terms of a configuration for a shape.
+ * compute is the number of FLOPs a compute unit executes on the critical
+ * path: the work groups run in waves of compute units times work groups per
+ * unit, and the tiles at the edges of C cost as much as the full ones.
+ * memory is the number of bytes read and written in global memory.
+ */
+struct GemmTerms {
+  double waves;
+  double compute;
+  double memory;
+};
+
+/*!
+ * @brief The predicted time in nanoseconds is
+ * overhead + compute * GemmTerms::compute + memory * GemmTerms::memory.
+ */
+struct GemmCoefficients {
+  double overhead;
+  double compute;
+  double memory;
+};
+
+/*!
+ * @brief Standard configurations of the backend of a tuning target, in the
+ * order in which its ladder numbers them. The tall and skinny and interleaved
+ * batch configurations are not part of the model.
+ */
+inline std::vector<GemmConfig> get_gemm_model_configs(tuning_target_t target,
+                                                      size_t element_size) {
+  switch (target) {
+    case tuning_target_t::intel_gpu:
+      return {{"intel_gpu_small", 4, 4, 8, 8, true, false},
+              {"intel_gpu_no_local", 8, 8, 8, 8, false, false},
+              {"intel_gpu_large", 8, 8, 8, 8, true, false}};
+    case tuning_target_t::amd_gpu: {
+      const int wg = static_cast<int>(64 / element_size);
+      return {{"amd_gpu_small", 1, 1, wg, wg, true, false},
+              {"amd_gpu_large", 4, 4, wg, wg, true, false}};
+    }
+    case tuning_target_t::default_cpu: {
+      const int item_rows = element_size == 8 ? 4 : 8;
+      return {{"default_cpu_small", 2, 2, 8, 8, false, false},
+              {"default_cpu_large", 8, 8, 8, 8, false, false},
+              {"default_cpu_cache_blocked", item_rows, 4, 8, 8, true, true}};
+    }
+    default:
+      return {};
+  }
+}
+
+/** GemmModel.
+ * @brief Performance model of the standard GEMM configurations. Set on an
+ * SB_Handle (see SB_Handle::set_gemm_model), it replaces the shape
+ * thresholds of the backends with the configuration of lowest predicted
+ * time.
+ *
+ * Every configuration starts with coefficients derived from the peaks of the
+ * device, and can be given coefficients fitted on benchmark runs (see
+ * benchmark/gemm_model.py), read from the text format written by write:
+ *   sycl-blas-gemm-model 1
+ *   <config name> <overhead> <compute> <memory>
+ */
+class GemmModel {
+ public:
+  /*!
+   * @param compute_units Number of compute units of the device
+   * @param work_group_size Work items a compute unit runs at once
+   * @param peak_gflops Peak FLOP rate of the device in GFLOP/s
+   * @param bandwidth Memory bandwidth of the device in GB/s
+   * @param overhead Launch overhead of a kernel in nanoseconds
+   */
+  inline GemmModel(size_t compute_units, size_t work_group_size,
+                   double peak_gflops, double bandwidth,
+                   double overhead = 5000)
+      : computeUnits_(std::max(size_t(1), compute_units)),
+        workGroupSize_(std::max(size_t(1), work_group_size)),
+        default_{overhead, computeUnits_ / peak_gflops, 1 / bandwidth},
+        forcedConfig_(-1) {
+    if (peak_gflops <= 0 || bandwidth <= 0 || overhead < 0) {
+      throw std::invalid_argument("Erroneous parameter");
+    }
+  }
+
+  inline GemmTerms get_terms(const GemmConfig& config,
+                             const GemmShape& shape) const {
+    const double tile_rows = config.item_rows * config.wg_rows;
+    const double tile_cols = config.item_cols * config.wg_cols;
+    const double wg_size =
+        config.one_item_per_unit ? 1 : config.wg_rows * config.wg_cols;
+    const double num_wgs = std::ceil(shape.m / tile_rows) *
+                           std::ceil(shape.n / tile_cols) * shape.batch;
+    const double wgs_per_unit =
+        config.one_item_per_unit
+            ? 1
+            : std::max(1.0, std::floor(workGroupSize_ / wg_size));
+    GemmTerms terms;
+    terms.waves = std::ceil(num_wgs / (computeUnits_ * wgs_per_unit));
+    terms.compute =
+        terms.waves * wgs_per_unit * 2 * tile_rows * tile_cols * shape.k;
+    // A work group reads its rows of A and columns of B once through local
+    // memory, otherwise every work item reads its own
+    const double reads =
+        config.local_memory
+            ? (tile_rows + tile_cols) * shape.k
+            : (tile_rows * config.wg_cols + tile_cols * config.wg_rows) *
+                  shape.k;
+    const double c_size = static_cast<double>(shape.m) * shape.n * shape.batch;
+    terms.memory = shape.element_size *
+                   (num_wgs * reads + c_size * (shape.beta_zero ? 1 : 2));
+    return terms;
+  }
+
+  inline GemmCoefficients get_coefficients(const GemmConfig& config) const {
+    auto it = calibrated_.find(config.name);
+    return it == calibrated_.end() ? default_ : it->second;
+  }
+
+  inline void set_coefficients(const std::string& name,
+                               GemmCoefficients coefficients) {
+    calibrated_[name] = coefficients;
+  }
+
+  /*!
+   * @brief Predicted time of the configuration for the shape in nanoseconds.
+   */
+  inline double predict(const GemmConfig& config,
+                        const GemmShape& shape) const {
+    const GemmTerms terms = get_terms(config, shape);
+    const GemmCoefficients c = get_coefficients(config);
+    return c.overhead + c.compute * terms.compute + c.memory * terms.memory;
+  }
+
+  /*!
+   * @brief Index of the configuration of lowest predicted time, or the
+   * forced configuration if it is one of them.
+   */
+  inline int select(const std::vector<GemmConfig>& configs,
+                    const GemmShape& shape) const {
+    if (forcedConfig_ >= 0 &&
+        forcedConfig_ < static_cast<int>(configs.size())) {
+      return forcedConfig_;
+    }
+    int best = 0;
+    double best_time = std::numeric_limits<double>::max();
+    for (size_t i = 0; i < configs.size(); ++i) {
+      const double time = predict(configs[i], shape);
+      if (time < best_time) {
+        best_time = time;
+        best = static_cast<int>(i);
+      }
+    }
+    return best;
+  }
+
+  /*!
+   * @brief Makes select return the given configuration, e.g to benchmark
+   * each configuration for the calibration. A negative value restores the
+   * prediction.
+   */
+  inline void set_forced_config(int config) { forcedConfig_ = config; }
+
+  inline int get_forced_config() const { return forcedConfig_; }
+
+  inline void write(std::ostream& os) const {
+    os << "sycl-blas-gemm-model 1\n";
+    os << std::setprecision(std::numeric_limits<double>::max_digits10);
+    for (const auto& c : calibrated_) {
+      os << c.first << " " << c.second.overhead << " " << c.second.compute
+         << " " << c.second.memory << "\n";
+    }
+  }
+
+  /*!
+   * @brief Reads the coefficients written by write or the calibration tool.
+   * @throw std::runtime_error if the input is not a valid model.
+   */
+  inline void read(std::istream& is) {
+    std::string line, name;
+    int version = 0;
+    std::getline(is, line);
+    std::istringstream header(line);
+    if (!(header >> name >> version) || name != "sycl-blas-gemm-model" ||
+        version != 1) {
+      throw std::runtime_error("Not a SYCL-BLAS GEMM model");
+    }
+    while (std::getline(is, line)) {
+      std::istringstream ls(line);
+      GemmCoefficients c;
+      if (!(ls >> name)) {
+        continue;
+      }
+      if (!(ls >> c.overhead >> c.compute >> c.memory)) {
+        throw std::runtime_error("Malformed GEMM model line: " + line);
+      }
+      calibrated_[name] = c;
+    }
+  }
+
+  /*!
+   * @brief Writes the predicted time and FLOP rate of every configuration of
+   * the target for every shape as CSV, marking the configuration select
+   * picks.
+   */
+  inline void write_predictions(std::ostream& os, tuning_target_t target,
+                                const std::vector<GemmShape>& shapes) const {
+    os << "m,n,k,batch,element_size,config,waves,predicted_time,"
+          "predicted_gflops,selected\n";
+    for (const auto& shape : shapes) {
+      const auto configs = get_gemm_model_configs(target, shape.element_size);
+      const int selected = select(configs, shape);
+      const double flops = 2.0 * shape.m * shape.n * shape.k * shape.batch;
+      for (size_t i = 0; i < configs.size(); ++i) {
+        const double time = predict(configs[i], shape);
+        os << shape.m << "," << shape.n << "," << shape.k << ","
+           << shape.batch << "," << shape.element_size << ","
+           << configs[i].name << "," << get_terms(configs[i], shape).waves
+           << "," << time << "," << flops / time << ","
+           << (static_cast<int>(i) == selected ? 1 : 0) << "\n";
+      }
+    }
+  }
+
+ private:
+  const size_t computeUnits_;
+  const size_t workGroupSize_;
+  const GemmCoefficients default_;
+  std::map<std::string, GemmCoefficients> calibrated_;
+  int forcedConfig_;
+};
+
+namespace internal {
+
+/*!
+ * @brief Standard configuration of the backend of the target for the shape:
+ * the one of lowest predicted time if the handle has a GemmModel, otherwise
+ * default_config, picked by the thresholds of the backend. The handle keeps
+ * it as the configuration its last GEMM launched.
+ */
+template <typename sb_handle_t, typename index_t>
+inline int select_gemm_config(sb_handle_t& sb_handle, tuning_target_t target,
+                              int default_config, index_t m, index_t n,
+                              index_t k, index_t batch, size_t element_size,
+                              bool beta_zero) {
+  const GemmModel* model = sb_handle.get_gemm_model();
+  const int config =
+      model == nullptr
+          ? default_config
+          : model->select(
+                get_gemm_model_configs(target, element_size),
+                {static_cast<std::int64_t>(m), static_cast<std::int64_t>(n),
+                 static_cast<std::int64_t>(k),
+                 static_cast<std::int64_t>(batch), element_size, beta_zero});
+  sb_handle.set_gemm_config(config);
+  return config;
+}
+
+}  // namespace internal
+}  // namespace blas
+
+#endif  // SYCL_BLAS_GEMM_MODEL_H
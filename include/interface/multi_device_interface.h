@@ -0,0 +1,236 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename multi_device_interface.h
+ *
+ **************************************************************************/
+
+#ifndef SYCL_BLAS_MULTI_DEVICE_INTERFACE_H
+#define SYCL_BLAS_MULTI_DEVICE_INTERFACE_H
+
+#include "blas_meta.h"
+#include "container/sycl_iterator.h"
+#include "interface/blas3_interface.h"
+#include "operations/blas3_trees.h"
+#include "sb_handle/multi_sb_handle.h"
+#include <algorithm>
+#include <cctype>
+#include <cstddef>
+#include <vector>
+
+namespace blas {
+namespace internal {
+
+/*!
+ * @brief View of count elements of a container, starting offset elements
+ * into it. The view is a sub-buffer when the device alignment allows it, so
+ * that the kernels of different queues writing to disjoint parts of the same
+ * buffer do not depend on each other, and the same buffer at a larger offset
+ * otherwise.
+ * @param align Alignment in bytes of the sub-buffer offsets.
+ */
+template <typename element_t>
+inline BufferIterator<element_t> make_sub_buffer_view(
+    BufferIterator<element_t> container, std::ptrdiff_t offset,
+    std::ptrdiff_t count, size_t align) {
+  using buff_t = typename BufferIterator<element_t>::buff_t;
+  buff_t buffer = container.get_buffer();
+  const std::ptrdiff_t first = container.get_offset() + offset;
+  const bool fits = count > 0 && first + count <=
+                                     static_cast<std::ptrdiff_t>(
+                                         buffer.get_count());
+  if (!fits || buffer.is_sub_buffer() ||
+      (first * sizeof(element_t)) % align != 0) {
+    return container + offset;
+  }
+  return BufferIterator<element_t>(
+      buff_t(buffer, cl::sycl::id<1>(first), cl::sycl::range<1>(count)));
+}
+
+/*!
+ * @brief Smallest number of consecutive matrices (or columns) of stride
+ * elements whose size is a multiple of the alignment in bytes.
+ */
+template <typename element_t, typename index_t>
+inline index_t get_split_granularity(index_t stride, size_t align) {
+  if (align % sizeof(element_t) != 0 || stride <= 0) {
+    return index_t(1);
+  }
+  index_t a = static_cast<index_t>(align / sizeof(element_t));
+  index_t b = stride;
+  while (b != 0) {
+    const index_t r = a % b;
+    a = b;
+    b = r;
+  }
+  return static_cast<index_t>(align / sizeof(element_t)) / a;
+}
+
+/*!
+ * @brief Splits [0, size) in parts consecutive ranges of similar sizes,
+ * multiple of the granularity unless it leaves a part empty.
+ * @return The parts + 1 boundaries of the ranges.
+ */
+template <typename index_t>
+inline std::vector<index_t> split_range(index_t size, size_t parts,
+                                        index_t granularity) {
+  const index_t num_parts = static_cast<index_t>(parts);
+  index_t chunk = (size + num_parts - 1) / num_parts;
+  const index_t aligned_chunk =
+      ((chunk + granularity - 1) / granularity) * granularity;
+  if (aligned_chunk * (num_parts - 1) < size) {
+    chunk = aligned_chunk;
+  }
+  std::vector<index_t> bounds(parts + 1);
+  for (index_t i = 0; i <= num_parts; ++i) {
+    bounds[i] = std::min(size, i * chunk);
+  }
+  return bounds;
+}
+
+/*!
+ * @brief Number of elements spanned by a column-major matrix.
+ */
+template <typename index_t>
+inline std::ptrdiff_t get_matrix_extent(index_t rows, index_t cols,
+                                        index_t ld) {
+  return (cols > 0 && rows > 0)
+             ? static_cast<std::ptrdiff_t>(ld) * (cols - 1) + rows
+             : 0;
+}
+
+}  // namespace internal
+
+/**
+ * @brief GEMM split across the queues of a MultiSB_Handle.
+ *
+ * Each queue computes a block of consecutive columns of C, reading the
+ * matching columns of op(B) and the whole of A. The blocks of C (and of B
+ * when it is not transposed) are sub-buffers when their offsets meet the
+ * alignment of the devices.
+ * @return The events of all the queues.
+ */
+template <typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t>
+typename MultiSB_Handle::event_t _gemm(
+    MultiSB_Handle& sb_handle, char _TransA, char _TransB, index_t _M,
+    index_t _N, index_t _K, element_t _alpha, container_0_t a_, index_t _lda,
+    container_1_t b_, index_t _ldb, element_t _beta, container_2_t _C,
+    index_t _ldc) {
+  using c_element_t = typename container_2_t::scalar_t;
+  const bool trans_b = std::tolower(_TransB) != 'n';
+  const size_t align = sb_handle.get_sub_buffer_align();
+  const auto bounds = internal::split_range(
+      _N, sb_handle.get_num_handles(),
+      internal::get_split_granularity<c_element_t>(_ldc, align));
+
+  typename MultiSB_Handle::event_t events;
+  for (size_t d = 0; d < sb_handle.get_num_handles(); ++d) {
+    const index_t first_col = bounds[d];
+    const index_t cols = bounds[d + 1] - first_col;
+    if (cols <= 0) {
+      continue;
+    }
+    auto c_d = internal::make_sub_buffer_view(
+        _C, static_cast<std::ptrdiff_t>(first_col) * _ldc,
+        internal::get_matrix_extent(_M, cols, _ldc), align);
+    auto b_d = trans_b ? b_ + first_col
+                       : internal::make_sub_buffer_view(
+                             b_, static_cast<std::ptrdiff_t>(first_col) * _ldb,
+                             internal::get_matrix_extent(_K, cols, _ldb),
+                             align);
+    events = concatenate_vectors(
+        events, _gemm(sb_handle.get_handle(d), _TransA, _TransB, _M, cols, _K,
+                      _alpha, a_, _lda, b_d, _ldb, _beta, c_d, _ldc));
+  }
+  return events;
+}
+
+/**
+ * @brief Batched GEMM split across the queues of a MultiSB_Handle.
+ *
+ * Strided batches are split by consecutive ranges of matrices, each queue
+ * getting sub-buffers of its operands when the alignment of the devices
+ * allows it. Interleaved batches cannot be split by offsets and run on the
+ * first queue.
+ * @return The events of all the queues.
+ */
+template <typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t>
+typename MultiSB_Handle::event_t _gemm_batched(
+    MultiSB_Handle& sb_handle, char _TransA, char _TransB, index_t _M,
+    index_t _N, index_t _K, element_t _alpha, container_0_t a_, index_t _lda,
+    container_1_t b_, index_t _ldb, element_t _beta, container_2_t _C,
+    index_t _ldc, index_t batch_size,
+    gemm_batch_type_t batch_type = gemm_batch_type_t::strided) {
+  if (batch_type == gemm_batch_type_t::interleaved) {
+    return _gemm_batched(sb_handle.get_handle(0), _TransA, _TransB, _M, _N,
+                         _K, _alpha, a_, _lda, b_, _ldb, _beta, _C, _ldc,
+                         batch_size, batch_type);
+  }
+  using c_element_t = typename container_2_t::scalar_t;
+  const bool trans_a = std::tolower(_TransA) != 'n';
+  const bool trans_b = std::tolower(_TransB) != 'n';
+  const index_t a_rows = trans_a ? _K : _M;
+  const index_t a_cols = trans_a ? _M : _K;
+  const index_t b_rows = trans_b ? _N : _K;
+  const index_t b_cols = trans_b ? _K : _N;
+  const std::ptrdiff_t a_size = static_cast<std::ptrdiff_t>(_lda) * a_cols;
+  const std::ptrdiff_t b_size = static_cast<std::ptrdiff_t>(_ldb) * b_cols;
+  const std::ptrdiff_t c_size = static_cast<std::ptrdiff_t>(_ldc) * _N;
+  const size_t align = sb_handle.get_sub_buffer_align();
+  const auto bounds = internal::split_range(
+      batch_size, sb_handle.get_num_handles(),
+      internal::get_split_granularity<c_element_t>(index_t(c_size), align));
+
+  typename MultiSB_Handle::event_t events;
+  for (size_t d = 0; d < sb_handle.get_num_handles(); ++d) {
+    const index_t first = bounds[d];
+    const index_t count = bounds[d + 1] - first;
+    if (count <= 0) {
+      continue;
+    }
+    auto a_d = internal::make_sub_buffer_view(
+        a_, first * a_size,
+        (count - 1) * a_size +
+            internal::get_matrix_extent(a_rows, a_cols, _lda),
+        align);
+    auto b_d = internal::make_sub_buffer_view(
+        b_, first * b_size,
+        (count - 1) * b_size +
+            internal::get_matrix_extent(b_rows, b_cols, _ldb),
+        align);
+    auto c_d = internal::make_sub_buffer_view(
+        _C, first * c_size,
+        (count - 1) * c_size + internal::get_matrix_extent(_M, _N, _ldc),
+        align);
+    events = concatenate_vectors(
+        events,
+        _gemm_batched(sb_handle.get_handle(d), _TransA, _TransB, _M, _N, _K,
+                      _alpha, a_d, _lda, b_d, _ldb, _beta, c_d, _ldc, count,
+                      batch_type));
+  }
+  return events;
+}
+
+}  // namespace blas
+
+#endif  // SYCL_BLAS_MULTI_DEVICE_INTERFACE_H
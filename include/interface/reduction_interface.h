@@ -52,8 +52,10 @@ typename sb_handle_t::event_t _reduction(sb_handle_t& sb_handle,
                                          output_t buffer_out, index_t rows,
                                          index_t cols,
                                          reduction_dim_t reduction_dim) {
+  blas::internal::CounterScope counter_scope(sb_handle, "reduction");
   return internal::_reduction<operator_t, element_t>(
-      sb_handle, buffer_in, ld, buffer_out, rows, cols, reduction_dim);
+      sb_handle, as_kernel_container(buffer_in), ld, buffer_out, rows, cols,
+      reduction_dim);
 }
 }  // namespace extension
 
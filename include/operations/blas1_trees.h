@@ -29,6 +29,7 @@
 #include "operations/blas_operators.h"
 #include <CL/sycl.hpp>
 #include <stdexcept>
+#include <type_traits>
 #include <vector>
 
 namespace blas {
@@ -64,6 +65,10 @@ struct Assign {
   bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
   value_t eval(index_t i);
   value_t eval(cl::sycl::nd_item<1> ndItem);
+  template <int vector_size>
+  bool is_packet_aligned() const;
+  template <int vector_size>
+  cl::sycl::vec<value_t, vector_size> eval_packet(index_t i);
   void bind(cl::sycl::handler &h);
   void adjust_access_displacement();
 };
@@ -84,6 +89,10 @@ struct DoubleAssign {
   bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
   value_t eval(index_t i);
   value_t eval(cl::sycl::nd_item<1> ndItem);
+  template <int vector_size>
+  bool is_packet_aligned() const;
+  template <int vector_size>
+  cl::sycl::vec<value_t, vector_size> eval_packet(index_t i);
   void bind(cl::sycl::handler &h);
   void adjust_access_displacement();
 };
@@ -103,6 +112,10 @@ struct ScalarOp {
   bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
   value_t eval(index_t i);
   value_t eval(cl::sycl::nd_item<1> ndItem);
+  template <int vector_size>
+  bool is_packet_aligned() const;
+  template <int vector_size>
+  cl::sycl::vec<value_t, vector_size> eval_packet(index_t i);
   void bind(cl::sycl::handler &h);
   void adjust_access_displacement();
 };
@@ -120,6 +133,10 @@ struct UnaryOp {
   bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
   value_t eval(index_t i);
   value_t eval(cl::sycl::nd_item<1> ndItem);
+  template <int vector_size>
+  bool is_packet_aligned() const;
+  template <int vector_size>
+  cl::sycl::vec<value_t, vector_size> eval_packet(index_t i);
   void bind(cl::sycl::handler &h);
   void adjust_access_displacement();
 };
@@ -138,10 +155,61 @@ struct BinaryOp {
   bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
   value_t eval(index_t i);
   value_t eval(cl::sycl::nd_item<1> ndItem);
+  template <int vector_size>
+  bool is_packet_aligned() const;
+  template <int vector_size>
+  cl::sycl::vec<value_t, vector_size> eval_packet(index_t i);
   void bind(cl::sycl::handler &h);
   void adjust_access_displacement();
 };
 
+/*! vectorized_size.
+ * @brief Number of elements of the 16 byte packets processed by Vectorized,
+ * 1 for the types sycl::vec does not support.
+ */
+template <typename value_t>
+struct vectorized_size {
+  static constexpr int value =
+      (std::is_arithmetic<value_t>::value ||
+       std::is_same<value_t, cl::sycl::half>::value)
+          ? static_cast<int>(16 / sizeof(value_t))
+          : 1;
+};
+
+/*! Vectorized.
+ * @brief Evaluates an element-wise tree (Assign or DoubleAssign) with a
+ * grid-stride loop. When all the views of the tree have unit stride and are
+ * aligned to the packet size, each iteration processes vector_size
+ * contiguous elements with vector loads and stores, the remaining elements
+ * are evaluated one at a time.
+ */
+template <int vector_size, typename tree_t>
+struct Vectorized {
+  using index_t = typename tree_t::index_t;
+  using value_t = typename tree_t::value_t;
+  // Upper bound of the grid, the loop covers larger vectors
+  static constexpr index_t work_groups_per_compute_unit = 4;
+  tree_t tree_;
+  Vectorized(tree_t &_tree);
+  index_t get_size() const;
+  bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
+  value_t eval(index_t i);
+  void eval(cl::sycl::nd_item<1> ndItem);
+  cl::sycl::nd_range<1> get_nd_range(index_t local_size,
+                                     index_t compute_units) const;
+  void bind(cl::sycl::handler &h);
+  void adjust_access_displacement();
+
+ private:
+  index_t eval_packets(index_t first, index_t stride, std::true_type);
+  index_t eval_packets(index_t, index_t, std::false_type);
+};
+
+template <int vector_size, typename tree_t>
+inline Vectorized<vector_size, tree_t> make_vectorized(tree_t &tree) {
+  return Vectorized<vector_size, tree_t>(tree);
+}
+
 /*! TupleOp.
  * @brief Implements a Tuple Operation (map (\x -> [i, x]) vector).
  */
@@ -182,8 +250,28 @@ struct AssignReduction {
   void adjust_access_displacement();
 };
 
+/*!
+ * @brief Computes the Givens rotation of the point (a, b) in place: on exit a
+ * holds r, b holds z, and c and s the parameters of the rotation. Shared by
+ * the Rotg expression and the host-scalar rotg.
+ */
+template <typename value_t>
+void compute_rotg(value_t &a, value_t &b, value_t &c, value_t &s);
+
+/*!
+ * @brief Computes the modified Givens rotation of the point (x1, y1) in
+ * place, re-scaling d1, d2 and x1 and writing the flag and the components of
+ * H. Shared by the Rotmg expression and the host-scalar rotmg.
+ */
+template <typename value_t>
+void compute_rotmg(value_t &d1, value_t &d2, value_t &x1, const value_t y1,
+                   value_t &flag, value_t &h11, value_t &h21, value_t &h12,
+                   value_t &h22);
+
 /*! Rotg.
- * @brief Implements the rotg (blas level 1 api)
+ * @brief Implements the rotg (blas level 1 api). Each work item computes the
+ * rotation of one element of the views, so that views of size N compute N
+ * rotations at once.
  */
 template <typename operand_t>
 struct Rotg {
@@ -203,7 +291,9 @@ struct Rotg {
 };
 
 /*! Rotmg.
- * @brief Implements the rotmg (blas level 1 api)
+ * @brief Implements the rotmg (blas level 1 api). Each work item computes the
+ * transformation of one element of the views and writes its parameters at
+ * i * param_stride_ in param_.
  */
 template <typename operand_t>
 struct Rotmg {
@@ -214,8 +304,9 @@ struct Rotmg {
   operand_t x1_;
   operand_t y1_;
   operand_t param_;
+  index_t param_stride_;
   Rotmg(operand_t &d1, operand_t &d2, operand_t &x1, operand_t &y1,
-        operand_t &param);
+        operand_t &param, index_t param_stride);
   index_t get_size() const;
   value_t eval(index_t i);
   value_t eval(cl::sycl::nd_item<1> ndItem);
@@ -224,6 +315,88 @@ struct Rotmg {
   void adjust_access_displacement();
 };
 
+/*! RotBatched.
+ * @brief Applies a batch of independent plane rotations to a matrix in one
+ * kernel. Rotation k acts on the rows (Left) or the columns (!Left) pairs_(2k)
+ * and pairs_(2k + 1) of matrix_ as rot does on x and y, with the cosine
+ * cos_(k) and the sine sin_(k). The pairs of the batch must be disjoint. Each
+ * work item updates one element of both lines of a rotation.
+ */
+template <bool Left, typename matrix_t, typename vector_t,
+          typename index_vector_t>
+struct RotBatched {
+  using value_t = typename vector_t::value_t;
+  using index_t = typename vector_t::index_t;
+  matrix_t matrix_;
+  vector_t cos_;
+  vector_t sin_;
+  index_vector_t pairs_;
+  RotBatched(matrix_t &matrix, vector_t &cos, vector_t &sin,
+             index_vector_t &pairs);
+  value_t &get_element(index_t line, index_t pos);
+  index_t get_line_size() const;
+  index_t get_size() const;
+  value_t eval(index_t i);
+  value_t eval(cl::sycl::nd_item<1> ndItem);
+  bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
+  void bind(cl::sycl::handler &h);
+  void adjust_access_displacement();
+};
+
+template <bool Left, typename matrix_t, typename vector_t,
+          typename index_vector_t>
+inline RotBatched<Left, matrix_t, vector_t, index_vector_t> make_rot_batched(
+    matrix_t &matrix, vector_t &cos, vector_t &sin, index_vector_t &pairs) {
+  return RotBatched<Left, matrix_t, vector_t, index_vector_t>(matrix, cos, sin,
+                                                              pairs);
+}
+
+/*! Lasr.
+ * @brief Applies a sequence of z - 1 plane rotations to a matrix, as LAPACK's
+ * lasr does, where z is the number of rows (Left) or columns (!Left) of
+ * matrix_. Rotation j acts on the lines (j, j + 1) for the variable pivot
+ * 'v', (0, j + 1) for the top pivot 't' and (j, z - 1) for the bottom pivot
+ * 'b', with the cosine cos_(j) and the sine sin_(j), in increasing order of j
+ * if forward_ and in decreasing order otherwise.
+ *
+ * Every work item owns one column (Left) or one row (!Left) of matrix_ and
+ * applies the whole sequence to it, carrying the element shared by consecutive
+ * rotations in a register. The work group streams its panel of matrix_
+ * through local memory in local_range x local_range tiles, so that the
+ * loads and stores of global memory are coalesced for both sides.
+ *
+ * @tparam local_range  the number of work items per work group, which is also
+ *                      the order of the tiles
+ */
+template <bool Left, uint32_t local_range, typename matrix_t,
+          typename vector_t>
+struct Lasr {
+  using value_t = typename vector_t::value_t;
+  using index_t = typename vector_t::index_t;
+  matrix_t matrix_;
+  vector_t cos_;
+  vector_t sin_;
+  char pivot_;
+  bool forward_;
+  Lasr(matrix_t &matrix, vector_t &cos, vector_t &sin, char pivot,
+       bool forward);
+  value_t &get_element(index_t line, index_t pos);
+  index_t get_size() const;
+  bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
+  template <typename sharedT>
+  value_t eval(sharedT shrMem, cl::sycl::nd_item<1> ndItem);
+  void bind(cl::sycl::handler &h);
+  void adjust_access_displacement();
+};
+
+template <bool Left, uint32_t local_range, typename matrix_t,
+          typename vector_t>
+inline Lasr<Left, local_range, matrix_t, vector_t> make_lasr(
+    matrix_t &matrix, vector_t &cos, vector_t &sin, char pivot, bool forward) {
+  return Lasr<Left, local_range, matrix_t, vector_t>(matrix, cos, sin, pivot,
+                                                     forward);
+}
+
 template <typename operator_t, typename lhs_t, typename rhs_t, typename index_t>
 inline AssignReduction<operator_t, lhs_t, rhs_t> make_assign_reduction(
     lhs_t &lhs_, rhs_t &rhs_, index_t local_num_thread_,
@@ -103,6 +103,63 @@ make_gemv(lhs_t &lhs_, matrix_t &matrix_, vector_t &vector_,
                                                 wgs_per_nc_, wgs_per_c_);
 }
 
+/**
+ * @struct GemvCpu
+ * @brief Tree node representing a Gemv for CPU devices, computing
+ * lhs_ = alpha_ * matrix_ * vector_ + beta_ * lhs_ in a single kernel with one
+ * work item per work group.
+ *
+ * Without transposition every work item owns block_size consecutive rows of
+ * lhs_, kept in vector registers while it streams over the columns of
+ * matrix_. With transposition every work item owns item_cols columns of
+ * matrix_ and walks down them in chunks of block_size rows, the matching chunk
+ * of vector_ being copied to local memory so that it stays in L1.
+ *
+ * @tparam block_size  rows of lhs_ per work item, or length of the chunks of
+ *                     vector_ when transposed
+ * @tparam vector_size  number of elements in a vector register
+ */
+template <typename lhs_t, typename matrix_t, typename vector_t,
+          uint32_t block_size, uint32_t vector_size, bool is_transposed>
+struct GemvCpu {
+  using value_t = typename std::remove_cv<typename vector_t::value_t>::type;
+  using index_t = typename vector_t::index_t;
+  /*! @brief Columns of matrix_ per work item when transposed */
+  static constexpr index_t item_cols = 8;
+  /*! @brief Size (in elements) of the local memory, only used when transposed
+   */
+  static constexpr index_t local_memory_size = is_transposed ? block_size : 1;
+
+  lhs_t lhs_;
+  matrix_t matrix_;
+  vector_t vector_;
+  value_t alpha_;
+  value_t beta_;
+
+  GemvCpu(lhs_t &_l, matrix_t &_matrix, vector_t &_vector, value_t _alpha,
+          value_t _beta);
+  index_t get_size() const;
+  index_t get_num_work_items() const;
+  bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
+  template <typename local_memory_t>
+  value_t eval(local_memory_t local_mem, cl::sycl::nd_item<1> ndItem);
+  void bind(cl::sycl::handler &h);
+  void adjust_access_displacement();
+};
+
+/*!
+ * @brief Generator/factory for CPU GEMV trees.
+ */
+template <uint32_t block_size, uint32_t vector_size, bool is_transposed,
+          typename lhs_t, typename matrix_t, typename vector_t,
+          typename value_t>
+GemvCpu<lhs_t, matrix_t, vector_t, block_size, vector_size, is_transposed>
+make_gemv_cpu(lhs_t &lhs_, matrix_t &matrix_, vector_t &vector_,
+              value_t alpha_, value_t beta_) {
+  return GemvCpu<lhs_t, matrix_t, vector_t, block_size, vector_size,
+                 is_transposed>(lhs_, matrix_, vector_, alpha_, beta_);
+}
+
 template <typename rhs_t>
 struct SumMatrixColumns {
   using value_t = typename rhs_t::value_t;
@@ -266,6 +323,307 @@ Gbmv<lhs_t, matrix_t, vector_t, local_range, is_transposed> make_gbmv(
       lhs_, matrix_, kl_, ku_, vector_);
 }
 
+/**
+ * @struct Sbmv
+ * @brief Tree node representing a symmetric band matrix_ vector_
+ * multiplication, matrix_ holding one triangle in the band storage of Gbmv.
+ *
+ * @tparam is_upper  whether the upper or the lower triangle is stored
+ */
+template <typename lhs_t, typename matrix_t, typename vector_t,
+          uint32_t local_range, bool is_upper>
+struct Sbmv {
+  using value_t = typename vector_t::value_t;
+  using index_t = typename vector_t::index_t;
+  // A padded tile of the matrix and the matching segment of vector_
+  static constexpr index_t local_memory_size =
+      local_range * (local_range + 1) + local_range;
+
+  lhs_t lhs_;
+  matrix_t matrix_;
+  index_t k_;
+  vector_t vector_;
+
+  Sbmv(lhs_t &_l, matrix_t &_matrix, index_t &_k, vector_t &_vector);
+  index_t get_size() const;
+  bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
+  template <typename sharedT>
+  value_t eval(sharedT shrMem, cl::sycl::nd_item<1> ndItem);
+  void bind(cl::sycl::handler &h);
+  void adjust_access_displacement();
+};
+/*!
+ @brief Generator/factory for SBMV trees.
+ */
+template <uint32_t local_range, bool is_upper, typename lhs_t,
+          typename matrix_t, typename vector_t>
+Sbmv<lhs_t, matrix_t, vector_t, local_range, is_upper> make_sbmv(
+    lhs_t &lhs_, matrix_t &matrix_, typename vector_t::index_t k_,
+    vector_t &vector_) {
+  return Sbmv<lhs_t, matrix_t, vector_t, local_range, is_upper>(
+      lhs_, matrix_, k_, vector_);
+}
+
+/**
+ * @struct Tbmv
+ * @brief Tree node representing a triangular band matrix_ vector_
+ * multiplication, matrix_ holding the triangle in the band storage of Gbmv.
+ *
+ * @tparam is_upper  whether matrix_ is upper or lower triangular
+ * @tparam is_transposed  whether matrix_ should be transposed
+ * @tparam is_unit  whether the diagonal of matrix_ is assumed to be all ones
+ */
+template <typename lhs_t, typename matrix_t, typename vector_t,
+          uint32_t local_range, bool is_upper, bool is_transposed,
+          bool is_unit>
+struct Tbmv {
+  using value_t = typename vector_t::value_t;
+  using index_t = typename vector_t::index_t;
+
+  lhs_t lhs_;
+  matrix_t matrix_;
+  index_t k_;
+  vector_t vector_;
+
+  Tbmv(lhs_t &_l, matrix_t &_matrix, index_t &_k, vector_t &_vector);
+  index_t get_size() const;
+  bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
+  value_t eval(cl::sycl::nd_item<1> ndItem);
+  void bind(cl::sycl::handler &h);
+  void adjust_access_displacement();
+};
+/*!
+ @brief Generator/factory for TBMV trees.
+ */
+template <uint32_t local_range, bool is_upper, bool is_transposed,
+          bool is_unit, typename lhs_t, typename matrix_t, typename vector_t>
+Tbmv<lhs_t, matrix_t, vector_t, local_range, is_upper, is_transposed, is_unit>
+make_tbmv(lhs_t &lhs_, matrix_t &matrix_, typename vector_t::index_t k_,
+          vector_t &vector_) {
+  return Tbmv<lhs_t, matrix_t, vector_t, local_range, is_upper, is_transposed,
+              is_unit>(lhs_, matrix_, k_, vector_);
+}
+
+/**
+ * @struct Spmv
+ * @brief Tree node representing a symmetric packed matrix_ vector_
+ * multiplication, matrix_ being a view with a packed_upper or packed_lower
+ * layout.
+ *
+ * @tparam is_upper  whether the upper or the lower triangle is stored
+ */
+template <typename lhs_t, typename matrix_t, typename vector_t,
+          uint32_t local_range, bool is_upper>
+struct Spmv {
+  using value_t = typename vector_t::value_t;
+  using index_t = typename vector_t::index_t;
+  // A padded tile of matrix_ and the matching segment of vector_
+  static constexpr index_t local_memory_size =
+      local_range * (local_range + 1) + local_range;
+
+  lhs_t lhs_;
+  matrix_t matrix_;
+  vector_t vector_;
+
+  Spmv(lhs_t &_l, matrix_t &_matrix, vector_t &_vector);
+  index_t get_size() const;
+  bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
+  template <typename sharedT>
+  value_t eval(sharedT shrMem, cl::sycl::nd_item<1> ndItem);
+  void bind(cl::sycl::handler &h);
+  void adjust_access_displacement();
+};
+/*!
+ @brief Generator/factory for SPMV trees.
+ */
+template <uint32_t local_range, bool is_upper, typename lhs_t,
+          typename matrix_t, typename vector_t>
+Spmv<lhs_t, matrix_t, vector_t, local_range, is_upper> make_spmv(
+    lhs_t &lhs_, matrix_t &matrix_, vector_t &vector_) {
+  return Spmv<lhs_t, matrix_t, vector_t, local_range, is_upper>(
+      lhs_, matrix_, vector_);
+}
+
+/**
+ * @struct Tpmv
+ * @brief Tree node representing a triangular packed matrix_ vector_
+ * multiplication, matrix_ being a view with a packed_upper or packed_lower
+ * layout.
+ *
+ * @tparam is_upper  whether matrix_ is upper or lower triangular
+ * @tparam is_transposed  whether matrix_ should be transposed
+ * @tparam is_unit  whether the diagonal of matrix_ is assumed to be all ones
+ */
+template <typename lhs_t, typename matrix_t, typename vector_t,
+          uint32_t local_range, bool is_upper, bool is_transposed,
+          bool is_unit>
+struct Tpmv {
+  using value_t = typename vector_t::value_t;
+  using index_t = typename vector_t::index_t;
+
+  lhs_t lhs_;
+  matrix_t matrix_;
+  vector_t vector_;
+
+  Tpmv(lhs_t &_l, matrix_t &_matrix, vector_t &_vector);
+  index_t get_size() const;
+  bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
+  value_t eval(cl::sycl::nd_item<1> ndItem);
+  void bind(cl::sycl::handler &h);
+  void adjust_access_displacement();
+};
+/*!
+ @brief Generator/factory for TPMV trees.
+ */
+template <uint32_t local_range, bool is_upper, bool is_transposed,
+          bool is_unit, typename lhs_t, typename matrix_t, typename vector_t>
+Tpmv<lhs_t, matrix_t, vector_t, local_range, is_upper, is_transposed, is_unit>
+make_tpmv(lhs_t &lhs_, matrix_t &matrix_, vector_t &vector_) {
+  return Tpmv<lhs_t, matrix_t, vector_t, local_range, is_upper, is_transposed,
+              is_unit>(lhs_, matrix_, vector_);
+}
+
+/**
+ * @struct Trsv
+ * @brief Tree node representing a blocked triangular solve
+ * op(matrix_) * x = vector_, the solution overwriting vector_.
+ *
+ * The diagonal is split in blocks of block_size rows, taken in the order of
+ * the substitution. A single work group walks through the blocks in one
+ * launch: for each block it subtracts the contributions of the solved blocks
+ * reached by the band, reading them back from vector_, and then solves the
+ * diagonal block in local memory. Only the triangle of matrix_ is read, so it
+ * can also be a packed_upper or packed_lower view.
+ *
+ * @tparam block_size  rows of the diagonal blocks, and work group size
+ * @tparam is_upper  whether matrix_ is upper or lower triangular
+ * @tparam is_transposed  whether matrix_ should be transposed
+ * @tparam is_unit  whether the diagonal of matrix_ is assumed to be all ones
+ * @tparam is_banded  whether matrix_ holds k_ off-diagonals in the band
+ *                    storage of Tbmv rather than a full triangle
+ */
+template <typename matrix_t, typename vector_t, uint32_t block_size,
+          bool is_upper, bool is_transposed, bool is_unit, bool is_banded>
+struct Trsv {
+  using value_t = typename vector_t::value_t;
+  using index_t = typename vector_t::index_t;
+  /*! @brief Size (in elements) of the local memory: a padded tile of op(A)
+   * and a block of the vector */
+  static constexpr index_t local_memory_size =
+      block_size * (block_size + 1) + block_size;
+
+  matrix_t matrix_;
+  vector_t vector_;
+  index_t k_;
+
+  Trsv(matrix_t &_matrix, vector_t &_vector, index_t _k);
+  index_t get_size() const;
+  index_t get_num_blocks() const;
+  bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
+  template <typename local_memory_t>
+  value_t eval(local_memory_t local_mem, cl::sycl::nd_item<1> ndItem);
+  void bind(cl::sycl::handler &h);
+  void adjust_access_displacement();
+
+ private:
+  value_t read_op_matrix(index_t row, index_t col) const;
+  void get_block_rows(index_t block, index_t &first, index_t &last) const;
+  template <typename local_ptr_t>
+  void load_tile(local_ptr_t tile, index_t row_first, index_t row_last,
+                 index_t col_first, index_t col_last, index_t local_id) const;
+};
+/*!
+ @brief Generator/factory for TRSV trees.
+ */
+template <uint32_t block_size, bool is_upper, bool is_transposed, bool is_unit,
+          bool is_banded, typename matrix_t, typename vector_t>
+Trsv<matrix_t, vector_t, block_size, is_upper, is_transposed, is_unit,
+     is_banded>
+make_trsv(matrix_t &matrix_, vector_t &vector_,
+          typename vector_t::index_t k_) {
+  return Trsv<matrix_t, vector_t, block_size, is_upper, is_transposed,
+              is_unit, is_banded>(matrix_, vector_, k_);
+}
+
+/**
+ * @struct Spr
+ * @brief Tree node representing a symmetric rank 1 update of a packed matrix,
+ * lhs_ = lhs_ + scalar_ * vector_ * vector_^T, with one work item per stored
+ * element so that consecutive work items update consecutive elements.
+ *
+ * @tparam is_upper  whether the upper or the lower triangle of lhs_ is stored
+ */
+template <bool is_upper, typename lhs_t, typename vector_t>
+struct Spr {
+  using value_t = typename vector_t::value_t;
+  using index_t = typename vector_t::index_t;
+
+  lhs_t lhs_;
+  value_t scalar_;
+  vector_t vector_;
+
+  Spr(lhs_t &_l, value_t _scl, vector_t &_vector);
+  index_t get_size() const;
+  bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
+  value_t eval(index_t i);
+  value_t eval(cl::sycl::nd_item<1> ndItem);
+  void bind(cl::sycl::handler &h);
+  void adjust_access_displacement();
+};
+/*!
+ @brief Generator/factory for SPR trees.
+ */
+template <bool is_upper, typename lhs_t, typename vector_t>
+Spr<is_upper, lhs_t, vector_t> make_spr(lhs_t &lhs_,
+                                        typename vector_t::value_t scalar_,
+                                        vector_t &vector_) {
+  return Spr<is_upper, lhs_t, vector_t>(lhs_, scalar_, vector_);
+}
+
+/**
+ * @struct Symv
+ * @brief Tree node representing a blocked symmetric matrix_ vector_
+ * multiplication.
+ *
+ * Each work group owns every G-th block row of the stored triangle, G being
+ * the number of work groups, and loads every tile of it into local memory
+ * once, applying both the tile and its transpose. The partial products of
+ * work group g are accumulated in column g of lhs_, so the result is obtained
+ * by summing the G columns of lhs_.
+ *
+ * @tparam Upper  whether the upper or the lower triangle of matrix_ is stored
+ * @tparam local_range  the number of work items per work group, which is also
+ *                      the order of the tiles
+ */
+template <bool Upper, uint32_t local_range, typename lhs_t, typename matrix_t,
+          typename vector_t>
+struct Symv {
+  using value_t = typename vector_t::value_t;
+  using index_t = typename vector_t::index_t;
+
+  lhs_t lhs_;
+  matrix_t matrix_;
+  vector_t vector_;
+
+  Symv(lhs_t &_l, matrix_t &_matrix, vector_t &_vector);
+  index_t get_size() const;
+  bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
+  template <typename sharedT>
+  value_t eval(sharedT shrMem, cl::sycl::nd_item<1> ndItem);
+  void bind(cl::sycl::handler &h);
+  void adjust_access_displacement();
+};
+/*!
+ @brief Generator/factory for SYMV trees.
+ */
+template <bool Upper, uint32_t local_range, typename lhs_t, typename matrix_t,
+          typename vector_t>
+Symv<Upper, local_range, lhs_t, matrix_t, vector_t> make_symv(
+    lhs_t &lhs_, matrix_t &matrix_, vector_t &vector_) {
+  return Symv<Upper, local_range, lhs_t, matrix_t, vector_t>(lhs_, matrix_,
+                                                             vector_);
+}
+
 /**** GER BY ROWS M ROWS x N BLOCK USING PROPERLY THE SHARED MEMORY ****/
 // template <typename lhs_t,typename rhs_1_t,typename rhs_2_t>
 template <bool Single, bool Lower, bool Diag, bool Upper, typename lhs_t,
@@ -343,5 +701,68 @@ GerCol<Single, Lower, Diag, Upper, lhs_t, rhs_1_t, rhs_2_t> make_ger_col(
       lhs_, scalar_, rhs_1_, rhs_2_, nWG_row_, nWG_col_, local_memory_size_);
 }
 
+/**
+ * @struct GerTiled
+ * @brief Tree node representing a tiled rank-k update of a matrix:
+ *   lhs_ += scalar_ * rhs_1_ * rhs_2_^T                      (Single)
+ *   lhs_ += scalar_ * (rhs_1_ * rhs_2_^T + rhs_2_ * rhs_1_^T) (!Single)
+ * where rhs_1_ and rhs_2_ hold the k vectors of the update as columns, k being
+ * 1 for ger, syr and syr2.
+ *
+ * Each work group owns a (local_range * item_rows) x tile_cols tile of lhs_.
+ * The segments of the vectors matching the rows and the columns of the tile
+ * are staged in local memory, k_block vectors at a time, and each work item
+ * accumulates the update of item_rows rows of every column of the tile in
+ * registers, its rows being local_range apart (row r of work item i is row
+ * r * local_range + i of the tile). Consecutive work items thus access
+ * consecutive elements of lhs_ and of the staged vectors, which coalesces the
+ * global accesses and avoids local memory bank conflicts. The tile is then
+ * read and written once, whatever k is.
+ *
+ * @tparam Single  whether the update is rhs_1_ * rhs_2_^T or symmetric
+ * @tparam Lower  whether the elements below the diagonal are updated
+ * @tparam Upper  whether the elements above the diagonal are updated
+ * @tparam local_range  the number of work items per work group
+ * @tparam item_rows  the number of rows of each work item
+ * @tparam tile_cols  the number of columns of a tile
+ * @tparam k_block  the number of vectors staged in local memory at once
+ */
+template <bool Single, bool Lower, bool Upper, uint32_t local_range,
+          uint32_t item_rows, uint32_t tile_cols, uint32_t k_block,
+          typename lhs_t, typename rhs_1_t, typename rhs_2_t>
+struct GerTiled {
+  using value_t = typename lhs_t::value_t;
+  using index_t = typename lhs_t::index_t;
+  static constexpr index_t tile_rows = local_range * item_rows;
+  // Elements of local memory the tree needs
+  static constexpr index_t local_memory_size =
+      (Single ? 1 : 2) * k_block * (tile_rows + tile_cols);
+
+  lhs_t lhs_;
+  value_t scalar_;
+  rhs_1_t rhs_1_;
+  rhs_2_t rhs_2_;
+
+  GerTiled(lhs_t &_l, value_t _scl, rhs_1_t &_r1, rhs_2_t &_r2);
+  index_t get_size() const;
+  bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
+  template <typename sharedT>
+  value_t eval(sharedT shrMem, cl::sycl::nd_item<1> ndItem);
+  void bind(cl::sycl::handler &h);
+  void adjust_access_displacement();
+};
+
+template <bool Single, bool Lower, bool Upper, uint32_t local_range,
+          uint32_t item_rows, uint32_t tile_cols, uint32_t k_block,
+          typename lhs_t, typename rhs_1_t, typename rhs_2_t>
+GerTiled<Single, Lower, Upper, local_range, item_rows, tile_cols, k_block,
+         lhs_t, rhs_1_t, rhs_2_t>
+make_ger_tiled(lhs_t &lhs_, typename lhs_t::value_t scalar_, rhs_1_t &rhs_1_,
+               rhs_2_t &rhs_2_) {
+  return GerTiled<Single, Lower, Upper, local_range, item_rows, tile_cols,
+                  k_block, lhs_t, rhs_1_t, rhs_2_t>(lhs_, scalar_, rhs_1_,
+                                                    rhs_2_);
+}
+
 }  // namespace blas
 #endif  // BLAS2_TREES_H
@@ -40,9 +40,15 @@ enum class gemm_memory_t : int { local = 0, no_local = 1, subgroup = 2 };
 /*
  * @brief Indicates which Gemm algorithm to use.
  * It can be either naive to use a naive algorithm, standard for the default
- * algorithms, or tall_skinny for tall and skinny matrices
+ * algorithms, tall_skinny for tall and skinny matrices, or cache_blocked for
+ * the packed, one work item per core algorithm of CPU devices
  */
-enum class gemm_algorithm_t : int { naive = 0, standard = 1, tall_skinny = 2 };
+enum class gemm_algorithm_t : int {
+  naive = 0,
+  standard = 1,
+  tall_skinny = 2,
+  cache_blocked = 3
+};
 /*!
  * @brief Indicates which vectorization approach to use.
  * none: No vectorization is used.
@@ -265,6 +271,202 @@ make_gemm(input_t buffer_a, input_t buffer_b, output_t buffer_c,
                               batch_size);
 }
 
+/*!
+ * @brief Shape dependent parameters of GemmSpecialized.
+ *
+ * When SYCL_BLAS_SPEC_CONSTANTS is set they are passed to the kernel as
+ * specialization constants, so the JIT compiler sees them as literals and can
+ * fold the boundary checks, strides and alpha/beta special cases. Otherwise
+ * they are ordinary kernel arguments.
+ */
+template <typename index_t>
+struct GemmSpecParams {
+  index_t m;
+  index_t n;
+  index_t k;
+  index_t lda;
+  index_t ldb;
+  index_t ldc;
+  index_t wg_rows;
+  index_t wg_cols;
+  bool alpha_one;
+  bool beta_zero;
+};
+
+/*!
+ * @brief GEMM kernel whose only compile time tile parameters are the ones
+ * sizing private arrays.
+ *
+ * Each work item computes ItemRows*ItemCols elements of C held in registers,
+ * so those two stay template parameters. The work group shape (wg_rows by
+ * wg_cols work items), the matrix sizes and leading dimensions and the
+ * alpha == 1 and beta == 0 cases are GemmSpecParams, chosen at run time and
+ * specialized at JIT time. This gives kernels specialized for the shapes
+ * actually used without instantiating one Gemm per tile configuration.
+ *
+ * The rows of a work item are wg_rows apart (and its columns wg_cols apart)
+ * so that neighbouring work items access neighbouring elements. As in Gemm,
+ * the work group stages block_depth columns of its tile of op(A) and rows of
+ * its tile of op(B) in local memory at a time, all its work items loading
+ * them with coalesced reads. The local memory is sized by
+ * get_local_memory_size from the same GemmSpecParams that become the
+ * specialization constants.
+ *
+ * @tparam ItemRows Number of rows of C computed by each work item
+ * @tparam ItemCols Number of columns of C computed by each work item
+ * @tparam TransA Whether A is transposed
+ * @tparam TransB Whether B is transposed
+ *
+ * @Note This kernel assumes the column-major matrices
+ */
+template <int ItemRows, int ItemCols, bool TransA, bool TransB,
+          typename input_t, typename output_t>
+struct GemmSpecialized {
+  using index_t = typename std::make_signed<typename input_t::index_t>::type;
+  using value_t = typename std::remove_cv<typename input_t::value_t>::type;
+  using params_t = GemmSpecParams<index_t>;
+  static constexpr index_t item_rows = ItemRows;
+  static constexpr index_t item_cols = ItemCols;
+  static constexpr index_t block_depth = 8;
+  input_t a_;
+  input_t b_;
+  output_t c_;
+  value_t alpha_;
+  value_t beta_;
+  index_t batch_size_;
+  params_t params_;
+
+  GemmSpecialized(input_t A, input_t B, output_t C, value_t alpha,
+                  value_t beta, index_t batch_size, index_t wg_rows,
+                  index_t wg_cols);
+  static index_t get_num_tiles(const params_t& params);
+  static index_t get_local_memory_size(const params_t& params);
+  cl::sycl::nd_range<1> get_nd_range() const;
+  index_t get_local_memory_size() const;
+  bool valid_thread(cl::sycl::nd_item<1> id) const;
+  template <typename local_memory_t>
+  void eval(local_memory_t local_mem, cl::sycl::nd_item<1> id,
+            const params_t& params) noexcept;
+  template <typename local_memory_t>
+  void eval(local_memory_t local_mem, cl::sycl::nd_item<1> id) noexcept;
+  void set_spec_constants(cl::sycl::handler& h) const;
+  void bind(cl::sycl::handler& h);
+  void adjust_access_displacement();
+};
+
+/*!
+ * @brief Kernel functor of GemmSpecialized, reading the GemmSpecParams from
+ * the specialization constants when they are supported.
+ */
+template <typename gemm_t, typename local_memory_t>
+struct GemmSpecializedFunctor;
+
+template <int ItemRows, int ItemCols, bool TransA, bool TransB,
+          typename input_t, typename output_t, typename element_t,
+          typename index_t>
+GemmSpecialized<ItemRows, ItemCols, TransA, TransB, input_t, output_t>
+make_gemm_specialized(input_t buffer_a, input_t buffer_b, output_t buffer_c,
+                      element_t alpha, element_t beta, index_t batch_size,
+                      index_t wg_rows, index_t wg_cols) {
+  return GemmSpecialized<ItemRows, ItemCols, TransA, TransB, input_t,
+                         output_t>(buffer_a, buffer_b, buffer_c, alpha, beta,
+                                   batch_size, wg_rows, wg_cols);
+}
+
+/*!
+ * @brief Number of columns of the panels written by _gemm_pack_b and read by
+ * _gemm_packed, i.e. the vector size of the loads of packed B.
+ */
+constexpr int gemm_packed_panel_cols = 4;
+
+/*!
+ * @brief Copies the K x N matrix op(B) into the panel-major layout read by
+ * GemmPacked.
+ *
+ * The columns are grouped into panels of PanelCols columns, the last one being
+ * padded with zeros. Panels are stored one after the other, each one row by
+ * row, so that element (k, j) lives at
+ * (j / PanelCols) * K * PanelCols + k * PanelCols + j % PanelCols and a row of
+ * a panel is a single aligned vector.
+ *
+ * @tparam PanelCols Number of columns of a panel
+ * @tparam TransB Whether B is transposed
+ */
+template <int PanelCols, bool TransB, typename input_t, typename output_t>
+struct GemmPackB {
+  using index_t = typename std::make_signed<typename input_t::index_t>::type;
+  using value_t = typename std::remove_cv<typename input_t::value_t>::type;
+  static constexpr index_t panel_cols = PanelCols;
+  input_t b_;
+  output_t packed_;
+  index_t k_;
+  index_t n_;
+
+  GemmPackB(input_t B, output_t packed, index_t k, index_t n);
+  /*! @brief Number of elements of the packed matrix, padding included */
+  static index_t get_packed_size(index_t k, index_t n);
+  index_t get_size() const;
+  bool valid_thread(cl::sycl::nd_item<1> id) const;
+  void eval(cl::sycl::nd_item<1> id) noexcept;
+  void bind(cl::sycl::handler& h);
+  void adjust_access_displacement();
+};
+
+template <int PanelCols, bool TransB, typename input_t, typename output_t,
+          typename index_t>
+GemmPackB<PanelCols, TransB, input_t, output_t> make_gemm_pack_b(
+    input_t buffer_b, output_t buffer_packed, index_t k, index_t n) {
+  return GemmPackB<PanelCols, TransB, input_t, output_t>(
+      buffer_b, buffer_packed, k, n);
+}
+
+/*!
+ * @brief GEMM kernel reading B from the layout written by GemmPackB.
+ *
+ * Each work item computes ItemRows rows of one panel of C, i.e. ItemRows x
+ * PanelCols elements. A row of the packed panel is read with one vector load,
+ * without bounds checks since the panels are padded, and is shared by the
+ * ItemRows rows of A. As in GemmSpecialized, the rows of a work item are
+ * wg_rows apart so that neighbouring work items read neighbouring elements of
+ * A. No local memory is used.
+ *
+ * @tparam ItemRows Number of rows of C computed by each work item
+ * @tparam PanelCols Number of columns of a panel of packed B
+ * @tparam TransA Whether A is transposed
+ */
+template <int ItemRows, int PanelCols, bool TransA, typename input_t,
+          typename output_t>
+struct GemmPacked {
+  using index_t = typename std::make_signed<typename input_t::index_t>::type;
+  using value_t = typename std::remove_cv<typename input_t::value_t>::type;
+  static constexpr index_t item_rows = ItemRows;
+  static constexpr index_t panel_cols = PanelCols;
+  input_t a_;
+  input_t packed_b_;
+  output_t c_;
+  value_t alpha_;
+  value_t beta_;
+  index_t wg_rows_;
+  index_t wg_cols_;
+
+  GemmPacked(input_t A, input_t packed_B, output_t C, value_t alpha,
+             value_t beta, index_t wg_rows, index_t wg_cols);
+  cl::sycl::nd_range<1> get_nd_range() const;
+  bool valid_thread(cl::sycl::nd_item<1> id) const;
+  void eval(cl::sycl::nd_item<1> id) noexcept;
+  void bind(cl::sycl::handler& h);
+  void adjust_access_displacement();
+};
+
+template <int ItemRows, int PanelCols, bool TransA, typename input_t,
+          typename output_t, typename element_t, typename index_t>
+GemmPacked<ItemRows, PanelCols, TransA, input_t, output_t> make_gemm_packed(
+    input_t buffer_a, input_t buffer_packed_b, output_t buffer_c,
+    element_t alpha, element_t beta, index_t wg_rows, index_t wg_cols) {
+  return GemmPacked<ItemRows, PanelCols, TransA, input_t, output_t>(
+      buffer_a, buffer_packed_b, buffer_c, alpha, beta, wg_rows, wg_cols);
+}
+
 /**
  * @brief Kernel that inverts the square diagonal blocks of a matrix. This
  * is used in the TRSM algorithm.
@@ -304,8 +506,12 @@ struct DiagonalBlocksInverter {
   matrix_t invA_;
   index_t lda_;
   index_t N_;
+  index_t batchSize_;
+  index_t strideA_;
+  index_t strideInvA_;
 
-  DiagonalBlocksInverter(matrix_t& A, matrix_t& invA);
+  DiagonalBlocksInverter(matrix_t& A, matrix_t& invA, index_t batchSize = 1,
+                         index_t strideA = 0, index_t strideInvA = 0);
   bool valid_thread(cl::sycl::nd_item<1> id) const;
   void bind(cl::sycl::handler& cgh);
   void adjust_access_displacement();
@@ -314,10 +520,236 @@ struct DiagonalBlocksInverter {
   void eval(local_memory_t localMem, cl::sycl::nd_item<1> id) noexcept;
 };
 
-template <bool UnitDiag, bool Upper, int BlockSize, typename matrix_t>
+/*!
+ * @brief Creates a DiagonalBlocksInverter. When batchSize is larger than one,
+ * the diagonal blocks of batchSize matrices, separated by strideA elements in
+ * A and strideInvA elements in invA, are inverted in a single launch.
+ */
+template <bool UnitDiag, bool Upper, int BlockSize, typename matrix_t,
+          typename index_t = typename matrix_t::index_t>
 DiagonalBlocksInverter<UnitDiag, Upper, BlockSize, matrix_t>
-make_diag_blocks_inverter(matrix_t& A, matrix_t& invA) {
-  return DiagonalBlocksInverter<UnitDiag, Upper, BlockSize, matrix_t>(A, invA);
+make_diag_blocks_inverter(matrix_t& A, matrix_t& invA, index_t batchSize = 1,
+                          index_t strideA = 0, index_t strideInvA = 0) {
+  return DiagonalBlocksInverter<UnitDiag, Upper, BlockSize, matrix_t>(
+      A, invA, batchSize, strideA, strideInvA);
+}
+
+/*!
+ * @brief Solves a batch of small triangular systems, one system per work
+ * group.
+ *
+ * Each work group loads the triangle of its matrix into local memory once,
+ * storing the reciprocal of the diagonal, and then every work item solves one
+ * or more right hand sides by forward or backward substitution. The right hand
+ * sides are columns of B when A is on the left and rows of B when A is on the
+ * right, since X*op(A) = alpha*B is solved as op(A)^T*X^T = alpha*B^T.
+ *
+ * The triangle kept in local memory is the one of the effective system matrix
+ * S = op(A) (left side) or S = op(A)^T (right side), so Lower refers to S and
+ * not to the stored matrix A.
+ *
+ * @tparam UnitDiag Whether the diagonal of A is assumed to be one
+ * @tparam Lower Whether the effective system matrix S is lower triangular
+ * @tparam MaxSize Maximum order of the systems, which is also the work group
+ *                 size. Local memory holds MaxSize*MaxSize elements.
+ *
+ * @Note This kernel assumes the column-major matrices
+ */
+template <bool UnitDiag, bool Lower, int MaxSize, typename matrix_a_t,
+          typename matrix_b_t>
+struct TrsmBatchedSmall {
+  using index_t = typename std::make_signed<typename matrix_b_t::index_t>::type;
+  using value_t = typename std::remove_cv<typename matrix_b_t::value_t>::type;
+  static constexpr index_t max_size = MaxSize;
+  matrix_a_t A_;
+  matrix_b_t B_;
+  value_t alpha_;
+  bool isLeft_;
+  bool transA_;
+  index_t K_;
+  index_t numRhs_;
+  index_t lda_;
+  index_t ldb_;
+  index_t strideA_;
+  index_t strideB_;
+  index_t batchSize_;
+
+  TrsmBatchedSmall(matrix_a_t& A, matrix_b_t& B, value_t alpha, bool isLeft,
+                   bool transA, index_t M, index_t N, index_t strideA,
+                   index_t strideB, index_t batchSize);
+  bool valid_thread(cl::sycl::nd_item<1> id) const;
+  void bind(cl::sycl::handler& cgh);
+  void adjust_access_displacement();
+
+  template <typename local_memory_t>
+  void eval(local_memory_t localMem, cl::sycl::nd_item<1> id) noexcept;
+};
+
+/*!
+ * @brief Creates a TrsmBatchedSmall.
+ * @param transA Whether S is read as the transpose of the stored matrix A
+ * @param M Number of rows of each matrix B
+ * @param N Number of columns of each matrix B
+ */
+template <bool UnitDiag, bool Lower, int MaxSize, typename matrix_a_t,
+          typename matrix_b_t, typename element_t, typename index_t>
+TrsmBatchedSmall<UnitDiag, Lower, MaxSize, matrix_a_t, matrix_b_t>
+make_trsm_batched_small(matrix_a_t& A, matrix_b_t& B, element_t alpha,
+                        bool isLeft, bool transA, index_t M, index_t N,
+                        index_t strideA, index_t strideB, index_t batchSize) {
+  return TrsmBatchedSmall<UnitDiag, Lower, MaxSize, matrix_a_t, matrix_b_t>(
+      A, B, alpha, isLeft, transA, M, N, strideA, strideB, batchSize);
+}
+
+/*!
+ * @brief GEMM step of the blocked batched TRSM: for every matrix i of the
+ * batch, C_i = alpha*op(A_i)*op(B_i) + beta*C_i, where the operands of matrix
+ * i start strideA, strideB and strideC elements after those of matrix i - 1.
+ *
+ * The inner dimension K is at most BlockSize, as for the diagonal blocks and
+ * the panels of TRSM. Each work group of BlockSize*BlockSize work items
+ * computes one BlockSize x BlockSize tile of C of one matrix, staging the
+ * matching tiles of op(A) and op(B) in local memory, so that a block step of
+ * the solve is a single launch for the whole batch.
+ *
+ * @tparam TransA Whether A is transposed
+ * @tparam TransB Whether B is transposed
+ * @tparam BlockSize Order of the tiles and maximum inner dimension. Local
+ *                   memory holds BlockSize*(2*BlockSize + 1) elements.
+ *
+ * @Note This kernel assumes the column-major matrices
+ */
+template <bool TransA, bool TransB, int BlockSize, typename matrix_a_t,
+          typename matrix_b_t, typename matrix_c_t>
+struct TrsmBatchedGemm {
+  using index_t = typename std::make_signed<typename matrix_c_t::index_t>::type;
+  using value_t = typename std::remove_cv<typename matrix_c_t::value_t>::type;
+  static constexpr index_t block_size = BlockSize;
+  static constexpr index_t local_memory_size =
+      BlockSize * BlockSize + BlockSize * (BlockSize + 1);
+  matrix_a_t A_;
+  matrix_b_t B_;
+  matrix_c_t C_;
+  value_t alpha_;
+  value_t beta_;
+  index_t M_;
+  index_t N_;
+  index_t K_;
+  index_t lda_;
+  index_t ldb_;
+  index_t ldc_;
+  index_t strideA_;
+  index_t strideB_;
+  index_t strideC_;
+  index_t batchSize_;
+
+  TrsmBatchedGemm(matrix_a_t& A, matrix_b_t& B, matrix_c_t& C, value_t alpha,
+                  value_t beta, index_t M, index_t N, index_t K,
+                  index_t strideA, index_t strideB, index_t strideC,
+                  index_t batchSize);
+  bool valid_thread(cl::sycl::nd_item<1> id) const;
+  void bind(cl::sycl::handler& cgh);
+  void adjust_access_displacement();
+
+  template <typename local_memory_t>
+  void eval(local_memory_t localMem, cl::sycl::nd_item<1> id) noexcept;
+};
+
+/*!
+ * @brief Creates a TrsmBatchedGemm. The views only provide the buffers and the
+ * leading dimensions of the operands.
+ */
+template <bool TransA, bool TransB, int BlockSize, typename matrix_a_t,
+          typename matrix_b_t, typename matrix_c_t, typename element_t,
+          typename index_t>
+TrsmBatchedGemm<TransA, TransB, BlockSize, matrix_a_t, matrix_b_t, matrix_c_t>
+make_trsm_batched_gemm(matrix_a_t& A, matrix_b_t& B, matrix_c_t& C,
+                       element_t alpha, element_t beta, index_t M, index_t N,
+                       index_t K, index_t strideA, index_t strideB,
+                       index_t strideC, index_t batchSize) {
+  return TrsmBatchedGemm<TransA, TransB, BlockSize, matrix_a_t, matrix_b_t,
+                         matrix_c_t>(A, B, C, alpha, beta, M, N, K, strideA,
+                                     strideB, strideC, batchSize);
+}
+
+/*!
+ * @brief Merges square diagonal blocks computed out of place into the upper or
+ * lower triangle of a matrix.
+ *
+ * The i-th block of blockSize*blockSize elements of rhs (stored consecutively,
+ * column major with leading dimension blockSize) is the diagonal block starting
+ * at row and column i*blockSize of lhs. Only the elements of the requested
+ * triangle are written, as lhs = rhs + beta*lhs, so the opposite triangle of
+ * lhs is never read nor written. One work item handles one element of rhs.
+ *
+ * @tparam Upper Whether the upper or the lower triangle is updated
+ */
+template <bool Upper, typename lhs_t, typename rhs_t>
+struct DiagonalBlocksUpdate {
+  using value_t = typename std::remove_cv<typename rhs_t::value_t>::type;
+  using index_t = typename rhs_t::index_t;
+  lhs_t lhs_;
+  rhs_t rhs_;
+  value_t beta_;
+  index_t blockSize_;
+
+  DiagonalBlocksUpdate(lhs_t& lhs, rhs_t& rhs, value_t beta,
+                       index_t blockSize);
+  index_t get_size() const;
+  bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
+  value_t eval(index_t i);
+  value_t eval(cl::sycl::nd_item<1> ndItem);
+  void bind(cl::sycl::handler& h);
+  void adjust_access_displacement();
+};
+
+template <bool Upper, typename lhs_t, typename rhs_t, typename element_t,
+          typename index_t>
+DiagonalBlocksUpdate<Upper, lhs_t, rhs_t> make_diag_blocks_update(
+    lhs_t& lhs, rhs_t& rhs, element_t beta, index_t blockSize) {
+  return DiagonalBlocksUpdate<Upper, lhs_t, rhs_t>(lhs, rhs, beta, blockSize);
+}
+
+/*!
+ * @brief Expands the square diagonal blocks of a triangular or symmetric
+ * matrix into full blocks.
+ *
+ * The i-th diagonal block of rhs, starting at row and column i*blockSize, is
+ * written as the i-th block of blockSize*blockSize elements of lhs (stored
+ * consecutively, column major with leading dimension blockSize). Only the
+ * triangle given by Upper is read from rhs. The opposite triangle is mirrored
+ * when Symmetric is true and zeroed otherwise, and elements past the end of
+ * rhs are zeroed. One work item handles one element of lhs.
+ *
+ * @tparam Symmetric Whether to mirror (SYMM) or zero (TRMM) the triangle that
+ *                   is not stored
+ * @tparam Upper Whether the upper or the lower triangle of rhs is stored
+ * @tparam UnitDiag Whether the diagonal is assumed to be one instead of read
+ */
+template <bool Symmetric, bool Upper, bool UnitDiag, typename lhs_t,
+          typename rhs_t>
+struct DiagonalBlocksExpand {
+  using value_t = typename std::remove_cv<typename lhs_t::value_t>::type;
+  using index_t = typename lhs_t::index_t;
+  lhs_t lhs_;
+  rhs_t rhs_;
+  index_t blockSize_;
+
+  DiagonalBlocksExpand(lhs_t& lhs, rhs_t& rhs, index_t blockSize);
+  index_t get_size() const;
+  bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
+  value_t eval(index_t i);
+  value_t eval(cl::sycl::nd_item<1> ndItem);
+  void bind(cl::sycl::handler& h);
+  void adjust_access_displacement();
+};
+
+template <bool Symmetric, bool Upper, bool UnitDiag, typename lhs_t,
+          typename rhs_t, typename index_t>
+DiagonalBlocksExpand<Symmetric, Upper, UnitDiag, lhs_t, rhs_t>
+make_diag_blocks_expand(lhs_t& lhs, rhs_t& rhs, index_t blockSize) {
+  return DiagonalBlocksExpand<Symmetric, Upper, UnitDiag, lhs_t, rhs_t>(
+      lhs, rhs, blockSize);
 }
 
 }  // namespace blas
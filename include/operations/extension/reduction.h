@@ -177,6 +177,11 @@ class Reduction {
   cl::sycl::nd_range<1> get_nd_range(index_t compute_units) noexcept;
   void reduce(index_t global_reduce_id, index_t global_preserve_id,
               element_t& accumulator) noexcept;
+  template <typename local_ptr_t>
+  void reduce_sub_groups(local_ptr_t scratch_ptr, cl::sycl::nd_item<1> id,
+                         index_t preserve_local_id, index_t reduce_local_id,
+                         index_t global_preserve_id, index_t out_offset,
+                         element_t accumulator) noexcept;
   template <typename local_memory_t>
   void eval(local_memory_t scratch, cl::sycl::nd_item<1> id) noexcept;
 };
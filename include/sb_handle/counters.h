@@ -0,0 +1,306 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename counters.h
+ *
+ **************************************************************************/
+
+#ifndef SYCL_BLAS_COUNTERS_H
+#define SYCL_BLAS_COUNTERS_H
+
+#include "container/sycl_iterator.h"
+#include "sycl_blas_config.h"
+#include "sycl_blas_helper.h"
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <ostream>
+#include <string>
+
+namespace blas {
+
+/*!
+ * @brief Work caused by the calls of a routine: the number of calls, of
+ * kernels and other commands submitted, of scratch buffers allocated and
+ * their size in bytes, of blocking waits, and of copies between the host and
+ * the device and their size in bytes.
+ */
+struct RoutineCounters {
+  std::uint64_t calls;
+  std::uint64_t kernels;
+  std::uint64_t scratch_allocations;
+  std::uint64_t scratch_bytes;
+  std::uint64_t waits;
+  std::uint64_t copies;
+  std::uint64_t copy_bytes;
+
+  inline RoutineCounters& operator+=(const RoutineCounters& other) {
+    calls += other.calls;
+    kernels += other.kernels;
+    scratch_allocations += other.scratch_allocations;
+    scratch_bytes += other.scratch_bytes;
+    waits += other.waits;
+    copies += other.copies;
+    copy_bytes += other.copy_bytes;
+    return *this;
+  }
+};
+
+template <bool is_enabled>
+class BasicCounters;
+
+/** Counters.
+ * @brief Counters of the work the calls made through an SB_Handle cause,
+ * broken down by routine (see SB_Handle::get_counters). A routine includes
+ * the routines it calls internally, e.g the GEMMs of TRSM, and the work done
+ * outside of any routine, e.g SB_Handle::wait called by the application, is
+ * counted under "other".
+ *
+ * The counters are only updated when SYCL-BLAS is configured with the CMake
+ * option BLAS_ENABLE_COUNTERS, which is recorded in the generated
+ * sycl_blas_config.h so that the library and the application always agree
+ * on it; otherwise Counters is the empty BasicCounters<false>, every hook
+ * does nothing and they stay at zero. Like the SB_Handle they belong to, they
+ * are not synchronized between threads.
+ */
+using Counters = BasicCounters<SYCL_BLAS_COUNTERS_ENABLED != 0>;
+
+template <>
+class BasicCounters<true> {
+ public:
+  inline BasicCounters() : current_(nullptr), depth_(0) {}
+
+  // A copy starts outside of any routine, as current_ points into routines_
+  inline BasicCounters(const BasicCounters& other)
+      : routines_(other.routines_), current_(nullptr), depth_(0) {}
+
+  inline BasicCounters& operator=(const BasicCounters& other) {
+    routines_ = other.routines_;
+    current_ = nullptr;
+    depth_ = 0;
+    return *this;
+  }
+
+  static constexpr bool enabled() { return true; }
+
+  inline const std::map<std::string, RoutineCounters>& get_routines() const {
+    return routines_;
+  }
+
+  /*!
+   * @brief Counters of the routine, all zero if it has not been called.
+   */
+  inline RoutineCounters get(const std::string& routine) const {
+    auto it = routines_.find(routine);
+    return it == routines_.end() ? RoutineCounters{} : it->second;
+  }
+
+  inline RoutineCounters get_total() const {
+    RoutineCounters total{};
+    for (const auto& routine : routines_) {
+      total += routine.second;
+    }
+    return total;
+  }
+
+  /*!
+   * @brief Sets every counter back to zero.
+   */
+  inline void reset() {
+    for (auto& routine : routines_) {
+      routine.second = RoutineCounters{};
+    }
+  }
+
+  /*!
+   * @brief Writes the counters of every routine that did some work as CSV.
+   */
+  inline void write(std::ostream& os) const {
+    os << "routine,calls,kernels,scratch_allocations,scratch_bytes,waits,"
+          "copies,copy_bytes\n";
+    for (const auto& routine : routines_) {
+      const RoutineCounters& c = routine.second;
+      if (c.calls == 0 && c.kernels == 0 && c.scratch_allocations == 0 &&
+          c.waits == 0 && c.copies == 0) {
+        continue;
+      }
+      os << routine.first << "," << c.calls << "," << c.kernels << ","
+         << c.scratch_allocations << "," << c.scratch_bytes << "," << c.waits
+         << "," << c.copies << "," << c.copy_bytes << "\n";
+    }
+  }
+
+  /*!
+   * @brief Starts a call of the routine; the calls it makes internally are
+   * counted as part of it. Used through internal::CounterScope.
+   */
+  inline void enter(const char* routine) {
+    if (depth_++ == 0) {
+      current_ = &routines_[routine];
+      ++current_->calls;
+    }
+  }
+
+  inline void leave() {
+    if (--depth_ == 0) {
+      current_ = nullptr;
+    }
+  }
+
+  inline void add_kernels(std::uint64_t kernels) {
+    current().kernels += kernels;
+  }
+
+  inline void add_scratch(std::uint64_t bytes) {
+    ++current().scratch_allocations;
+    current().scratch_bytes += bytes;
+  }
+
+  inline void add_wait() { ++current().waits; }
+
+  inline void add_copy(std::uint64_t bytes) {
+    ++current().copies;
+    current().copy_bytes += bytes;
+  }
+
+ private:
+  inline RoutineCounters& current() {
+    return current_ != nullptr ? *current_ : routines_["other"];
+  }
+
+  std::map<std::string, RoutineCounters> routines_;
+  RoutineCounters* current_;
+  int depth_;
+};
+
+/*!
+ * @brief The counters compiled out: the same interface, no state, and hooks
+ * that do nothing.
+ */
+template <>
+class BasicCounters<false> {
+ public:
+  static constexpr bool enabled() { return false; }
+
+  inline const std::map<std::string, RoutineCounters>& get_routines() const {
+    static const std::map<std::string, RoutineCounters> none;
+    return none;
+  }
+
+  inline RoutineCounters get(const std::string&) const {
+    return RoutineCounters{};
+  }
+
+  inline RoutineCounters get_total() const { return RoutineCounters{}; }
+
+  inline void reset() {}
+
+  inline void write(std::ostream& os) const {
+    os << "routine,calls,kernels,scratch_allocations,scratch_bytes,waits,"
+          "copies,copy_bytes\n";
+  }
+
+  inline void enter(const char*) {}
+
+  inline void leave() {}
+
+  inline void add_kernels(std::uint64_t) {}
+
+  inline void add_scratch(std::uint64_t) {}
+
+  inline void add_wait() {}
+
+  inline void add_copy(std::uint64_t) {}
+};
+
+namespace internal {
+
+/*!
+ * @brief Attributes the work done during its lifetime to the routine.
+ */
+class CounterScope {
+ public:
+  template <typename sb_handle_t>
+  inline CounterScope(sb_handle_t& sb_handle, const char* routine)
+      : counters_(sb_handle.get_counters()) {
+    counters_.enter(routine);
+  }
+
+  inline ~CounterScope() { counters_.leave(); }
+
+  CounterScope(const CounterScope&) = delete;
+  CounterScope& operator=(const CounterScope&) = delete;
+
+ private:
+  Counters& counters_;
+};
+
+/*!
+ * @brief Allocates a scratch buffer of size elements, counting it on the
+ * handle.
+ */
+template <typename element_t, typename sb_handle_t, typename index_t>
+inline BufferIterator<element_t> make_scratch_buffer(sb_handle_t& sb_handle,
+                                                     index_t size) {
+  sb_handle.get_counters().add_scratch(static_cast<std::uint64_t>(size) *
+                                       sizeof(element_t));
+  return make_sycl_iterator_buffer<element_t>(size);
+}
+
+/*!
+ * @brief helper::copy_to_device on the queue of the handle, counting the
+ * copy.
+ */
+template <typename sb_handle_t, typename element_t>
+inline cl::sycl::event copy_to_device(sb_handle_t& sb_handle,
+                                      const element_t* src,
+                                      BufferIterator<element_t> dst,
+                                      size_t size) {
+  sb_handle.get_counters().add_copy(size * sizeof(element_t));
+  return helper::copy_to_device(sb_handle.get_queue(), src, dst, size);
+}
+
+/*!
+ * @brief helper::copy_to_host on the queue of the handle, counting the copy.
+ */
+template <typename sb_handle_t, typename element_t>
+inline cl::sycl::event copy_to_host(sb_handle_t& sb_handle,
+                                    BufferIterator<element_t> src,
+                                    element_t* dst, size_t size) {
+  sb_handle.get_counters().add_copy(size * sizeof(element_t));
+  return helper::copy_to_host(sb_handle.get_queue(), src, dst, size);
+}
+
+/*!
+ * @brief helper::fill on the queue of the handle, counting the command.
+ */
+template <typename sb_handle_t, typename element_t>
+inline cl::sycl::event fill(sb_handle_t& sb_handle,
+                            BufferIterator<element_t> buff, element_t value,
+                            size_t size) {
+  sb_handle.get_counters().add_kernels(1);
+  return helper::fill(sb_handle.get_queue(), buff, value, size);
+}
+
+}  // namespace internal
+}  // namespace blas
+
+#endif  // SYCL_BLAS_COUNTERS_H
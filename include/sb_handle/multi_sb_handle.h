@@ -0,0 +1,107 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename multi_sb_handle.h
+ *
+ **************************************************************************/
+
+#ifndef SYCL_BLAS_MULTI_HANDLE_H
+#define SYCL_BLAS_MULTI_HANDLE_H
+#include "blas_meta.h"
+#include "sb_handle/sycl_blas_handle.h"
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+namespace blas {
+
+/** MultiSB_Handle.
+ * @brief Set of SB_Handles, one per queue, over which the multi-device
+ * operations (see interface/multi_device_interface.h) split their work.
+ * The queues may target different devices or the same one.
+ */
+class MultiSB_Handle {
+  using queue_t = cl::sycl::queue;
+
+ public:
+  using event_t = SB_Handle::event_t;
+
+  inline MultiSB_Handle(const std::vector<queue_t> &queues)
+      : subBufferAlign_(0) {
+    if (queues.empty()) {
+      throw std::invalid_argument("Erroneous parameter");
+    }
+    for (const auto &q : queues) {
+      handles_.emplace_back(q);
+      subBufferAlign_ = std::max(subBufferAlign_, get_sub_buffer_align(q));
+    }
+  }
+
+  inline size_t get_num_handles() const { return handles_.size(); }
+
+  inline SB_Handle &get_handle(size_t i) { return handles_[i]; }
+
+  /*!
+   * @brief Alignment in bytes of the sub-buffer offsets accepted by all the
+   * devices.
+   */
+  inline size_t get_sub_buffer_align() const { return subBufferAlign_; }
+
+  /*!
+   * @brief Every overload goes through SB_Handle::wait on each handle, so
+   * that the wait is counted on all of them (see SB_Handle::get_counters).
+   */
+  inline void wait() {
+    for (auto &handle : handles_) {
+      handle.wait();
+    }
+  }
+
+  inline void wait(std::vector<cl::sycl::event> evs) {
+    for (auto &handle : handles_) {
+      handle.wait(evs);
+    }
+  }
+
+  inline void wait(cl::sycl::event ev) {
+    wait(std::vector<cl::sycl::event>{ev});
+  }
+
+  template <typename first_event_t, typename... next_event_t>
+  inline void wait(first_event_t first_event, next_event_t... next_events) {
+    wait(concatenate_vectors(first_event, next_events...));
+  }
+
+ private:
+  static inline size_t get_sub_buffer_align(queue_t q) {
+    // mem_base_addr_align is given in bits
+    const size_t bits =
+        q.get_device()
+            .template get_info<cl::sycl::info::device::mem_base_addr_align>();
+    return std::max(size_t(1), bits / 8);
+  }
+
+  std::vector<SB_Handle> handles_;
+  size_t subBufferAlign_;
+};
+
+}  // namespace blas
+
+#endif  // SYCL_BLAS_MULTI_HANDLE_H
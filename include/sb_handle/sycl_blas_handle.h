@@ -30,9 +30,13 @@
 #include "operations/blas2_trees.h"
 #include "operations/blas3_trees.h"
 #include "operations/extension/reduction.h"
+#include "sb_handle/counters.h"
 #include "sycl_blas_helper.h"
 namespace blas {
 
+class GemmModel;
+class Trace;
+
 /** SB_Handle.
  * @brief Primary template for the SB_Handle specializations.
  * The SB_Handle represents the object that executes a tree on
@@ -50,7 +54,13 @@ class SB_Handle {
       : q_(q),
         workGroupSize_(helper::get_work_group_size(q)),
         localMemorySupport_(helper::has_local_memory(q)),
-        computeUnits_(helper::get_num_compute_units(q)) {}
+        computeUnits_(helper::get_num_compute_units(q)),
+        cpuDevice_(helper::is_cpu(q)),
+        tuningTarget_(helper::get_tuning_target(q)),
+        subGroupSize_(helper::get_sub_group_size(q)),
+        trace_(nullptr),
+        gemmModel_(nullptr),
+        gemmConfig_(-1) {}
 
   template <typename expression_tree_t>
   event_t execute(expression_tree_t tree);
@@ -73,6 +83,20 @@ class SB_Handle {
   event_t execute(AssignReduction<operator_t, lhs_t, rhs_t> t,
                   local_memory_t scr);
 
+  // Vectorized, launching a bounded grid that loops over the elements
+  template <int vector_size, typename tree_t>
+  event_t execute(Vectorized<vector_size, tree_t> tree);
+
+  // GemvRow, reducing each row in sub-groups when the device allows it
+  template <int interLoop, bool Lower, bool Diag, bool Upper, bool Unit,
+            typename lhs_t, typename matrix_t, typename vector_t,
+            typename index_t>
+  event_t execute(GemvRow<interLoop, Lower, Diag, Upper, Unit, lhs_t,
+                          matrix_t, vector_t>
+                      tree,
+                  index_t localSize, index_t globalSize,
+                  index_t local_memory_size);
+
   template <typename input_t, typename output_t, bool DoubleBuffer, bool NbcA,
             bool NbcB, int ClSize, typename tile_type, bool TransA, bool TransB,
             typename element_t, bool is_beta_zero, int GemmMemoryType,
@@ -106,6 +130,13 @@ class SB_Handle {
                               IsBetaZero, element_t, GemmMemoryType>
                       gemm_partial);
 
+  // GemmSpecialized, launched with its shape as specialization constants
+  template <int ItemRows, int ItemCols, bool TransA, bool TransB,
+            typename input_t, typename output_t>
+  event_t execute(GemmSpecialized<ItemRows, ItemCols, TransA, TransB, input_t,
+                                  output_t>
+                      gemm_tree);
+
   // Reduction specialization (inner or outer dimension)
   template <typename operator_t, typename params_t, typename input_t,
             typename output_t>
@@ -119,13 +150,64 @@ class SB_Handle {
 
   inline size_t get_num_compute_units() const { return computeUnits_; }
 
-  inline void wait() { q_.wait(); }
+  inline bool is_cpu_device() const { return cpuDevice_; }
+
+  inline tuning_target_t get_tuning_target() const { return tuningTarget_; }
+
+  // Largest sub-group size of the device, 0 when reductions do not use
+  // sub-groups (see helper::get_sub_group_size)
+  inline size_t get_sub_group_size() const { return subGroupSize_; }
+
+  /*!
+   * @brief Sets the trace the GEMM, batched GEMM, GEMV and TRSM calls made
+   * through this handle are recorded to, or stops recording with nullptr.
+   * The trace must outlive the calls.
+   */
+  inline void set_trace(Trace* trace) { trace_ = trace; }
+
+  inline Trace* get_trace() const { return trace_; }
+
+  /*!
+   * @brief Sets the model the GEMM backends choose their standard
+   * configuration with, or restores their thresholds with nullptr. The model
+   * must outlive the calls.
+   */
+  inline void set_gemm_model(const GemmModel* model) { gemmModel_ = model; }
+
+  inline const GemmModel* get_gemm_model() const { return gemmModel_; }
+
+  /*!
+   * @brief Index, as numbered by get_gemm_model_configs, of the standard
+   * configuration the last GEMM through this handle launched, or -1 if it
+   * launched another one, e.g a tall and skinny or interleaved GEMM.
+   */
+  inline int get_gemm_config() const { return gemmConfig_; }
+
+  inline void set_gemm_config(int config) { gemmConfig_ = config; }
+
+  /*!
+   * @brief Counters of the kernels, scratch allocations, blocking waits and
+   * copies caused by the calls made through this handle, per routine. They
+   * are only updated when SYCL-BLAS is configured with BLAS_ENABLE_COUNTERS.
+   */
+  inline Counters& get_counters() { return counters_; }
+
+  inline const Counters& get_counters() const { return counters_; }
+
+  inline void wait() {
+    counters_.add_wait();
+    q_.wait();
+  }
 
   inline void wait(std::vector<cl::sycl::event> evs) {
+    counters_.add_wait();
     cl::sycl::event::wait(evs);
   }
 
-  inline void wait(cl::sycl::event ev) { cl::sycl::event::wait({ev}); }
+  inline void wait(cl::sycl::event ev) {
+    counters_.add_wait();
+    cl::sycl::event::wait({ev});
+  }
 
   /*  @brief waiting for a list of sycl events
  @param first_event  and next_events are instances of sycl::sycl::event
@@ -134,14 +216,44 @@ class SB_Handle {
   // dont know howmany permutation can be used by a user
   template <typename first_event_t, typename... next_event_t>
   void inline wait(first_event_t first_event, next_event_t... next_events) {
+    counters_.add_wait();
     cl::sycl::event::wait(concatenate_vectors(first_event, next_events...));
   }
 
  private:
+  /*!
+   * @brief Launches a tree reducing values across the work group, in the
+   * using_local_memory::subgroup mode when the device supports sub-groups and
+   * the work group size is a multiple of the largest sub-group size.
+   */
+  template <typename expression_tree_t>
+  cl::sycl::event execute_reduction_tree(expression_tree_t tree,
+                                         size_t localSize, size_t globalSize,
+                                         size_t local_memory_size);
+
+  template <typename expression_tree_t>
+  cl::sycl::event execute_reduction_tree(expression_tree_t tree,
+                                         size_t localSize, size_t globalSize,
+                                         size_t local_memory_size,
+                                         std::true_type);
+
+  template <typename expression_tree_t>
+  cl::sycl::event execute_reduction_tree(expression_tree_t tree,
+                                         size_t localSize, size_t globalSize,
+                                         size_t local_memory_size,
+                                         std::false_type);
+
   queue_t q_;
   const size_t workGroupSize_;
   const bool localMemorySupport_;
   const size_t computeUnits_;
+  const bool cpuDevice_;
+  const tuning_target_t tuningTarget_;
+  const size_t subGroupSize_;
+  Trace* trace_;
+  const GemmModel* gemmModel_;
+  int gemmConfig_;
+  Counters counters_;
 };
 
 }  // namespace blas
@@ -0,0 +1,264 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename trace.h
+ *
+ **************************************************************************/
+
+#ifndef SYCL_BLAS_TRACE_H
+#define SYCL_BLAS_TRACE_H
+
+#include "container/sycl_iterator.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iomanip>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace blas {
+
+/*!
+ * @brief Buffer seen by a trace, with the size in bytes of its elements and
+ * its number of elements.
+ */
+struct TraceBuffer {
+  size_t element_size;
+  std::ptrdiff_t count;
+};
+
+/*!
+ * @brief Operand of a traced call: the index of its buffer in the trace and
+ * the offset of its first element in that buffer.
+ */
+struct TraceOperand {
+  size_t buffer;
+  std::ptrdiff_t offset;
+};
+
+/*!
+ * @brief Call recorded by a trace. The meaning of the options (transposes,
+ * side, triangle, diagonal), sizes (dimensions, leading dimensions,
+ * increments, batch size) and scalars follows the order of the arguments of
+ * the routine.
+ */
+struct TraceCall {
+  std::string routine;
+  std::string options;
+  std::vector<std::int64_t> sizes;
+  std::vector<double> scalars;
+  std::vector<TraceOperand> operands;
+};
+
+/** Trace.
+ * @brief Sequence of the calls made through an SB_Handle the trace is set on
+ * (see SB_Handle::set_trace), in submission order. Buffers are identified by
+ * the order in which the trace first sees them, so that a replay can
+ * allocate one buffer per identifier and reproduce the aliasing, hence the
+ * dependencies, between the calls. A sub-buffer is a buffer of its own.
+ *
+ * The text format written by write and parsed by read has a header line
+ * followed by one line per buffer and one line per call:
+ *   sycl-blas-trace 1
+ *   buffer <id> <element size> <count>
+ *   call <routine> <options> <num sizes> <sizes...> <num scalars>
+ *        <scalars...> <num operands> <buffer id> <offset>...
+ */
+class Trace {
+ public:
+  /*!
+   * @brief Records a call of the routine, whose operands are the containers
+   * in the order of the arguments of the routine.
+   */
+  template <typename... container_t>
+  inline void record(std::string routine, std::string options,
+                     std::vector<std::int64_t> sizes,
+                     std::vector<double> scalars,
+                     container_t... containers) {
+    calls_.push_back({std::move(routine), std::move(options), std::move(sizes),
+                      std::move(scalars),
+                      std::vector<TraceOperand>{get_operand(containers)...}});
+  }
+
+  inline const std::vector<TraceBuffer>& get_buffers() const {
+    return buffers_;
+  }
+
+  inline const std::vector<TraceCall>& get_calls() const { return calls_; }
+
+  inline void clear() {
+    ids_.clear();
+    buffers_.clear();
+    calls_.clear();
+  }
+
+  inline void write(std::ostream& os) const {
+    os << "sycl-blas-trace 1\n";
+    for (size_t i = 0; i < buffers_.size(); ++i) {
+      os << "buffer " << i << " " << buffers_[i].element_size << " "
+         << buffers_[i].count << "\n";
+    }
+    os << std::setprecision(std::numeric_limits<double>::max_digits10);
+    for (const auto& call : calls_) {
+      os << "call " << call.routine << " "
+         << (call.options.empty() ? "-" : call.options) << " "
+         << call.sizes.size();
+      for (auto size : call.sizes) {
+        os << " " << size;
+      }
+      os << " " << call.scalars.size();
+      for (auto scalar : call.scalars) {
+        os << " " << scalar;
+      }
+      os << " " << call.operands.size();
+      for (const auto& operand : call.operands) {
+        os << " " << operand.buffer << " " << operand.offset;
+      }
+      os << "\n";
+    }
+  }
+
+  /*!
+   * @brief Parses a trace written by write.
+   * @throw std::runtime_error if the input is not a valid trace.
+   */
+  static inline Trace read(std::istream& is) {
+    Trace trace;
+    std::string line, keyword;
+    int version = 0;
+    std::getline(is, line);
+    std::istringstream header(line);
+    if (!(header >> keyword >> version) || keyword != "sycl-blas-trace" ||
+        version != 1) {
+      throw std::runtime_error("Not a SYCL-BLAS trace");
+    }
+    while (std::getline(is, line)) {
+      std::istringstream ls(line);
+      if (!(ls >> keyword)) {
+        continue;
+      }
+      bool valid = true;
+      if (keyword == "buffer") {
+        size_t id;
+        TraceBuffer buffer;
+        valid = static_cast<bool>(ls >> id >> buffer.element_size >>
+                                  buffer.count) &&
+                id == trace.buffers_.size();
+        trace.buffers_.push_back(buffer);
+      } else if (keyword == "call") {
+        TraceCall call;
+        valid = read_call(ls, call, trace.buffers_.size());
+        trace.calls_.push_back(call);
+      } else {
+        valid = false;
+      }
+      if (!valid) {
+        throw std::runtime_error("Malformed trace line: " + line);
+      }
+    }
+    return trace;
+  }
+
+ private:
+  template <typename element_t>
+  inline TraceOperand get_operand(BufferIterator<element_t> container) {
+    auto buffer = container.get_buffer();
+    const size_t key = std::hash<decltype(buffer)>()(buffer);
+    const auto count = static_cast<std::ptrdiff_t>(buffer.get_count());
+    auto it = ids_.find(key);
+    if (it == ids_.end()) {
+      it = ids_.emplace(key, buffers_.size()).first;
+      buffers_.push_back({sizeof(element_t), count});
+    }
+    // A buffer allocated where a released one was may share its identifier,
+    // which at worst adds a dependency to the replay
+    auto& traced = buffers_[it->second];
+    traced.count = std::max(traced.count, count);
+    return {it->second, container.get_offset()};
+  }
+
+  static inline bool read_call(std::istream& is, TraceCall& call,
+                               size_t num_buffers) {
+    size_t count;
+    if (!(is >> call.routine >> call.options >> count)) {
+      return false;
+    }
+    if (call.options == "-") {
+      call.options.clear();
+    }
+    call.sizes.resize(count);
+    for (auto& size : call.sizes) {
+      is >> size;
+    }
+    is >> count;
+    call.scalars.resize(count);
+    for (auto& scalar : call.scalars) {
+      is >> scalar;
+    }
+    is >> count;
+    call.operands.resize(count);
+    for (auto& operand : call.operands) {
+      is >> operand.buffer >> operand.offset;
+      if (operand.buffer >= num_buffers) {
+        return false;
+      }
+    }
+    return static_cast<bool>(is);
+  }
+
+  std::unordered_map<size_t, size_t> ids_;
+  std::vector<TraceBuffer> buffers_;
+  std::vector<TraceCall> calls_;
+};
+
+namespace internal {
+
+template <typename... index_t>
+inline std::vector<std::int64_t> make_trace_sizes(index_t... sizes) {
+  return {static_cast<std::int64_t>(sizes)...};
+}
+
+/*!
+ * @brief Records the call in the trace of the handle, which must have one.
+ * The public routines check get_trace() before calling it, so the options and
+ * the sizes are only built when the handle is traced.
+ */
+template <typename sb_handle_t, typename... container_t>
+inline void trace_call(sb_handle_t& sb_handle, const char* routine,
+                       std::string options, std::vector<std::int64_t> sizes,
+                       std::vector<double> scalars,
+                       container_t... containers) {
+  sb_handle.get_trace()->record(routine, std::move(options), std::move(sizes),
+                                std::move(scalars), containers...);
+}
+
+}  // namespace internal
+}  // namespace blas
+
+#endif  // SYCL_BLAS_TRACE_H
@@ -31,8 +31,14 @@
 
 #include "sb_handle/sycl_blas_handle.h"
 
+#include "sb_handle/trace.h"
+
+#include "sb_handle/counters.h"
+
 #include "sb_handle/kernel_constructor.h"
 
+#include "sb_handle/multi_sb_handle.h"
+
 #include "interface/blas1_interface.h"
 
 #include "interface/blas2_interface.h"
@@ -41,6 +47,10 @@
 
 #include "interface/gemm_launcher.h"
 
+#include "interface/gemm_model.h"
+
+#include "interface/multi_device_interface.h"
+
 #include "interface/reduction_interface.h"
 
 #include "operations/blas1_trees.h"
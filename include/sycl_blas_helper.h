@@ -28,6 +28,9 @@
 #include "blas_meta.h"
 #include "container/sycl_iterator.h"
 #include <CL/sycl.hpp>
+#include <algorithm>
+#include <cctype>
+#include <string>
 
 namespace blas {
 namespace helper {
@@ -51,6 +54,78 @@ inline size_t get_num_compute_units(cl::sycl::queue &q) {
       .template get_info<cl::sycl::info::device::max_compute_units>();
 }
 
+/* @brief Whether the kernels of the queue run on the cores of the host, i.e.
+  a CPU device or, before SYCL 2020, the host device.
+*/
+inline bool is_cpu(cl::sycl::queue &q) {
+  const auto device = q.get_device();
+#if SYCL_LANGUAGE_VERSION < 202001
+  return device.is_cpu() || device.is_host();
+#else
+  return device.is_cpu();
+#endif
+}
+
+/* @brief Largest sub-group size of the device, or 0 when reductions cannot
+  rely on sub-groups: without SYCL 2020 sub-group collectives or when one of
+  the supported sizes is not a power of two.
+*/
+inline size_t get_sub_group_size(cl::sycl::queue &q) {
+#if SYCL_BLAS_SUBGROUPS
+  const auto sizes = q.get_device()
+                         .template get_info<
+                             cl::sycl::info::device::sub_group_sizes>();
+  size_t max_size = 0;
+  for (const auto size : sizes) {
+    if (size == 0 || (size & (size - 1)) != 0) {
+      return 0;
+    }
+    max_size = std::max(max_size, size_t(size));
+  }
+  return max_size;
+#else
+  return 0;
+#endif
+}
+
+/* @brief Maps a device vendor and type, in the lower case "vendor:type"
+  vocabulary of the benchmark device selector (e.g. "intel", "gpu"), to the
+  GEMM tuning target. Devices that match no tuned class map to default_cpu.
+*/
+inline tuning_target_t get_tuning_target(const std::string &vendor,
+                                         const std::string &type) {
+  auto has = [&vendor](const char *name) {
+    return vendor.find(name) != std::string::npos;
+  };
+  if (type == "gpu") {
+    if (has("intel")) {
+      return tuning_target_t::intel_gpu;
+    } else if (has("nvidia")) {
+      return tuning_target_t::nvidia_gpu;
+    } else if (has("amd") || has("advanced micro devices")) {
+      return tuning_target_t::amd_gpu;
+    } else if (has("arm")) {
+      return tuning_target_t::arm_gpu;
+    } else if (has("imagination") || has("powervr")) {
+      return tuning_target_t::power_vr;
+    }
+  } else if (type == "accelerator" && (has("renesas") || has("rcar"))) {
+    return tuning_target_t::rcar;
+  }
+  return tuning_target_t::default_cpu;
+}
+
+inline tuning_target_t get_tuning_target(cl::sycl::queue &q) {
+  const auto device = q.get_device();
+  std::string vendor =
+      device.template get_info<cl::sycl::info::device::vendor>();
+  std::transform(vendor.begin(), vendor.end(), vendor.begin(), ::tolower);
+  const std::string type = device.is_gpu()           ? "gpu"
+                           : device.is_accelerator() ? "accelerator"
+                                                     : "cpu";
+  return get_tuning_target(vendor, type);
+}
+
 /* @brief Copying the data back to device
   @tparam element_t is the type of the data
   @param src is the host pointer we want to copy from.
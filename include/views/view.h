@@ -249,6 +249,25 @@ static inline auto make_matrix_view(BufferIterator<scalar_t> buff, index_t m,
                      lda, (index_t)buff.get_offset()};
 }
 
+/*!
+ * @brief Views of an operand the routine only reads. They are bound with
+ * access::mode::read whether the container is const or not, so that a
+ * read-only input converted by KernelContainer to share the kernels of its
+ * non-const container is never accessed for writing.
+ */
+template <typename scalar_t, typename increment_t, typename index_t>
+static inline auto make_input_vector_view(BufferIterator<scalar_t> buff,
+                                          increment_t inc, index_t sz) {
+  return make_vector_view(BufferIterator<scalar_t const>(buff), inc, sz);
+}
+
+template <typename access_layout_t, typename scalar_t, typename index_t>
+static inline auto make_input_matrix_view(BufferIterator<scalar_t> buff,
+                                          index_t m, index_t n, index_t lda) {
+  return make_matrix_view<access_layout_t>(BufferIterator<scalar_t const>(buff),
+                                           m, n, lda);
+}
+
 }  // namespace blas
 
 #endif  // VIEW_H
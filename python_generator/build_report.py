@@ -0,0 +1,130 @@
+#/***************************************************************************
+# *
+# *  @license
+# *  Copyright (C) Codeplay Software Limited
+# *  Licensed under the Apache License, Version 2.0 (the "License");
+# *  you may not use this file except in compliance with the License.
+# *  You may obtain a copy of the License at
+# *
+# *      http://www.apache.org/licenses/LICENSE-2.0
+# *
+# *  For your convenience, a copy of the License has been included in this
+# *  repository.
+# *
+# *  Unless required by applicable law or agreed to in writing, software
+# *  distributed under the License is distributed on an "AS IS" BASIS,
+# *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# *  See the License for the specific language governing permissions and
+# *  limitations under the License.
+# *
+# *  SYCL-BLAS: BLAS implementation using SYCL
+# *
+# *  @filename build_report.py
+# *
+# **************************************************************************/
+# Build time and binary size report of the generated instantiations.
+#
+# record <log> <target> <compiler command...>
+#   Used as compiler launcher: runs the compiler command and appends the
+#   compilation time and object size of the source to <log>.
+# summarize <log> <library> <json output>
+#   Prints the number of translation units, the compilation time and the
+#   object size of every routine, and writes the same data to <json output>.
+import json
+import os
+import subprocess
+import sys
+import time
+
+
+def find_argument(command, flag):
+    for i, arg in enumerate(command):
+        if arg == flag and i + 1 < len(command):
+            return command[i + 1]
+        if arg.startswith(flag) and len(arg) > len(flag):
+            return arg[len(flag):]
+    return ''
+
+
+def record(log, target, command):
+    start = time.time()
+    status = subprocess.call(command)
+    elapsed = time.time() - start
+    if status != 0:
+        return status
+    obj = find_argument(command, '-o')
+    entry = {
+        'target': target,
+        'source': os.path.basename(find_argument(command, '-c')),
+        'object': obj,
+        'seconds': round(elapsed, 3),
+        'bytes': os.path.getsize(obj) if os.path.isfile(obj) else 0
+    }
+    # A single short write in append mode keeps the records of parallel
+    # compilations on separate lines
+    with open(log, 'a') as f:
+        f.write(json.dumps(entry) + '\n')
+    return 0
+
+
+def summarize(log, library, output):
+    # Only the latest compilation of each object is relevant
+    objects = {}
+    with open(log, 'r') as f:
+        for line in f:
+            line = line.strip()
+            if line:
+                entry = json.loads(line)
+                objects[entry['object']] = entry
+    routines = {}
+    for entry in objects.values():
+        routine = routines.setdefault(entry['target'], {
+            'translation_units': 0,
+            'seconds': 0.0,
+            'bytes': 0,
+            'slowest_source': '',
+            'slowest_seconds': 0.0
+        })
+        routine['translation_units'] += 1
+        routine['seconds'] += entry['seconds']
+        routine['bytes'] += entry['bytes']
+        if entry['seconds'] > routine['slowest_seconds']:
+            routine['slowest_source'] = entry['source']
+            routine['slowest_seconds'] = entry['seconds']
+    report = {
+        'library': os.path.basename(library),
+        'library_bytes':
+        os.path.getsize(library) if os.path.isfile(library) else 0,
+        'translation_units': len(objects),
+        'seconds': round(sum(r['seconds'] for r in routines.values()), 3),
+        'bytes': sum(r['bytes'] for r in routines.values()),
+        'routines': routines
+    }
+    print('{:<24}{:>8}{:>12}{:>14}'.format('routine', 'TUs', 'time (s)',
+                                            'size (KiB)'))
+    for name, routine in sorted(routines.items(),
+                                key=lambda item: -item[1]['seconds']):
+        routine['seconds'] = round(routine['seconds'], 3)
+        print('{:<24}{:>8}{:>12.1f}{:>14.1f}'.format(
+            name, routine['translation_units'], routine['seconds'],
+            routine['bytes'] / 1024.0))
+    print('{:<24}{:>8}{:>12.1f}{:>14.1f}'.format(
+        'total', report['translation_units'], report['seconds'],
+        report['bytes'] / 1024.0))
+    print('{}: {:.1f} KiB'.format(report['library'],
+                                  report['library_bytes'] / 1024.0))
+    with open(output, 'w') as f:
+        json.dump(report, f, indent=2, sort_keys=True)
+    return 0
+
+
+if __name__ == '__main__':
+    if len(sys.argv) > 4 and sys.argv[1] == 'record':
+        sys.exit(record(sys.argv[2], sys.argv[3], sys.argv[4:]))
+    if len(sys.argv) == 5 and sys.argv[1] == 'summarize':
+        sys.exit(summarize(sys.argv[2], sys.argv[3], sys.argv[4]))
+    sys.stderr.write('usage: build_report.py record <log> <target> '
+                     '<command...>\n'
+                     '       build_report.py summarize <log> <library> '
+                     '<json output>\n')
+    sys.exit(1)
@@ -26,6 +26,8 @@
 #ifndef SYCL_BLAS_BLAS1_INTERFACE_HPP
 #define SYCL_BLAS_BLAS1_INTERFACE_HPP
 
+#include <algorithm>
+#include <cctype>
 #include <cmath>
 #include <iostream>
 #include <stdexcept>
@@ -64,7 +66,8 @@ typename sb_handle_t::event_t _axpy(sb_handle_t &sb_handle, index_t _N,
   auto scalOp = make_op<ScalarOp, ProductOperator>(_alpha, vx);
   auto addOp = make_op<BinaryOp, AddOperator>(vy, scalOp);
   auto assignOp = make_op<Assign>(vy, addOp);
-  auto ret = sb_handle.execute(assignOp);
+  constexpr int vector_size = vectorized_size<element_t>::value;
+  auto ret = sb_handle.execute(make_vectorized<vector_size>(assignOp));
   return ret;
 }
 
@@ -85,7 +88,9 @@ typename sb_handle_t::event_t _copy(sb_handle_t &sb_handle, index_t _N,
   auto vx = make_vector_view(_vx, _incx, _N);
   auto vy = make_vector_view(_vy, _incy, _N);
   auto assignOp2 = make_op<Assign>(vy, vx);
-  auto ret = sb_handle.execute(assignOp2);
+  constexpr int vector_size =
+      vectorized_size<typename decltype(vx)::value_t>::value;
+  auto ret = sb_handle.execute(make_vectorized<vector_size>(assignOp2));
   return ret;
 }
 
@@ -251,7 +256,9 @@ typename sb_handle_t::event_t _swap(sb_handle_t &sb_handle, index_t _N,
   auto vx = make_vector_view(_vx, _incx, _N);
   auto vy = make_vector_view(_vy, _incy, _N);
   auto swapOp = make_op<DoubleAssign>(vy, vx, vx, vy);
-  auto ret = sb_handle.execute(swapOp);
+  constexpr int vector_size =
+      vectorized_size<typename decltype(vx)::value_t>::value;
+  auto ret = sb_handle.execute(make_vectorized<vector_size>(swapOp));
 
   return ret;
 }
@@ -268,15 +275,16 @@ typename sb_handle_t::event_t _scal(sb_handle_t &sb_handle, index_t _N,
                                     element_t _alpha, container_0_t _vx,
                                     increment_t _incx) {
   auto vx = make_vector_view(_vx, _incx, _N);
+  constexpr int vector_size = vectorized_size<element_t>::value;
   if (_alpha == element_t{0}) {
     auto zeroOp = make_op<UnaryOp, AdditionIdentity>(vx);
     auto assignOp = make_op<Assign>(vx, zeroOp);
-    auto ret = sb_handle.execute(assignOp);
+    auto ret = sb_handle.execute(make_vectorized<vector_size>(assignOp));
     return ret;
   } else {
     auto scalOp = make_op<ScalarOp, ProductOperator>(_alpha, vx);
     auto assignOp = make_op<Assign>(vx, scalOp);
-    auto ret = sb_handle.execute(assignOp);
+    auto ret = sb_handle.execute(make_vectorized<vector_size>(assignOp));
     return ret;
   }
 }
@@ -341,6 +349,133 @@ typename sb_handle_t::event_t _rot(sb_handle_t &sb_handle, index_t _N,
   return ret;
 }
 
+/**
+ * \brief Applies a batch of independent plane rotations to a column major
+ * matrix A in one kernel, e.g. for the sweeps of a Jacobi eigenvalue solver.
+ * Rotation k acts on the rows (side 'l') or the columns (side 'r')
+ * _pairs[2k] and _pairs[2k + 1] of A as rot does on x and y, with the cosine
+ * _c[k] and the sine _s[k]. The pairs of the batch must be disjoint.
+ * @tparam sb_handle_t SB_Handle type
+ * @tparam container_0_t Buffer Iterator
+ * @tparam container_1_t Buffer Iterator
+ * @tparam container_2_t Buffer Iterator
+ * @tparam container_3_t Buffer Iterator of an integer type
+ * @tparam index_t Index type
+ * @param sb_handle SB_Handle
+ * @param _side 'l' to rotate pairs of rows, 'r' to rotate pairs of columns
+ * @param _M Number of rows of A
+ * @param _N Number of columns of A
+ * @param _batch_size Number of rotations
+ * @param _mA[in, out] Buffer holding the matrix A
+ * @param _lda Leading dimension of A
+ * @param _c Buffer holding the cosines of the rotations
+ * @param _s Buffer holding the sines of the rotations
+ * @param _pairs Buffer holding the indices of the rows or columns of each
+ * rotation
+ * @return Vector of events to wait for.
+ */
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename container_3_t, typename index_t>
+typename sb_handle_t::event_t _rot_batched(
+    sb_handle_t &sb_handle, char _side, index_t _M, index_t _N,
+    index_t _batch_size, container_0_t _mA, index_t _lda, container_1_t _c,
+    container_2_t _s, container_3_t _pairs) {
+  _side = tolower(_side);
+  if ((_side != 'l' && _side != 'r') || _M < 0 || _N < 0 || _batch_size < 0 ||
+      _lda < std::max<index_t>(1, _M)) {
+    throw std::invalid_argument("Erroneous parameter");
+  }
+  if (_M == 0 || _N == 0 || _batch_size == 0) {
+    return {};
+  }
+  constexpr index_t inc = 1;
+  auto mA = make_matrix_view<col_major>(_mA, _M, _N, _lda);
+  auto vc = make_vector_view(_c, inc, _batch_size);
+  auto vs = make_vector_view(_s, inc, _batch_size);
+  auto vpairs = make_vector_view(_pairs, inc, index_t(2 * _batch_size));
+
+  if (_side == 'l') {
+    auto rot = make_rot_batched<true>(mA, vc, vs, vpairs);
+    return sb_handle.execute(rot);
+  } else {
+    auto rot = make_rot_batched<false>(mA, vc, vs, vpairs);
+    return sb_handle.execute(rot);
+  }
+}
+
+/**
+ * \brief Applies a sequence of plane rotations to a column major matrix A, as
+ * LAPACK's lasr does. With z the number of rows (side 'l') or columns (side
+ * 'r') of A, rotation j for j in [0, z - 1) acts on the rows or columns
+ * (j, j + 1) for the variable pivot 'v', (0, j + 1) for the top pivot 't' and
+ * (j, z - 1) for the bottom pivot 'b', as rot does on x and y with the cosine
+ * _c[j] and the sine _s[j]. The rotations are applied in increasing order of
+ * j for the forward direction 'f' and in decreasing order for the backward
+ * direction 'b'.
+ *
+ * Each work item applies the whole sequence to one column (side 'l') or one
+ * row (side 'r') of A, streamed through local memory in tiles.
+ * @tparam sb_handle_t SB_Handle type
+ * @tparam container_0_t Buffer Iterator
+ * @tparam container_1_t Buffer Iterator
+ * @tparam container_2_t Buffer Iterator
+ * @tparam index_t Index type
+ * @param sb_handle SB_Handle
+ * @param _side 'l' to combine rows, 'r' to combine columns
+ * @param _pivot 'v', 't' or 'b'
+ * @param _direct 'f' or 'b'
+ * @param _M Number of rows of A
+ * @param _N Number of columns of A
+ * @param _c Buffer holding the z - 1 cosines
+ * @param _s Buffer holding the z - 1 sines
+ * @param _mA[in, out] Buffer holding the matrix A
+ * @param _lda Leading dimension of A
+ * @return Vector of events to wait for.
+ */
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename index_t>
+typename sb_handle_t::event_t _lasr(sb_handle_t &sb_handle, char _side,
+                                    char _pivot, char _direct, index_t _M,
+                                    index_t _N, container_0_t _c,
+                                    container_1_t _s, container_2_t _mA,
+                                    index_t _lda) {
+  _side = tolower(_side);
+  _pivot = tolower(_pivot);
+  _direct = tolower(_direct);
+  if ((_side != 'l' && _side != 'r') ||
+      (_pivot != 'v' && _pivot != 't' && _pivot != 'b') ||
+      (_direct != 'f' && _direct != 'b') || _M < 0 || _N < 0 ||
+      _lda < std::max<index_t>(1, _M)) {
+    throw std::invalid_argument("Erroneous parameter");
+  }
+  const index_t num_lines = _side == 'l' ? _N : _M;
+  const index_t num_rot = (_side == 'l' ? _M : _N) - 1;
+  if (num_lines == 0 || num_rot <= 0) {
+    return {};
+  }
+  constexpr index_t inc = 1;
+  auto mA = make_matrix_view<col_major>(_mA, _M, _N, _lda);
+  auto vc = make_vector_view(_c, inc, num_rot);
+  auto vs = make_vector_view(_s, inc, num_rot);
+
+  // One work group per local_range columns (side 'l') or rows (side 'r')
+  constexpr uint32_t local_range = 32;
+  const index_t localSize = static_cast<index_t>(local_range);
+  const index_t nWG = (num_lines + localSize - 1) / localSize;
+  const index_t globalSize = localSize * nWG;
+  // A padded tile plus the cosines and the sines of its rotations
+  const index_t localMemSize = localSize * (localSize + 1) + 2 * localSize;
+  const bool forward = _direct == 'f';
+
+  if (_side == 'l') {
+    auto lasr = make_lasr<true, local_range>(mA, vc, vs, _pivot, forward);
+    return sb_handle.execute(lasr, localSize, globalSize, localMemSize);
+  } else {
+    auto lasr = make_lasr<false, local_range>(mA, vc, vs, _pivot, forward);
+    return sb_handle.execute(lasr, localSize, globalSize, localMemSize);
+  }
+}
+
 /**
  * @brief Performs a modified Givens rotation of points.
  * Given two vectors x and y and a modified Givens transformation matrix, each
@@ -390,8 +525,8 @@ typename sb_handle_t::event_t _rotm(sb_handle_t &sb_handle, index_t _N,
   /* This implementation can be further optimized for small input vectors by
    * creating a custom kernel that modifies param instead of copying it back to
    * the host */
-  auto copy_event = blas::helper::copy_to_host(sb_handle.get_queue(), _param,
-                                               param_host.data(), param_size);
+  auto copy_event = blas::internal::copy_to_host(
+      sb_handle, _param, param_host.data(), param_size);
   sb_handle.wait(copy_event);
 
   const element_t flag = param_host[0];
@@ -463,9 +598,10 @@ typename sb_handle_t::event_t _rotm(sb_handle_t &sb_handle, index_t _N,
  * h22].
  * @return Vector of events to wait for.
  */
-template <typename sb_handle_t, typename container_0_t, typename container_1_t,
-          typename container_2_t, typename container_3_t,
-          typename container_4_t>
+template <
+    typename sb_handle_t, typename container_0_t, typename container_1_t,
+    typename container_2_t, typename container_3_t, typename container_4_t,
+    typename std::enable_if<!is_sycl_scalar<container_0_t>::value, bool>::type>
 typename sb_handle_t::event_t _rotmg(sb_handle_t &sb_handle, container_0_t _d1,
                                      container_1_t _d2, container_2_t _x1,
                                      container_3_t _y1, container_4_t _param) {
@@ -479,8 +615,91 @@ typename sb_handle_t::event_t _rotmg(sb_handle_t &sb_handle, container_0_t _d1,
   auto y1_view = make_vector_view(_y1, inc, vector_size);
   auto param_view = make_vector_view(_param, inc, param_size);
 
-  auto operation =
-      Rotmg<decltype(d1_view)>(d1_view, d2_view, x1_view, y1_view, param_view);
+  auto operation = Rotmg<decltype(d1_view)>(d1_view, d2_view, x1_view, y1_view,
+                                            param_view, param_size);
+  auto ret = sb_handle.execute(operation);
+
+  return ret;
+}
+
+/**
+ * \brief Synchronous version of rotmg, computed on the host.
+ * @tparam sb_handle_t SB_Handle type
+ * @tparam scalar_t Scalar type
+ * @param sb_handle SB_Handle
+ * @param d1[in,out] On entry, scaling factor for the x-coordinate. On exit,
+ * the re-scaled d1.
+ * @param d2[in,out] On entry, scaling factor for the y-coordinate. On exit,
+ * the re-scaled d2.
+ * @param x1[in,out] On entry, x-coordinate. On exit, the re-scaled x1.
+ * @param y1[in] y-coordinate of the point.
+ * @param param[out] Array of 5 elements with the following layout: [flag,
+ * h11, h21, h12, h22].
+ */
+template <typename sb_handle_t, typename scalar_t,
+          typename std::enable_if<is_sycl_scalar<scalar_t>::value, bool>::type>
+void _rotmg(sb_handle_t &sb_handle, scalar_t &d1, scalar_t &d2, scalar_t &x1,
+            scalar_t y1, scalar_t *param) {
+  (void)sb_handle;
+  compute_rotmg(d1, d2, x1, y1, param[0], param[1], param[2], param[3],
+                param[4]);
+}
+
+/**
+ * \brief Computes N modified Givens transformations at once, one per work
+ * item. The i-th transformation reads the i-th elements of d1, d2, x1 and y1
+ * and writes its parameters [flag, h11, h21, h12, h22] at i * _param_stride
+ * in param.
+ * @tparam sb_handle_t SB_Handle type
+ * @tparam container_0_t Buffer Iterator
+ * @tparam container_1_t Buffer Iterator
+ * @tparam container_2_t Buffer Iterator
+ * @tparam container_3_t Buffer Iterator
+ * @tparam container_4_t Buffer Iterator
+ * @tparam index_t Index type
+ * @tparam increment_t Increment type
+ * @param sb_handle SB_Handle
+ * @param _N Number of transformations.
+ * @param _d1[in,out] Buffer holding the scaling factors for the x-coordinates
+ * @param _incd1 Stride of d1
+ * @param _d2[in,out] Buffer holding the scaling factors for the y-coordinates
+ * @param _incd2 Stride of d2
+ * @param _x1[in,out] Buffer holding the x-coordinates
+ * @param _incx1 Stride of x1
+ * @param _y1[in] Buffer holding the y-coordinates
+ * @param _incy1 Stride of y1
+ * @param _param[out] Buffer holding the parameters of the transformations
+ * @param _param_stride Distance between the parameters of two consecutive
+ * transformations, at least 5
+ * @return Vector of events to wait for.
+ */
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename container_3_t,
+          typename container_4_t, typename index_t, typename increment_t>
+typename sb_handle_t::event_t _rotmg_batched(
+    sb_handle_t &sb_handle, index_t _N, container_0_t _d1, increment_t _incd1,
+    container_1_t _d2, increment_t _incd2, container_2_t _x1,
+    increment_t _incx1, container_3_t _y1, increment_t _incy1,
+    container_4_t _param, index_t _param_stride) {
+  constexpr index_t param_size = 5;
+  if (_N < 0 || _param_stride < param_size || _incd1 <= 0 || _incd2 <= 0 ||
+      _incx1 <= 0 || _incy1 <= 0) {
+    throw std::invalid_argument("Erroneous parameter");
+  }
+  if (_N == 0) {
+    return {};
+  }
+
+  auto d1_view = make_vector_view(_d1, _incd1, _N);
+  auto d2_view = make_vector_view(_d2, _incd2, _N);
+  auto x1_view = make_vector_view(_x1, _incx1, _N);
+  auto y1_view = make_vector_view(_y1, _incy1, _N);
+  auto param_view = make_vector_view(
+      _param, static_cast<increment_t>(1),
+      static_cast<index_t>((_N - 1) * _param_stride + param_size));
+
+  auto operation = Rotmg<decltype(d1_view)>(d1_view, d2_view, x1_view, y1_view,
+                                            param_view, _param_stride);
   auto ret = sb_handle.execute(operation);
 
   return ret;
@@ -522,7 +741,56 @@ typename sb_handle_t::event_t _rotg(sb_handle_t &sb_handle, container_0_t a,
 }
 
 /**
- * \brief Synchronous version of rotg.
+ * \brief Computes N Givens rotations at once, one per work item. The i-th
+ * rotation reads and writes the i-th elements of a, b, c and s as rotg does.
+ * @tparam sb_handle_t SB_Handle type
+ * @tparam container_0_t Buffer Iterator
+ * @tparam container_1_t Buffer Iterator
+ * @tparam container_2_t Buffer Iterator
+ * @tparam container_3_t Buffer Iterator
+ * @tparam index_t Index type
+ * @tparam increment_t Increment type
+ * @param sb_handle SB_Handle
+ * @param _N Number of rotations.
+ * @param a[in, out] On entry, buffer holding the x-coordinates of the points.
+ * On exit, the scalars r.
+ * @param _inca Stride of a
+ * @param b[in, out] On entry, buffer holding the y-coordinates of the points.
+ * On exit, the scalars z.
+ * @param _incb Stride of b
+ * @param c[out] Buffer holding the parameters c.
+ * @param _incc Stride of c
+ * @param s[out] Buffer holding the parameters s.
+ * @param _incs Stride of s
+ * @return Vector of events to wait for.
+ */
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename container_3_t, typename index_t,
+          typename increment_t>
+typename sb_handle_t::event_t _rotg_batched(
+    sb_handle_t &sb_handle, index_t _N, container_0_t a, increment_t _inca,
+    container_1_t b, increment_t _incb, container_2_t c, increment_t _incc,
+    container_3_t s, increment_t _incs) {
+  if (_N < 0 || _inca <= 0 || _incb <= 0 || _incc <= 0 || _incs <= 0) {
+    throw std::invalid_argument("Erroneous parameter");
+  }
+  if (_N == 0) {
+    return {};
+  }
+
+  auto a_view = make_vector_view(a, _inca, _N);
+  auto b_view = make_vector_view(b, _incb, _N);
+  auto c_view = make_vector_view(c, _incc, _N);
+  auto s_view = make_vector_view(s, _incs, _N);
+
+  auto operation = Rotg<decltype(a_view)>(a_view, b_view, c_view, s_view);
+  auto ret = sb_handle.execute(operation);
+
+  return ret;
+}
+
+/**
+ * \brief Synchronous version of rotg, computed on the host.
  * Given the Cartesian coordinates (a, b) of a point, the rotg routines
  * return the parameters c, s, r, and z associated with the Givens rotation.
  * @tparam sb_handle_t SB_Handle type
@@ -537,31 +805,8 @@ template <typename sb_handle_t, typename scalar_t,
           typename std::enable_if<is_sycl_scalar<scalar_t>::value, bool>::type>
 void _rotg(sb_handle_t &sb_handle, scalar_t &a, scalar_t &b, scalar_t &c,
            scalar_t &s) {
-  auto device_a = make_sycl_iterator_buffer<scalar_t>(1);
-  auto device_b = make_sycl_iterator_buffer<scalar_t>(1);
-  auto device_c = make_sycl_iterator_buffer<scalar_t>(1);
-  auto device_s = make_sycl_iterator_buffer<scalar_t>(1);
-  blas::helper::copy_to_device(sb_handle.get_queue(), &a, device_a, 1);
-  blas::helper::copy_to_device(sb_handle.get_queue(), &b, device_b, 1);
-  blas::helper::copy_to_device(sb_handle.get_queue(), &c, device_c, 1);
-  blas::helper::copy_to_device(sb_handle.get_queue(), &s, device_s, 1);
-
-  auto event =
-      blas::internal::_rotg(sb_handle, device_a, device_b, device_c, device_s);
-
-  auto event1 =
-      blas::helper::copy_to_host(sb_handle.get_queue(), device_c, &c, 1);
-  auto event2 =
-      blas::helper::copy_to_host(sb_handle.get_queue(), device_s, &s, 1);
-  auto event3 =
-      blas::helper::copy_to_host(sb_handle.get_queue(), device_a, &a, 1);
-  auto event4 =
-      blas::helper::copy_to_host(sb_handle.get_queue(), device_b, &b, 1);
-
-  sb_handle.wait(event1);
-  sb_handle.wait(event2);
-  sb_handle.wait(event3);
-  sb_handle.wait(event4);
+  (void)sb_handle;
+  compute_rotg(a, b, c, s);
 }
 
 /**
@@ -591,9 +836,11 @@ typename ValueType<container_0_t>::type _dot(sb_handle_t &sb_handle, index_t _N,
                                              increment_t _incy) {
   using element_t = typename ValueType<container_0_t>::type;
   auto res = std::vector<element_t>(1);
-  auto gpu_res = make_sycl_iterator_buffer<element_t>(static_cast<index_t>(1));
+  auto gpu_res = blas::internal::make_scratch_buffer<element_t>(
+      sb_handle, static_cast<index_t>(1));
   blas::internal::_dot(sb_handle, _N, _vx, _incx, _vy, _incy, gpu_res);
-  blas::helper::copy_to_host(sb_handle.get_queue(), gpu_res, res.data(), 1);
+  auto event = blas::internal::copy_to_host(sb_handle, gpu_res, res.data(), 1);
+  sb_handle.wait(event);
   return res[0];
 }
 
@@ -624,12 +871,12 @@ typename ValueType<container_0_t>::type _sdsdot(
     increment_t _incx, container_1_t _vy, increment_t _incy) {
   using element_t = typename ValueType<container_0_t>::type;
   element_t res{};
-  auto gpu_res = make_sycl_iterator_buffer<element_t>(static_cast<index_t>(1));
+  auto gpu_res = blas::internal::make_scratch_buffer<element_t>(
+      sb_handle, static_cast<index_t>(1));
   auto event1 = blas::internal::_sdsdot(sb_handle, _N, sb, _vx, _incx, _vy,
                                         _incy, gpu_res);
   sb_handle.wait(event1);
-  auto event2 =
-      blas::helper::copy_to_host(sb_handle.get_queue(), gpu_res, &res, 1);
+  auto event2 = blas::internal::copy_to_host(sb_handle, gpu_res, &res, 1);
   sb_handle.wait(event2);
   return res;
 }
@@ -647,9 +894,10 @@ index_t _iamax(sb_handle_t &sb_handle, index_t _N, container_t _vx,
   using IndValTuple = IndexValueTuple<index_t, element_t>;
   std::vector<IndValTuple> rsT(1, IndValTuple(index_t(-1), element_t(-1)));
   auto gpu_res =
-      make_sycl_iterator_buffer<IndValTuple>(static_cast<index_t>(1));
+      blas::internal::make_scratch_buffer<IndValTuple>(sb_handle, index_t(1));
   blas::internal::_iamax(sb_handle, _N, _vx, _incx, gpu_res);
-  blas::helper::copy_to_host(sb_handle.get_queue(), gpu_res, rsT.data(), 1);
+  auto event = blas::internal::copy_to_host(sb_handle, gpu_res, rsT.data(), 1);
+  sb_handle.wait(event);
   return rsT[0].get_index();
 }
 
@@ -666,9 +914,10 @@ index_t _iamin(sb_handle_t &sb_handle, index_t _N, container_t _vx,
   using IndValTuple = IndexValueTuple<index_t, element_t>;
   std::vector<IndValTuple> rsT(1, IndValTuple(index_t(-1), element_t(-1)));
   auto gpu_res =
-      make_sycl_iterator_buffer<IndValTuple>(static_cast<index_t>(1));
+      blas::internal::make_scratch_buffer<IndValTuple>(sb_handle, index_t(1));
   blas::internal::_iamin(sb_handle, _N, _vx, _incx, gpu_res);
-  blas::helper::copy_to_host(sb_handle.get_queue(), gpu_res, rsT.data(), 1);
+  auto event = blas::internal::copy_to_host(sb_handle, gpu_res, rsT.data(), 1);
+  sb_handle.wait(event);
   return rsT[0].get_index();
 }
 
@@ -686,9 +935,11 @@ typename ValueType<container_t>::type _asum(sb_handle_t &sb_handle, index_t _N,
                                             increment_t _incx) {
   using element_t = typename ValueType<container_t>::type;
   auto res = std::vector<element_t>(1, element_t(0));
-  auto gpu_res = make_sycl_iterator_buffer<element_t>(static_cast<index_t>(1));
+  auto gpu_res = blas::internal::make_scratch_buffer<element_t>(
+      sb_handle, static_cast<index_t>(1));
   blas::internal::_asum(sb_handle, _N, _vx, _incx, gpu_res);
-  blas::helper::copy_to_host(sb_handle.get_queue(), gpu_res, res.data(), 1);
+  auto event = blas::internal::copy_to_host(sb_handle, gpu_res, res.data(), 1);
+  sb_handle.wait(event);
   return res[0];
 }
 
@@ -706,9 +957,11 @@ typename ValueType<container_t>::type _nrm2(sb_handle_t &sb_handle, index_t _N,
                                             increment_t _incx) {
   using element_t = typename ValueType<container_t>::type;
   auto res = std::vector<element_t>(1, element_t(0));
-  auto gpu_res = make_sycl_iterator_buffer<element_t>(static_cast<index_t>(1));
+  auto gpu_res = blas::internal::make_scratch_buffer<element_t>(
+      sb_handle, static_cast<index_t>(1));
   blas::internal::_nrm2(sb_handle, _N, _vx, _incx, gpu_res);
-  blas::helper::copy_to_host(sb_handle.get_queue(), gpu_res, res.data(), 1);
+  auto event = blas::internal::copy_to_host(sb_handle, gpu_res, res.data(), 1);
+  sb_handle.wait(event);
   return res[0];
 }
 
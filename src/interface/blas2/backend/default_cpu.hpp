@@ -37,6 +37,15 @@ typename SB_Handle::event_t _gemv(SB_Handle& sb_handle, index_t _M, index_t _N,
                                   index_t _lda, container_t1 _vx,
                                   increment_t _incx, element_t _beta,
                                   container_t2 _vy, increment_t _incy) {
+  if (sb_handle.is_cpu_device()) {
+    // One 256 bit vector register, x chunks of 16 KiB when transposed
+    constexpr uint32_t vector_size = 32 / sizeof(element_t);
+    constexpr uint32_t block_size =
+        trn == transpose_type::Normal ? 4 * vector_size
+                                      : 16384 / sizeof(element_t);
+    return blas::internal::_gemv_cpu_impl<block_size, vector_size, trn>(
+        sb_handle, _M, _N, _alpha, _mA, _lda, _vx, _incx, _beta, _vy, _incy);
+  }
   if (trn == transpose_type::Normal) {
     return blas::internal::_gemv_impl<256, 32, gemv_memory_t::local, trn>(
         sb_handle, _M, _N, _alpha, _mA, _lda, _vx, _incx, _beta, _vy, _incy);
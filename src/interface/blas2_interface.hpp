@@ -35,6 +35,7 @@
 #include "operations/blas_operators.hpp"
 #include "sb_handle/sycl_blas_handle.h"
 #include "views/view.h"
+#include <algorithm>
 #include <cmath>
 #include <iostream>
 #include <stdexcept>
@@ -80,8 +81,8 @@ typename sb_handle_t::event_t _gemv_impl(sb_handle_t& sb_handle, index_t _M,
   const auto x_vector_size = is_transposed ? _M : _N;
   const auto y_vector_size = is_transposed ? _N : _M;
 
-  auto mA = make_matrix_view<col_major>(_mA, _M, _N, _lda);
-  auto vx = make_vector_view(_vx, _incx, x_vector_size);
+  auto mA = make_input_matrix_view<col_major>(_mA, _M, _N, _lda);
+  auto vx = make_input_vector_view(_vx, _incx, x_vector_size);
   auto vy = make_vector_view(_vy, _incy, y_vector_size);
 
   // Non-local memory kernel
@@ -90,7 +91,8 @@ typename sb_handle_t::event_t _gemv_impl(sb_handle_t& sb_handle, index_t _M,
     const auto ld = is_transposed ? _N : _M;
     constexpr index_t one = 1;
 
-    auto dot_products_buffer = blas::make_sycl_iterator_buffer<element_t>(ld);
+    auto dot_products_buffer =
+        internal::make_scratch_buffer<element_t>(sb_handle, ld);
     auto dot_products_matrix =
         make_matrix_view<col_major>(dot_products_buffer, ld, one, ld);
 
@@ -151,7 +153,8 @@ typename sb_handle_t::event_t _gemv_impl(sb_handle_t& sb_handle, index_t _M,
 
     // Create the dot products buffer and matrix view
     auto dot_products_buffer =
-        blas::make_sycl_iterator_buffer<element_t>(dot_products_buffer_size);
+        internal::make_scratch_buffer<element_t>(sb_handle,
+                                                 dot_products_buffer_size);
     auto dot_products_matrix =
         make_matrix_view<col_major>(dot_products_buffer, ld, WGs_per_C, ld);
 
@@ -195,6 +198,43 @@ typename sb_handle_t::event_t _gemv_impl(sb_handle_t& sb_handle, index_t _M,
   }
 }
 
+/*! _gemv_cpu_impl.
+ * @brief Implementation of the General Matrix Vector product for CPU devices.
+ *
+ * A single kernel computes y = alpha * op(A) * x + beta * y, without the
+ * partial dot products buffer of _gemv_impl. Every work group has one work
+ * item, which maps to a CPU thread.
+ *
+ * @tparam block_size  rows of y per work item, or length of the chunks of x
+ *                     kept in local memory when the matrix is transposed
+ * @tparam vector_size  number of elements in a vector register
+ * @tparam trn  specifies whether the input matrix should be transposed
+ */
+template <uint32_t block_size, uint32_t vector_size, transpose_type trn,
+          typename sb_handle_t, typename index_t, typename element_t,
+          typename container_t0, typename container_t1, typename increment_t,
+          typename container_t2>
+typename sb_handle_t::event_t _gemv_cpu_impl(
+    sb_handle_t& sb_handle, index_t _M, index_t _N, element_t _alpha,
+    container_t0 _mA, index_t _lda, container_t1 _vx, increment_t _incx,
+    element_t _beta, container_t2 _vy, increment_t _incy) {
+  constexpr bool is_transposed = trn != transpose_type::Normal;
+
+  const auto x_vector_size = is_transposed ? _M : _N;
+  const auto y_vector_size = is_transposed ? _N : _M;
+
+  auto mA = make_input_matrix_view<col_major>(_mA, _M, _N, _lda);
+  auto vx = make_input_vector_view(_vx, _incx, x_vector_size);
+  auto vy = make_vector_view(_vy, _incy, y_vector_size);
+
+  auto gemv = make_gemv_cpu<block_size, vector_size, is_transposed>(
+      vy, mA, vx, _alpha, _beta);
+  constexpr index_t local_range = 1;
+  return sb_handle.execute(gemv, local_range,
+                           static_cast<index_t>(gemv.get_num_work_items()),
+                           static_cast<index_t>(gemv.local_memory_size));
+}
+
 /*! _TRMV.
  * @brief Implementation of the Triangular Matrix Vector product.
  */
@@ -245,7 +285,8 @@ typename sb_handle_t::event_t _trmv_impl(
   const index_t globalSize = localSize * nWGPerRow * nWGPerCol;
 
   using element_t = typename ValueType<container_t0>::type;
-  auto valT1 = blas::make_sycl_iterator_buffer<element_t>(N * scratchSize);
+  auto valT1 =
+      internal::make_scratch_buffer<element_t>(sb_handle, N * scratchSize);
   auto mat1 = make_matrix_view<row_major>(valT1, N, scratchSize, scratchSize);
 
   if (data_layout_t::is_col_major()) {
@@ -330,89 +371,55 @@ ssymv 	( 	character  	UPLO,
    real, dimension(*)  	Y,
    integer  	INCY
  ) 	*/
-template <typename sb_handle_t, typename index_t, typename element_t,
-          typename container_t0, typename container_t1, typename increment_t,
-          typename container_t2>
-typename sb_handle_t::event_t _symv_impl(
-    sb_handle_t& sb_handle, char _Uplo, index_t _N, element_t _alpha,
-    container_t0 _mA, index_t _lda, container_t1 _vx, increment_t _incx,
-    element_t _beta, container_t2 _vy, increment_t _incy,
-    index_t _localSize = 0, index_t _scratchPadSize = 0, index_t _nRowsWG = 0,
-    index_t _nColsWG = 0) {
+template <uint32_t local_range, typename sb_handle_t, typename index_t,
+          typename element_t, typename container_t0, typename container_t1,
+          typename increment_t, typename container_t2>
+typename sb_handle_t::event_t _symv_impl(sb_handle_t& sb_handle, char _Uplo,
+                                         index_t _N, element_t _alpha,
+                                         container_t0 _mA, index_t _lda,
+                                         container_t1 _vx, increment_t _incx,
+                                         element_t _beta, container_t2 _vy,
+                                         increment_t _incy) {
   _Uplo = tolower(_Uplo);
   typename sb_handle_t::event_t ret;
   if ((_Uplo != 'u') && (_Uplo != 'l')) {
     throw std::invalid_argument("Erroneous parameter");
   }
-  int triangOpr = (_Uplo == 'u');
   index_t N = _N;
   auto mA = make_matrix_view<col_major>(_mA, N, N, _lda);
   auto vx = make_vector_view(_vx, _incx, N);
   auto vy = make_vector_view(_vy, _incy, N);
-  auto mAT = make_matrix_view<row_major>(_mA, N, N, _lda);
-
-  const index_t interLoop = 1;
 
-  const index_t localSize =
-      (_localSize == 0) ? sb_handle.get_work_group_size() : _localSize;
-  const index_t scratchPadSize =
-      (_localSize == 0) ? localSize : _scratchPadSize;
-
-  const index_t nRowsWG_R = (_nRowsWG == 0) ? 1 : std::min(N, _nRowsWG);
-  const index_t nColsWG_R = (_nColsWG == 0) ? N : std::min(N, _nColsWG);
-
-  const index_t nWGPerRow_R = (N - 1) / nRowsWG_R + 1;
-  const index_t nWGPerCol_R = (N - 1) / nColsWG_R + 1;
-  const index_t globalSize_R = localSize * nWGPerRow_R * nWGPerCol_R;
-
-  const index_t nRowsWG_C = (_nRowsWG == 0) ? localSize : _nRowsWG;
-  const index_t nColsWG_C = (_nColsWG == 0) ? localSize : _nColsWG;
-
-  const index_t nWGPerRow_C = (N - 1) / nRowsWG_C + 1;
-  const index_t nWGPerCol_C = (N - 1) / nColsWG_C + 1;
-  const index_t globalSize_C = localSize * nWGPerRow_C * nWGPerCol_C;
-
-  const index_t scratchSize_R =
-      ((scratchPadSize == 0) ? std::min(N, localSize) : 1) * nWGPerCol_R;
-
-  auto valTR = blas::make_sycl_iterator_buffer<element_t>(N * scratchSize_R);
-  auto matR =
-      make_matrix_view<row_major>(valTR, N, scratchSize_R, scratchSize_R);
-
-  const index_t scratchSize_C = nWGPerCol_C;
-
-  auto valTC = blas::make_sycl_iterator_buffer<element_t>(N * scratchSize_C);
-  auto matC =
-      make_matrix_view<row_major>(valTC, N, scratchSize_C, scratchSize_C);
-
-  if (triangOpr == 1) {
-    auto gemvC = make_gemv_col<false, true, true>(matC, mA, vx, nWGPerRow_C,
-                                                  nWGPerCol_C, scratchPadSize);
-    auto gemvR = make_gemv_row<interLoop, true, false, false>(
-        matR, mAT, vx, nWGPerRow_R, nWGPerCol_R, scratchPadSize);
+  // The block rows of local_range x local_range tiles are dealt to a number
+  // of work groups bounded by the device, which keeps the scratch in O(N)
+  const index_t num_blocks = (N + local_range - 1) / local_range;
+  const index_t nWG = std::min(
+      num_blocks, static_cast<index_t>(4 * sb_handle.get_num_compute_units()));
+  const index_t localSize = static_cast<index_t>(local_range);
+  const index_t globalSize = localSize * nWG;
+  // A padded tile plus the two blocks of x it is multiplied with
+  const index_t localMemSize = localSize * (localSize + 1) + 2 * localSize;
+
+  // Column g holds the partial products of work group g
+  auto partials = internal::make_scratch_buffer<element_t>(sb_handle, N * nWG);
+  auto matP = make_matrix_view<col_major>(partials, N, nWG, N);
+
+  if (_Uplo == 'u') {
+    auto symv = make_symv<true, local_range>(matP, mA, vx);
     ret = concatenate_vectors(
-        ret, sb_handle.execute(gemvC, localSize, globalSize_C, scratchPadSize));
-    ret = concatenate_vectors(
-        ret, sb_handle.execute(gemvR, localSize, globalSize_R, scratchPadSize));
+        ret, sb_handle.execute(symv, localSize, globalSize, localMemSize));
   } else {
-    auto gemvC = make_gemv_col<true, true, false>(matC, mA, vx, nWGPerRow_C,
-                                                  nWGPerCol_C, scratchPadSize);
-    auto gemvR = make_gemv_row<interLoop, false, false, true>(
-        matR, mAT, vx, nWGPerRow_R, nWGPerCol_R, scratchPadSize);
-    ret = concatenate_vectors(
-        ret, sb_handle.execute(gemvC, localSize, globalSize_C, scratchPadSize));
+    auto symv = make_symv<false, local_range>(matP, mA, vx);
     ret = concatenate_vectors(
-        ret, sb_handle.execute(gemvR, localSize, globalSize_R, scratchPadSize));
+        ret, sb_handle.execute(symv, localSize, globalSize, localMemSize));
   }
 
   auto scalOp1 = make_op<ScalarOp, ProductOperator>(_beta, vy);
-  auto addMOpR = make_sum_matrix_columns(matR);
-  auto addMOpC = make_sum_matrix_columns(matC);
-  auto addMOp = make_op<BinaryOp, AddOperator>(addMOpR, addMOpC);
+  auto addMOp = make_sum_matrix_columns(matP);
   auto scalOp2 = make_op<ScalarOp, ProductOperator>(_alpha, addMOp);
   auto addOp = make_op<BinaryOp, AddOperator>(scalOp1, scalOp2);
   auto assignOp = make_op<Assign>(vy, addOp);
-  ret = concatenate_vectors(ret, sb_handle.execute(assignOp, localSize));
+  ret = concatenate_vectors(ret, sb_handle.execute(assignOp));
   return ret;
 }
 
@@ -447,7 +454,8 @@ typename sb_handle_t::event_t _gbmv_impl(sb_handle_t& sb_handle, char _trans,
   const auto ld = is_transposed ? _N : _M;
   constexpr index_t one = 1;
 
-  auto dot_products_buffer = blas::make_sycl_iterator_buffer<element_t>(ld);
+  auto dot_products_buffer =
+      internal::make_scratch_buffer<element_t>(sb_handle, ld);
 
   auto dot_products_matrix =
       make_matrix_view<col_major>(dot_products_buffer, ld, one, ld);
@@ -487,6 +495,319 @@ typename sb_handle_t::event_t _gbmv_impl(sb_handle_t& sb_handle, char _trans,
   }
 }
 
+/*! _scale_dot_products.
+ * @brief Assigns y = alpha * dot_products + beta * y, the last step of the
+ * symmetric band and packed matrix vector products.
+ */
+template <typename sb_handle_t, typename element_t, typename dot_products_t,
+          typename vector_t>
+typename sb_handle_t::event_t _scale_dot_products(
+    sb_handle_t& sb_handle, element_t _alpha, dot_products_t& dot_products,
+    element_t _beta, vector_t& vy) {
+  auto alphaMulDotsOp =
+      make_op<ScalarOp, ProductOperator>(_alpha, dot_products);
+  if (_beta != static_cast<element_t>(0)) {
+    auto betaMulYOp = make_op<ScalarOp, ProductOperator>(_beta, vy);
+    auto addOp = make_op<BinaryOp, AddOperator>(betaMulYOp, alphaMulDotsOp);
+    auto assignOp = make_op<Assign>(vy, addOp);
+    return sb_handle.execute(assignOp);
+  } else {
+    auto assignOp = make_op<Assign>(vy, alphaMulDotsOp);
+    return sb_handle.execute(assignOp);
+  }
+}
+
+/*! _sbmv_impl.
+ * @brief Implementation of the Symmetric Band Matrix Vector product.
+ */
+template <uint32_t local_range, bool is_upper, typename sb_handle_t,
+          typename index_t, typename element_t, typename container_t0,
+          typename container_t1, typename increment_t, typename container_t2>
+typename sb_handle_t::event_t _sbmv_impl(sb_handle_t& sb_handle, index_t _N,
+                                         index_t _K, element_t _alpha,
+                                         container_t0 _mA, index_t _lda,
+                                         container_t1 _vx, increment_t _incx,
+                                         element_t _beta, container_t2 _vy,
+                                         increment_t _incy) {
+  if (_N == 0) {
+    return {};
+  }
+  if (_K >= _N) {
+    throw std::invalid_argument("Erroneous parameter");
+  }
+
+  auto mA = make_matrix_view<col_major>(_mA, _K + 1, _N, _lda);
+  auto vx = make_vector_view(_vx, _incx, _N);
+  auto vy = make_vector_view(_vy, _incy, _N);
+
+  constexpr index_t one = 1;
+  auto dot_products_buffer =
+      internal::make_scratch_buffer<element_t>(sb_handle, _N);
+  auto dot_products_matrix =
+      make_matrix_view<col_major>(dot_products_buffer, _N, one, _N);
+
+  const index_t global_size = roundUp<index_t>(_N, local_range);
+  auto sbmv =
+      make_sbmv<local_range, is_upper>(dot_products_matrix, mA, _K, vx);
+  auto sbmvEvent = sb_handle.execute(
+      sbmv, static_cast<index_t>(local_range), global_size,
+      static_cast<index_t>(sbmv.local_memory_size));
+
+  return concatenate_vectors(
+      sbmvEvent,
+      _scale_dot_products(sb_handle, _alpha, dot_products_matrix, _beta, vy));
+}
+
+/*! _tbmv_impl.
+ * @brief Implementation of the Triangular Band Matrix Vector product.
+ */
+template <uint32_t local_range, transpose_type trn, typename sb_handle_t,
+          typename index_t, typename container_t0, typename container_t1,
+          typename increment_t>
+typename sb_handle_t::event_t _tbmv_impl(sb_handle_t& sb_handle, char _Uplo,
+                                         char _Diag, index_t _N, index_t _K,
+                                         container_t0 _mA, index_t _lda,
+                                         container_t1 _vx, increment_t _incx) {
+  constexpr bool is_transposed = (trn != transpose_type::Normal);
+  _Uplo = tolower(_Uplo);
+  _Diag = tolower(_Diag);
+
+  if ((_Uplo != 'u' && _Uplo != 'l') || (_Diag != 'u' && _Diag != 'n')) {
+    throw std::invalid_argument("Erroneous parameter");
+  }
+  if (_N == 0) {
+    return {};
+  }
+  if (_K >= _N) {
+    throw std::invalid_argument("Erroneous parameter");
+  }
+
+  using element_t = typename ValueType<container_t0>::type;
+  auto mA = make_matrix_view<col_major>(_mA, _K + 1, _N, _lda);
+  auto vx = make_vector_view(_vx, _incx, _N);
+
+  constexpr index_t one = 1;
+  auto dot_products_buffer =
+      internal::make_scratch_buffer<element_t>(sb_handle, _N);
+  auto dot_products_matrix =
+      make_matrix_view<col_major>(dot_products_buffer, _N, one, _N);
+
+  const index_t local_size = static_cast<index_t>(local_range);
+  const index_t global_size = roundUp<index_t>(_N, local_range);
+  typename sb_handle_t::event_t ret;
+  if (_Uplo == 'u') {
+    if (_Diag == 'u') {
+      auto tbmv = make_tbmv<local_range, true, is_transposed, true>(
+          dot_products_matrix, mA, _K, vx);
+      ret = sb_handle.execute(tbmv, local_size, global_size);
+    } else {
+      auto tbmv = make_tbmv<local_range, true, is_transposed, false>(
+          dot_products_matrix, mA, _K, vx);
+      ret = sb_handle.execute(tbmv, local_size, global_size);
+    }
+  } else {
+    if (_Diag == 'u') {
+      auto tbmv = make_tbmv<local_range, false, is_transposed, true>(
+          dot_products_matrix, mA, _K, vx);
+      ret = sb_handle.execute(tbmv, local_size, global_size);
+    } else {
+      auto tbmv = make_tbmv<local_range, false, is_transposed, false>(
+          dot_products_matrix, mA, _K, vx);
+      ret = sb_handle.execute(tbmv, local_size, global_size);
+    }
+  }
+
+  // x is read by every work item, so the result is copied back afterwards
+  auto assignOp = make_op<Assign>(vx, dot_products_matrix);
+  return concatenate_vectors(ret, sb_handle.execute(assignOp));
+}
+
+/*! _spmv_impl.
+ * @brief Implementation of the Symmetric Packed Matrix Vector product.
+ */
+template <uint32_t local_range, bool is_upper, typename sb_handle_t,
+          typename index_t, typename element_t, typename container_t0,
+          typename container_t1, typename increment_t, typename container_t2>
+typename sb_handle_t::event_t _spmv_impl(sb_handle_t& sb_handle, index_t _N,
+                                         element_t _alpha, container_t0 _mAP,
+                                         container_t1 _vx, increment_t _incx,
+                                         element_t _beta, container_t2 _vy,
+                                         increment_t _incy) {
+  if (_N == 0) {
+    return {};
+  }
+
+  using packed_layout_t =
+      typename std::conditional<is_upper, packed_upper, packed_lower>::type;
+  auto mAP = make_matrix_view<packed_layout_t>(_mAP, _N, _N, _N);
+  auto vx = make_vector_view(_vx, _incx, _N);
+  auto vy = make_vector_view(_vy, _incy, _N);
+
+  constexpr index_t one = 1;
+  auto dot_products_buffer =
+      internal::make_scratch_buffer<element_t>(sb_handle, _N);
+  auto dot_products_matrix =
+      make_matrix_view<col_major>(dot_products_buffer, _N, one, _N);
+
+  const index_t global_size = roundUp<index_t>(_N, local_range);
+  auto spmv = make_spmv<local_range, is_upper>(dot_products_matrix, mAP, vx);
+  auto spmvEvent = sb_handle.execute(
+      spmv, static_cast<index_t>(local_range), global_size,
+      static_cast<index_t>(spmv.local_memory_size));
+
+  return concatenate_vectors(
+      spmvEvent,
+      _scale_dot_products(sb_handle, _alpha, dot_products_matrix, _beta, vy));
+}
+
+/*! _tpmv_impl.
+ * @brief Implementation of the Triangular Packed Matrix Vector product.
+ */
+template <uint32_t local_range, transpose_type trn, bool is_upper,
+          typename sb_handle_t, typename index_t, typename container_t0,
+          typename container_t1, typename increment_t>
+typename sb_handle_t::event_t _tpmv_impl(sb_handle_t& sb_handle, char _Diag,
+                                         index_t _N, container_t0 _mAP,
+                                         container_t1 _vx, increment_t _incx) {
+  constexpr bool is_transposed = (trn != transpose_type::Normal);
+  _Diag = tolower(_Diag);
+  if ((_Diag != 'u') && (_Diag != 'n')) {
+    throw std::invalid_argument("Erroneous parameter");
+  }
+  if (_N == 0) {
+    return {};
+  }
+
+  using element_t = typename ValueType<container_t0>::type;
+  using packed_layout_t =
+      typename std::conditional<is_upper, packed_upper, packed_lower>::type;
+  auto mAP = make_matrix_view<packed_layout_t>(_mAP, _N, _N, _N);
+  auto vx = make_vector_view(_vx, _incx, _N);
+
+  constexpr index_t one = 1;
+  auto dot_products_buffer =
+      internal::make_scratch_buffer<element_t>(sb_handle, _N);
+  auto dot_products_matrix =
+      make_matrix_view<col_major>(dot_products_buffer, _N, one, _N);
+
+  const index_t local_size = static_cast<index_t>(local_range);
+  const index_t global_size = roundUp<index_t>(_N, local_range);
+  typename sb_handle_t::event_t ret;
+  if (_Diag == 'u') {
+    auto tpmv = make_tpmv<local_range, is_upper, is_transposed, true>(
+        dot_products_matrix, mAP, vx);
+    ret = sb_handle.execute(tpmv, local_size, global_size);
+  } else {
+    auto tpmv = make_tpmv<local_range, is_upper, is_transposed, false>(
+        dot_products_matrix, mAP, vx);
+    ret = sb_handle.execute(tpmv, local_size, global_size);
+  }
+
+  // x is read by every work item, so the result is copied back afterwards
+  auto assignOp = make_op<Assign>(vx, dot_products_matrix);
+  return concatenate_vectors(ret, sb_handle.execute(assignOp));
+}
+
+/*! _trsv_impl.
+ * @brief Implementation of the blocked triangular solve with a vector, shared
+ * by the full (_trsv), band (_tbsv) and packed (_tpsv) storages.
+ *
+ * The whole solve is a single launch of one work group, which solves the
+ * diagonal blocks of block_size rows in order. Before solving a block it
+ * subtracts the contributions of the solved blocks reaching it, which are all
+ * the previous blocks for a full or packed matrix and the blocks within _K
+ * rows for a band matrix.
+ */
+template <uint32_t block_size, bool is_banded, bool is_packed,
+          transpose_type trn, bool is_upper, bool is_unit,
+          typename sb_handle_t, typename index_t, typename container_t0,
+          typename container_t1, typename increment_t>
+typename sb_handle_t::event_t _trsv_impl(sb_handle_t& sb_handle, index_t _N,
+                                         index_t _K, container_t0 _mA,
+                                         index_t _lda, container_t1 _vx,
+                                         increment_t _incx) {
+  constexpr bool is_transposed = (trn != transpose_type::Normal);
+  typename sb_handle_t::event_t ret{};
+  if (_N == 0) {
+    return ret;
+  }
+
+  using packed_layout_t =
+      typename std::conditional<is_upper, packed_upper, packed_lower>::type;
+  using layout_t =
+      typename std::conditional<is_packed, packed_layout_t, col_major>::type;
+  auto mA = make_matrix_view<layout_t>(_mA, is_banded ? _K + 1 : _N, _N,
+                                       _lda);
+  auto vx = make_vector_view(_vx, _incx, _N);
+
+  // Every block of a full matrix reaches all the following ones
+  const index_t k = is_banded ? _K : _N;
+  auto trsv = make_trsv<block_size, is_upper, is_transposed, is_unit,
+                        is_banded>(mA, vx, k);
+  const index_t local_size = static_cast<index_t>(block_size);
+  return sb_handle.execute(trsv, local_size, local_size,
+                           static_cast<index_t>(trsv.local_memory_size));
+}
+
+/*! _trsv_select.
+ * @brief Checks the parameters of a triangular solve and dispatches it to the
+ * matching _trsv_impl.
+ */
+template <uint32_t block_size, bool is_banded, bool is_packed,
+          typename sb_handle_t, typename index_t, typename container_t0,
+          typename container_t1, typename increment_t>
+typename sb_handle_t::event_t _trsv_select(sb_handle_t& sb_handle, char _Uplo,
+                                           char _trans, char _Diag, index_t _N,
+                                           index_t _K, container_t0 _mA,
+                                           index_t _lda, container_t1 _vx,
+                                           increment_t _incx) {
+  _Uplo = tolower(_Uplo);
+  _trans = tolower(_trans);
+  _Diag = tolower(_Diag);
+  if ((_Uplo != 'u' && _Uplo != 'l') ||
+      (_trans != 'n' && _trans != 't' && _trans != 'c') ||
+      (_Diag != 'u' && _Diag != 'n') || (is_banded && _K >= _N)) {
+    throw std::invalid_argument("Erroneous parameter");
+  }
+
+  constexpr auto normal = transpose_type::Normal;
+  constexpr auto transposed = transpose_type::Transposed;
+  const bool is_normal = _trans == 'n';
+  if (_Uplo == 'u') {
+    if (_Diag == 'u') {
+      return is_normal
+                 ? _trsv_impl<block_size, is_banded, is_packed, normal, true,
+                              true>(sb_handle, _N, _K, _mA, _lda, _vx, _incx)
+                 : _trsv_impl<block_size, is_banded, is_packed, transposed,
+                              true, true>(sb_handle, _N, _K, _mA, _lda, _vx,
+                                          _incx);
+    } else {
+      return is_normal
+                 ? _trsv_impl<block_size, is_banded, is_packed, normal, true,
+                              false>(sb_handle, _N, _K, _mA, _lda, _vx, _incx)
+                 : _trsv_impl<block_size, is_banded, is_packed, transposed,
+                              true, false>(sb_handle, _N, _K, _mA, _lda, _vx,
+                                           _incx);
+    }
+  } else {
+    if (_Diag == 'u') {
+      return is_normal
+                 ? _trsv_impl<block_size, is_banded, is_packed, normal, false,
+                              true>(sb_handle, _N, _K, _mA, _lda, _vx, _incx)
+                 : _trsv_impl<block_size, is_banded, is_packed, transposed,
+                              false, true>(sb_handle, _N, _K, _mA, _lda, _vx,
+                                           _incx);
+    } else {
+      return is_normal
+                 ? _trsv_impl<block_size, is_banded, is_packed, normal, false,
+                              false>(sb_handle, _N, _K, _mA, _lda, _vx, _incx)
+                 : _trsv_impl<block_size, is_banded, is_packed, transposed,
+                              false, false>(sb_handle, _N, _K, _mA, _lda, _vx,
+                                            _incx);
+    }
+  }
+}
+
 /**** RANK 1 MODIFICATION ****/
 
 template <typename sb_handle_t, typename index_t, typename element_t,
@@ -625,6 +946,63 @@ typename sb_handle_t::event_t _syr2_impl(
   }
 }
 
+/*! _ger_tiled_impl.
+ * @brief Rank-k update of mA by the columns of mX and mY with the tiled
+ * GerTiled kernel, which reads and writes each element of mA once.
+ */
+template <bool Single, bool Lower, bool Upper, typename sb_handle_t,
+          typename element_t, typename matrix_t, typename rhs_1_t,
+          typename rhs_2_t>
+typename sb_handle_t::event_t _ger_tiled_impl(sb_handle_t& sb_handle,
+                                              matrix_t mA, element_t _alpha,
+                                              rhs_1_t mX, rhs_2_t mY) {
+  using index_t = typename matrix_t::index_t;
+  constexpr uint32_t local_range = 64;
+  constexpr uint32_t item_rows = 4;
+  constexpr uint32_t tile_cols = 8;
+  constexpr uint32_t k_block = 4;
+  auto ger = make_ger_tiled<Single, Lower, Upper, local_range, item_rows,
+                            tile_cols, k_block>(mA, _alpha, mX, mY);
+  using ger_t = decltype(ger);
+
+  const index_t M = mA.get_size_row();
+  const index_t N = mA.get_size_col();
+  if (M == 0 || N == 0) {
+    return {};
+  }
+  // Tiles outside the updated triangle are launched and skipped at once
+  const index_t nWGPerRow = (M - 1) / ger_t::tile_rows + 1;
+  const index_t nWGPerCol = (N - 1) / index_t(tile_cols) + 1;
+  const index_t localSize = static_cast<index_t>(local_range);
+  const index_t globalSize = localSize * nWGPerRow * nWGPerCol;
+  const index_t localMemSize = ger_t::local_memory_size;
+  return sb_handle.execute(ger, localSize, globalSize, localMemSize);
+}
+
+/*
+    sspr 	( 	character  	UPLO,
+                integer  	N,
+                real  	ALPHA,
+                real, dimension(*)  	X,
+                integer  	INCX,
+                real, dimension(*)  	AP
+        )
+*/
+template <bool is_upper, typename sb_handle_t, typename index_t,
+          typename element_t, typename container_t0, typename increment_t,
+          typename container_t1>
+typename sb_handle_t::event_t _spr_impl(sb_handle_t& sb_handle, index_t _N,
+                                        element_t _alpha, container_t0 _vx,
+                                        increment_t _incx, container_t1 _mAP) {
+  using packed_layout_t =
+      typename std::conditional<is_upper, packed_upper, packed_lower>::type;
+  auto mAP = make_matrix_view<packed_layout_t>(_mAP, _N, _N, _N);
+  auto vx = make_vector_view(_vx, _incx, _N);
+
+  auto spr = make_spr<is_upper>(mAP, _alpha, vx);
+  return sb_handle.execute(spr);
+}
+
 /*!
  @brief Generalised matrix vector product with rectangular non-symmetric
  matrices.
@@ -695,8 +1073,8 @@ typename sb_handle_t::event_t inline _symv(sb_handle_t& sb_handle, char _Uplo,
                                            increment_t _incy) {
   // TODO: Here we can use some heuristics to select localn global, local, and
   // scratch size per device
-  return _symv_impl(sb_handle, _Uplo, _N, _alpha, _mA, _lda, _vx, _incx, _beta,
-                    _vy, _incy);
+  return _symv_impl<32>(sb_handle, _Uplo, _N, _alpha, _mA, _lda, _vx, _incx,
+                        _beta, _vy, _incy);
 }
 
 template <typename sb_handle_t, typename index_t, typename element_t,
@@ -726,8 +1104,16 @@ typename sb_handle_t::event_t inline _ger(sb_handle_t& sb_handle, index_t _M,
                                           container_t0 _vx, increment_t _incx,
                                           container_t1 _vy, increment_t _incy,
                                           container_t2 _mA, index_t _lda) {
-  // TODO: Here we can use some heuristics to select localn global, local, and
-  // scratch size per device
+  // A vector with a positive increment is seen as a one column row major
+  // matrix, whose leading dimension is the increment
+  if (_incx > 0 && _incy > 0) {
+    auto mA = make_matrix_view<col_major>(_mA, _M, _N, _lda);
+    auto mX =
+        make_matrix_view<row_major>(_vx, _M, index_t(1), index_t(_incx));
+    auto mY =
+        make_matrix_view<row_major>(_vy, _N, index_t(1), index_t(_incy));
+    return _ger_tiled_impl<true, true, true>(sb_handle, mA, _alpha, mX, mY);
+  }
   return _ger_impl(sb_handle, _M, _N, _alpha, _vx, _incx, _vy, _incy, _mA,
                    _lda);
 }
@@ -737,8 +1123,16 @@ typename sb_handle_t::event_t inline _syr(sb_handle_t& sb_handle, char _Uplo,
                                           index_t _N, element_t _alpha,
                                           container_t0 _vx, increment_t _incx,
                                           container_t1 _mA, index_t _lda) {
-  // TODO: Here we can use some heuristics to select localn global, local, and
-  // scratch size per device
+  if (_incx > 0) {
+    auto mA = make_matrix_view<col_major>(_mA, _N, _N, _lda);
+    auto mX =
+        make_matrix_view<row_major>(_vx, _N, index_t(1), index_t(_incx));
+    return (tolower(_Uplo) == 'u')
+               ? _ger_tiled_impl<true, false, true>(sb_handle, mA, _alpha,
+                                                    mX, mX)
+               : _ger_tiled_impl<true, true, false>(sb_handle, mA, _alpha,
+                                                    mX, mX);
+  }
   return _syr_impl(sb_handle, _Uplo, _N, _alpha, _vx, _incx, _mA, _lda);
 }
 template <typename sb_handle_t, typename index_t, typename element_t,
@@ -749,12 +1143,172 @@ typename sb_handle_t::event_t inline _syr2(sb_handle_t& sb_handle, char _Uplo,
                                            container_t0 _vx, increment_t _incx,
                                            container_t1 _vy, increment_t _incy,
                                            container_t2 _mA, index_t _lda) {
-  // TODO: Here we can use some heuristics to select localn global, local, and
-  // scratch size per device
+  if (_incx > 0 && _incy > 0) {
+    auto mA = make_matrix_view<col_major>(_mA, _N, _N, _lda);
+    auto mX =
+        make_matrix_view<row_major>(_vx, _N, index_t(1), index_t(_incx));
+    auto mY =
+        make_matrix_view<row_major>(_vy, _N, index_t(1), index_t(_incy));
+    return (tolower(_Uplo) == 'u')
+               ? _ger_tiled_impl<false, false, true>(sb_handle, mA, _alpha,
+                                                     mX, mY)
+               : _ger_tiled_impl<false, true, false>(sb_handle, mA, _alpha,
+                                                     mX, mY);
+  }
   return _syr2_impl(sb_handle, _Uplo, _N, _alpha, _vx, _incx, _vy, _incy, _mA,
                     _lda);
 }
 
+template <typename sb_handle_t, typename index_t, typename element_t,
+          typename container_t0, typename container_t1,
+          typename container_t2>
+typename sb_handle_t::event_t inline _gerk(sb_handle_t& sb_handle, index_t _M,
+                                           index_t _N, index_t _K,
+                                           element_t _alpha, container_t0 _mX,
+                                           index_t _ldx, container_t1 _mY,
+                                           index_t _ldy, container_t2 _mA,
+                                           index_t _lda) {
+  if (_M < 0 || _N < 0 || _K < 0 || _ldx < std::max<index_t>(1, _M) ||
+      _ldy < std::max<index_t>(1, _N) || _lda < std::max<index_t>(1, _M)) {
+    throw std::invalid_argument("Erroneous parameter");
+  }
+  if (_K == 0) {
+    return {};
+  }
+  auto mA = make_matrix_view<col_major>(_mA, _M, _N, _lda);
+  auto mX = make_matrix_view<col_major>(_mX, _M, _K, _ldx);
+  auto mY = make_matrix_view<col_major>(_mY, _N, _K, _ldy);
+  return _ger_tiled_impl<true, true, true>(sb_handle, mA, _alpha, mX, mY);
+}
+
+template <typename sb_handle_t, typename index_t, typename element_t,
+          typename container_t0, typename container_t1, typename increment_t,
+          typename container_t2>
+typename sb_handle_t::event_t inline _sbmv(
+    sb_handle_t& sb_handle, char _Uplo, index_t _N, index_t _K,
+    element_t _alpha, container_t0 _mA, index_t _lda, container_t1 _vx,
+    increment_t _incx, element_t _beta, container_t2 _vy, increment_t _incy) {
+  _Uplo = tolower(_Uplo);
+  if ((_Uplo != 'u') && (_Uplo != 'l')) {
+    throw std::invalid_argument("Erroneous parameter");
+  }
+  return _Uplo == 'u' ? _sbmv_impl<32, true>(sb_handle, _N, _K, _alpha, _mA,
+                                             _lda, _vx, _incx, _beta, _vy,
+                                             _incy)
+                      : _sbmv_impl<32, false>(sb_handle, _N, _K, _alpha, _mA,
+                                              _lda, _vx, _incx, _beta, _vy,
+                                              _incy);
+}
+
+template <typename sb_handle_t, typename index_t, typename container_t0,
+          typename container_t1, typename increment_t>
+typename sb_handle_t::event_t inline _tbmv(sb_handle_t& sb_handle, char _Uplo,
+                                           char _trans, char _Diag, index_t _N,
+                                           index_t _K, container_t0 _mA,
+                                           index_t _lda, container_t1 _vx,
+                                           increment_t _incx) {
+  _trans = tolower(_trans);
+  if ((_trans != 'n') && (_trans != 't') && (_trans != 'c')) {
+    throw std::invalid_argument("Erroneous parameter");
+  }
+  return _trans == 'n'
+             ? _tbmv_impl<32, transpose_type::Normal>(
+                   sb_handle, _Uplo, _Diag, _N, _K, _mA, _lda, _vx, _incx)
+             : _tbmv_impl<32, transpose_type::Transposed>(
+                   sb_handle, _Uplo, _Diag, _N, _K, _mA, _lda, _vx, _incx);
+}
+
+template <typename sb_handle_t, typename index_t, typename element_t,
+          typename container_t0, typename container_t1, typename increment_t,
+          typename container_t2>
+typename sb_handle_t::event_t inline _spmv(
+    sb_handle_t& sb_handle, char _Uplo, index_t _N, element_t _alpha,
+    container_t0 _mAP, container_t1 _vx, increment_t _incx, element_t _beta,
+    container_t2 _vy, increment_t _incy) {
+  _Uplo = tolower(_Uplo);
+  if ((_Uplo != 'u') && (_Uplo != 'l')) {
+    throw std::invalid_argument("Erroneous parameter");
+  }
+  return _Uplo == 'u' ? _spmv_impl<32, true>(sb_handle, _N, _alpha, _mAP, _vx,
+                                             _incx, _beta, _vy, _incy)
+                      : _spmv_impl<32, false>(sb_handle, _N, _alpha, _mAP, _vx,
+                                              _incx, _beta, _vy, _incy);
+}
+
+template <typename sb_handle_t, typename index_t, typename container_t0,
+          typename container_t1, typename increment_t>
+typename sb_handle_t::event_t inline _tpmv(sb_handle_t& sb_handle, char _Uplo,
+                                           char _trans, char _Diag, index_t _N,
+                                           container_t0 _mAP, container_t1 _vx,
+                                           increment_t _incx) {
+  _Uplo = tolower(_Uplo);
+  _trans = tolower(_trans);
+  if ((_Uplo != 'u' && _Uplo != 'l') ||
+      (_trans != 'n' && _trans != 't' && _trans != 'c')) {
+    throw std::invalid_argument("Erroneous parameter");
+  }
+  const bool is_normal = _trans == 'n';
+  if (_Uplo == 'u') {
+    return is_normal ? _tpmv_impl<32, transpose_type::Normal, true>(
+                           sb_handle, _Diag, _N, _mAP, _vx, _incx)
+                     : _tpmv_impl<32, transpose_type::Transposed, true>(
+                           sb_handle, _Diag, _N, _mAP, _vx, _incx);
+  } else {
+    return is_normal ? _tpmv_impl<32, transpose_type::Normal, false>(
+                           sb_handle, _Diag, _N, _mAP, _vx, _incx)
+                     : _tpmv_impl<32, transpose_type::Transposed, false>(
+                           sb_handle, _Diag, _N, _mAP, _vx, _incx);
+  }
+}
+
+template <typename sb_handle_t, typename index_t, typename container_t0,
+          typename container_t1, typename increment_t>
+typename sb_handle_t::event_t inline _trsv(sb_handle_t& sb_handle, char _Uplo,
+                                           char _trans, char _Diag, index_t _N,
+                                           container_t0 _mA, index_t _lda,
+                                           container_t1 _vx,
+                                           increment_t _incx) {
+  return _trsv_select<32, false, false>(sb_handle, _Uplo, _trans, _Diag, _N,
+                                        index_t(0), _mA, _lda, _vx, _incx);
+}
+
+template <typename sb_handle_t, typename index_t, typename container_t0,
+          typename container_t1, typename increment_t>
+typename sb_handle_t::event_t inline _tbsv(sb_handle_t& sb_handle, char _Uplo,
+                                           char _trans, char _Diag, index_t _N,
+                                           index_t _K, container_t0 _mA,
+                                           index_t _lda, container_t1 _vx,
+                                           increment_t _incx) {
+  return _trsv_select<32, true, false>(sb_handle, _Uplo, _trans, _Diag, _N, _K,
+                                       _mA, _lda, _vx, _incx);
+}
+
+template <typename sb_handle_t, typename index_t, typename container_t0,
+          typename container_t1, typename increment_t>
+typename sb_handle_t::event_t inline _tpsv(sb_handle_t& sb_handle, char _Uplo,
+                                           char _trans, char _Diag, index_t _N,
+                                           container_t0 _mAP, container_t1 _vx,
+                                           increment_t _incx) {
+  // The leading dimension of the packed view is unused
+  return _trsv_select<32, false, true>(sb_handle, _Uplo, _trans, _Diag, _N,
+                                       index_t(0), _mAP, _N, _vx, _incx);
+}
+
+template <typename sb_handle_t, typename index_t, typename element_t,
+          typename container_t0, typename increment_t, typename container_t1>
+typename sb_handle_t::event_t inline _spr(sb_handle_t& sb_handle, char _Uplo,
+                                          index_t _N, element_t _alpha,
+                                          container_t0 _vx, increment_t _incx,
+                                          container_t1 _mAP) {
+  _Uplo = tolower(_Uplo);
+  if ((_Uplo != 'u') && (_Uplo != 'l')) {
+    throw std::invalid_argument("Erroneous parameter");
+  }
+  return _Uplo == 'u'
+             ? _spr_impl<true>(sb_handle, _N, _alpha, _vx, _incx, _mAP)
+             : _spr_impl<false>(sb_handle, _N, _alpha, _vx, _incx, _mAP);
+}
+
 }  // namespace internal
 }  // namespace blas
 
@@ -25,11 +25,13 @@
 #ifndef SYCL_BLAS_GEMM_AMD_GPU_BACKEND_HPP
 #define SYCL_BLAS_GEMM_AMD_GPU_BACKEND_HPP
 #include "interface/gemm_launcher.h"
+#include "interface/gemm_model.h"
 
 namespace blas {
 namespace gemm {
 
 namespace backend {
+namespace amd_gpu {
 template <bool _t_a, bool _t_b, bool is_beta_zero, typename sb_handle_t,
           typename container_0_t, typename container_1_t,
           typename container_2_t, typename element_t, typename index_t>
@@ -132,9 +134,13 @@ typename sb_handle_t::event_t _gemm(sb_handle_t& sb_handle, index_t _M,
                                                                   _c, _ldc,
                                                                   batch_size);
     }
-  } else
+  }
 #endif  // GEMM_TALL_SKINNY_SUPPORT
-      if (_M * _N <= 65536) {
+  // Standard configurations, numbered as in get_gemm_model_configs
+  const int config = blas::internal::select_gemm_config(
+      sb_handle, tuning_target_t::amd_gpu, (_M * _N <= 65536) ? 0 : 1, _M, _N,
+      _K, batch_size, sizeof(element_t), is_beta_zero);
+  if (config == 0) {
     return blas::Gemm_Launcher<
         256, false, false, false, ClSize, Tile<1, 1, tileWgSize, tileWgSize>,
         _t_a, _t_b, static_cast<int>(gemm_memory_t::local),
@@ -162,6 +168,7 @@ typename sb_handle_t::event_t _gemm(sb_handle_t& sb_handle, index_t _M,
                                                                 batch_size);
   }
 }
+}  // namespace amd_gpu
 }  // namespace backend
 }  // namespace gemm
 }  // namespace blas
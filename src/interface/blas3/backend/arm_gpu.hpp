@@ -29,6 +29,7 @@
 namespace blas {
 namespace gemm {
 namespace backend {
+namespace arm_gpu {
 template <bool _t_a, bool _t_b, bool is_beta_zero, typename sb_handle_t,
           typename container_0_t, typename container_1_t,
           typename container_2_t, typename element_t, typename index_t>
@@ -432,6 +433,7 @@ typename sb_handle_t::event_t _gemm(sb_handle_t& sb_handle, index_t _M,
 #endif
   }
 }
+}  // namespace arm_gpu
 }  // namespace backend
 }  // namespace gemm
 }  // namespace blas
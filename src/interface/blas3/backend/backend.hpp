@@ -22,18 +22,117 @@
  *  @filename backend.hpp
  *
  **************************************************************************/
+#ifndef SYCL_BLAS_GEMM_BACKEND_HPP
+#define SYCL_BLAS_GEMM_BACKEND_HPP
+
+// Every tuning target enabled in the build brings in its backend, each one
+// in its own namespace so that a single library can hold several of them
 #if defined(RCAR)
 #include "interface/blas3/backend/rcar.hpp"
-#elif defined INTEL_GPU
+#endif
+#if defined(INTEL_GPU)
 #include "interface/blas3/backend/intel_gpu.hpp"
-#elif defined AMD_GPU
+#endif
+#if defined(AMD_GPU)
 #include "interface/blas3/backend/amd_gpu.hpp"
-#elif defined ARM_GPU
+#endif
+#if defined(ARM_GPU)
 #include "interface/blas3/backend/arm_gpu.hpp"
-#elif defined POWER_VR
+#endif
+#if defined(POWER_VR)
 #include "interface/blas3/backend/power_vr.hpp"
-#elif defined NVIDIA_GPU
+#endif
+#if defined(NVIDIA_GPU)
 #include "interface/blas3/backend/nvidia_gpu.hpp"
-#else
+#endif
+#if defined(DEFAULT_CPU) ||                                       \
+    !(defined(RCAR) || defined(INTEL_GPU) || defined(AMD_GPU) || \
+      defined(ARM_GPU) || defined(POWER_VR) || defined(NVIDIA_GPU))
 #include "interface/blas3/backend/default_cpu.hpp"
 #endif
+
+// Backend used when the device of the handle matches no enabled target. The
+// build system sets it to TUNING_TARGET, header only users get the first
+// enabled target in the historical priority order.
+#ifndef SYCLBLAS_FALLBACK_TUNING_TARGET
+#if defined(RCAR)
+#define SYCLBLAS_FALLBACK_TUNING_TARGET rcar
+#elif defined(INTEL_GPU)
+#define SYCLBLAS_FALLBACK_TUNING_TARGET intel_gpu
+#elif defined(AMD_GPU)
+#define SYCLBLAS_FALLBACK_TUNING_TARGET amd_gpu
+#elif defined(ARM_GPU)
+#define SYCLBLAS_FALLBACK_TUNING_TARGET arm_gpu
+#elif defined(POWER_VR)
+#define SYCLBLAS_FALLBACK_TUNING_TARGET power_vr
+#elif defined(NVIDIA_GPU)
+#define SYCLBLAS_FALLBACK_TUNING_TARGET nvidia_gpu
+#else
+#define SYCLBLAS_FALLBACK_TUNING_TARGET default_cpu
+#endif
+#endif
+
+namespace blas {
+namespace gemm {
+namespace backend {
+
+#define SYCLBLAS_GEMM_BACKEND_CALL(target)                                 \
+  target::_gemm<_t_a, _t_b, is_beta_zero>(sb_handle, _M, _N, _K, _alpha, _a, \
+                                          _lda, _b, _ldb, _beta, _c, _ldc,  \
+                                          batch_size, batch_type)
+
+/*!
+ * @brief Selects the GEMM backend tuned for the device of the handle among
+ * the ones compiled in, falling back to SYCLBLAS_FALLBACK_TUNING_TARGET.
+ */
+template <bool _t_a, bool _t_b, bool is_beta_zero, typename sb_handle_t,
+          typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t>
+typename sb_handle_t::event_t _gemm(sb_handle_t& sb_handle, index_t _M,
+                                    index_t _N, index_t _K, element_t _alpha,
+                                    container_0_t _a, index_t _lda,
+                                    container_1_t _b, index_t _ldb,
+                                    element_t _beta, container_2_t _c,
+                                    index_t _ldc, index_t batch_size,
+                                    gemm_batch_type_t batch_type) {
+  switch (sb_handle.get_tuning_target()) {
+#if defined(RCAR)
+    case tuning_target_t::rcar:
+      return SYCLBLAS_GEMM_BACKEND_CALL(rcar);
+#endif
+#if defined(INTEL_GPU)
+    case tuning_target_t::intel_gpu:
+      return SYCLBLAS_GEMM_BACKEND_CALL(intel_gpu);
+#endif
+#if defined(AMD_GPU)
+    case tuning_target_t::amd_gpu:
+      return SYCLBLAS_GEMM_BACKEND_CALL(amd_gpu);
+#endif
+#if defined(ARM_GPU)
+    case tuning_target_t::arm_gpu:
+      return SYCLBLAS_GEMM_BACKEND_CALL(arm_gpu);
+#endif
+#if defined(POWER_VR)
+    case tuning_target_t::power_vr:
+      return SYCLBLAS_GEMM_BACKEND_CALL(power_vr);
+#endif
+#if defined(NVIDIA_GPU)
+    case tuning_target_t::nvidia_gpu:
+      return SYCLBLAS_GEMM_BACKEND_CALL(nvidia_gpu);
+#endif
+#if defined(DEFAULT_CPU)
+    case tuning_target_t::default_cpu:
+      return SYCLBLAS_GEMM_BACKEND_CALL(default_cpu);
+#endif
+    default:
+      return SYCLBLAS_GEMM_BACKEND_CALL(SYCLBLAS_FALLBACK_TUNING_TARGET);
+  }
+}
+
+#undef SYCLBLAS_GEMM_BACKEND_CALL
+
+}  // namespace backend
+}  // namespace gemm
+}  // namespace blas
+
+#endif  // SYCL_BLAS_GEMM_BACKEND_HPP
@@ -25,10 +25,12 @@
 #ifndef SYCL_BLAS_GEMM_DEFAULT_CPU_BACKEND_HPP
 #define SYCL_BLAS_GEMM_DEFAULT_CPU_BACKEND_HPP
 #include "interface/gemm_launcher.h"
+#include "interface/gemm_model.h"
 
 namespace blas {
 namespace gemm {
 namespace backend {
+namespace default_cpu {
 
 template <bool _t_a, bool _t_b, bool is_beta_zero, typename sb_handle_t,
           typename container_0_t, typename container_1_t,
@@ -68,7 +70,14 @@ typename sb_handle_t::event_t _gemm(sb_handle_t& sb_handle, index_t _M,
                                                               _beta, _c, _ldc,
                                                               batch_size);
 #else
-  if (_M <= 128 && _N <= 128 && _K <= 128) {
+  // Standard configurations, numbered as in get_gemm_model_configs. CPU
+  // devices default to the cache blocked one
+  const bool is_small = _M <= 128 && _N <= 128 && _K <= 128;
+  const int config = blas::internal::select_gemm_config(
+      sb_handle, tuning_target_t::default_cpu,
+      sb_handle.is_cpu_device() ? 2 : is_small ? 0 : 1, _M, _N, _K, batch_size,
+      sizeof(element_t), is_beta_zero);
+  if (config == 0) {
     return blas::Gemm_Launcher<
         64, false, false, false, 64, Tile<2, 2, 8, 8>, _t_a, _t_b,
         static_cast<int>(gemm_memory_t::no_local),
@@ -81,7 +90,7 @@ typename sb_handle_t::event_t _gemm(sb_handle_t& sb_handle, index_t _M,
                                                                 _ldb, _beta, _c,
                                                                 _ldc,
                                                                 batch_size);
-  } else {
+  } else if (config == 1) {
     return blas::Gemm_Launcher<
         64, false, false, false, 64, Tile<8, 8, 8, 8>, _t_a, _t_b,
         static_cast<int>(gemm_memory_t::no_local),
@@ -94,10 +103,26 @@ typename sb_handle_t::event_t _gemm(sb_handle_t& sb_handle, index_t _M,
                                                                 _ldb, _beta, _c,
                                                                 _ldc,
                                                                 batch_size);
+  } else {
+    // Packed panels of ClSize bytes per row, one work item per core
+    constexpr int item_rows = sizeof(element_t) == 8 ? 4 : 8;
+    return blas::Gemm_Launcher<
+        1, false, false, false, 256, Tile<item_rows, 4, 8, 8>, _t_a, _t_b,
+        static_cast<int>(gemm_memory_t::local),
+        static_cast<int>(gemm_algorithm_t::cache_blocked),
+        static_cast<int>(gemm_vectorization_t::full), is_beta_zero, item_rows,
+        static_cast<int>(
+            gemm_batch_type_t::strided)>::template _select_gemm(sb_handle, _M,
+                                                                _N, _K, _alpha,
+                                                                _a, _lda, _b,
+                                                                _ldb, _beta, _c,
+                                                                _ldc,
+                                                                batch_size);
   }
 
 #endif
 }
+}  // namespace default_cpu
 }  // namespace backend
 }  // namespace gemm
 }  // namespace blas
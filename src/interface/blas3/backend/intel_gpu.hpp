@@ -25,10 +25,12 @@
 #ifndef SYCL_BLAS_GEMM_INTEL_GPU_BACKEND_HPP
 #define SYCL_BLAS_GEMM_INTEL_GPU_BACKEND_HPP
 #include "interface/gemm_launcher.h"
+#include "interface/gemm_model.h"
 
 namespace blas {
 namespace gemm {
 namespace backend {
+namespace intel_gpu {
 template <bool _t_a, bool _t_b, bool is_beta_zero, typename sb_handle_t,
           typename container_0_t, typename container_1_t,
           typename container_2_t, typename element_t, typename index_t>
@@ -199,7 +201,12 @@ typename sb_handle_t::event_t _gemm(sb_handle_t& sb_handle, index_t _M,
     }
   }
 #endif
-  if (_M <= 128 && _N <= 128) {
+  // Standard configurations, numbered as in get_gemm_model_configs
+  const int config = blas::internal::select_gemm_config(
+      sb_handle, tuning_target_t::intel_gpu,
+      (_M <= 128 && _N <= 128) ? 0 : (_t_b && !_t_a) ? 1 : 2, _M, _N, _K,
+      batch_size, sizeof(element_t), is_beta_zero);
+  if (config == 0) {
     return blas::Gemm_Launcher<
         64, true, false, false, 64, Tile<4, 4, 8, 8>, _t_a, _t_b,
         static_cast<int>(gemm_memory_t::local),
@@ -212,7 +219,7 @@ typename sb_handle_t::event_t _gemm(sb_handle_t& sb_handle, index_t _M,
                                                                 _ldb, _beta, _c,
                                                                 _ldc,
                                                                 batch_size);
-  } else if (_t_b && !_t_a) {
+  } else if (config == 1) {
     return blas::Gemm_Launcher<
         64, false, false, false, 64, Tile<8, 8, 8, 8>, _t_a, _t_b,
         static_cast<int>(gemm_memory_t::no_local),
@@ -240,6 +247,7 @@ typename sb_handle_t::event_t _gemm(sb_handle_t& sb_handle, index_t _M,
                                                                 batch_size);
   }
 }
+}  // namespace intel_gpu
 }  // namespace backend
 }  // namespace gemm
 }  // namespace blas
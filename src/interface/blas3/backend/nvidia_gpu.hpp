@@ -29,6 +29,7 @@
 namespace blas {
 namespace gemm {
 namespace backend {
+namespace nvidia_gpu {
 
 template <bool _t_a, bool _t_b, bool is_beta_zero, typename sb_handle_t,
           typename container_0_t, typename container_1_t,
@@ -121,6 +122,7 @@ typename sb_handle_t::event_t _gemm(sb_handle_t& sb_handle, index_t _M,
   }
 #endif
 }
+}  // namespace nvidia_gpu
 }  // namespace backend
 }  // namespace gemm
 }  // namespace blas
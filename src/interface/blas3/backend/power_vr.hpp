@@ -36,6 +36,7 @@
 namespace blas {
 namespace gemm {
 namespace backend {
+namespace power_vr {
 
 #ifdef IMGDNN_LIBRARY
 namespace sycl_imagination_nn_api {
@@ -63,6 +64,7 @@ struct Gemm_Launcher {
     auto a_buffer = _A.get_buffer();
     auto b_buffer = _B.get_buffer();
     auto c_buffer = _C.get_buffer();
+    sb_handle.get_counters().add_kernels(1);
     auto interop_event = sb_handle.get_queue().submit([&](cl::sycl::codeplay::
                                                               handler& cgh) {
       auto a_acc =
@@ -280,7 +282,7 @@ struct Gemm_Launcher {
         clReleaseEvent(cl_ev);
       });
     });
-    interop_event.wait();
+    sb_handle.wait(interop_event);
     return {sycl_event};
   }
 };
@@ -420,6 +422,7 @@ typename sb_handle_t::event_t _gemm(sb_handle_t& sb_handle, index_t _M,
   }
 #endif
 }
+}  // namespace power_vr
 }  // namespace backend
 }  // namespace gemm
 }  // namespace blas
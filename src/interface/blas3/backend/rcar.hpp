@@ -29,6 +29,7 @@
 namespace blas {
 namespace gemm {
 namespace backend {
+namespace rcar {
 template <bool _t_a, bool _t_b, bool is_beta_zero, typename SB_Handle,
           typename container_t0, typename container_t1, typename container_t2,
           typename element_t, typename index_t>
@@ -82,6 +83,7 @@ typename SB_Handle::event_t _gemm(SB_Handle& sb_handle, index_t _M, index_t _N,
                                                                 batch_size);
   }
 }
+}  // namespace rcar
 }  // namespace backend
 }  // namespace gemm
 }  // namespace blas
@@ -56,6 +56,8 @@ typename sb_handle_t::event_t _gemm_platform_specific(
     element_t _alpha, container_0_t a_, index_t _lda, container_1_t b_,
     index_t _ldb, element_t _beta, container_2_t _C, index_t _ldc,
     index_t batch_size, gemm_batch_type_t batch_type) {
+  // The backend sets it if it launches one of its standard configurations
+  sb_handle.set_gemm_config(-1);
   return blas::gemm::backend::_gemm<_t_a, _t_b, is_beta_zero>(
       sb_handle, _M, _N, _K, _alpha, a_, _lda, b_, _ldb, _beta, _C, _ldc,
       batch_size, batch_type);
@@ -159,6 +161,190 @@ typename sb_handle_t::event_t _gemm_batched(
                        _lda, b_, _ldb, _beta, _C, _ldc, batch_size, batch_type);
 }
 
+/*!
+ * @brief GEMM through GemmSpecialized, where only the 4x4 block of C computed
+ * by each work item is fixed at compile time.
+ *
+ * The work group shape is picked here from the problem size: as many rows as
+ * needed up to 16 work items, then as many columns as the device work group
+ * size allows. Together with the sizes and leading dimensions it becomes a
+ * specialization constant of the kernel.
+ */
+template <bool _t_a, bool _t_b, typename sb_handle_t, typename container_0_t,
+          typename container_1_t, typename container_2_t, typename element_t,
+          typename index_t>
+typename sb_handle_t::event_t _gemm_specialized_impl(
+    sb_handle_t& sb_handle, index_t _M, index_t _N, index_t _K,
+    element_t _alpha, container_0_t a_, index_t _lda, container_1_t b_,
+    index_t _ldb, element_t _beta, container_2_t _C, index_t _ldc,
+    index_t batch_size) {
+  constexpr index_t item_rows = 4;
+  constexpr index_t item_cols = 4;
+  constexpr index_t max_wg_dim = 16;
+  const index_t max_wg_size =
+      static_cast<index_t>(sb_handle.get_work_group_size());
+
+  index_t wg_rows = 1;
+  while (wg_rows < max_wg_dim && 2 * wg_rows <= max_wg_size &&
+         wg_rows * item_rows < _M) {
+    wg_rows *= 2;
+  }
+  index_t wg_cols = 1;
+  while (wg_cols < max_wg_dim && 2 * wg_cols * wg_rows <= max_wg_size &&
+         wg_cols * item_cols < _N) {
+    wg_cols *= 2;
+  }
+
+  auto buffer_a = make_input_matrix_view<col_major>(a_, _M, _K, _lda);
+  auto buffer_b = make_input_matrix_view<col_major>(b_, _K, _N, _ldb);
+  auto buffer_c = make_matrix_view<col_major>(_C, _M, _N, _ldc);
+  auto gemm = make_gemm_specialized<item_rows, item_cols, _t_a, _t_b>(
+      buffer_a, buffer_b, buffer_c, _alpha, _beta, batch_size, wg_rows,
+      wg_cols);
+  return sb_handle.execute(gemm);
+}
+
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t>
+typename sb_handle_t::event_t _gemm_specialized(
+    sb_handle_t& sb_handle, char _TransA, char _TransB, index_t _M, index_t _N,
+    index_t _K, element_t _alpha, container_0_t a_, index_t _lda,
+    container_1_t b_, index_t _ldb, element_t _beta, container_2_t _C,
+    index_t _ldc, index_t batch_size) {
+  _TransA = tolower(_TransA);
+  _TransB = tolower(_TransB);
+
+  if (_TransA != 'n' && _TransA != 't' && _TransA != 'c') {
+    throw std::invalid_argument("invalid _TransA");
+  } else if (_TransB != 'n' && _TransB != 't' && _TransB != 'c') {
+    throw std::invalid_argument("invalid _TransB");
+  }
+  if (_M == 0 || _N == 0 || batch_size == 0) {
+    return {};
+  }
+
+  const bool _TrA = _TransA != 'n';
+  const bool _TrB = _TransB != 'n';
+  if (_TrA && _TrB) {
+    return _gemm_specialized_impl<true, true>(sb_handle, _M, _N, _K, _alpha,
+                                              a_, _lda, b_, _ldb, _beta, _C,
+                                              _ldc, batch_size);
+  } else if (!_TrA && _TrB) {
+    return _gemm_specialized_impl<false, true>(sb_handle, _M, _N, _K, _alpha,
+                                               a_, _lda, b_, _ldb, _beta, _C,
+                                               _ldc, batch_size);
+  } else if (_TrA && !_TrB) {
+    return _gemm_specialized_impl<true, false>(sb_handle, _M, _N, _K, _alpha,
+                                               a_, _lda, b_, _ldb, _beta, _C,
+                                               _ldc, batch_size);
+  } else {
+    return _gemm_specialized_impl<false, false>(sb_handle, _M, _N, _K, _alpha,
+                                                a_, _lda, b_, _ldb, _beta, _C,
+                                                _ldc, batch_size);
+  }
+}
+
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename index_t>
+typename sb_handle_t::event_t _gemm_pack_b(sb_handle_t& sb_handle,
+                                           char _TransB, index_t _K,
+                                           index_t _N, container_0_t b_,
+                                           index_t _ldb,
+                                           container_1_t packed_b) {
+  _TransB = tolower(_TransB);
+  if (_TransB != 'n' && _TransB != 't' && _TransB != 'c') {
+    throw std::invalid_argument("invalid _TransB");
+  }
+  if (_K == 0 || _N == 0) {
+    return {};
+  }
+
+  constexpr index_t panel_cols = gemm_packed_panel_cols;
+  const index_t panel_size = _K * panel_cols;
+  const index_t num_panels = (_N - 1) / panel_cols + 1;
+  auto buffer_packed = make_matrix_view<col_major>(packed_b, panel_size,
+                                                   num_panels, panel_size);
+  if (_TransB != 'n') {
+    auto buffer_b = make_input_matrix_view<col_major>(b_, _N, _K, _ldb);
+    return sb_handle.execute(make_gemm_pack_b<panel_cols, true>(
+        buffer_b, buffer_packed, _K, _N));
+  } else {
+    auto buffer_b = make_input_matrix_view<col_major>(b_, _K, _N, _ldb);
+    return sb_handle.execute(make_gemm_pack_b<panel_cols, false>(
+        buffer_b, buffer_packed, _K, _N));
+  }
+}
+
+/*!
+ * @brief Launches GemmPacked with a work group shape suited to the problem.
+ */
+template <bool _t_a, typename sb_handle_t, typename container_0_t,
+          typename container_1_t, typename container_2_t, typename element_t,
+          typename index_t>
+typename sb_handle_t::event_t _gemm_packed_impl(
+    sb_handle_t& sb_handle, index_t _M, index_t _N, index_t _K,
+    element_t _alpha, container_0_t a_, index_t _lda, container_1_t packed_b,
+    element_t _beta, container_2_t _C, index_t _ldc) {
+  constexpr index_t item_rows = 4;
+  constexpr index_t panel_cols = gemm_packed_panel_cols;
+  constexpr index_t max_wg_dim = 16;
+  const index_t max_wg_size =
+      static_cast<index_t>(sb_handle.get_work_group_size());
+
+  index_t wg_rows = 1;
+  while (wg_rows < max_wg_dim && 2 * wg_rows <= max_wg_size &&
+         wg_rows * item_rows < _M) {
+    wg_rows *= 2;
+  }
+  index_t wg_cols = 1;
+  while (wg_cols < max_wg_dim && 2 * wg_cols * wg_rows <= max_wg_size &&
+         wg_cols * panel_cols < _N) {
+    wg_cols *= 2;
+  }
+
+  const index_t panel_size = _K * panel_cols;
+  const index_t num_panels = (_N - 1) / panel_cols + 1;
+  auto buffer_a = make_input_matrix_view<col_major>(a_, _M, _K, _lda);
+  auto buffer_b = make_input_matrix_view<col_major>(packed_b, panel_size,
+                                                    num_panels, panel_size);
+  auto buffer_c = make_matrix_view<col_major>(_C, _M, _N, _ldc);
+  auto gemm = make_gemm_packed<item_rows, panel_cols, _t_a>(
+      buffer_a, buffer_b, buffer_c, _alpha, _beta, wg_rows, wg_cols);
+  const auto rng = gemm.get_nd_range();
+  return sb_handle.execute(gemm,
+                           static_cast<index_t>(rng.get_local_range()[0]),
+                           static_cast<index_t>(rng.get_global_range()[0]));
+}
+
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t>
+typename sb_handle_t::event_t _gemm_packed(
+    sb_handle_t& sb_handle, char _TransA, index_t _M, index_t _N, index_t _K,
+    element_t _alpha, container_0_t a_, index_t _lda, container_1_t packed_b,
+    element_t _beta, container_2_t _C, index_t _ldc) {
+  _TransA = tolower(_TransA);
+  if (_TransA != 'n' && _TransA != 't' && _TransA != 'c') {
+    throw std::invalid_argument("invalid _TransA");
+  }
+  // The rows of the panels are read with vector loads of
+  // gemm_packed_panel_cols elements, which must be aligned
+  if (packed_b.get_offset() % gemm_packed_panel_cols != 0) {
+    throw std::invalid_argument(
+        "packed_b offset must be a multiple of gemm_packed_panel_cols");
+  }
+  if (_M == 0 || _N == 0) {
+    return {};
+  }
+
+  if (_TransA != 'n') {
+    return _gemm_packed_impl<true>(sb_handle, _M, _N, _K, _alpha, a_, _lda,
+                                   packed_b, _beta, _C, _ldc);
+  } else {
+    return _gemm_packed_impl<false>(sb_handle, _M, _N, _K, _alpha, a_, _lda,
+                                    packed_b, _beta, _C, _ldc);
+  }
+}
+
 }  // namespace internal
 }  // namespace blas
 
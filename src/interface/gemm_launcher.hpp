@@ -48,8 +48,8 @@ typename sb_handle_t::event_t Gemm_Launcher<
                              index_t _lda, container_t1 b_, index_t _ldb,
                              element_t _beta, container_t2 _C, index_t _ldc,
                              index_t batch_size) {
-  auto buffer_a = make_matrix_view<col_major>(a_, _M, _K, _lda);
-  auto buffer_b = make_matrix_view<col_major>(b_, _K, _N, _ldb);
+  auto buffer_a = make_input_matrix_view<col_major>(a_, _M, _K, _lda);
+  auto buffer_b = make_input_matrix_view<col_major>(b_, _K, _N, _ldb);
   auto buffer_c = make_matrix_view<col_major>(_C, _M, _N, _ldc);
 
   auto gemm = make_gemm<DoubleBuffer, ConflictA, ConflictB, ClSize, TileT,
@@ -51,20 +51,12 @@ struct get_second_step_op<MeanOperator> {
  * the Reduction kernel
  */
 template <typename operator_t, reduction_dim_t reduction_dim,
-          typename element_t, typename sb_handle_t, typename input_t,
+          typename element_t, int ClSize, int WgSize,
+          int reductions_per_thread, typename sb_handle_t, typename input_t,
           typename output_t, typename index_t>
 typename sb_handle_t::event_t launch_type_based_reduction(
     sb_handle_t& sb_handle, input_t buffer_in, index_t ld, output_t buffer_out,
     index_t rows, index_t cols) {
-#ifdef POWER_VR
-  constexpr int ClSize = 32;
-  constexpr int WgSize = 64;
-#else
-  constexpr int ClSize = 64;
-  constexpr int WgSize = 256;
-#endif
-  constexpr index_t reductions_per_thread = 64;
-
   using params_t = blas::ReductionParams<index_t, element_t, ClSize, WgSize,
                                          reductions_per_thread,
                                          static_cast<int>(reduction_dim)>;
@@ -76,7 +68,7 @@ typename sb_handle_t::event_t launch_type_based_reduction(
   typename sb_handle_t::event_t reduction_event;
 
   auto matrix_buffer_in =
-      make_matrix_view<col_major>(buffer_in, rows, cols, ld);
+      make_input_matrix_view<col_major>(buffer_in, rows, cols, ld);
   const index_t out_rows =
       reduction_dim == reduction_dim_t::outer ? rows : index_t(1);
   const index_t out_cols =
@@ -88,9 +80,9 @@ typename sb_handle_t::event_t launch_type_based_reduction(
   /* 2-step reduction */
   if (two_step_reduction) {
     /* Create a temporary buffer */
-    auto temp_buffer = make_sycl_iterator_buffer<element_t>(
-        (reduction_dim == reduction_dim_t::outer ? rows : cols) *
-        reduced_group_count);
+    auto temp_buffer = blas::internal::make_scratch_buffer<element_t>(
+        sb_handle, (reduction_dim == reduction_dim_t::outer ? rows : cols) *
+                       reduced_group_count);
 
     const index_t temp_rows =
         reduction_dim == reduction_dim_t::outer ? rows : reduced_group_count;
@@ -122,6 +114,31 @@ typename sb_handle_t::event_t launch_type_based_reduction(
   return reduction_event;
 }
 
+/*!
+ * @brief Launches the reduction along the given dimension with the work group
+ * shape of the device.
+ */
+template <typename operator_t, typename element_t, int ClSize, int WgSize,
+          int reductions_per_thread, typename sb_handle_t, typename input_t,
+          typename output_t, typename index_t>
+typename sb_handle_t::event_t launch_reduction(sb_handle_t& sb_handle,
+                                               input_t buffer_in, index_t ld,
+                                               output_t buffer_out,
+                                               index_t rows, index_t cols,
+                                               reduction_dim_t reduction_dim) {
+  if (reduction_dim == reduction_dim_t::inner) {
+    return launch_type_based_reduction<operator_t, reduction_dim_t::inner,
+                                       element_t, ClSize, WgSize,
+                                       reductions_per_thread>(
+        sb_handle, buffer_in, ld, buffer_out, rows, cols);
+  } else {  // reduction_dim_t::outer
+    return launch_type_based_reduction<operator_t, reduction_dim_t::outer,
+                                       element_t, ClSize, WgSize,
+                                       reductions_per_thread>(
+        sb_handle, buffer_in, ld, buffer_out, rows, cols);
+  }
+}
+
 template <typename operator_t, typename element_t, typename sb_handle_t,
           typename input_t, typename output_t, typename index_t>
 typename sb_handle_t::event_t _reduction(sb_handle_t& sb_handle,
@@ -129,15 +146,21 @@ typename sb_handle_t::event_t _reduction(sb_handle_t& sb_handle,
                                          output_t buffer_out, index_t rows,
                                          index_t cols,
                                          reduction_dim_t reduction_dim) {
-  if (reduction_dim == reduction_dim_t::inner) {
-    return launch_type_based_reduction<operator_t, reduction_dim_t::inner,
-                                       element_t>(sb_handle, buffer_in, ld,
-                                                  buffer_out, rows, cols);
-  } else {  // reduction_dim_t::outer
-    return launch_type_based_reduction<operator_t, reduction_dim_t::outer,
-                                       element_t>(sb_handle, buffer_in, ld,
-                                                  buffer_out, rows, cols);
+#ifdef DEFAULT_CPU
+  if (sb_handle.is_cpu_device()) {
+    // Fewer, longer running work items, each one reducing a slice that fits
+    // in the L1 and L2 caches of its core
+    return launch_reduction<operator_t, element_t, 64, 64, 256>(
+        sb_handle, buffer_in, ld, buffer_out, rows, cols, reduction_dim);
   }
+#endif
+#ifdef POWER_VR
+  return launch_reduction<operator_t, element_t, 32, 64, 64>(
+      sb_handle, buffer_in, ld, buffer_out, rows, cols, reduction_dim);
+#else
+  return launch_reduction<operator_t, element_t, 64, 256, 64>(
+      sb_handle, buffer_in, ld, buffer_out, rows, cols, reduction_dim);
+#endif
 }
 
 }  // namespace internal
@@ -0,0 +1,168 @@
+/***************************************************************************
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename symm_interface.hpp
+ *
+ **************************************************************************/
+
+#ifndef SYCL_BLAS_BLAS3_SYMM_INTERFACE_HPP
+#define SYCL_BLAS_BLAS3_SYMM_INTERFACE_HPP
+
+#include "blas_meta.h"
+#include "interface/gemm_interface.hpp"
+#include "interface/trmm_interface.hpp"
+#include "operations/blas3_trees.h"
+#include "sb_handle/sycl_blas_handle.h"
+#include "sycl_blas_helper.h"
+#include "views/view.h"
+
+namespace blas {
+namespace internal {
+
+/**
+ * @brief Implementation of the Symmetric Matrix Multiplication (SYMM).
+ *
+ * C = alpha*A*B + beta*C    or    C = alpha*B*A + beta*C
+ *
+ * where A is a symmetric matrix of which only the triangle given by uplo is
+ * stored.
+ *
+ * The product is computed by block rows (left side) or block columns (right
+ * side) of C. The diagonal blocks of A are expanded once into a small scratch
+ * buffer, mirroring the stored triangle, and the off-diagonal part of each
+ * block row (or column) of A is covered by two panels: the one inside the
+ * stored triangle is used as is, and the one outside it is read from the
+ * stored triangle and transposed by internal::_gemm.
+ *
+ * @note all matrices are expected to be stored in column major order
+ */
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t>
+typename sb_handle_t::event_t _symm(sb_handle_t& sb_handle, char side,
+                                    char uplo, index_t M, index_t N,
+                                    element_t alpha, container_0_t A,
+                                    index_t lda, container_1_t B, index_t ldb,
+                                    element_t beta, container_2_t C,
+                                    index_t ldc) {
+  side = tolower(side);
+  uplo = tolower(uplo);
+
+  if (side != 'l' && side != 'r') {
+    throw std::invalid_argument("invalid Side argument");
+  } else if (uplo != 'u' && uplo != 'l') {
+    throw std::invalid_argument("invalid Triangle argument");
+  }
+
+  const bool isLeft = side == 'l';
+  const bool isUpper = uplo == 'u';
+  const index_t K = isLeft ? M : N;
+
+  if ((M == 0) || (N == 0) || (lda < K) || (ldb < M) || (ldc < M)) {
+    throw std::invalid_argument("invalid matrix size argument");
+  }
+
+  constexpr index_t minBlockSize = 64;
+  constexpr index_t maxBlocks = 8;
+  const index_t blockSize = std::max(
+      minBlockSize, roundUp<index_t>((K + maxBlocks - 1) / maxBlocks, 16));
+  const index_t numBlocks = (K + blockSize - 1) / blockSize;
+  const index_t diagBlockSize = blockSize * blockSize;
+
+  typename sb_handle_t::event_t symmEvents;
+
+  auto diagBlocks = internal::make_scratch_buffer<element_t>(
+      sb_handle, diagBlockSize * numBlocks);
+  symmEvents = concatenate_vectors(
+      symmEvents,
+      _expand_diagonal_blocks<true>(sb_handle, isUpper, false, K, A, lda,
+                                    diagBlocks, blockSize));
+
+  for (index_t i = 0; i < numBlocks; ++i) {
+    const index_t blockStart = i * blockSize;
+    const index_t currentBlockSize = std::min(K - blockStart, blockSize);
+    const index_t afterStart = blockStart + currentBlockSize;
+    auto diagBlock = diagBlocks + i * diagBlockSize;
+
+    // The logical block A(i, 0:blockStart) is stored for a lower A, and
+    // A(i, afterStart:K) for an upper A. The other one is the transpose of a
+    // stored panel.
+    const char transBefore = isUpper ? 't' : 'n';
+    const char transAfter = isUpper ? 'n' : 't';
+    const std::ptrdiff_t offsetBefore =
+        isUpper ? blockStart * lda : blockStart;
+    const std::ptrdiff_t offsetAfter = isUpper
+                                           ? blockStart + afterStart * lda
+                                           : afterStart + blockStart * lda;
+
+    if (isLeft) {
+      auto blockC = C + blockStart;
+      symmEvents = concatenate_vectors(
+          symmEvents,
+          internal::_gemm(sb_handle, 'n', 'n', currentBlockSize, N,
+                          currentBlockSize, alpha, diagBlock, blockSize,
+                          B + blockStart, ldb, beta, blockC, ldc));
+      if (blockStart > 0) {
+        symmEvents = concatenate_vectors(
+            symmEvents,
+            internal::_gemm(sb_handle, transBefore, 'n', currentBlockSize, N,
+                            blockStart, alpha, A + offsetBefore, lda, B, ldb,
+                            element_t{1}, blockC, ldc));
+      }
+      if (afterStart < K) {
+        symmEvents = concatenate_vectors(
+            symmEvents,
+            internal::_gemm(sb_handle, transAfter, 'n', currentBlockSize, N,
+                            K - afterStart, alpha, A + offsetAfter, lda,
+                            B + afterStart, ldb, element_t{1}, blockC, ldc));
+      }
+    } else {
+      // For the right side the block column A(:, i) is needed, which is the
+      // transpose of the block row A(i, :) by symmetry
+      auto blockC = C + blockStart * ldc;
+      symmEvents = concatenate_vectors(
+          symmEvents,
+          internal::_gemm(sb_handle, 'n', 'n', M, currentBlockSize,
+                          currentBlockSize, alpha, B + blockStart * ldb, ldb,
+                          diagBlock, blockSize, beta, blockC, ldc));
+      if (blockStart > 0) {
+        symmEvents = concatenate_vectors(
+            symmEvents,
+            internal::_gemm(sb_handle, 'n', transBefore == 'n' ? 't' : 'n', M,
+                            currentBlockSize, blockStart, alpha, B, ldb,
+                            A + offsetBefore, lda, element_t{1}, blockC, ldc));
+      }
+      if (afterStart < K) {
+        symmEvents = concatenate_vectors(
+            symmEvents,
+            internal::_gemm(sb_handle, 'n', transAfter == 'n' ? 't' : 'n', M,
+                            currentBlockSize, K - afterStart, alpha,
+                            B + afterStart * ldb, ldb, A + offsetAfter, lda,
+                            element_t{1}, blockC, ldc));
+      }
+    }
+  }
+
+  return symmEvents;
+}
+
+}  // namespace internal
+}  // namespace blas
+
+#endif  // SYCL_BLAS_BLAS3_SYMM_INTERFACE_HPP
@@ -0,0 +1,253 @@
+/***************************************************************************
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename syrk_interface.hpp
+ *
+ **************************************************************************/
+
+#ifndef SYCL_BLAS_BLAS3_SYRK_INTERFACE_HPP
+#define SYCL_BLAS_BLAS3_SYRK_INTERFACE_HPP
+
+#include "blas_meta.h"
+#include "interface/gemm_interface.hpp"
+#include "operations/blas3_trees.h"
+#include "sb_handle/sycl_blas_handle.h"
+#include "sycl_blas_helper.h"
+#include "views/view.h"
+
+namespace blas {
+namespace internal {
+
+/**
+ * @brief Blocked implementation shared by SYRK and SYR2K.
+ *
+ * C is divided in block columns of blockSize columns. For each block column j
+ * only the tiles that touch the requested triangle are computed:
+ *
+ *  - The off-diagonal panel (rows above the diagonal block for an upper C,
+ *    rows below it for a lower C) is a plain GEMM written in place.
+ *  - The diagonal block is computed by GEMM into a scratch buffer and then
+ *    merged into the triangle of C by DiagonalBlocksUpdate, so the opposite
+ *    triangle of C is never touched.
+ *
+ * The tiles of C that lie entirely outside the triangle are never computed,
+ * and every GEMM goes through internal::_gemm so the backend specific tile
+ * selection applies to all of them.
+ *
+ * When rank2 is true, alpha*op(B)*op(A)^T is added to each tile as well.
+ *
+ * As in _gemm, when K or alpha is zero the triangle of C is only scaled by
+ * beta, and nothing is launched when beta is one as well.
+ */
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t>
+typename sb_handle_t::event_t _syrk_blocked(
+    sb_handle_t& sb_handle, bool isUpper, bool isTranspose, bool rank2,
+    index_t N, index_t K, element_t alpha, container_0_t A, index_t lda,
+    container_1_t B, index_t ldb, element_t beta, container_2_t C,
+    index_t ldc) {
+  const bool scaleOnly = (K == 0) || (alpha == element_t{0});
+  if (scaleOnly && beta == element_t{1}) {
+    return {};
+  }
+
+  // Around maxBlocks block columns are used for large matrices, which computes
+  // about (maxBlocks + 1) / (2 * maxBlocks) of the full GEMM
+  constexpr index_t minBlockSize = 64;
+  constexpr index_t maxBlocks = 8;
+  const index_t blockSize = std::max(
+      minBlockSize, roundUp<index_t>((N + maxBlocks - 1) / maxBlocks, 16));
+  const index_t numBlocks = (N + blockSize - 1) / blockSize;
+
+  const char transA = isTranspose ? 't' : 'n';
+  const char transB = isTranspose ? 'n' : 't';
+  // Offset of the first row of op(A) (or op(B)) belonging to a block
+  auto offsetA = [&](index_t row) -> std::ptrdiff_t {
+    return isTranspose ? row * lda : row;
+  };
+  auto offsetB = [&](index_t row) -> std::ptrdiff_t {
+    return isTranspose ? row * ldb : row;
+  };
+
+  typename sb_handle_t::event_t syrkEvents;
+
+  // Scratch buffer holding the diagonal blocks one after the other
+  const index_t scratchBlockSize = blockSize * blockSize;
+  auto scratch = internal::make_scratch_buffer<element_t>(
+      sb_handle, scratchBlockSize * numBlocks);
+  if (scaleOnly) {
+    // The diagonal blocks only add beta*C, the product being empty
+    syrkEvents = concatenate_vectors(
+        syrkEvents, std::vector<cl::sycl::event>{internal::fill(
+                        sb_handle, scratch, element_t{0},
+                        scratchBlockSize * numBlocks)});
+  }
+
+  for (index_t i = 0; i < numBlocks; ++i) {
+    const index_t blockStart = i * blockSize;
+    const index_t currentBlockSize = std::min(N - blockStart, blockSize);
+    auto scratchBlock = scratch + i * scratchBlockSize;
+
+    // Diagonal block
+    if (!scaleOnly) {
+      syrkEvents = concatenate_vectors(
+        syrkEvents,
+          internal::_gemm(sb_handle, transA, transB, currentBlockSize,
+                          currentBlockSize, K, alpha, A + offsetA(blockStart),
+                          lda, B + offsetB(blockStart), ldb, element_t{0},
+                          scratchBlock, blockSize));
+    }
+    if (rank2 && !scaleOnly) {
+      syrkEvents = concatenate_vectors(
+          syrkEvents,
+          internal::_gemm(sb_handle, transA, transB, currentBlockSize,
+                          currentBlockSize, K, alpha, B + offsetB(blockStart),
+                          ldb, A + offsetA(blockStart), lda, element_t{1},
+                          scratchBlock, blockSize));
+    }
+
+    // Off-diagonal panel of the block column
+    const index_t panelStart = isUpper ? 0 : blockStart + currentBlockSize;
+    const index_t panelRows = isUpper ? blockStart : N - panelStart;
+    if (panelRows <= 0) {
+      continue;
+    }
+    // With a zero alpha _gemm only scales the panel by beta
+    auto panelC = C + (panelStart + blockStart * ldc);
+    syrkEvents = concatenate_vectors(
+        syrkEvents,
+        internal::_gemm(sb_handle, transA, transB, panelRows, currentBlockSize,
+                        K, scaleOnly ? element_t{0} : alpha,
+                        A + offsetA(panelStart), lda, B + offsetB(blockStart),
+                        ldb, beta, panelC, ldc));
+    if (rank2 && !scaleOnly) {
+      syrkEvents = concatenate_vectors(
+          syrkEvents,
+          internal::_gemm(sb_handle, transA, transB, panelRows,
+                          currentBlockSize, K, alpha, B + offsetB(panelStart),
+                          ldb, A + offsetA(blockStart), lda, element_t{1},
+                          panelC, ldc));
+    }
+  }
+
+  // Merges the triangles of all the diagonal blocks in a single launch
+  auto bufferC = make_matrix_view<col_major>(C, N, N, ldc);
+  auto bufferScratch = make_matrix_view<col_major>(
+      scratch, blockSize, blockSize * numBlocks, blockSize);
+  const index_t localSize = sb_handle.get_work_group_size();
+  const index_t globalSize =
+      roundUp<index_t>(scratchBlockSize * numBlocks, localSize);
+  if (isUpper) {
+    auto update =
+        make_diag_blocks_update<true>(bufferC, bufferScratch, beta, blockSize);
+    syrkEvents = concatenate_vectors(
+        syrkEvents, sb_handle.execute(update, localSize, globalSize));
+  } else {
+    auto update =
+        make_diag_blocks_update<false>(bufferC, bufferScratch, beta, blockSize);
+    syrkEvents = concatenate_vectors(
+        syrkEvents, sb_handle.execute(update, localSize, globalSize));
+  }
+
+  return syrkEvents;
+}
+
+/**
+ * @brief Implementation of the Symmetric Rank-K update (SYRK).
+ *
+ * C = alpha*A*A^T + beta*C    or    C = alpha*A^T*A + beta*C
+ *
+ * where C is an N by N symmetric matrix of which only the triangle given by
+ * uplo is referenced, and A is N by K (trans = 'n') or K by N otherwise.
+ *
+ * See the netlib blas interface documentation for more details.
+ *
+ * @note all matrices are expected to be stored in column major order. For the
+ * real types supported by SYCL-BLAS, HERK is equivalent to SYRK.
+ */
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename element_t, typename index_t>
+typename sb_handle_t::event_t _syrk(sb_handle_t& sb_handle, char uplo,
+                                    char trans, index_t N, index_t K,
+                                    element_t alpha, container_0_t A,
+                                    index_t lda, element_t beta,
+                                    container_1_t C, index_t ldc) {
+  uplo = tolower(uplo);
+  trans = tolower(trans);
+
+  if (uplo != 'u' && uplo != 'l') {
+    throw std::invalid_argument("invalid Triangle argument");
+  } else if (trans != 'n' && trans != 't' && trans != 'c') {
+    throw std::invalid_argument("invalid Transpose argument");
+  }
+
+  const bool isTranspose = trans != 'n';
+  if ((N == 0) || (K < 0) || (lda < (isTranspose ? K : N)) || (ldc < N)) {
+    throw std::invalid_argument("invalid matrix size argument");
+  }
+
+  return _syrk_blocked(sb_handle, uplo == 'u', isTranspose, false, N, K, alpha,
+                       A, lda, A, lda, beta, C, ldc);
+}
+
+/**
+ * @brief Implementation of the Symmetric Rank-2K update (SYR2K).
+ *
+ * C = alpha*A*B^T + alpha*B*A^T + beta*C    or
+ * C = alpha*A^T*B + alpha*B^T*A + beta*C
+ *
+ * where C is an N by N symmetric matrix of which only the triangle given by
+ * uplo is referenced, and A and B are N by K (trans = 'n') or K by N otherwise.
+ *
+ * See the netlib blas interface documentation for more details.
+ *
+ * @note all matrices are expected to be stored in column major order.
+ */
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t>
+typename sb_handle_t::event_t _syr2k(sb_handle_t& sb_handle, char uplo,
+                                     char trans, index_t N, index_t K,
+                                     element_t alpha, container_0_t A,
+                                     index_t lda, container_1_t B, index_t ldb,
+                                     element_t beta, container_2_t C,
+                                     index_t ldc) {
+  uplo = tolower(uplo);
+  trans = tolower(trans);
+
+  if (uplo != 'u' && uplo != 'l') {
+    throw std::invalid_argument("invalid Triangle argument");
+  } else if (trans != 'n' && trans != 't' && trans != 'c') {
+    throw std::invalid_argument("invalid Transpose argument");
+  }
+
+  const bool isTranspose = trans != 'n';
+  const index_t minLd = isTranspose ? K : N;
+  if ((N == 0) || (K < 0) || (lda < minLd) || (ldb < minLd) || (ldc < N)) {
+    throw std::invalid_argument("invalid matrix size argument");
+  }
+
+  return _syrk_blocked(sb_handle, uplo == 'u', isTranspose, true, N, K, alpha,
+                       A, lda, B, ldb, beta, C, ldc);
+}
+
+}  // namespace internal
+}  // namespace blas
+
+#endif  // SYCL_BLAS_BLAS3_SYRK_INTERFACE_HPP
@@ -0,0 +1,212 @@
+/***************************************************************************
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename trmm_interface.hpp
+ *
+ **************************************************************************/
+
+#ifndef SYCL_BLAS_BLAS3_TRMM_INTERFACE_HPP
+#define SYCL_BLAS_BLAS3_TRMM_INTERFACE_HPP
+
+#include "blas_meta.h"
+#include "interface/gemm_interface.hpp"
+#include "operations/blas3_trees.h"
+#include "sb_handle/sycl_blas_handle.h"
+#include "sycl_blas_helper.h"
+#include "views/view.h"
+
+namespace blas {
+namespace internal {
+
+/**
+ * @brief Writes the full diagonal blocks of the K by K triangular or symmetric
+ * matrix A into diagBlocks, one blockSize*blockSize block after the other.
+ *
+ * Only the stored triangle of A is read, the other one is mirrored (symmetric)
+ * or zeroed (triangular), so the blocks can be used directly as GEMM operands.
+ */
+template <bool Symmetric, typename sb_handle_t, typename container_0_t,
+          typename container_1_t, typename index_t>
+typename sb_handle_t::event_t _expand_diagonal_blocks(
+    sb_handle_t& sb_handle, bool isUpper, bool isUnitDiag, index_t K,
+    container_0_t A, index_t lda, container_1_t diagBlocks,
+    index_t blockSize) {
+  const index_t numBlocks = (K + blockSize - 1) / blockSize;
+  auto bufferA = make_matrix_view<col_major>(A, K, K, lda);
+  auto bufferDiag = make_matrix_view<col_major>(
+      diagBlocks, blockSize, blockSize * numBlocks, blockSize);
+  const index_t localSize = sb_handle.get_work_group_size();
+  const index_t globalSize =
+      roundUp<index_t>(blockSize * blockSize * numBlocks, localSize);
+  if (isUpper && isUnitDiag) {
+    auto expand = make_diag_blocks_expand<Symmetric, true, true>(
+        bufferDiag, bufferA, blockSize);
+    return sb_handle.execute(expand, localSize, globalSize);
+  } else if (isUpper && !isUnitDiag) {
+    auto expand = make_diag_blocks_expand<Symmetric, true, false>(
+        bufferDiag, bufferA, blockSize);
+    return sb_handle.execute(expand, localSize, globalSize);
+  } else if (!isUpper && isUnitDiag) {
+    auto expand = make_diag_blocks_expand<Symmetric, false, true>(
+        bufferDiag, bufferA, blockSize);
+    return sb_handle.execute(expand, localSize, globalSize);
+  } else {
+    auto expand = make_diag_blocks_expand<Symmetric, false, false>(
+        bufferDiag, bufferA, blockSize);
+    return sb_handle.execute(expand, localSize, globalSize);
+  }
+}
+
+/**
+ * @brief Implementation of the Triangular Matrix Multiplication (TRMM).
+ *
+ * B = alpha*op(A)*B    or    B = alpha*B*op(A)
+ *
+ * where A is a unit or non-unit, upper or lower triangular matrix, and
+ * op(A) = A or op(A) = A^T.
+ *
+ * The product is computed by block rows (left side) or block columns (right
+ * side) of B. Each block is the sum of a diagonal block product and a single
+ * panel product over the non-zero part of op(A), both computed by
+ * internal::_gemm. The diagonal blocks of A are expanded once into a small
+ * scratch buffer, zeroing the triangle that is not stored, so no element
+ * outside the stored triangle of A is ever read and the zero blocks of op(A)
+ * are skipped. B is copied to a temporary buffer first as it is updated in
+ * place.
+ *
+ * @note both matrices A and B are expected to be stored in column major order
+ */
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename element_t, typename index_t>
+typename sb_handle_t::event_t _trmm(sb_handle_t& sb_handle, char side,
+                                    char uplo, char trans, char diag, index_t M,
+                                    index_t N, element_t alpha, container_0_t A,
+                                    index_t lda, container_1_t B, index_t ldb) {
+  side = tolower(side);
+  uplo = tolower(uplo);
+  trans = tolower(trans);
+  diag = tolower(diag);
+
+  if (side != 'l' && side != 'r') {
+    throw std::invalid_argument("invalid Side argument");
+  } else if (uplo != 'u' && uplo != 'l') {
+    throw std::invalid_argument("invalid Triangle argument");
+  } else if (trans != 'n' && trans != 't' && trans != 'c') {
+    throw std::invalid_argument("invalid Transpose argument");
+  } else if (diag != 'u' && diag != 'n') {
+    throw std::invalid_argument("invalid Diagonal argument");
+  }
+
+  const bool isLeft = side == 'l';
+  const bool isUpper = uplo == 'u';
+  const bool isTranspose = trans != 'n';
+  const bool isUnitDiag = diag == 'u';
+  const index_t K = isLeft ? M : N;
+
+  if ((M == 0) || (N == 0) || (lda < K) || (ldb < M)) {
+    throw std::invalid_argument("invalid matrix size argument");
+  }
+
+  // op(A) is lower triangular for a lower A or for a transposed upper A
+  const bool isOpLower = isUpper == isTranspose;
+
+  constexpr index_t minBlockSize = 64;
+  constexpr index_t maxBlocks = 8;
+  const index_t blockSize = std::max(
+      minBlockSize, roundUp<index_t>((K + maxBlocks - 1) / maxBlocks, 16));
+  const index_t numBlocks = (K + blockSize - 1) / blockSize;
+  const index_t diagBlockSize = blockSize * blockSize;
+  const char transA = isTranspose ? 't' : 'n';
+
+  typename sb_handle_t::event_t trmmEvents;
+
+  auto diagBlocks = internal::make_scratch_buffer<element_t>(
+      sb_handle, diagBlockSize * numBlocks);
+  trmmEvents = concatenate_vectors(
+      trmmEvents,
+      _expand_diagonal_blocks<false>(sb_handle, isUpper, isUnitDiag, K, A, lda,
+                                     diagBlocks, blockSize));
+
+  // B is read by the panels of other blocks while it is updated, so the
+  // products read from a copy of it
+  const index_t BSize = ldb * (N - 1) + M;
+  const index_t ldx = ldb;
+  auto X = internal::make_scratch_buffer<element_t>(sb_handle, BSize);
+  trmmEvents = concatenate_vectors(
+      trmmEvents, internal::_copy(sb_handle, BSize, B, 1, X, 1));
+
+  for (index_t i = 0; i < numBlocks; ++i) {
+    const index_t blockStart = i * blockSize;
+    const index_t currentBlockSize = std::min(K - blockStart, blockSize);
+    auto diagBlock = diagBlocks + i * diagBlockSize;
+
+    // Range of op(A) that is not zero in the block row (left) or block column
+    // (right), excluding the diagonal block
+    const bool panelBefore = isLeft ? isOpLower : !isOpLower;
+    const index_t panelStart = panelBefore ? 0 : blockStart + currentBlockSize;
+    const index_t panelSize = panelBefore ? blockStart : K - panelStart;
+
+    if (isLeft) {
+      trmmEvents = concatenate_vectors(
+          trmmEvents,
+          internal::_gemm(sb_handle, transA, 'n', currentBlockSize, N,
+                          currentBlockSize, alpha, diagBlock, blockSize,
+                          X + blockStart, ldx, element_t{0}, B + blockStart,
+                          ldb));
+      if (panelSize > 0) {
+        // op(A)(block rows, panel columns)
+        const std::ptrdiff_t offsetA =
+            isTranspose ? (panelStart + blockStart * lda)
+                        : (blockStart + panelStart * lda);
+        trmmEvents = concatenate_vectors(
+            trmmEvents,
+            internal::_gemm(sb_handle, transA, 'n', currentBlockSize, N,
+                            panelSize, alpha, A + offsetA, lda, X + panelStart,
+                            ldx, element_t{1}, B + blockStart, ldb));
+      }
+    } else {
+      trmmEvents = concatenate_vectors(
+          trmmEvents,
+          internal::_gemm(sb_handle, 'n', transA, M, currentBlockSize,
+                          currentBlockSize, alpha, X + blockStart * ldx, ldx,
+                          diagBlock, blockSize, element_t{0},
+                          B + blockStart * ldb, ldb));
+      if (panelSize > 0) {
+        // op(A)(panel rows, block columns)
+        const std::ptrdiff_t offsetA =
+            isTranspose ? (blockStart + panelStart * lda)
+                        : (panelStart + blockStart * lda);
+        trmmEvents = concatenate_vectors(
+            trmmEvents,
+            internal::_gemm(sb_handle, 'n', transA, M, currentBlockSize,
+                            panelSize, alpha, X + panelStart * ldx, ldx,
+                            A + offsetA, lda, element_t{1},
+                            B + blockStart * ldb, ldb));
+      }
+    }
+  }
+
+  return trmmEvents;
+}
+
+}  // namespace internal
+}  // namespace blas
+
+#endif  // SYCL_BLAS_BLAS3_TRMM_INTERFACE_HPP
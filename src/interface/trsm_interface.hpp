@@ -34,6 +34,254 @@
 namespace blas {
 namespace internal {
 
+/**
+ * @brief GEMM step of the blocked TRSM solve, computing
+ * C_i = alpha*op(A_i)*op(B_i) + beta*C_i for each of the batchSize matrices,
+ * the operands of matrix i starting strideA, strideB and strideC elements
+ * after those of matrix i - 1.
+ *
+ * A single system is handed to _gemm. A batch is computed in one launch of
+ * TrsmBatchedGemm, which requires K <= BlockSize; _gemm_batched cannot be used
+ * here because it derives the strides from the sizes of the operands.
+ */
+template <int BlockSize, typename sb_handle_t, typename container_0_t,
+          typename container_1_t, typename container_2_t, typename element_t,
+          typename index_t>
+typename sb_handle_t::event_t _trsm_gemm(
+    sb_handle_t& sb_handle, bool transA, bool transB, index_t M, index_t N,
+    index_t K, element_t alpha, container_0_t A, index_t lda, index_t strideA,
+    container_1_t B, index_t ldb, index_t strideB, element_t beta,
+    container_2_t C, index_t ldc, index_t strideC, index_t batchSize) {
+  if ((M == 0) || (N == 0)) {
+    return {};
+  }
+  if (batchSize == 1) {
+    return internal::_gemm(sb_handle, transA ? 't' : 'n', transB ? 't' : 'n',
+                           M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
+  }
+  auto bufferA = make_matrix_view<col_major>(A, M, K, lda);
+  auto bufferB = make_matrix_view<col_major>(B, K, N, ldb);
+  auto bufferC = make_matrix_view<col_major>(C, M, N, ldc);
+  const index_t tilesM = (M + BlockSize - 1) / BlockSize;
+  const index_t tilesN = (N + BlockSize - 1) / BlockSize;
+  const index_t localSize = BlockSize * BlockSize;
+  const index_t globalSize = batchSize * tilesM * tilesN * localSize;
+  const index_t localMemSize = BlockSize * (2 * BlockSize + 1);
+  if (!transA && !transB) {
+    auto gemmTree = make_trsm_batched_gemm<false, false, BlockSize>(
+        bufferA, bufferB, bufferC, alpha, beta, M, N, K, strideA, strideB,
+        strideC, batchSize);
+    return sb_handle.execute(gemmTree, localSize, globalSize, localMemSize);
+  } else if (!transA && transB) {
+    auto gemmTree = make_trsm_batched_gemm<false, true, BlockSize>(
+        bufferA, bufferB, bufferC, alpha, beta, M, N, K, strideA, strideB,
+        strideC, batchSize);
+    return sb_handle.execute(gemmTree, localSize, globalSize, localMemSize);
+  } else if (transA && !transB) {
+    auto gemmTree = make_trsm_batched_gemm<true, false, BlockSize>(
+        bufferA, bufferB, bufferC, alpha, beta, M, N, K, strideA, strideB,
+        strideC, batchSize);
+    return sb_handle.execute(gemmTree, localSize, globalSize, localMemSize);
+  } else {
+    auto gemmTree = make_trsm_batched_gemm<true, true, BlockSize>(
+        bufferA, bufferB, bufferC, alpha, beta, M, N, K, strideA, strideB,
+        strideC, batchSize);
+    return sb_handle.execute(gemmTree, localSize, globalSize, localMemSize);
+  }
+}
+
+/**
+ * @brief Blocked GEMM phase of TRSM, shared by _trsm and _trsm_batched.
+ *
+ * Given the inverses of the diagonal blocks of A in invA (blockSize*blockSize
+ * consecutive column major blocks), solves op(A)*X = alpha*B or
+ * X*op(A) = alpha*B writing the result to X. B is overwritten with partial
+ * results. See the documentation of _trsm for a description of the algorithm.
+ *
+ * The batchSize systems are solved together: system i reads A, B, invA and X
+ * strideA, strideB, strideInvA and strideX elements after system i - 1, and
+ * each block step is a pair of GEMM launches covering the whole batch.
+ */
+template <int BlockSize, typename sb_handle_t, typename container_0_t,
+          typename container_1_t, typename container_2_t,
+          typename container_3_t, typename element_t, typename index_t>
+typename sb_handle_t::event_t _trsm_blocked_solve(
+    sb_handle_t& sb_handle, bool isLeft, bool isUpper, bool isTranspose,
+    index_t M, index_t N, element_t alpha, container_0_t A, index_t lda,
+    index_t strideA, container_1_t B, index_t ldb, index_t strideB,
+    container_2_t invA, index_t strideInvA, container_3_t X, index_t ldx,
+    index_t strideX, index_t batchSize) {
+  constexpr index_t blockSize = BlockSize;
+  typename sb_handle_t::event_t trsmEvents;
+
+  if (isLeft) {
+    if ((isUpper && isTranspose) || (!isUpper && !isTranspose)) {
+      // Solves the system AX = alpha*B, as described in the documentation of
+      // the function when X is lower triangular.
+      //
+      //         A            X                 B
+      //    [ A00   0  ] * [ X0 ]  =  alpha * [ B0 ]
+      //    [ A10  A11 ]   [ X1 ]             [ B1 ]
+      //
+      // yields:
+      //
+      //  X0 = alpha*A00{-1}*B0
+      //  B1 = -1 * A10*X0 + alpha*B1
+      //  X1 = A11{-1}*B1  + 0*X1
+      //
+
+      // True when (lower triangular) or (upper triangular and transposed)
+      for (index_t i = 0; i < M; i += blockSize) {
+        const index_t currentBlockSize = std::min(M - i, blockSize);
+        auto gemmEvent = _trsm_gemm<BlockSize>(
+            sb_handle, isTranspose, false, currentBlockSize, N,
+            currentBlockSize, (i == 0) ? alpha : element_t{1},
+            invA + i * blockSize, blockSize, strideInvA, B + i, ldb, strideB,
+            element_t{0}, X + i, ldx, strideX, batchSize);
+        trsmEvents = concatenate_vectors(trsmEvents, gemmEvent);
+
+        if ((i + blockSize) >= M) {
+          break;
+        }
+
+        const std::ptrdiff_t offsetA = !isTranspose
+                                           ? ((i + blockSize) + (i * lda))
+                                           : (i + (blockSize + i) * lda);
+        gemmEvent = _trsm_gemm<BlockSize>(
+            sb_handle, isTranspose, false, M - i - blockSize, N, blockSize,
+            element_t{-1}, A + offsetA, lda, strideA, X + i, ldx, strideX,
+            (i == 0) ? alpha : element_t{1}, B + i + blockSize, ldb, strideB,
+            batchSize);
+        trsmEvents = concatenate_vectors(trsmEvents, gemmEvent);
+      }
+    } else {
+      // Solves the system AX = alpha*B when X is upper triangular
+      //
+      //         A            X                 B
+      //    [ A00  A01  ] * [ X0 ]  =  alpha * [ B0 ]
+      //    [  0   A11  ]   [ X1 ]             [ B1 ]
+      //
+      // yields:
+      //
+      //  X1 = alpha*A11{-1}*B1
+      //  B0 = -1 * A01*X1 + alpha*B0
+      //  X0 = A00{-1}*B0  + 0*X0
+      //
+
+      // True when (upper triangular) or (lower triangular and transposed)
+      const index_t specialBlockSize =
+          (M % blockSize == 0) ? blockSize : (M % blockSize);
+      const index_t iStart = M - specialBlockSize;
+      for (index_t i = iStart; i >= 0; i -= blockSize) {
+        const index_t currentBlockSize =
+            (i == iStart) ? specialBlockSize : blockSize;
+        auto gemmEvent = _trsm_gemm<BlockSize>(
+            sb_handle, isTranspose, false, currentBlockSize, N,
+            currentBlockSize, (i == iStart) ? alpha : element_t{1},
+            invA + i * blockSize, blockSize, strideInvA, B + i, ldb, strideB,
+            element_t{0}, X + i, ldx, strideX, batchSize);
+        trsmEvents = concatenate_vectors(trsmEvents, gemmEvent);
+
+        if ((i - blockSize) < 0) {
+          break;
+        }
+
+        gemmEvent = _trsm_gemm<BlockSize>(
+            sb_handle, isTranspose, false, i, N, currentBlockSize,
+            element_t{-1}, A + (!isTranspose ? (i * lda) : i), lda, strideA,
+            X + i, ldx, strideX, (i == iStart) ? alpha : element_t{1}, B, ldb,
+            strideB, batchSize);
+        trsmEvents = concatenate_vectors(trsmEvents, gemmEvent);
+      }
+    }
+  } else {
+    // Right side
+
+    if ((isUpper && isTranspose) || (!isUpper && !isTranspose)) {
+      // Solves the system XA = alpha*B when A is lower triangular
+
+      //         X     *      A                        B
+      //    [ X0  X1 ]   [ A00   0   ]  =  alpha * [ B0  B1 ]
+      //                 [ A10  A11  ]
+      //
+      // yields:
+      //
+      //  X1 = alpha*B1*A11{-1}
+      //  B0 = -1 * X1*A10 + alpha*B0
+      //  X0 = B0*A00{-1}  + 0*X0
+      //
+
+      // True when (lower triangular) or (upper triangular and transposed)
+      const index_t specialBlockSize =
+          (N % blockSize == 0) ? blockSize : (N % blockSize);
+      const index_t iStart = N - specialBlockSize;
+      for (index_t i = iStart; i >= 0; i -= blockSize) {
+        const index_t currentBlockSize =
+            (i == iStart) ? specialBlockSize : blockSize;
+        auto gemmEvent = _trsm_gemm<BlockSize>(
+            sb_handle, false, isTranspose, M, currentBlockSize,
+            currentBlockSize, (i == iStart) ? alpha : element_t{1}, B + i * ldb,
+            ldb, strideB, invA + i * blockSize, blockSize, strideInvA,
+            element_t{0}, X + i * ldx, ldx, strideX, batchSize);
+        trsmEvents = concatenate_vectors(trsmEvents, gemmEvent);
+
+        if ((i - blockSize) < 0) {
+          break;
+        }
+
+        gemmEvent = _trsm_gemm<BlockSize>(
+            sb_handle, false, isTranspose, M, i, currentBlockSize,
+            element_t{-1}, X + i * ldx, ldx, strideX,
+            A + (!isTranspose ? i : (i * lda)), lda, strideA,
+            (i == iStart) ? alpha : element_t{1}, B, ldb, strideB, batchSize);
+        trsmEvents = concatenate_vectors(trsmEvents, gemmEvent);
+      }
+
+    } else {
+      // Solves the system XA = alpha*B when A is upper triangular
+
+      //      X        *      A                         B
+      //    [ X0  X1 ]   [ A00  A01  ]  =  alpha * [ B0  B1 ]
+      //                 [  0   A11  ]
+      //
+      // yields:
+      //
+      //  X0 = alpha*B0*A00^{-1}
+      //  B1 = -1 * X0*A01 + alpha*B1
+      //  X1 = B1*A11{-1}  + 0*X1
+      //
+
+      // True when (upper triangular) or (lower triangular and transposed)
+      for (index_t i = 0; i < N; i += blockSize) {
+        const index_t currentBlockSize = std::min(N - i, blockSize);
+
+        auto gemmEvent = _trsm_gemm<BlockSize>(
+            sb_handle, false, isTranspose, M, currentBlockSize,
+            currentBlockSize, (i == 0) ? alpha : element_t{1}, B + i * ldb, ldb,
+            strideB, invA + i * blockSize, blockSize, strideInvA, element_t{0},
+            X + i * ldx, ldx, strideX, batchSize);
+        trsmEvents = concatenate_vectors(trsmEvents, gemmEvent);
+
+        if ((i + blockSize) > N) {
+          break;
+        }
+
+        const std::ptrdiff_t offset = !isTranspose
+                                          ? (i + (blockSize + i) * lda)
+                                          : (i + blockSize) + (i * lda);
+        gemmEvent = _trsm_gemm<BlockSize>(
+            sb_handle, false, isTranspose, M, N - i - blockSize, blockSize,
+            element_t{-1}, X + i * ldx, ldx, strideX, A + offset, lda, strideA,
+            (i == 0) ? alpha : element_t{1}, B + (i + blockSize) * ldb, ldb,
+            strideB, batchSize);
+        trsmEvents = concatenate_vectors(trsmEvents, gemmEvent);
+      }
+    }
+  }
+
+  return trsmEvents;
+}
+
 /**
  * @brief Implementation of Triangle Solve with Multiple Right Hand Sides
  * (TRSM).
@@ -144,9 +392,9 @@ typename sb_handle_t::event_t _trsm(sb_handle_t& sb_handle, char side,
   // Temporary buffer for the inverse of the diagonal blocks of the matrix A
   // filled with zeroes
   const index_t invASize = roundUp<index_t>(K, blockSize) * blockSize;
-  auto invA = make_sycl_iterator_buffer<element_t>(invASize);
+  auto invA = internal::make_scratch_buffer<element_t>(sb_handle, invASize);
   std::vector<cl::sycl::event> event = {
-      blas::helper::fill(sb_handle.get_queue(), invA, element_t{0}, invASize)};
+      internal::fill(sb_handle, invA, element_t{0}, invASize)};
   trsmEvents = concatenate_vectors(trsmEvents, event);
 
   // Create the matrix views from the input buffers
@@ -192,171 +440,177 @@ typename sb_handle_t::event_t _trsm(sb_handle_t& sb_handle, char side,
   // output X will hold the TRSM result and will be copied to B at the end
   const index_t BSize = ldb * (N - 1) + M;
   const index_t ldx = ldb;
-  auto X = make_sycl_iterator_buffer<element_t>(BSize);
+  auto X = internal::make_scratch_buffer<element_t>(sb_handle, BSize);
   trsmEvents = concatenate_vectors(
       trsmEvents, internal::_copy(sb_handle, BSize, B, 1, X, 1));
 
-  if (isLeft) {
-    if ((isUpper && isTranspose) || (!isUpper && !isTranspose)) {
-      // Solves the system AX = alpha*B, as described in the documentation of
-      // the function when X is lower triangular.
-      //
-      //         A            X                 B
-      //    [ A00   0  ] * [ X0 ]  =  alpha * [ B0 ]
-      //    [ A10  A11 ]   [ X1 ]             [ B1 ]
-      //
-      // yields:
-      //
-      //  X0 = alpha*A00{-1}*B0
-      //  B1 = -1 * A10*X0 + alpha*B1
-      //  X1 = A11{-1}*B1  + 0*X1
-      //
-
-      // True when (lower triangular) or (upper triangular and transposed)
-      for (index_t i = 0; i < M; i += blockSize) {
-        const index_t currentBlockSize = std::min(M - i, blockSize);
-        auto gemmEvent = internal::_gemm(
-            sb_handle, isTranspose ? 't' : 'n', 'n', currentBlockSize, N,
-            currentBlockSize, (i == 0) ? alpha : element_t{1},
-            invA + i * blockSize, blockSize, B + i, ldb, element_t{0}, X + i,
-            ldx);
-        trsmEvents = concatenate_vectors(trsmEvents, gemmEvent);
-
-        if ((i + blockSize) >= M) {
-          break;
-        }
+  trsmEvents = concatenate_vectors(
+      trsmEvents,
+      _trsm_blocked_solve<blockSize>(sb_handle, isLeft, isUpper, isTranspose,
+                                     M, N, alpha, A, lda, index_t{0}, B, ldb,
+                                     index_t{0}, invA, index_t{0}, X, ldx,
+                                     index_t{0}, index_t{1}));
 
-        const std::ptrdiff_t offsetA = !isTranspose
-                                           ? ((i + blockSize) + (i * lda))
-                                           : (i + (blockSize + i) * lda);
-        internal::_gemm(
-            sb_handle, isTranspose ? 't' : 'n', 'n', M - i - blockSize, N,
-            blockSize, element_t{-1}, A + offsetA, lda, X + i, ldx,
-            (i == 0) ? alpha : element_t{1}, B + i + blockSize, ldb);
-        trsmEvents = concatenate_vectors(trsmEvents, gemmEvent);
-      }
-    } else {
-      // Solves the system AX = alpha*B when X is upper triangular
-      //
-      //         A            X                 B
-      //    [ A00  A01  ] * [ X0 ]  =  alpha * [ B0 ]
-      //    [  0   A11  ]   [ X1 ]             [ B1 ]
-      //
-      // yields:
-      //
-      //  X1 = alpha*A11{-1}*B1
-      //  B0 = -1 * A01*X1 + alpha*B0
-      //  X0 = A00{-1}*B0  + 0*X0
-      //
+  // Copy bufferX to bufferB as the TRSM result
+  trsmEvents = concatenate_vectors(
+      trsmEvents, internal::_copy(sb_handle, BSize, X, 1, B, 1));
 
-      // True when (upper triangular) or (lower triangular and transposed)
-      const index_t specialBlockSize =
-          (M % blockSize == 0) ? blockSize : (M % blockSize);
-      const index_t iStart = M - specialBlockSize;
-      for (index_t i = iStart; i >= 0; i -= blockSize) {
-        const index_t currentBlockSize =
-            (i == iStart) ? specialBlockSize : blockSize;
-        auto gemmEvent = internal::_gemm(
-            sb_handle, isTranspose ? 't' : 'n', 'n', currentBlockSize, N,
-            currentBlockSize, (i == iStart) ? alpha : element_t{1},
-            invA + i * blockSize, blockSize, B + i, ldb, element_t{0}, X + i,
-            ldx);
-        trsmEvents = concatenate_vectors(trsmEvents, gemmEvent);
+  return trsmEvents;
+}
 
-        if ((i - blockSize) < 0) {
-          break;
-        }
+/**
+ * @brief Implementation of the strided batched TRSM.
+ *
+ * Solves batch_size independent systems op(A_i)*X_i = alpha*B_i or
+ * X_i*op(A_i) = alpha*B_i, where A_i starts stride_a elements after A_{i-1}
+ * and B_i starts stride_b elements after B_{i-1}. All other parameters have the
+ * same meaning as in _trsm.
+ *
+ * Systems of order up to TrsmBatchedSmall::max_size are solved in a single
+ * launch, one work group per system, keeping the triangle in local memory.
+ * Larger systems invert the diagonal blocks of every matrix in the batch with a
+ * single DiagonalBlocksInverter launch and then run the blocked GEMM solve of
+ * _trsm on all the systems together, each block step being two launches of
+ * TrsmBatchedGemm that cover the whole batch.
+ */
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename element_t, typename index_t>
+typename sb_handle_t::event_t _trsm_batched(
+    sb_handle_t& sb_handle, char side, char uplo, char trans, char diag,
+    index_t M, index_t N, element_t alpha, container_0_t A, index_t lda,
+    index_t stride_a, container_1_t B, index_t ldb, index_t stride_b,
+    index_t batch_size) {
+  // Makes sure all dimensions are larger than zero
+  if ((M == 0) || (N == 0) || (lda == 0) || (ldb == 0)) {
+    throw std::invalid_argument("invalid matrix size argument");
+  }
+  if (batch_size <= 0) {
+    throw std::invalid_argument("invalid batch size argument");
+  }
 
-        gemmEvent = internal::_gemm(
-            sb_handle, isTranspose ? 't' : 'n', 'n', i, N, currentBlockSize,
-            element_t{-1}, A + (!isTranspose ? (i * lda) : i), lda, X + i, ldx,
-            (i == iStart) ? alpha : element_t{1}, B, ldb);
-        trsmEvents = concatenate_vectors(trsmEvents, gemmEvent);
-      }
-    }
-  } else {
-    // Right side
+  side = tolower(side);
+  uplo = tolower(uplo);
+  trans = tolower(trans);
+  diag = tolower(diag);
 
-    if ((isUpper && isTranspose) || (!isUpper && !isTranspose)) {
-      // Solves the system XA = alpha*B when A is lower triangular
+  if (side != 'l' && side != 'r') {
+    throw std::invalid_argument("invalid Side argument");
+  } else if (uplo != 'u' && uplo != 'l') {
+    throw std::invalid_argument("invalid Triangle argument");
+  } else if (trans != 'n' && trans != 't') {
+    throw std::invalid_argument("invalid Transpose argument");
+  } else if (diag != 'u' && diag != 'n') {
+    throw std::invalid_argument("invalid Diagonal argument");
+  }
 
-      //         X     *      A                        B
-      //    [ X0  X1 ]   [ A00   0   ]  =  alpha * [ B0  B1 ]
-      //                 [ A10  A11  ]
-      //
-      // yields:
-      //
-      //  X1 = alpha*B1*A11{-1}
-      //  B0 = -1 * X1*A10 + alpha*B0
-      //  X0 = B0*A00{-1}  + 0*X0
-      //
+  const index_t K = (side == 'l') ? M : N;
 
-      // True when (lower triangular) or (upper triangular and transposed)
-      const index_t specialBlockSize =
-          (N % blockSize == 0) ? blockSize : (N % blockSize);
-      const index_t iStart = N - specialBlockSize;
-      for (index_t i = iStart; i >= 0; i -= blockSize) {
-        const index_t currentBlockSize =
-            (i == iStart) ? specialBlockSize : blockSize;
-        auto gemmEvent = internal::_gemm(
-            sb_handle, 'n', isTranspose ? 't' : 'n', M, currentBlockSize,
-            currentBlockSize, (i == iStart) ? alpha : element_t{1}, B + i * ldb,
-            ldb, invA + i * blockSize, blockSize, element_t{0}, X + i * ldx,
-            ldx);
-        trsmEvents = concatenate_vectors(trsmEvents, gemmEvent);
+  const bool isUnitDiag = diag == 'u';
+  const bool isUpper = uplo == 'u';
+  const bool isLeft = side == 'l';
+  const bool isTranspose = trans == 't';
 
-        if ((i - blockSize) < 0) {
-          break;
-        }
+  if (batch_size > 1 &&
+      (stride_a < lda * (K - 1) + K || stride_b < ldb * (N - 1) + M)) {
+    throw std::invalid_argument("invalid stride argument");
+  }
 
-        gemmEvent = internal::_gemm(
-            sb_handle, 'n', isTranspose ? 't' : 'n', M, i, currentBlockSize,
-            element_t{-1}, X + i * ldx, ldx, A + (!isTranspose ? i : (i * lda)),
-            lda, (i == iStart) ? alpha : element_t{1}, B, ldb);
-        trsmEvents = concatenate_vectors(trsmEvents, gemmEvent);
-      }
+  auto bufferA = make_matrix_view<col_major>(A, K, K, lda);
+  auto bufferB = make_matrix_view<col_major>(B, M, N, ldb);
 
+  // Small systems: one work group solves a whole system in local memory
+  constexpr index_t smallSize = 32;
+  if (K <= smallSize) {
+    // X*op(A) = alpha*B is solved as op(A)^T*X^T = alpha*B^T, so the matrix
+    // read by the kernel is transposed once more on the right side
+    const bool transA = isTranspose != !isLeft;
+    const bool isLower = isUpper == transA;
+    const index_t localSize = smallSize;
+    const index_t globalSize = batch_size * localSize;
+    const index_t localMemSize = smallSize * smallSize;
+    if (isUnitDiag && isLower) {
+      auto trsmTree = make_trsm_batched_small<true, true, smallSize>(
+          bufferA, bufferB, alpha, isLeft, transA, M, N, stride_a, stride_b,
+          batch_size);
+      return sb_handle.execute(trsmTree, localSize, globalSize, localMemSize);
+    } else if (!isUnitDiag && isLower) {
+      auto trsmTree = make_trsm_batched_small<false, true, smallSize>(
+          bufferA, bufferB, alpha, isLeft, transA, M, N, stride_a, stride_b,
+          batch_size);
+      return sb_handle.execute(trsmTree, localSize, globalSize, localMemSize);
+    } else if (isUnitDiag && !isLower) {
+      auto trsmTree = make_trsm_batched_small<true, false, smallSize>(
+          bufferA, bufferB, alpha, isLeft, transA, M, N, stride_a, stride_b,
+          batch_size);
+      return sb_handle.execute(trsmTree, localSize, globalSize, localMemSize);
     } else {
-      // Solves the system XA = alpha*B when A is upper triangular
+      auto trsmTree = make_trsm_batched_small<false, false, smallSize>(
+          bufferA, bufferB, alpha, isLeft, transA, M, N, stride_a, stride_b,
+          batch_size);
+      return sb_handle.execute(trsmTree, localSize, globalSize, localMemSize);
+    }
+  }
 
-      //      X        *      A                         B
-      //    [ X0  X1 ]   [ A00  A01  ]  =  alpha * [ B0  B1 ]
-      //                 [  0   A11  ]
-      //
-      // yields:
-      //
-      //  X0 = alpha*B0*A00^{-1}
-      //  B1 = -1 * X0*A01 + alpha*B1
-      //  X1 = B1*A11{-1}  + 0*X1
-      //
+  constexpr index_t blockSize = 16;
 
-      // True when (upper triangular) or (lower triangular and transposed)
-      for (index_t i = 0; i < N; i += blockSize) {
-        const index_t currentBlockSize = std::min(N - i, blockSize);
+  typename sb_handle_t::event_t trsmEvents;
 
-        auto gemmEvent = internal::_gemm(
-            sb_handle, 'n', isTranspose ? 't' : 'n', M, currentBlockSize,
-            currentBlockSize, (i == 0) ? alpha : element_t{1}, B + i * ldb, ldb,
-            invA + i * blockSize, blockSize, element_t{0}, X + i * ldx, ldx);
-        trsmEvents = concatenate_vectors(trsmEvents, gemmEvent);
+  // Temporary buffer for the inverse of the diagonal blocks of every matrix A
+  // in the batch, filled with zeroes
+  const index_t invAStride = roundUp<index_t>(K, blockSize) * blockSize;
+  const index_t invASize = invAStride * batch_size;
+  auto invA = internal::make_scratch_buffer<element_t>(sb_handle, invASize);
+  std::vector<cl::sycl::event> event = {
+      internal::fill(sb_handle, invA, element_t{0}, invASize)};
+  trsmEvents = concatenate_vectors(trsmEvents, event);
 
-        if ((i + blockSize) > N) {
-          break;
-        }
+  auto bufferInvA =
+      make_matrix_view<col_major>(invA, blockSize, blockSize, lda);
 
-        const std::ptrdiff_t offset = !isTranspose
-                                          ? (i + (blockSize + i) * lda)
-                                          : (i + blockSize) + (i * lda);
-        gemmEvent = internal::_gemm(
-            sb_handle, 'n', isTranspose ? 't' : 'n', M, N - i - blockSize,
-            blockSize, element_t{-1}, X + i * ldx, ldx, A + offset, lda,
-            (i == 0) ? alpha : element_t{1}, B + (i + blockSize) * ldb, ldb);
-        trsmEvents = concatenate_vectors(trsmEvents, gemmEvent);
-      }
-    }
+  // The diagonal blocks of all the matrices are inverted in a single launch
+  const index_t numBlocks = roundUp<index_t>(K, blockSize) / blockSize;
+  const index_t globalSize = batch_size * numBlocks * blockSize;
+  const index_t localSize = blockSize;
+  const index_t localMemSize = blockSize * blockSize;
+
+  typename sb_handle_t::event_t invertBlocksEvent;
+  if (isUnitDiag && isUpper) {
+    auto diagInverter = make_diag_blocks_inverter<true, true, blockSize>(
+        bufferA, bufferInvA, batch_size, stride_a, invAStride);
+    invertBlocksEvent =
+        sb_handle.execute(diagInverter, localSize, globalSize, localMemSize);
+  } else if (!isUnitDiag && isUpper) {
+    auto diagInverter = make_diag_blocks_inverter<false, true, blockSize>(
+        bufferA, bufferInvA, batch_size, stride_a, invAStride);
+    invertBlocksEvent =
+        sb_handle.execute(diagInverter, localSize, globalSize, localMemSize);
+  } else if (isUnitDiag && !isUpper) {
+    auto diagInverter = make_diag_blocks_inverter<true, false, blockSize>(
+        bufferA, bufferInvA, batch_size, stride_a, invAStride);
+    invertBlocksEvent =
+        sb_handle.execute(diagInverter, localSize, globalSize, localMemSize);
+  } else if (!isUnitDiag && !isUpper) {
+    auto diagInverter = make_diag_blocks_inverter<false, false, blockSize>(
+        bufferA, bufferInvA, batch_size, stride_a, invAStride);
+    invertBlocksEvent =
+        sb_handle.execute(diagInverter, localSize, globalSize, localMemSize);
   }
+  trsmEvents = concatenate_vectors(trsmEvents, invertBlocksEvent);
+
+  // A single copy of the whole strided B is used as the output X
+  const index_t BSize = stride_b * (batch_size - 1) + ldb * (N - 1) + M;
+  const index_t ldx = ldb;
+  auto X = internal::make_scratch_buffer<element_t>(sb_handle, BSize);
+  trsmEvents = concatenate_vectors(
+      trsmEvents, internal::_copy(sb_handle, BSize, B, 1, X, 1));
+
+  trsmEvents = concatenate_vectors(
+      trsmEvents,
+      _trsm_blocked_solve<blockSize>(sb_handle, isLeft, isUpper, isTranspose,
+                                     M, N, alpha, A, lda, stride_a, B, ldb,
+                                     stride_b, invA, invAStride, X, ldx,
+                                     stride_b, batch_size));
 
-  // Copy bufferX to bufferB as the TRSM result
   trsmEvents = concatenate_vectors(
       trsmEvents, internal::_copy(sb_handle, BSize, X, 1, B, 1));
 
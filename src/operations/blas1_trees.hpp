@@ -28,7 +28,9 @@
 
 #include "operations/blas1_trees.h"
 #include "operations/blas_operators.hpp"
+#include "operations/subgroup_reduction.hpp"
 #include "views/view_sycl.hpp"
+#include <algorithm>
 #include <stdexcept>
 #include <vector>
 
@@ -112,6 +114,15 @@ auto get_scalar(element_t &scalar_)
     -> decltype(DetectScalar<element_t>::get_scalar(scalar_)) {
   return DetectScalar<element_t>::get_scalar(scalar_);
 }
+
+/*! packet_element.
+ * @brief Reference to the k-th element of a packet.
+ */
+template <typename value_t, int vector_size>
+SYCL_BLAS_INLINE value_t &packet_element(
+    cl::sycl::vec<value_t, vector_size> &packet, int k) {
+  return reinterpret_cast<value_t *>(&packet)[k];
+}
 }  // namespace internal
 
 /** Join.
@@ -188,6 +199,23 @@ Assign<lhs_t, rhs_t>::eval(cl::sycl::nd_item<1> ndItem) {
   return Assign<lhs_t, rhs_t>::eval(ndItem.get_global_id(0));
 }
 
+template <typename lhs_t, typename rhs_t>
+template <int vector_size>
+SYCL_BLAS_INLINE bool Assign<lhs_t, rhs_t>::is_packet_aligned() const {
+  return lhs_.template is_packet_aligned<vector_size>() &&
+         rhs_.template is_packet_aligned<vector_size>();
+}
+
+template <typename lhs_t, typename rhs_t>
+template <int vector_size>
+SYCL_BLAS_INLINE cl::sycl::vec<typename Assign<lhs_t, rhs_t>::value_t,
+                               vector_size>
+Assign<lhs_t, rhs_t>::eval_packet(typename Assign<lhs_t, rhs_t>::index_t i) {
+  auto packet = rhs_.template eval_packet<vector_size>(i);
+  lhs_.template store_packet<vector_size>(i, packet);
+  return packet;
+}
+
 template <typename lhs_t, typename rhs_t>
 SYCL_BLAS_INLINE void Assign<lhs_t, rhs_t>::bind(cl::sycl::handler &h) {
   lhs_.bind(h);
@@ -245,6 +273,32 @@ SYCL_BLAS_INLINE
   return DoubleAssign<lhs_1_t, lhs_2_t, rhs_1_t, rhs_2_t>::eval(
       ndItem.get_global_id(0));
 }
+
+template <typename lhs_1_t, typename lhs_2_t, typename rhs_1_t,
+          typename rhs_2_t>
+template <int vector_size>
+SYCL_BLAS_INLINE bool
+DoubleAssign<lhs_1_t, lhs_2_t, rhs_1_t, rhs_2_t>::is_packet_aligned() const {
+  return lhs_1_.template is_packet_aligned<vector_size>() &&
+         lhs_2_.template is_packet_aligned<vector_size>() &&
+         rhs_1_.template is_packet_aligned<vector_size>() &&
+         rhs_2_.template is_packet_aligned<vector_size>();
+}
+
+template <typename lhs_1_t, typename lhs_2_t, typename rhs_1_t,
+          typename rhs_2_t>
+template <int vector_size>
+SYCL_BLAS_INLINE cl::sycl::vec<
+    typename DoubleAssign<lhs_1_t, lhs_2_t, rhs_1_t, rhs_2_t>::value_t,
+    vector_size>
+DoubleAssign<lhs_1_t, lhs_2_t, rhs_1_t, rhs_2_t>::eval_packet(
+    typename DoubleAssign<lhs_1_t, lhs_2_t, rhs_1_t, rhs_2_t>::index_t i) {
+  auto packet1 = rhs_1_.template eval_packet<vector_size>(i);
+  auto packet2 = rhs_2_.template eval_packet<vector_size>(i);
+  lhs_1_.template store_packet<vector_size>(i, packet1);
+  lhs_2_.template store_packet<vector_size>(i, packet2);
+  return packet1;
+}
 template <typename lhs_1_t, typename lhs_2_t, typename rhs_1_t,
           typename rhs_2_t>
 SYCL_BLAS_INLINE void DoubleAssign<lhs_1_t, lhs_2_t, rhs_1_t, rhs_2_t>::bind(
@@ -296,6 +350,28 @@ ScalarOp<operator_t, scalar_t, rhs_t>::eval(cl::sycl::nd_item<1> ndItem) {
   return ScalarOp<operator_t, scalar_t, rhs_t>::eval(ndItem.get_global_id(0));
 }
 template <typename operator_t, typename scalar_t, typename rhs_t>
+template <int vector_size>
+SYCL_BLAS_INLINE bool ScalarOp<operator_t, scalar_t, rhs_t>::is_packet_aligned()
+    const {
+  return rhs_.template is_packet_aligned<vector_size>();
+}
+template <typename operator_t, typename scalar_t, typename rhs_t>
+template <int vector_size>
+SYCL_BLAS_INLINE cl::sycl::vec<
+    typename ScalarOp<operator_t, scalar_t, rhs_t>::value_t, vector_size>
+ScalarOp<operator_t, scalar_t, rhs_t>::eval_packet(
+    typename ScalarOp<operator_t, scalar_t, rhs_t>::index_t i) {
+  auto in = rhs_.template eval_packet<vector_size>(i);
+  cl::sycl::vec<value_t, vector_size> out;
+  const auto scalar = internal::get_scalar(scalar_);
+#pragma unroll
+  for (int k = 0; k < vector_size; ++k) {
+    internal::packet_element(out, k) =
+        operator_t::eval(scalar, internal::packet_element(in, k));
+  }
+  return out;
+}
+template <typename operator_t, typename scalar_t, typename rhs_t>
 SYCL_BLAS_INLINE void ScalarOp<operator_t, scalar_t, rhs_t>::bind(
     cl::sycl::handler &h) {
   rhs_.bind(h);
@@ -337,6 +413,26 @@ UnaryOp<operator_t, rhs_t>::eval(cl::sycl::nd_item<1> ndItem) {
   return UnaryOp<operator_t, rhs_t>::eval(ndItem.get_global_id(0));
 }
 template <typename operator_t, typename rhs_t>
+template <int vector_size>
+SYCL_BLAS_INLINE bool UnaryOp<operator_t, rhs_t>::is_packet_aligned() const {
+  return rhs_.template is_packet_aligned<vector_size>();
+}
+template <typename operator_t, typename rhs_t>
+template <int vector_size>
+SYCL_BLAS_INLINE
+    cl::sycl::vec<typename UnaryOp<operator_t, rhs_t>::value_t, vector_size>
+    UnaryOp<operator_t, rhs_t>::eval_packet(
+        typename UnaryOp<operator_t, rhs_t>::index_t i) {
+  auto in = rhs_.template eval_packet<vector_size>(i);
+  cl::sycl::vec<value_t, vector_size> out;
+#pragma unroll
+  for (int k = 0; k < vector_size; ++k) {
+    internal::packet_element(out, k) =
+        operator_t::eval(internal::packet_element(in, k));
+  }
+  return out;
+}
+template <typename operator_t, typename rhs_t>
 SYCL_BLAS_INLINE void UnaryOp<operator_t, rhs_t>::bind(cl::sycl::handler &h) {
   rhs_.bind(h);
 }
@@ -375,6 +471,29 @@ BinaryOp<operator_t, lhs_t, rhs_t>::eval(cl::sycl::nd_item<1> ndItem) {
   return BinaryOp<operator_t, lhs_t, rhs_t>::eval(ndItem.get_global_id(0));
 }
 template <typename operator_t, typename lhs_t, typename rhs_t>
+template <int vector_size>
+SYCL_BLAS_INLINE bool BinaryOp<operator_t, lhs_t, rhs_t>::is_packet_aligned()
+    const {
+  return lhs_.template is_packet_aligned<vector_size>() &&
+         rhs_.template is_packet_aligned<vector_size>();
+}
+template <typename operator_t, typename lhs_t, typename rhs_t>
+template <int vector_size>
+SYCL_BLAS_INLINE cl::sycl::vec<
+    typename BinaryOp<operator_t, lhs_t, rhs_t>::value_t, vector_size>
+BinaryOp<operator_t, lhs_t, rhs_t>::eval_packet(
+    typename BinaryOp<operator_t, lhs_t, rhs_t>::index_t i) {
+  auto l = lhs_.template eval_packet<vector_size>(i);
+  auto r = rhs_.template eval_packet<vector_size>(i);
+  cl::sycl::vec<value_t, vector_size> out;
+#pragma unroll
+  for (int k = 0; k < vector_size; ++k) {
+    internal::packet_element(out, k) = operator_t::eval(
+        internal::packet_element(l, k), internal::packet_element(r, k));
+  }
+  return out;
+}
+template <typename operator_t, typename lhs_t, typename rhs_t>
 SYCL_BLAS_INLINE void BinaryOp<operator_t, lhs_t, rhs_t>::bind(
     cl::sycl::handler &h) {
   lhs_.bind(h);
@@ -388,6 +507,96 @@ BinaryOp<operator_t, lhs_t, rhs_t>::adjust_access_displacement() {
   rhs_.adjust_access_displacement();
 }
 
+/*! Vectorized.
+ * @brief See Vectorized.
+ */
+template <int vector_size, typename tree_t>
+Vectorized<vector_size, tree_t>::Vectorized(tree_t &_tree) : tree_(_tree) {}
+
+template <int vector_size, typename tree_t>
+SYCL_BLAS_INLINE typename Vectorized<vector_size, tree_t>::index_t
+Vectorized<vector_size, tree_t>::get_size() const {
+  return tree_.get_size();
+}
+
+template <int vector_size, typename tree_t>
+SYCL_BLAS_INLINE bool Vectorized<vector_size, tree_t>::valid_thread(
+    cl::sycl::nd_item<1>) const {
+  // The grid-stride loop of ::eval checks the bounds
+  return true;
+}
+
+template <int vector_size, typename tree_t>
+SYCL_BLAS_INLINE typename Vectorized<vector_size, tree_t>::value_t
+Vectorized<vector_size, tree_t>::eval(
+    typename Vectorized<vector_size, tree_t>::index_t i) {
+  return tree_.eval(i);
+}
+
+/*!
+ * @brief Evaluates the packets of the tree from the packet first, when the
+ * views allow it.
+ * @return Index of the first element left to the scalar loop.
+ */
+template <int vector_size, typename tree_t>
+SYCL_BLAS_INLINE typename Vectorized<vector_size, tree_t>::index_t
+Vectorized<vector_size, tree_t>::eval_packets(index_t first, index_t stride,
+                                              std::true_type) {
+  if (!tree_.template is_packet_aligned<vector_size>()) {
+    return index_t(0);
+  }
+  const index_t num_packets = get_size() / vector_size;
+  for (index_t p = first; p < num_packets; p += stride) {
+    tree_.template eval_packet<vector_size>(p * vector_size);
+  }
+  return num_packets * vector_size;
+}
+
+template <int vector_size, typename tree_t>
+SYCL_BLAS_INLINE typename Vectorized<vector_size, tree_t>::index_t
+Vectorized<vector_size, tree_t>::eval_packets(index_t, index_t,
+                                              std::false_type) {
+  return index_t(0);
+}
+
+template <int vector_size, typename tree_t>
+SYCL_BLAS_INLINE void Vectorized<vector_size, tree_t>::eval(
+    cl::sycl::nd_item<1> ndItem) {
+  const index_t first = ndItem.get_global_id(0);
+  const index_t stride = ndItem.get_global_range(0);
+  const index_t size = get_size();
+  const index_t tail = eval_packets(
+      first, stride, std::integral_constant<bool, (vector_size > 1)>{});
+  for (index_t i = tail + first; i < size; i += stride) {
+    tree_.eval(i);
+  }
+}
+
+template <int vector_size, typename tree_t>
+SYCL_BLAS_INLINE cl::sycl::nd_range<1>
+Vectorized<vector_size, tree_t>::get_nd_range(index_t local_size,
+                                              index_t compute_units) const {
+  const index_t num_packets = (get_size() + vector_size - 1) / vector_size;
+  const index_t needed = (num_packets + local_size - 1) / local_size;
+  const index_t num_groups =
+      std::max(index_t(1),
+               std::min(needed, compute_units * work_groups_per_compute_unit));
+  return cl::sycl::nd_range<1>{cl::sycl::range<1>(num_groups * local_size),
+                               cl::sycl::range<1>(local_size)};
+}
+
+template <int vector_size, typename tree_t>
+SYCL_BLAS_INLINE void Vectorized<vector_size, tree_t>::bind(
+    cl::sycl::handler &h) {
+  tree_.bind(h);
+}
+
+template <int vector_size, typename tree_t>
+SYCL_BLAS_INLINE void
+Vectorized<vector_size, tree_t>::adjust_access_displacement() {
+  tree_.adjust_access_displacement();
+}
+
 /*! TupleOp.
  * @brief Implements a Tuple Operation (map (\x -> [i, x]) vector).
  */
@@ -505,6 +714,16 @@ AssignReduction<operator_t, lhs_t, rhs_t>::eval(sharedT scratch,
     }
   }
 
+  if (is_subgroup_memory<sharedT>::value &&
+      subgroup_reducible<value_t>::value) {
+    // Reduction inside the block, one value per sub-group in local memory
+    val = reduce_work_group<operator_t>(scratch, ndItem, val, init_val);
+    if (localid == 0) {
+      lhs_.eval(groupid) = val;
+    }
+    return val;
+  }
+
   scratch[localid] = val;
   // This barrier is mandatory to be sure the data is on the shared memory
   ndItem.barrier(cl::sycl::access::fence_space::local_space);
@@ -538,57 +757,58 @@ AssignReduction<operator_t, lhs_t, rhs_t>::adjust_access_displacement() {
   rhs_.adjust_access_displacement();
 }
 
-template <typename operand_t>
-Rotg<operand_t>::Rotg(operand_t &_a, operand_t &_b, operand_t &_c,
-                      operand_t &_s)
-    : a_{_a}, b_{_b}, c_{_c}, s_{_s} {}
-
-template <typename operand_t>
-SYCL_BLAS_INLINE typename Rotg<operand_t>::index_t Rotg<operand_t>::get_size()
-    const {
-  return static_cast<Rotg<operand_t>::index_t>(1);
-}
-
-template <typename operand_t>
-SYCL_BLAS_INLINE typename Rotg<operand_t>::value_t Rotg<operand_t>::eval(
-    typename Rotg<operand_t>::index_t i) {
+template <typename value_t>
+SYCL_BLAS_INLINE void compute_rotg(value_t &a, value_t &b, value_t &c,
+                                   value_t &s) {
   using zero = constant<value_t, const_val::zero>;
   using one = constant<value_t, const_val::one>;
 
-  value_t &a_ref = a_.eval(i);
-  value_t &b_ref = b_.eval(i);
-  value_t &c_ref = c_.eval(i);
-  value_t &s_ref = s_.eval(i);
-
-  const value_t abs_a = AbsoluteValue::eval(a_ref);
-  const value_t abs_b = AbsoluteValue::eval(b_ref);
+  const value_t abs_a = AbsoluteValue::eval(a);
+  const value_t abs_b = AbsoluteValue::eval(b);
   const value_t sigma =
-      abs_a > abs_b ? SignOperator::eval(a_ref) : SignOperator::eval(b_ref);
+      abs_a > abs_b ? SignOperator::eval(a) : SignOperator::eval(b);
   const value_t r =
-      ProductOperator::eval(sigma, HypotenuseOperator::eval(a_ref, b_ref));
+      ProductOperator::eval(sigma, HypotenuseOperator::eval(a, b));
 
   if (r == zero::value()) {
-    c_ref = one::value();
-    s_ref = zero::value();
+    c = one::value();
+    s = zero::value();
   } else {
-    c_ref = DivisionOperator::eval(a_ref, r);
-    s_ref = DivisionOperator::eval(b_ref, r);
+    c = DivisionOperator::eval(a, r);
+    s = DivisionOperator::eval(b, r);
   }
-  a_ref = r;
+  a = r;
 
   /* Calculate z and assign it to parameter b */
   if (abs_a >= abs_b) {
     /* Documentation says that the comparison should be ">" but reference
      * implementation seems to be using ">=" */
-    b_ref = s_ref;
-  } else if (c_ref != zero::value()) {
-    b_ref = DivisionOperator::eval(one::value(), c_ref);
+    b = s;
+  } else if (c != zero::value()) {
+    b = DivisionOperator::eval(one::value(), c);
   } else {
-    b_ref = one::value();
+    b = one::value();
   }
+}
+
+template <typename operand_t>
+Rotg<operand_t>::Rotg(operand_t &_a, operand_t &_b, operand_t &_c,
+                      operand_t &_s)
+    : a_{_a}, b_{_b}, c_{_c}, s_{_s} {}
+
+template <typename operand_t>
+SYCL_BLAS_INLINE typename Rotg<operand_t>::index_t Rotg<operand_t>::get_size()
+    const {
+  return a_.get_size();
+}
+
+template <typename operand_t>
+SYCL_BLAS_INLINE typename Rotg<operand_t>::value_t Rotg<operand_t>::eval(
+    typename Rotg<operand_t>::index_t i) {
+  compute_rotg(a_.eval(i), b_.eval(i), c_.eval(i), s_.eval(i));
 
   // The return value of rotg is void but eval expects something to be returned.
-  return zero::value();
+  return constant<value_t, const_val::zero>::value();
 }
 
 template <typename operand_t>
@@ -619,17 +839,6 @@ SYCL_BLAS_INLINE void Rotg<operand_t>::adjust_access_displacement() {
   s_.adjust_access_displacement();
 }
 
-template <typename operand_t>
-Rotmg<operand_t>::Rotmg(operand_t &_d1, operand_t &_d2, operand_t &_x1,
-                        operand_t &_y1, operand_t &_param)
-    : d1_{_d1}, d2_{_d2}, x1_{_x1}, y1_{_y1}, param_{_param} {}
-
-template <typename operand_t>
-SYCL_BLAS_INLINE typename Rotmg<operand_t>::index_t Rotmg<operand_t>::get_size()
-    const {
-  return static_cast<Rotmg<operand_t>::index_t>(1);
-}
-
 /**
  * For further details about the rotmg algorithm refer to:
  *
@@ -642,9 +851,12 @@ SYCL_BLAS_INLINE typename Rotmg<operand_t>::index_t Rotmg<operand_t>::get_size()
  * algebra subprograms for Fortran usage. ACM Trans. Math. Softw., 5:308-323,
  * 1979.
  */
-template <typename operand_t>
-SYCL_BLAS_INLINE typename Rotmg<operand_t>::value_t Rotmg<operand_t>::eval(
-    typename Rotmg<operand_t>::index_t i) {
+template <typename value_t>
+SYCL_BLAS_INLINE void compute_rotmg(value_t &d1_ref, value_t &d2_ref,
+                                    value_t &x1_ref, const value_t y1,
+                                    value_t &flag_ref, value_t &h11_ref,
+                                    value_t &h21_ref, value_t &h12_ref,
+                                    value_t &h22_ref) {
   using zero = constant<value_t, const_val::zero>;
   using one = constant<value_t, const_val::one>;
   using two = constant<value_t, const_val::two>;
@@ -668,19 +880,9 @@ SYCL_BLAS_INLINE typename Rotmg<operand_t>::value_t Rotmg<operand_t>::eval(
   /* Inverse of the square of gamma (i.e. 1 / (gamma * gamma)) */
   constexpr value_t inv_gamma_sq = static_cast<value_t>(1.0) / gamma_sq;
 
-  value_t &d1_ref = d1_.eval(i);
-  value_t &d2_ref = d2_.eval(i);
-  value_t &x1_ref = x1_.eval(i);
-  value_t &flag_ref = param_.eval(static_cast<index_t>(0));
-  value_t &h11_ref = param_.eval(static_cast<index_t>(1));
-  value_t &h21_ref = param_.eval(static_cast<index_t>(2));
-  value_t &h12_ref = param_.eval(static_cast<index_t>(3));
-  value_t &h22_ref = param_.eval(static_cast<index_t>(4));
-
   value_t d1 = d1_ref;
   value_t d2 = d2_ref;
   value_t x1 = x1_ref;
-  const value_t y1 = y1_.eval(i);
 
   value_t flag;
   value_t h11;
@@ -851,10 +1053,37 @@ SYCL_BLAS_INLINE typename Rotmg<operand_t>::value_t Rotmg<operand_t>::eval(
     }
   }
   flag_ref = flag;
+}
+
+template <typename operand_t>
+Rotmg<operand_t>::Rotmg(operand_t &_d1, operand_t &_d2, operand_t &_x1,
+                        operand_t &_y1, operand_t &_param,
+                        typename Rotmg<operand_t>::index_t _param_stride)
+    : d1_{_d1},
+      d2_{_d2},
+      x1_{_x1},
+      y1_{_y1},
+      param_{_param},
+      param_stride_{_param_stride} {}
+
+template <typename operand_t>
+SYCL_BLAS_INLINE typename Rotmg<operand_t>::index_t Rotmg<operand_t>::get_size()
+    const {
+  return d1_.get_size();
+}
+
+template <typename operand_t>
+SYCL_BLAS_INLINE typename Rotmg<operand_t>::value_t Rotmg<operand_t>::eval(
+    typename Rotmg<operand_t>::index_t i) {
+  const index_t param = i * param_stride_;
+  compute_rotmg(d1_.eval(i), d2_.eval(i), x1_.eval(i), y1_.eval(i),
+                param_.eval(param), param_.eval(param + 1),
+                param_.eval(param + 2), param_.eval(param + 3),
+                param_.eval(param + 4));
 
   // The return value of rotmg is void but eval expects something to be
   // returned.
-  return zero::value();
+  return constant<value_t, const_val::zero>::value();
 }
 
 template <typename operand_t>
@@ -887,6 +1116,277 @@ SYCL_BLAS_INLINE void Rotmg<operand_t>::adjust_access_displacement() {
   param_.adjust_access_displacement();
 }
 
+template <bool Left, typename matrix_t, typename vector_t,
+          typename index_vector_t>
+RotBatched<Left, matrix_t, vector_t, index_vector_t>::RotBatched(
+    matrix_t &_matrix, vector_t &_cos, vector_t &_sin, index_vector_t &_pairs)
+    : matrix_{_matrix}, cos_{_cos}, sin_{_sin}, pairs_{_pairs} {}
+
+/*!
+ * @brief Element pos of the row (Left) or column (!Left) line of matrix_.
+ */
+template <bool Left, typename matrix_t, typename vector_t,
+          typename index_vector_t>
+SYCL_BLAS_INLINE
+    typename RotBatched<Left, matrix_t, vector_t, index_vector_t>::value_t &
+    RotBatched<Left, matrix_t, vector_t, index_vector_t>::get_element(
+        index_t line, index_t pos) {
+  return Left ? matrix_.eval(line, pos) : matrix_.eval(pos, line);
+}
+
+template <bool Left, typename matrix_t, typename vector_t,
+          typename index_vector_t>
+SYCL_BLAS_INLINE
+    typename RotBatched<Left, matrix_t, vector_t, index_vector_t>::index_t
+    RotBatched<Left, matrix_t, vector_t, index_vector_t>::get_line_size()
+        const {
+  return Left ? matrix_.get_size_col() : matrix_.get_size_row();
+}
+
+template <bool Left, typename matrix_t, typename vector_t,
+          typename index_vector_t>
+SYCL_BLAS_INLINE
+    typename RotBatched<Left, matrix_t, vector_t, index_vector_t>::index_t
+    RotBatched<Left, matrix_t, vector_t, index_vector_t>::get_size() const {
+  return cos_.get_size() * get_line_size();
+}
+
+template <bool Left, typename matrix_t, typename vector_t,
+          typename index_vector_t>
+SYCL_BLAS_INLINE
+    typename RotBatched<Left, matrix_t, vector_t, index_vector_t>::value_t
+    RotBatched<Left, matrix_t, vector_t, index_vector_t>::eval(index_t i) {
+  // Consecutive work items update consecutive elements of the same pair
+  const index_t line_size = get_line_size();
+  const index_t k = i / line_size;
+  const index_t pos = i - k * line_size;
+
+  value_t &x = get_element(static_cast<index_t>(pairs_.eval(2 * k)), pos);
+  value_t &y = get_element(static_cast<index_t>(pairs_.eval(2 * k + 1)), pos);
+  const value_t c = cos_.eval(k);
+  const value_t s = sin_.eval(k);
+  const value_t x_val = x;
+  x = c * x_val + s * y;
+  y = c * y - s * x_val;
+  return x;
+}
+
+template <bool Left, typename matrix_t, typename vector_t,
+          typename index_vector_t>
+SYCL_BLAS_INLINE
+    typename RotBatched<Left, matrix_t, vector_t, index_vector_t>::value_t
+    RotBatched<Left, matrix_t, vector_t, index_vector_t>::eval(
+        cl::sycl::nd_item<1> ndItem) {
+  return eval(ndItem.get_global_id(0));
+}
+
+template <bool Left, typename matrix_t, typename vector_t,
+          typename index_vector_t>
+SYCL_BLAS_INLINE bool
+RotBatched<Left, matrix_t, vector_t, index_vector_t>::valid_thread(
+    cl::sycl::nd_item<1> ndItem) const {
+  return ndItem.get_global_id(0) < get_size();
+}
+
+template <bool Left, typename matrix_t, typename vector_t,
+          typename index_vector_t>
+SYCL_BLAS_INLINE void RotBatched<Left, matrix_t, vector_t,
+                                 index_vector_t>::bind(cl::sycl::handler &h) {
+  matrix_.bind(h);
+  cos_.bind(h);
+  sin_.bind(h);
+  pairs_.bind(h);
+}
+
+template <bool Left, typename matrix_t, typename vector_t,
+          typename index_vector_t>
+SYCL_BLAS_INLINE void RotBatched<Left, matrix_t, vector_t,
+                                 index_vector_t>::adjust_access_displacement() {
+  matrix_.adjust_access_displacement();
+  cos_.adjust_access_displacement();
+  sin_.adjust_access_displacement();
+  pairs_.adjust_access_displacement();
+}
+
+template <bool Left, uint32_t local_range, typename matrix_t,
+          typename vector_t>
+Lasr<Left, local_range, matrix_t, vector_t>::Lasr(matrix_t &_matrix,
+                                                  vector_t &_cos,
+                                                  vector_t &_sin, char _pivot,
+                                                  bool _forward)
+    : matrix_{_matrix},
+      cos_{_cos},
+      sin_{_sin},
+      pivot_{_pivot},
+      forward_{_forward} {}
+
+/*!
+ * @brief Element pos of the column (Left) or row (!Left) line of matrix_.
+ */
+template <bool Left, uint32_t local_range, typename matrix_t,
+          typename vector_t>
+SYCL_BLAS_INLINE typename Lasr<Left, local_range, matrix_t, vector_t>::value_t
+    &Lasr<Left, local_range, matrix_t, vector_t>::get_element(index_t line,
+                                                              index_t pos) {
+  return Left ? matrix_.eval(pos, line) : matrix_.eval(line, pos);
+}
+
+template <bool Left, uint32_t local_range, typename matrix_t,
+          typename vector_t>
+SYCL_BLAS_INLINE typename Lasr<Left, local_range, matrix_t, vector_t>::index_t
+Lasr<Left, local_range, matrix_t, vector_t>::get_size() const {
+  return Left ? matrix_.get_size_col() : matrix_.get_size_row();
+}
+
+template <bool Left, uint32_t local_range, typename matrix_t,
+          typename vector_t>
+SYCL_BLAS_INLINE bool Lasr<Left, local_range, matrix_t, vector_t>::valid_thread(
+    cl::sycl::nd_item<1> ndItem) const {
+  // Valid threads are established by ::eval, all of them take part in the
+  // barriers.
+  return true;
+}
+
+/*!
+ * @brief Rotation j acts on the elements x and y of a line as rot does. One
+ * of them is carried in a register from a rotation to the next: x for the
+ * forward variable and the top pivots, y otherwise. The other one is the
+ * element streamed through local memory, at position j + 1 if the carried
+ * element is x and j otherwise.
+ *
+ * With the top and bottom pivots the carried element stays at the pivot and
+ * the streamed one is final once rotated. With the variable pivot the streamed
+ * element becomes the carried one and the previous carried element is final,
+ * so the last streamed element of a tile is not stored with the tile but
+ * written to global memory by its work item once the next rotation is done.
+ *
+ * Local memory layout: a local_range x (local_range + 1) tile, whose row k
+ * holds the elements streamed by the k-th rotation of the tile for the lines
+ * of the work group, followed by the cosines and the sines of the rotations
+ * of the tile.
+ */
+template <bool Left, uint32_t local_range, typename matrix_t,
+          typename vector_t>
+template <typename sharedT>
+SYCL_BLAS_INLINE typename Lasr<Left, local_range, matrix_t, vector_t>::value_t
+Lasr<Left, local_range, matrix_t, vector_t>::eval(sharedT shrMem,
+                                                  cl::sycl::nd_item<1> ndItem) {
+  constexpr index_t tile_ld = local_range + 1;
+  constexpr index_t cos_offset = local_range * tile_ld;
+  constexpr index_t sin_offset = cos_offset + local_range;
+
+  const index_t local_id = ndItem.get_local_id(0);
+  const index_t num_lines = get_size();
+  const index_t line_size =
+      Left ? matrix_.get_size_row() : matrix_.get_size_col();
+  const index_t num_rot = line_size - 1;
+  const index_t first_line = ndItem.get_group(0) * local_range;
+  const index_t line = first_line + local_id;
+  const bool valid = line < num_lines;
+
+  const bool variable = pivot_ == 'v';
+  const bool carry_is_x = pivot_ == 't' || (variable && forward_);
+  const index_t stream_offset = carry_is_x ? 1 : 0;
+  const index_t first_rot = forward_ ? 0 : num_rot - 1;
+  const index_t rot_step = forward_ ? 1 : -1;
+
+  index_t carry_pos = pivot_ == 't'   ? 0
+                      : pivot_ == 'b' ? num_rot
+                      : forward_      ? 0
+                                      : num_rot;
+  value_t carry = valid ? get_element(line, carry_pos) : value_t{0};
+
+  for (index_t tile = 0; tile < num_rot; tile += local_range) {
+    const index_t tile_size =
+        (num_rot - tile) < index_t(local_range) ? num_rot - tile : local_range;
+    const index_t tile_rot = first_rot + rot_step * tile;
+
+    if (local_id < tile_size) {
+      shrMem[cos_offset + local_id] = cos_.eval(tile_rot + rot_step * local_id);
+      shrMem[sin_offset + local_id] = sin_.eval(tile_rot + rot_step * local_id);
+    }
+    // Consecutive work items load consecutive elements of the column major
+    // matrix: positions of a column for Left, lines of a column otherwise.
+    for (index_t idx = local_id; idx < index_t(local_range * local_range);
+         idx += local_range) {
+      const index_t k = Left ? idx % local_range : idx / local_range;
+      const index_t l = Left ? idx / local_range : idx % local_range;
+      if (k < tile_size && first_line + l < num_lines) {
+        shrMem[k * tile_ld + l] = get_element(
+            first_line + l, tile_rot + rot_step * k + stream_offset);
+      }
+    }
+
+    // This barrier is mandatory to be sure the data is on the shared memory
+    ndItem.barrier(cl::sycl::access::fence_space::local_space);
+
+    if (valid) {
+      for (index_t k = 0; k < tile_size; ++k) {
+        const value_t c = shrMem[cos_offset + k];
+        const value_t s = shrMem[sin_offset + k];
+        const value_t streamed = shrMem[k * tile_ld + local_id];
+        const value_t x = carry_is_x ? carry : streamed;
+        const value_t y = carry_is_x ? streamed : carry;
+        const value_t new_x = c * x + s * y;
+        const value_t new_y = c * y - s * x;
+        const value_t carry_side = carry_is_x ? new_x : new_y;
+        const value_t streamed_side = carry_is_x ? new_y : new_x;
+        if (variable) {
+          if (k > 0) {
+            shrMem[(k - 1) * tile_ld + local_id] = carry_side;
+          } else {
+            get_element(line, carry_pos) = carry_side;
+          }
+          carry = streamed_side;
+          carry_pos = tile_rot + rot_step * k + stream_offset;
+        } else {
+          shrMem[k * tile_ld + local_id] = streamed_side;
+          carry = carry_side;
+        }
+      }
+    }
+
+    ndItem.barrier(cl::sycl::access::fence_space::local_space);
+
+    const index_t store_size = variable ? tile_size - 1 : tile_size;
+    for (index_t idx = local_id; idx < index_t(local_range * local_range);
+         idx += local_range) {
+      const index_t k = Left ? idx % local_range : idx / local_range;
+      const index_t l = Left ? idx / local_range : idx % local_range;
+      if (k < store_size && first_line + l < num_lines) {
+        get_element(first_line + l, tile_rot + rot_step * k + stream_offset) =
+            shrMem[k * tile_ld + l];
+      }
+    }
+
+    // The tile is overwritten by the next iteration
+    ndItem.barrier(cl::sycl::access::fence_space::local_space);
+  }
+
+  if (valid) {
+    get_element(line, carry_pos) = carry;
+  }
+  return carry;
+}
+
+template <bool Left, uint32_t local_range, typename matrix_t,
+          typename vector_t>
+SYCL_BLAS_INLINE void Lasr<Left, local_range, matrix_t, vector_t>::bind(
+    cl::sycl::handler &h) {
+  matrix_.bind(h);
+  cos_.bind(h);
+  sin_.bind(h);
+}
+
+template <bool Left, uint32_t local_range, typename matrix_t,
+          typename vector_t>
+SYCL_BLAS_INLINE void
+Lasr<Left, local_range, matrix_t, vector_t>::adjust_access_displacement() {
+  matrix_.adjust_access_displacement();
+  cos_.adjust_access_displacement();
+  sin_.adjust_access_displacement();
+}
+
 }  // namespace blas
 
 #endif  // BLAS1_TREES_HPP
@@ -27,6 +27,7 @@
 #define GEMV_HPP
 #include "operations/blas2_trees.h"
 #include "operations/blas_operators.hpp"
+#include "operations/subgroup_reduction.hpp"
 #include "views/view_sycl.hpp"
 #include <stdexcept>
 #include <vector>
@@ -586,6 +587,12 @@ GemvRow<interLoop, Lower, Diag, Upper, Unit, lhs_t, matrix_t, vector_t>::eval(
   index_t lst_col = cl::sycl::min(index_t(dimC), index_t(frs_col + dimWFC));
   // TODO(Peter): This should be constexpr once half supports it
   static const value_t init_val = AddOperator::template init<vector_t>();
+  // With sub-group memory each sub-group sums the row contributions of its
+  // work items and only stores one value per row in local memory
+  constexpr bool reduce_sub_groups =
+      is_subgroup_memory<local_memory_t>::value &&
+      subgroup_reducible<value_t>::value;
+  const index_t num_sg = get_num_sub_groups(ndItem);
   // PROBLEM IF ONLY SOME THREADS OF A WORKGROUP ARE CANCELED
   // TO SOLVE IT, USE GLOBAL VALUES OF frs_col AND lst_col
   if ((!Upper && (((idWFC * dimWFC) + ((!Diag) ? 1 : 0)) > (lst_row - 1))) ||
@@ -622,7 +629,12 @@ GemvRow<interLoop, Lower, Diag, Upper, Unit, lhs_t, matrix_t, vector_t>::eval(
               }
             }
           }
-          shrMem[row * localSz + localid] = val;
+          if (reduce_sub_groups) {
+            store_sub_group_reduction<AddOperator>(shrMem, ndItem, val,
+                                                   row * num_sg);
+          } else {
+            shrMem[row * localSz + localid] = val;
+          }
         }
       } else {
         for (index_t row = 0, id_row = rowid; row < blqSz; row++, id_row++) {
@@ -652,12 +664,30 @@ GemvRow<interLoop, Lower, Diag, Upper, Unit, lhs_t, matrix_t, vector_t>::eval(
               }
             }
           }
-          shrMem[row * localSz + localid] = val;
+          if (reduce_sub_groups) {
+            store_sub_group_reduction<AddOperator>(shrMem, ndItem, val,
+                                                   row * num_sg);
+          } else {
+            shrMem[row * localSz + localid] = val;
+          }
         }
       }
 
       // This barrier is mandatory to be sure the data is on the shared memory
       ndItem.barrier(cl::sycl::access::fence_space::local_space);
+      if (reduce_sub_groups) {
+        // One work item per row adds the partial sums of the sub-groups
+        for (index_t row = localid; row < blqSz; row += localSz) {
+          value_t sum = init_val;
+          for (index_t sg = 0; sg < num_sg; sg++) {
+            sum = AddOperator::eval(sum, shrMem[row * num_sg + sg]);
+          }
+          lhs_.eval(rowid + row, idWFC) = sum;
+        }
+        // The next block of rows reuses the shared memory
+        ndItem.barrier(cl::sycl::access::fence_space::local_space);
+        continue;
+      }
       // Reduction inside the block
       for (index_t offset = localSz >> 1; offset > 0; offset >>= 1) {
         if (localid < offset) {
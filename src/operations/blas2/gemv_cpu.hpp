@@ -0,0 +1,224 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename gemv_cpu.hpp
+ *
+ **************************************************************************/
+
+#ifndef GEMV_CPU_HPP
+#define GEMV_CPU_HPP
+#include "operations/blas2_trees.h"
+#include "operations/blas_operators.hpp"
+#include "views/view_sycl.hpp"
+#include <stdexcept>
+#include <vector>
+namespace blas {
+
+/**
+ * @struct GemvCpu
+ * @brief Tree node representing a Gemv for CPU devices.
+ */
+template <typename lhs_t, typename matrix_t, typename vector_t,
+          uint32_t block_size, uint32_t vector_size, bool is_transposed>
+SYCL_BLAS_INLINE GemvCpu<lhs_t, matrix_t, vector_t, block_size, vector_size,
+                         is_transposed>::GemvCpu(lhs_t &_l, matrix_t &_matrix,
+                                                 vector_t &_vector,
+                                                 value_t _alpha, value_t _beta)
+    : lhs_(_l),
+      matrix_(_matrix),
+      vector_(_vector),
+      alpha_(_alpha),
+      beta_(_beta) {}
+
+template <typename lhs_t, typename matrix_t, typename vector_t,
+          uint32_t block_size, uint32_t vector_size, bool is_transposed>
+SYCL_BLAS_INLINE typename GemvCpu<lhs_t, matrix_t, vector_t, block_size,
+                                  vector_size, is_transposed>::index_t
+GemvCpu<lhs_t, matrix_t, vector_t, block_size, vector_size,
+        is_transposed>::get_size() const {
+  return lhs_.get_size();
+}
+
+/*!
+ * @brief Number of work items, each one in its own work group.
+ */
+template <typename lhs_t, typename matrix_t, typename vector_t,
+          uint32_t block_size, uint32_t vector_size, bool is_transposed>
+SYCL_BLAS_INLINE typename GemvCpu<lhs_t, matrix_t, vector_t, block_size,
+                                  vector_size, is_transposed>::index_t
+GemvCpu<lhs_t, matrix_t, vector_t, block_size, vector_size,
+        is_transposed>::get_num_work_items() const {
+  const index_t per_item = is_transposed ? item_cols : index_t(block_size);
+  return (lhs_.get_size() - 1) / per_item + 1;
+}
+
+template <typename lhs_t, typename matrix_t, typename vector_t,
+          uint32_t block_size, uint32_t vector_size, bool is_transposed>
+SYCL_BLAS_INLINE bool GemvCpu<lhs_t, matrix_t, vector_t, block_size,
+                              vector_size, is_transposed>::
+    valid_thread(cl::sycl::nd_item<1> ndItem) const {
+  // Valid threads are established by ::eval.
+  return true;
+}
+
+template <typename lhs_t, typename matrix_t, typename vector_t,
+          uint32_t block_size, uint32_t vector_size, bool is_transposed>
+template <typename local_memory_t>
+SYCL_BLAS_INLINE typename GemvCpu<lhs_t, matrix_t, vector_t, block_size,
+                                  vector_size, is_transposed>::value_t
+GemvCpu<lhs_t, matrix_t, vector_t, block_size, vector_size,
+        is_transposed>::eval(local_memory_t local_mem,
+                             cl::sycl::nd_item<1> ndItem) {
+  using address_t = cl::sycl::access::address_space;
+  using packet_t = cl::sycl::vec<value_t, vector_size>;
+  static_assert(block_size % vector_size == 0,
+                "The block size must be a multiple of the vector size");
+
+  const index_t lda = matrix_.getSizeL();
+  const index_t y_size = lhs_.get_size();
+  const index_t x_size = vector_.get_size();
+  const index_t per_item = is_transposed ? item_cols : index_t(block_size);
+  const index_t first = ndItem.get_global_id(0) * per_item;
+  if (first >= y_size) {
+    return value_t{0};
+  }
+  const index_t count = cl::sycl::min(per_item, y_size - first);
+  value_t res[is_transposed ? item_cols : block_size];
+
+  if (!is_transposed) {
+    // Rows [first, first + count) of the result, accumulated column by column
+    constexpr index_t packets = block_size / vector_size;
+    auto a = matrix_.get_pointer() + first;
+    if (count == index_t(block_size)) {
+      packet_t acc[packets];
+#pragma unroll
+      for (index_t v = 0; v < packets; ++v) {
+        acc[v] = packet_t(value_t{0});
+      }
+      for (index_t j = 0; j < x_size; ++j) {
+        const packet_t x_j(vector_.eval(j));
+#pragma unroll
+        for (index_t v = 0; v < packets; ++v) {
+          packet_t a_ij;
+          a_ij.template load<address_t::global_space>(
+              0, cl::sycl::multi_ptr<const value_t, address_t::global_space>(
+                     a + j * lda + v * vector_size));
+          acc[v] += a_ij * x_j;
+        }
+      }
+#pragma unroll
+      for (index_t v = 0; v < packets; ++v) {
+        acc[v].template store<address_t::private_space>(
+            0, cl::sycl::multi_ptr<value_t, address_t::private_space>(
+                   res + v * vector_size));
+      }
+    } else {
+      for (index_t i = 0; i < count; ++i) {
+        res[i] = value_t{0};
+      }
+      for (index_t j = 0; j < x_size; ++j) {
+        const value_t x_j = vector_.eval(j);
+        for (index_t i = 0; i < count; ++i) {
+          res[i] += a[i + j * lda] * x_j;
+        }
+      }
+    }
+  } else {
+    // Columns [first, first + count) of the matrix, walked down in chunks of
+    // block_size rows with the matching chunk of the vector in local memory
+    auto x_chunk = local_mem.localAcc.get_pointer();
+    auto a = matrix_.get_pointer() + first * lda;
+    packet_t acc[item_cols];
+#pragma unroll
+    for (index_t c = 0; c < item_cols; ++c) {
+      acc[c] = packet_t(value_t{0});
+      res[c] = value_t{0};
+    }
+    for (index_t chunk = 0; chunk < x_size; chunk += block_size) {
+      const index_t rows = cl::sycl::min(index_t(block_size), x_size - chunk);
+      const index_t vec_rows = rows - rows % vector_size;
+      for (index_t i = 0; i < rows; ++i) {
+        x_chunk[i] = vector_.eval(chunk + i);
+      }
+#pragma unroll
+      for (index_t c = 0; c < item_cols; ++c) {
+        if (c < count) {
+          auto a_col = a + c * lda + chunk;
+          for (index_t i = 0; i < vec_rows; i += vector_size) {
+            packet_t a_ij;
+            a_ij.template load<address_t::global_space>(
+                0, cl::sycl::multi_ptr<const value_t, address_t::global_space>(
+                       a_col + i));
+            packet_t x_i;
+            x_i.template load<address_t::local_space>(
+                0, cl::sycl::multi_ptr<const value_t, address_t::local_space>(
+                       x_chunk + i));
+            acc[c] += a_ij * x_i;
+          }
+          for (index_t i = vec_rows; i < rows; ++i) {
+            res[c] += a_col[i] * x_chunk[i];
+          }
+        }
+      }
+    }
+#pragma unroll
+    for (index_t c = 0; c < item_cols; ++c) {
+      value_t lanes[vector_size];
+      acc[c].template store<address_t::private_space>(
+          0, cl::sycl::multi_ptr<value_t, address_t::private_space>(lanes));
+#pragma unroll
+      for (index_t l = 0; l < vector_size; ++l) {
+        res[c] += lanes[l];
+      }
+    }
+  }
+
+  // y is only read when beta is not zero, as required by BLAS
+  for (index_t i = 0; i < count; ++i) {
+    auto &out = lhs_.eval(first + i);
+    out = (beta_ == value_t{0}) ? alpha_ * res[i]
+                                : alpha_ * res[i] + beta_ * out;
+  }
+  return res[0];
+}
+
+template <typename lhs_t, typename matrix_t, typename vector_t,
+          uint32_t block_size, uint32_t vector_size, bool is_transposed>
+SYCL_BLAS_INLINE void GemvCpu<lhs_t, matrix_t, vector_t, block_size,
+                              vector_size,
+                              is_transposed>::bind(cl::sycl::handler &h) {
+  lhs_.bind(h);
+  matrix_.bind(h);
+  vector_.bind(h);
+}
+
+template <typename lhs_t, typename matrix_t, typename vector_t,
+          uint32_t block_size, uint32_t vector_size, bool is_transposed>
+SYCL_BLAS_INLINE void GemvCpu<lhs_t, matrix_t, vector_t, block_size,
+                              vector_size,
+                              is_transposed>::adjust_access_displacement() {
+  lhs_.adjust_access_displacement();
+  matrix_.adjust_access_displacement();
+  vector_.adjust_access_displacement();
+}
+
+}  // namespace blas
+#endif
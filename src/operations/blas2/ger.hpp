@@ -506,6 +506,174 @@ SYCL_BLAS_INLINE void GerCol<Single, Lower, Diag, Upper, lhs_t, rhs_1_t,
   rhs_2_.adjust_access_displacement();
 }
 
+/**** TILED RANK-K UPDATE ****/
+template <bool Single, bool Lower, bool Upper, uint32_t local_range,
+          uint32_t item_rows, uint32_t tile_cols, uint32_t k_block,
+          typename lhs_t, typename rhs_1_t, typename rhs_2_t>
+SYCL_BLAS_INLINE
+GerTiled<Single, Lower, Upper, local_range, item_rows, tile_cols, k_block,
+         lhs_t, rhs_1_t, rhs_2_t>::GerTiled(lhs_t &_l, value_t _scl,
+                                            rhs_1_t &_r1, rhs_2_t &_r2)
+    : lhs_(_l), scalar_(_scl), rhs_1_(_r1), rhs_2_(_r2) {}
+
+template <bool Single, bool Lower, bool Upper, uint32_t local_range,
+          uint32_t item_rows, uint32_t tile_cols, uint32_t k_block,
+          typename lhs_t, typename rhs_1_t, typename rhs_2_t>
+SYCL_BLAS_INLINE typename GerTiled<Single, Lower, Upper, local_range,
+                                   item_rows, tile_cols, k_block, lhs_t,
+                                   rhs_1_t, rhs_2_t>::index_t
+GerTiled<Single, Lower, Upper, local_range, item_rows, tile_cols, k_block,
+         lhs_t, rhs_1_t, rhs_2_t>::get_size() const {
+  return lhs_.get_size();
+}
+
+template <bool Single, bool Lower, bool Upper, uint32_t local_range,
+          uint32_t item_rows, uint32_t tile_cols, uint32_t k_block,
+          typename lhs_t, typename rhs_1_t, typename rhs_2_t>
+SYCL_BLAS_INLINE bool
+GerTiled<Single, Lower, Upper, local_range, item_rows, tile_cols, k_block,
+         lhs_t, rhs_1_t, rhs_2_t>::valid_thread(
+    cl::sycl::nd_item<1> ndItem) const {
+  // Valid threads are established by ::eval, all of them take part in the
+  // barriers.
+  return true;
+}
+
+/*!
+ * @brief Work group g owns the tile (g % nWG_row, g / nWG_row) of lhs_. Tiles
+ * with no element in the updated triangle are skipped by the whole work group,
+ * before any barrier.
+ *
+ * Local memory layout: the elements of the k_block staged vectors of rhs_1_
+ * matching the rows of the tile (x_rows), those of rhs_2_ matching its
+ * columns (y_cols) and, for a symmetric update, those of rhs_2_ matching its
+ * rows (y_rows) and those of rhs_1_ matching its columns (x_cols), one vector
+ * after the other. Consecutive work items load consecutive elements.
+ */
+template <bool Single, bool Lower, bool Upper, uint32_t local_range,
+          uint32_t item_rows, uint32_t tile_cols, uint32_t k_block,
+          typename lhs_t, typename rhs_1_t, typename rhs_2_t>
+template <typename sharedT>
+SYCL_BLAS_INLINE typename GerTiled<Single, Lower, Upper, local_range,
+                                   item_rows, tile_cols, k_block, lhs_t,
+                                   rhs_1_t, rhs_2_t>::value_t
+GerTiled<Single, Lower, Upper, local_range, item_rows, tile_cols, k_block,
+         lhs_t, rhs_1_t, rhs_2_t>::eval(
+    sharedT shrMem, cl::sycl::nd_item<1> ndItem) {
+  constexpr index_t x_rows = 0;
+  constexpr index_t y_cols = x_rows + k_block * tile_rows;
+  constexpr index_t y_rows = y_cols + k_block * tile_cols;
+  constexpr index_t x_cols = y_rows + k_block * tile_rows;
+
+  const index_t local_id = ndItem.get_local_id(0);
+  const index_t group_id = ndItem.get_group(0);
+  const index_t dim_r = lhs_.get_size_row();
+  const index_t dim_c = lhs_.get_size_col();
+  const index_t dim_k = rhs_1_.get_size_col();
+  const index_t nWG_row = (dim_r + tile_rows - 1) / tile_rows;
+  const index_t first_row = (group_id % nWG_row) * tile_rows;
+  const index_t first_col = (group_id / nWG_row) * tile_cols;
+
+  if ((!Upper && first_col > first_row + tile_rows - 1) ||
+      (!Lower && first_row > first_col + tile_cols - 1)) {
+    return value_t{0};
+  }
+
+  value_t acc[item_rows][tile_cols];
+#pragma unroll
+  for (index_t r = 0; r < item_rows; ++r) {
+#pragma unroll
+    for (index_t c = 0; c < tile_cols; ++c) {
+      acc[r][c] = value_t{0};
+    }
+  }
+
+  for (index_t k = 0; k < dim_k; k += k_block) {
+    const index_t k_size = std::min(index_t(k_block), dim_k - k);
+    if (k > 0) {
+      // The previous vectors must have been used before they are overwritten
+      ndItem.barrier(cl::sycl::access::fence_space::local_space);
+    }
+    for (index_t id = local_id; id < k_size * tile_rows; id += local_range) {
+      const index_t p = id / tile_rows;
+      const index_t row = first_row + id % tile_rows;
+      const bool valid = row < dim_r;
+      shrMem[x_rows + id] = valid ? rhs_1_.eval(row, k + p) : value_t{0};
+      if (!Single) {
+        shrMem[y_rows + id] = valid ? rhs_2_.eval(row, k + p) : value_t{0};
+      }
+    }
+    for (index_t id = local_id; id < k_size * tile_cols; id += local_range) {
+      const index_t p = id / tile_cols;
+      const index_t col = first_col + id % tile_cols;
+      const bool valid = col < dim_c;
+      shrMem[y_cols + id] = valid ? rhs_2_.eval(col, k + p) : value_t{0};
+      if (!Single) {
+        shrMem[x_cols + id] = valid ? rhs_1_.eval(col, k + p) : value_t{0};
+      }
+    }
+
+    // This barrier is mandatory to be sure the data is on the shared memory
+    ndItem.barrier(cl::sycl::access::fence_space::local_space);
+
+    for (index_t p = 0; p < k_size; ++p) {
+#pragma unroll
+      for (index_t c = 0; c < tile_cols; ++c) {
+        const value_t y_col = shrMem[y_cols + p * tile_cols + c];
+        const value_t x_col = Single ? value_t{0}
+                                     : shrMem[x_cols + p * tile_cols + c];
+#pragma unroll
+        for (index_t r = 0; r < item_rows; ++r) {
+          const index_t id = p * tile_rows + r * local_range + local_id;
+          acc[r][c] += shrMem[x_rows + id] * y_col;
+          if (!Single) {
+            acc[r][c] += shrMem[y_rows + id] * x_col;
+          }
+        }
+      }
+    }
+  }
+
+  // Each work item updates item_rows elements of every column, local_range
+  // apart, so that consecutive work items update consecutive elements
+#pragma unroll
+  for (index_t c = 0; c < tile_cols; ++c) {
+    const index_t col = first_col + c;
+#pragma unroll
+    for (index_t r = 0; r < item_rows; ++r) {
+      const index_t row = first_row + r * local_range + local_id;
+      if (row < dim_r && col < dim_c &&
+          ((Lower && col <= row) || (Upper && col >= row))) {
+        lhs_.eval(row, col) += scalar_ * acc[r][c];
+      }
+    }
+  }
+
+  return shrMem[0];
+}
+
+template <bool Single, bool Lower, bool Upper, uint32_t local_range,
+          uint32_t item_rows, uint32_t tile_cols, uint32_t k_block,
+          typename lhs_t, typename rhs_1_t, typename rhs_2_t>
+SYCL_BLAS_INLINE void
+GerTiled<Single, Lower, Upper, local_range, item_rows, tile_cols, k_block,
+         lhs_t, rhs_1_t, rhs_2_t>::bind(cl::sycl::handler &h) {
+  lhs_.bind(h);
+  rhs_1_.bind(h);
+  rhs_2_.bind(h);
+}
+
+template <bool Single, bool Lower, bool Upper, uint32_t local_range,
+          uint32_t item_rows, uint32_t tile_cols, uint32_t k_block,
+          typename lhs_t, typename rhs_1_t, typename rhs_2_t>
+SYCL_BLAS_INLINE void
+GerTiled<Single, Lower, Upper, local_range, item_rows, tile_cols, k_block,
+         lhs_t, rhs_1_t, rhs_2_t>::adjust_access_displacement() {
+  lhs_.adjust_access_displacement();
+  rhs_1_.adjust_access_displacement();
+  rhs_2_.adjust_access_displacement();
+}
+
 }  // namespace blas
 
 #endif
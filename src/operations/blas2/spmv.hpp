@@ -0,0 +1,158 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename spmv.hpp
+ *
+ **************************************************************************/
+
+#ifndef SPMV_HPP
+#define SPMV_HPP
+#include "operations/blas2_trees.h"
+#include "operations/blas_operators.hpp"
+#include "views/view_sycl.hpp"
+#include <stdexcept>
+#include <vector>
+namespace blas {
+
+/**
+ * @struct Spmv
+ * @brief Tree node representing a symmetric packed matrix_ vector_
+ * multiplication.
+ */
+template <typename lhs_t, typename matrix_t, typename vector_t,
+          uint32_t local_range, bool is_upper>
+SYCL_BLAS_INLINE Spmv<lhs_t, matrix_t, vector_t, local_range, is_upper>::Spmv(
+    lhs_t &_l, matrix_t &_matrix, vector_t &_vector)
+    : lhs_(_l), matrix_(_matrix), vector_(_vector) {}
+
+template <typename lhs_t, typename matrix_t, typename vector_t,
+          uint32_t local_range, bool is_upper>
+SYCL_BLAS_INLINE
+    typename Spmv<lhs_t, matrix_t, vector_t, local_range, is_upper>::index_t
+    Spmv<lhs_t, matrix_t, vector_t, local_range, is_upper>::get_size() const {
+  return vector_.get_size();
+}
+
+template <typename lhs_t, typename matrix_t, typename vector_t,
+          uint32_t local_range, bool is_upper>
+SYCL_BLAS_INLINE bool
+Spmv<lhs_t, matrix_t, vector_t, local_range, is_upper>::valid_thread(
+    cl::sycl::nd_item<1> ndItem) const {
+  // Valid threads are established by ::eval.
+  return true;
+}
+
+/*!
+ * @brief Work group g computes the rows [g * local_range, (g + 1) *
+ * local_range) of the product, one per work item, a local_range x local_range
+ * tile of matrix_ at a time.
+ *
+ * Each tile is staged in local memory by reading the stored triangle column
+ * by column, consecutive work items reading consecutive packed elements.
+ * Tiles on the other side of the diagonal are read from their mirror in the
+ * stored triangle and transposed when written to local memory, so that both
+ * halves of the matrix are read coalesced. The rows of the tile are padded
+ * to local_range + 1 elements to avoid bank conflicts.
+ */
+template <typename lhs_t, typename matrix_t, typename vector_t,
+          uint32_t local_range, bool is_upper>
+template <typename sharedT>
+SYCL_BLAS_INLINE
+    typename Spmv<lhs_t, matrix_t, vector_t, local_range, is_upper>::value_t
+    Spmv<lhs_t, matrix_t, vector_t, local_range, is_upper>::eval(
+        sharedT shrMem, cl::sycl::nd_item<1> ndItem) {
+  constexpr index_t ld_tile = local_range + 1;
+  constexpr index_t x_tile = local_range * ld_tile;
+
+  const index_t local_id = ndItem.get_local_id(0);
+  const index_t n = vector_.get_size();
+  const index_t first_row = ndItem.get_group(0) * local_range;
+  value_t val = 0;
+
+  for (index_t first_col = 0; first_col < n; first_col += local_range) {
+    const bool diagonal = first_col == first_row;
+    // Whether the tile lies in the stored triangle, otherwise its mirror is
+    const bool direct =
+        is_upper ? first_col > first_row : first_col < first_row;
+    const index_t stored_row = direct ? first_row : first_col;
+    const index_t stored_col = direct ? first_col : first_row;
+
+    if (first_col > 0) {
+      // The previous tile must have been used before it is overwritten
+      ndItem.barrier(cl::sycl::access::fence_space::local_space);
+    }
+    for (index_t j = 0; j < local_range; ++j) {
+      const index_t row = stored_row + local_id;
+      const index_t col = stored_col + j;
+      if (!diagonal || (is_upper ? local_id <= j : local_id >= j)) {
+        const value_t a =
+            (row < n && col < n) ? matrix_.eval(row, col) : value_t{0};
+        if (direct || diagonal) {
+          shrMem[local_id * ld_tile + j] = a;
+        }
+        if (!direct) {
+          shrMem[j * ld_tile + local_id] = a;
+        }
+      }
+    }
+    shrMem[x_tile + local_id] = first_col + local_id < n
+                                    ? vector_.eval(first_col + local_id)
+                                    : value_t{0};
+
+    // This barrier is mandatory to be sure the data is on the shared memory
+    ndItem.barrier(cl::sycl::access::fence_space::local_space);
+
+    for (index_t j = 0; j < local_range; ++j) {
+      val = AddOperator::eval(
+          val, ProductOperator::eval(shrMem[local_id * ld_tile + j],
+                                     shrMem[x_tile + j]));
+    }
+  }
+
+  const index_t lhs_idx = first_row + local_id;
+  if (lhs_idx < lhs_.get_size_row()) {
+    lhs_.eval(lhs_idx, index_t(0)) = val;
+  }
+  return val;
+}
+
+template <typename lhs_t, typename matrix_t, typename vector_t,
+          uint32_t local_range, bool is_upper>
+SYCL_BLAS_INLINE void
+Spmv<lhs_t, matrix_t, vector_t, local_range, is_upper>::bind(
+    cl::sycl::handler &h) {
+  lhs_.bind(h);
+  matrix_.bind(h);
+  vector_.bind(h);
+}
+
+template <typename lhs_t, typename matrix_t, typename vector_t,
+          uint32_t local_range, bool is_upper>
+SYCL_BLAS_INLINE void
+Spmv<lhs_t, matrix_t, vector_t, local_range,
+     is_upper>::adjust_access_displacement() {
+  lhs_.adjust_access_displacement();
+  matrix_.adjust_access_displacement();
+  vector_.adjust_access_displacement();
+}
+
+}  // namespace blas
+#endif
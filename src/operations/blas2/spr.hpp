@@ -0,0 +1,115 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename spr.hpp
+ *
+ **************************************************************************/
+
+#ifndef SPR_HPP
+#define SPR_HPP
+#include "operations/blas2_trees.h"
+#include "operations/blas_operators.hpp"
+#include "views/view_sycl.hpp"
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+namespace blas {
+
+/**
+ * @struct Spr
+ * @brief Tree node representing a symmetric rank 1 update of a packed matrix.
+ */
+template <bool is_upper, typename lhs_t, typename vector_t>
+SYCL_BLAS_INLINE Spr<is_upper, lhs_t, vector_t>::Spr(lhs_t &_l, value_t _scl,
+                                                     vector_t &_vector)
+    : lhs_(_l), scalar_(_scl), vector_(_vector) {}
+
+template <bool is_upper, typename lhs_t, typename vector_t>
+SYCL_BLAS_INLINE typename Spr<is_upper, lhs_t, vector_t>::index_t
+Spr<is_upper, lhs_t, vector_t>::get_size() const {
+  // n * (n + 1) overflows a 32 bit index long before the packed size does
+  const int64_t n = vector_.get_size();
+  return static_cast<index_t>((n * (n + 1)) / 2);
+}
+
+template <bool is_upper, typename lhs_t, typename vector_t>
+SYCL_BLAS_INLINE bool Spr<is_upper, lhs_t, vector_t>::valid_thread(
+    cl::sycl::nd_item<1> ndItem) const {
+  return ndItem.get_global_id(0) < get_size();
+}
+
+/*!
+ * @brief Updates the packed element i. Its column is recovered from the
+ * triangular number just below i; the lower triangle is handled as the upper
+ * triangle of the matrix with its rows and columns reversed, since both are
+ * then laid out in reverse order.
+ *
+ * The triangular numbers are computed in 64 bits, as 8 * p + 1 overflows a 32
+ * bit index from n = 23171 on, and the single precision square root is only
+ * an estimate of the column, corrected in both directions.
+ */
+template <bool is_upper, typename lhs_t, typename vector_t>
+SYCL_BLAS_INLINE typename Spr<is_upper, lhs_t, vector_t>::value_t
+Spr<is_upper, lhs_t, vector_t>::eval(index_t i) {
+  const int64_t n = vector_.get_size();
+  const int64_t size = (n * (n + 1)) / 2;
+  const int64_t p = is_upper ? static_cast<int64_t>(i) : size - 1 - i;
+  int64_t col = static_cast<int64_t>(
+      (cl::sycl::sqrt(static_cast<float>(8 * p + 1)) - 1.0f) / 2.0f);
+  col = cl::sycl::min(cl::sycl::max(col, int64_t{0}), n - 1);
+  while (col > 0 && (col * (col + 1)) / 2 > p) {
+    --col;
+  }
+  while (col < n - 1 && ((col + 1) * (col + 2)) / 2 <= p) {
+    ++col;
+  }
+  int64_t row = p - (col * (col + 1)) / 2;
+  if (!is_upper) {
+    row = n - 1 - row;
+    col = n - 1 - col;
+  }
+  return lhs_.template eval<true>(i) +=
+         scalar_ * vector_.eval(static_cast<index_t>(row)) *
+         vector_.eval(static_cast<index_t>(col));
+}
+
+template <bool is_upper, typename lhs_t, typename vector_t>
+SYCL_BLAS_INLINE typename Spr<is_upper, lhs_t, vector_t>::value_t
+Spr<is_upper, lhs_t, vector_t>::eval(cl::sycl::nd_item<1> ndItem) {
+  return eval(ndItem.get_global_id(0));
+}
+
+template <bool is_upper, typename lhs_t, typename vector_t>
+SYCL_BLAS_INLINE void Spr<is_upper, lhs_t, vector_t>::bind(
+    cl::sycl::handler &h) {
+  lhs_.bind(h);
+  vector_.bind(h);
+}
+
+template <bool is_upper, typename lhs_t, typename vector_t>
+SYCL_BLAS_INLINE void
+Spr<is_upper, lhs_t, vector_t>::adjust_access_displacement() {
+  lhs_.adjust_access_displacement();
+  vector_.adjust_access_displacement();
+}
+
+}  // namespace blas
+#endif
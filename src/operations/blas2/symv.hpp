@@ -0,0 +1,186 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename symv.hpp
+ *
+ **************************************************************************/
+
+#ifndef SYMV_HPP
+#define SYMV_HPP
+#include "operations/blas2_trees.h"
+#include "operations/blas_operators.hpp"
+#include "views/view_sycl.hpp"
+#include <stdexcept>
+#include <vector>
+namespace blas {
+
+/**
+ * @struct Symv
+ * @brief Tree node representing a blocked symmetric matrix_ vector_
+ * multiplication.
+ */
+template <bool Upper, uint32_t local_range, typename lhs_t, typename matrix_t,
+          typename vector_t>
+SYCL_BLAS_INLINE Symv<Upper, local_range, lhs_t, matrix_t, vector_t>::Symv(
+    lhs_t &_l, matrix_t &_matrix, vector_t &_vector)
+    : lhs_(_l), matrix_(_matrix), vector_(_vector) {}
+
+template <bool Upper, uint32_t local_range, typename lhs_t, typename matrix_t,
+          typename vector_t>
+SYCL_BLAS_INLINE
+    typename Symv<Upper, local_range, lhs_t, matrix_t, vector_t>::index_t
+    Symv<Upper, local_range, lhs_t, matrix_t, vector_t>::get_size() const {
+  return vector_.get_size();
+}
+
+template <bool Upper, uint32_t local_range, typename lhs_t, typename matrix_t,
+          typename vector_t>
+SYCL_BLAS_INLINE bool
+Symv<Upper, local_range, lhs_t, matrix_t, vector_t>::valid_thread(
+    cl::sycl::nd_item<1> ndItem) const {
+  // Valid threads are established by ::eval, all of them take part in the
+  // barriers.
+  return true;
+}
+
+/*!
+ * @brief Work group g walks the block rows g, g + G, g + 2G, ... of the stored
+ * triangle, G being the number of work groups. For block row b, each tile
+ * (b, t) is loaded into local memory once and contributes A(b, t) * x(t) to
+ * the rows of block b and A(b, t)^T * x(b) to the rows of block t. The
+ * diagonal tile is mirrored in local memory so that the unstored triangle is
+ * never read. Work item i only ever touches the elements i + l * local_range
+ * of column g of lhs_, so it accumulates into them without any barrier.
+ *
+ * Local memory layout: a local_range x (local_range + 1) tile, padded to
+ * avoid bank conflicts when it is read by columns, followed by the block of x
+ * matching the rows and the block of x matching the columns of the tile.
+ */
+template <bool Upper, uint32_t local_range, typename lhs_t, typename matrix_t,
+          typename vector_t>
+template <typename sharedT>
+SYCL_BLAS_INLINE
+    typename Symv<Upper, local_range, lhs_t, matrix_t, vector_t>::value_t
+    Symv<Upper, local_range, lhs_t, matrix_t, vector_t>::eval(
+        sharedT shrMem, cl::sycl::nd_item<1> ndItem) {
+  constexpr index_t tile_ld = local_range + 1;
+  constexpr index_t x_row_offset = local_range * tile_ld;
+  constexpr index_t x_col_offset = x_row_offset + local_range;
+
+  const index_t local_id = ndItem.get_local_id(0);
+  const index_t group_id = ndItem.get_group(0);
+  const index_t num_groups = ndItem.get_group_range(0);
+  const index_t n = vector_.get_size();
+  const index_t num_tiles = (n + local_range - 1) / local_range;
+
+  for (index_t tile = 0; tile < num_tiles; ++tile) {
+    const index_t idx = tile * local_range + local_id;
+    if (idx < n) {
+      lhs_.eval(idx, group_id) = value_t{0};
+    }
+  }
+
+  value_t row_val = value_t{0};
+  for (index_t block = group_id; block < num_tiles; block += num_groups) {
+    const index_t row = block * local_range + local_id;
+    shrMem[x_row_offset + local_id] = row < n ? vector_.eval(row) : value_t{0};
+
+    const index_t first_tile = Upper ? block : index_t(0);
+    const index_t last_tile = Upper ? num_tiles : block + 1;
+
+    row_val = value_t{0};
+    for (index_t tile = first_tile; tile < last_tile; ++tile) {
+      const index_t col_base = tile * local_range;
+      const bool is_diag = tile == block;
+
+      // Work item local_id loads row local_id of the tile, so that
+      // consecutive work items read consecutive elements of each column.
+      for (index_t c = 0; c < local_range; ++c) {
+        const index_t col = col_base + c;
+        const bool stored =
+            !is_diag || (Upper ? local_id <= c : local_id >= c);
+        shrMem[local_id * tile_ld + c] = (row < n && col < n && stored)
+                                             ? matrix_.eval(row, col)
+                                             : value_t{0};
+      }
+      shrMem[x_col_offset + local_id] = (col_base + local_id) < n
+                                            ? vector_.eval(col_base + local_id)
+                                            : value_t{0};
+
+      // This barrier is mandatory to be sure the data is on the shared memory
+      ndItem.barrier(cl::sycl::access::fence_space::local_space);
+
+      if (is_diag) {
+        // Only the stored elements are read, only the unstored ones are
+        // written
+        for (index_t c = 0; c < local_range; ++c) {
+          if (Upper ? c < local_id : c > local_id) {
+            shrMem[local_id * tile_ld + c] = shrMem[c * tile_ld + local_id];
+          }
+        }
+        ndItem.barrier(cl::sycl::access::fence_space::local_space);
+      }
+
+      for (index_t c = 0; c < local_range; ++c) {
+        row_val += shrMem[local_id * tile_ld + c] * shrMem[x_col_offset + c];
+      }
+
+      if (!is_diag) {
+        value_t col_val = value_t{0};
+        for (index_t r = 0; r < local_range; ++r) {
+          col_val += shrMem[r * tile_ld + local_id] * shrMem[x_row_offset + r];
+        }
+        if ((col_base + local_id) < n) {
+          lhs_.eval(col_base + local_id, group_id) += col_val;
+        }
+      }
+
+      // The tile is overwritten by the next iteration
+      ndItem.barrier(cl::sycl::access::fence_space::local_space);
+    }
+
+    if (row < n) {
+      lhs_.eval(row, group_id) += row_val;
+    }
+  }
+  return row_val;
+}
+
+template <bool Upper, uint32_t local_range, typename lhs_t, typename matrix_t,
+          typename vector_t>
+SYCL_BLAS_INLINE void Symv<Upper, local_range, lhs_t, matrix_t, vector_t>::bind(
+    cl::sycl::handler &h) {
+  lhs_.bind(h);
+  matrix_.bind(h);
+  vector_.bind(h);
+}
+
+template <bool Upper, uint32_t local_range, typename lhs_t, typename matrix_t,
+          typename vector_t>
+SYCL_BLAS_INLINE void Symv<Upper, local_range, lhs_t, matrix_t,
+                           vector_t>::adjust_access_displacement() {
+  lhs_.adjust_access_displacement();
+  matrix_.adjust_access_displacement();
+  vector_.adjust_access_displacement();
+}
+
+}  // namespace blas
+#endif
@@ -0,0 +1,128 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename tbmv.hpp
+ *
+ **************************************************************************/
+
+#ifndef TBMV_HPP
+#define TBMV_HPP
+#include "operations/blas2_trees.h"
+#include "operations/blas_operators.hpp"
+#include "views/view_sycl.hpp"
+#include <stdexcept>
+#include <vector>
+namespace blas {
+
+/**
+ * @struct Tbmv
+ * @brief Tree node representing a triangular band matrix_ vector_
+ * multiplication.
+ */
+template <typename lhs_t, typename matrix_t, typename vector_t,
+          uint32_t local_range, bool is_upper, bool is_transposed,
+          bool is_unit>
+SYCL_BLAS_INLINE Tbmv<lhs_t, matrix_t, vector_t, local_range, is_upper,
+                      is_transposed, is_unit>::Tbmv(lhs_t &_l,
+                                                     matrix_t &_matrix,
+                                                     index_t &_k,
+                                                     vector_t &_vector)
+    : lhs_(_l), matrix_(_matrix), k_(_k), vector_(_vector) {}
+
+template <typename lhs_t, typename matrix_t, typename vector_t,
+          uint32_t local_range, bool is_upper, bool is_transposed,
+          bool is_unit>
+SYCL_BLAS_INLINE typename Tbmv<lhs_t, matrix_t, vector_t, local_range,
+                               is_upper, is_transposed, is_unit>::index_t
+Tbmv<lhs_t, matrix_t, vector_t, local_range, is_upper, is_transposed,
+     is_unit>::get_size() const {
+  return vector_.get_size();
+}
+
+template <typename lhs_t, typename matrix_t, typename vector_t,
+          uint32_t local_range, bool is_upper, bool is_transposed,
+          bool is_unit>
+SYCL_BLAS_INLINE bool
+Tbmv<lhs_t, matrix_t, vector_t, local_range, is_upper, is_transposed,
+     is_unit>::valid_thread(cl::sycl::nd_item<1> ndItem) const {
+  // Valid threads are established by ::eval.
+  return true;
+}
+
+template <typename lhs_t, typename matrix_t, typename vector_t,
+          uint32_t local_range, bool is_upper, bool is_transposed,
+          bool is_unit>
+SYCL_BLAS_INLINE typename Tbmv<lhs_t, matrix_t, vector_t, local_range,
+                               is_upper, is_transposed, is_unit>::value_t
+Tbmv<lhs_t, matrix_t, vector_t, local_range, is_upper, is_transposed,
+     is_unit>::eval(cl::sycl::nd_item<1> ndItem) {
+  const index_t lhs_idx =
+      ndItem.get_group(0) * local_range + ndItem.get_local_id(0);
+  value_t val = 0;
+
+  if (lhs_idx < lhs_.get_size_row()) {
+    // Non-zero band of the row lhs_idx of op(A)
+    constexpr bool is_op_upper = is_upper != is_transposed;
+    const index_t k_beg =
+        is_op_upper ? lhs_idx : cl::sycl::max(index_t(0), lhs_idx - k_);
+    const index_t k_end =
+        is_op_upper ? cl::sycl::min(vector_.get_size(), lhs_idx + k_ + 1)
+                    : lhs_idx + 1;
+
+    for (index_t s_idx = k_beg; s_idx < k_end; ++s_idx) {
+      const index_t row = is_transposed ? s_idx : lhs_idx;
+      const index_t col = is_transposed ? lhs_idx : s_idx;
+      const index_t K = (is_upper ? k_ : index_t(0)) + row - col;
+      const value_t a =
+          (is_unit && s_idx == lhs_idx) ? value_t(1) : matrix_.eval(K, col);
+      val = AddOperator::eval(val,
+                              ProductOperator::eval(a, vector_.eval(s_idx)));
+    }
+
+    lhs_.eval(lhs_idx, index_t(0)) = val;
+  }
+  return val;
+}
+
+template <typename lhs_t, typename matrix_t, typename vector_t,
+          uint32_t local_range, bool is_upper, bool is_transposed,
+          bool is_unit>
+SYCL_BLAS_INLINE void
+Tbmv<lhs_t, matrix_t, vector_t, local_range, is_upper, is_transposed,
+     is_unit>::bind(cl::sycl::handler &h) {
+  lhs_.bind(h);
+  matrix_.bind(h);
+  vector_.bind(h);
+}
+
+template <typename lhs_t, typename matrix_t, typename vector_t,
+          uint32_t local_range, bool is_upper, bool is_transposed,
+          bool is_unit>
+SYCL_BLAS_INLINE void
+Tbmv<lhs_t, matrix_t, vector_t, local_range, is_upper, is_transposed,
+     is_unit>::adjust_access_displacement() {
+  lhs_.adjust_access_displacement();
+  matrix_.adjust_access_displacement();
+  vector_.adjust_access_displacement();
+}
+
+}  // namespace blas
+#endif
@@ -0,0 +1,234 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename trsv.hpp
+ *
+ **************************************************************************/
+
+#ifndef TRSV_HPP
+#define TRSV_HPP
+#include "operations/blas2_trees.h"
+#include "operations/blas_operators.hpp"
+#include "views/view_sycl.hpp"
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+namespace blas {
+
+/**
+ * @struct Trsv
+ * @brief Tree node representing a blocked triangular solve.
+ */
+template <typename matrix_t, typename vector_t, uint32_t block_size,
+          bool is_upper, bool is_transposed, bool is_unit, bool is_banded>
+SYCL_BLAS_INLINE Trsv<matrix_t, vector_t, block_size, is_upper, is_transposed,
+                      is_unit, is_banded>::Trsv(matrix_t &_matrix,
+                                                vector_t &_vector, index_t _k)
+    : matrix_(_matrix), vector_(_vector), k_(_k) {}
+
+template <typename matrix_t, typename vector_t, uint32_t block_size,
+          bool is_upper, bool is_transposed, bool is_unit, bool is_banded>
+SYCL_BLAS_INLINE typename Trsv<matrix_t, vector_t, block_size, is_upper,
+                               is_transposed, is_unit, is_banded>::index_t
+Trsv<matrix_t, vector_t, block_size, is_upper, is_transposed, is_unit,
+     is_banded>::get_size() const {
+  return vector_.get_size();
+}
+
+template <typename matrix_t, typename vector_t, uint32_t block_size,
+          bool is_upper, bool is_transposed, bool is_unit, bool is_banded>
+SYCL_BLAS_INLINE typename Trsv<matrix_t, vector_t, block_size, is_upper,
+                               is_transposed, is_unit, is_banded>::index_t
+Trsv<matrix_t, vector_t, block_size, is_upper, is_transposed, is_unit,
+     is_banded>::get_num_blocks() const {
+  return (vector_.get_size() - 1) / index_t(block_size) + 1;
+}
+
+template <typename matrix_t, typename vector_t, uint32_t block_size,
+          bool is_upper, bool is_transposed, bool is_unit, bool is_banded>
+SYCL_BLAS_INLINE bool
+Trsv<matrix_t, vector_t, block_size, is_upper, is_transposed, is_unit,
+     is_banded>::valid_thread(cl::sycl::nd_item<1> ndItem) const {
+  // Valid threads are established by ::eval.
+  return true;
+}
+
+/*!
+ * @brief Element (row, col) of op(matrix_), zero outside of the triangle or
+ * the band. The opposite triangle is never read, as it does not exist in the
+ * packed storage used by _tpsv.
+ */
+template <typename matrix_t, typename vector_t, uint32_t block_size,
+          bool is_upper, bool is_transposed, bool is_unit, bool is_banded>
+SYCL_BLAS_INLINE typename Trsv<matrix_t, vector_t, block_size, is_upper,
+                               is_transposed, is_unit, is_banded>::value_t
+Trsv<matrix_t, vector_t, block_size, is_upper, is_transposed, is_unit,
+     is_banded>::read_op_matrix(index_t row, index_t col) const {
+  const index_t a_row = is_transposed ? col : row;
+  const index_t a_col = is_transposed ? row : col;
+  if (!is_banded) {
+    const bool in_triangle = is_upper ? a_row <= a_col : a_row >= a_col;
+    return in_triangle ? matrix_.eval(a_row, a_col) : value_t{0};
+  }
+  const index_t band = is_upper ? a_col - a_row : a_row - a_col;
+  return (band < 0 || band > k_)
+             ? value_t{0}
+             : matrix_.eval((is_upper ? k_ : index_t(0)) + a_row - a_col,
+                            a_col);
+}
+
+/*!
+ * @brief Rows [first, last) of the block solved at the given step. Lower
+ * triangular systems are solved from the top, upper ones from the bottom.
+ */
+template <typename matrix_t, typename vector_t, uint32_t block_size,
+          bool is_upper, bool is_transposed, bool is_unit, bool is_banded>
+SYCL_BLAS_INLINE void
+Trsv<matrix_t, vector_t, block_size, is_upper, is_transposed, is_unit,
+     is_banded>::get_block_rows(index_t block, index_t &first,
+                                index_t &last) const {
+  constexpr bool is_forward = (is_upper == is_transposed);
+  const index_t size = vector_.get_size();
+  if (is_forward) {
+    first = block * index_t(block_size);
+    last = std::min(size, first + index_t(block_size));
+  } else {
+    last = size - block * index_t(block_size);
+    first = std::max(index_t(0), last - index_t(block_size));
+  }
+}
+
+/*!
+ * @brief Copies a block of op(matrix_) to the padded tile in local memory,
+ * reading consecutive elements of a column of matrix_ with consecutive work
+ * items.
+ */
+template <typename matrix_t, typename vector_t, uint32_t block_size,
+          bool is_upper, bool is_transposed, bool is_unit, bool is_banded>
+template <typename local_ptr_t>
+SYCL_BLAS_INLINE void
+Trsv<matrix_t, vector_t, block_size, is_upper, is_transposed, is_unit,
+     is_banded>::load_tile(local_ptr_t tile, index_t row_first,
+                           index_t row_last, index_t col_first,
+                           index_t col_last, index_t local_id) const {
+  constexpr index_t ld = block_size + 1;
+  for (index_t l = 0; l < index_t(block_size); ++l) {
+    const index_t i = is_transposed ? l : local_id;
+    const index_t j = is_transposed ? local_id : l;
+    const index_t row = row_first + i;
+    const index_t col = col_first + j;
+    tile[i * ld + j] = (row < row_last && col < col_last)
+                           ? read_op_matrix(row, col)
+                           : value_t{0};
+  }
+}
+
+template <typename matrix_t, typename vector_t, uint32_t block_size,
+          bool is_upper, bool is_transposed, bool is_unit, bool is_banded>
+template <typename local_memory_t>
+SYCL_BLAS_INLINE typename Trsv<matrix_t, vector_t, block_size, is_upper,
+                               is_transposed, is_unit, is_banded>::value_t
+Trsv<matrix_t, vector_t, block_size, is_upper, is_transposed, is_unit,
+     is_banded>::eval(local_memory_t local_mem, cl::sycl::nd_item<1> ndItem) {
+  constexpr bool is_forward = (is_upper == is_transposed);
+  constexpr index_t ld = block_size + 1;
+  const index_t local_id = ndItem.get_local_id(0);
+  auto tile = local_mem.localAcc.get_pointer();
+  auto x_block = tile + block_size * ld;
+
+  constexpr index_t bs = block_size;
+  const index_t reach = std::max(index_t(1), (k_ + bs - 1) / bs);
+  const index_t num_blocks = get_num_blocks();
+
+  for (index_t block = 0; block < num_blocks; ++block) {
+    index_t first, last;
+    get_block_rows(block, first, last);
+    const index_t row = first + local_id;
+    value_t x_row = (row < last) ? vector_.eval(row) : value_t{0};
+
+    // Contributions of the solved blocks reached by the band, read back from
+    // vector_ where the previous iterations wrote them
+    const index_t prev_begin = std::max(index_t(0), block - reach);
+    for (index_t prev = prev_begin; prev < block; ++prev) {
+      index_t prev_first, prev_last;
+      get_block_rows(prev, prev_first, prev_last);
+      load_tile(tile, first, last, prev_first, prev_last, local_id);
+      x_block[local_id] = (prev_first + local_id < prev_last)
+                              ? vector_.eval(prev_first + local_id)
+                              : value_t{0};
+      ndItem.barrier(cl::sycl::access::fence_space::local_space);
+      for (index_t j = 0; j < bs; ++j) {
+        x_row -= tile[local_id * ld + j] * x_block[j];
+      }
+      ndItem.barrier(cl::sycl::access::fence_space::local_space);
+    }
+
+    // Substitution on the diagonal block, one column per iteration. The work
+    // item owning a row keeps its solution in x_row, the others update theirs
+    // in local memory.
+    load_tile(tile, first, last, first, last, local_id);
+    x_block[local_id] = x_row;
+    ndItem.barrier(cl::sycl::access::fence_space::local_space);
+    const index_t count = last - first;
+    for (index_t c = 0; c < count; ++c) {
+      const index_t j = is_forward ? c : count - 1 - c;
+      value_t x_j = x_block[j];
+      if (!is_unit) {
+        x_j /= tile[j * ld + j];
+      }
+      if (local_id == j) {
+        x_row = x_j;
+      } else if (local_id < count &&
+                 (is_forward ? local_id > j : local_id < j)) {
+        x_block[local_id] -= tile[local_id * ld + j] * x_j;
+      }
+      ndItem.barrier(cl::sycl::access::fence_space::local_space);
+    }
+
+    if (local_id < count) {
+      vector_.eval(row) = x_row;
+    }
+    // The solved block is read by the following iterations
+    ndItem.barrier(cl::sycl::access::fence_space::global_and_local);
+  }
+  return value_t{0};
+}
+
+template <typename matrix_t, typename vector_t, uint32_t block_size,
+          bool is_upper, bool is_transposed, bool is_unit, bool is_banded>
+SYCL_BLAS_INLINE void
+Trsv<matrix_t, vector_t, block_size, is_upper, is_transposed, is_unit,
+     is_banded>::bind(cl::sycl::handler &h) {
+  matrix_.bind(h);
+  vector_.bind(h);
+}
+
+template <typename matrix_t, typename vector_t, uint32_t block_size,
+          bool is_upper, bool is_transposed, bool is_unit, bool is_banded>
+SYCL_BLAS_INLINE void
+Trsv<matrix_t, vector_t, block_size, is_upper, is_transposed, is_unit,
+     is_banded>::adjust_access_displacement() {
+  matrix_.adjust_access_displacement();
+  vector_.adjust_access_displacement();
+}
+
+}  // namespace blas
+#endif
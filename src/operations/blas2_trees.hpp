@@ -28,6 +28,14 @@
 
 #include "blas2/gbmv.hpp"
 #include "blas2/gemv.hpp"
+#include "blas2/gemv_cpu.hpp"
 #include "blas2/ger.hpp"
+#include "blas2/sbmv.hpp"
+#include "blas2/spmv.hpp"
+#include "blas2/spr.hpp"
+#include "blas2/symv.hpp"
+#include "blas2/tbmv.hpp"
+#include "blas2/tpmv.hpp"
+#include "blas2/trsv.hpp"
 
 #endif  // BLAS2_TREES_HPP
@@ -0,0 +1,348 @@
+/***************************************************************************
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename gemm_cache_blocked.hpp
+ *
+ **************************************************************************/
+
+#ifndef SYCL_BLAS_BLAS3_CACHE_BLOCKED_GEMM_HPP
+#define SYCL_BLAS_BLAS3_CACHE_BLOCKED_GEMM_HPP
+
+#include "gemm_common.hpp"
+#include "gemm_load_store.hpp"
+
+namespace blas {
+
+/*!
+ * @brief Cache blocked GEMM for CPU devices.
+ *
+ * Each work group has a single work item, which maps to one thread of the
+ * CPU, and the kernel is launched with at most one work group per compute
+ * unit. Every work item walks over the block-level tiles of C with a stride of
+ * the number of work groups. For each tile, panels of A and B of depth
+ * ClSize / sizeof(element_t) are packed into local memory, so that the
+ * micro-kernel reads both operands contiguously, and the micro-kernel keeps an
+ * item_rows x item_cols tile of C in vector registers.
+ *
+ * @tparam ClSize  the size in bytes of the rows of the packed panels, i.e. the
+ *                 depth of the panels is ClSize / sizeof(element_t)
+ * @tparam TileType  item_rows x item_cols is the size of the register tile of
+ *                   the micro-kernel, wg_rows x wg_cols is the number of
+ *                   register tiles in a packed block of C. The other members
+ *                   are ignored
+ * @tparam TransA  iff true, matrix A will be transposed on the fly
+ * @tparam TransB  iff true, matrix B will be transposed on the fly
+ * @tparam element_t  type of matrix elements
+ * @tparam is_beta_zero True if beta == 0.
+ * @tparam VectorSize The packet size of the micro-kernel registers.
+ */
+template <typename input_t, typename output_t, bool DoubleBuffer, bool NbcA,
+          bool NbcB, int ClSize, typename tile_type, bool TransA, bool TransB,
+          typename element_t, bool is_beta_zero, int VectorSize>
+class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
+           TransA, TransB, element_t, is_beta_zero,
+           static_cast<int>(gemm_memory_t::local),
+           static_cast<int>(gemm_algorithm_t::cache_blocked),
+           static_cast<int>(gemm_vectorization_t::full), VectorSize,
+           static_cast<int>(gemm_batch_type_t::strided), false> {
+ public:
+  using value_t = element_t;
+  using index_t = typename std::make_signed<typename input_t::index_t>::type;
+  using address_t = cl::sycl::access::address_space;
+  using packetize_t = Packetize<VectorSize, value_t, index_t>;
+  using vector_t = typename packetize_t::PacketType;
+  /*! @brief The number of elements in a vector register */
+  static constexpr index_t packet_size = packetize_t::packet_size;
+  /*! @brief The number of rows of the register tile */
+  static constexpr index_t item_rows = tile_type::item_rows;
+  /*! @brief The number of columns of the register tile */
+  static constexpr index_t item_cols = tile_type::item_cols;
+  /*! @brief The number of vector registers in a column of the register tile */
+  static constexpr index_t item_packets = item_rows / packet_size;
+  /*! @brief Number of rows of a packed block */
+  static constexpr index_t block_rows = tile_type::wg_rows * item_rows;
+  /*! @brief Number of columns of a packed block */
+  static constexpr index_t block_cols = tile_type::wg_cols * item_cols;
+  /*! @brief Depth of the packed panels of A and B */
+  static constexpr index_t block_depth = ClSize / sizeof(element_t);
+  /*! @brief One work item per work group, i.e. one per CPU thread */
+  static constexpr index_t wg_size = 1;
+  static constexpr bool trans_a = TransA;
+  static constexpr bool trans_b = TransB;
+  /*! @brief Size (in elements) of the packed panels of A and B */
+  static constexpr index_t local_memory_size =
+      block_depth * (block_rows + block_cols);
+
+  static_assert(item_rows % packet_size == 0,
+                "Item rows must be a multiple of the vector packet size");
+  static_assert(block_depth > 0,
+                "ClSize must hold at least one element of the panels");
+
+  input_t a_;
+  input_t b_;
+  output_t c_;
+  const element_t alpha_;
+  const element_t beta_;
+  index_t batch_size_;
+
+  SYCL_BLAS_INLINE Gemm(input_t A, input_t B, output_t C, element_t alpha,
+                        element_t beta, index_t batch_size)
+      : a_(A),
+        b_(B),
+        c_(C),
+        alpha_(alpha),
+        beta_(beta),
+        batch_size_(batch_size) {}
+
+  /*!
+   * @brief Get the type of this Gemm as a human readable string.
+   */
+  static SYCL_BLAS_INLINE std::string get_type_string() noexcept {
+    std::ostringstream str{};
+    str << "Gemm <" << ClSize << ", " << tile_type::get_type_string() << ", "
+        << type_string<value_t>::get_value() << "gemm_memory:local, "
+        << "gemm_algorithm:cache_blocked, "
+        << "gemm_vectorization:full, "
+        << "vector size" << VectorSize << ", batch_type:strided>";
+    return str.str();
+  }
+
+  /*!
+   * @brief Number of packed blocks of C in one batch.
+   */
+  SYCL_BLAS_INLINE index_t get_workgroup_cluster() const noexcept {
+    return (((a_.get_size_row() - 1) / block_rows + 1) *
+            ((b_.get_size_col() - 1) / block_cols + 1));
+  }
+
+  /*!
+   * @brief One work group per compute unit, unless there are fewer blocks.
+   */
+  SYCL_BLAS_INLINE cl::sycl::nd_range<1> get_nd_range(
+      index_t compute_units) const noexcept {
+    const index_t blocks = get_workgroup_cluster() * batch_size_;
+    const cl::sycl::range<1> nwg(
+        std::max(index_t(1), std::min(compute_units, blocks)));
+    const cl::sycl::range<1> wgs(wg_size);
+    return cl::sycl::nd_range<1>(nwg * wgs, wgs);
+  }
+
+  SYCL_BLAS_INLINE index_t get_size() const {
+    return a_.get_size_row() * b_.get_size_col();
+  }
+
+  SYCL_BLAS_INLINE bool valid_thread(const cl::sycl::nd_item<1> &) const {
+    return true;
+  }
+
+  template <typename local_memory_t>
+  SYCL_BLAS_INLINE void eval(local_memory_t scratch_acc,
+                             const cl::sycl::nd_item<1> &id) noexcept {
+    const index_t m = a_.get_size_row();
+    const index_t n = b_.get_size_col();
+    const index_t k = a_.get_size_col();
+    const index_t lda = a_.getSizeL();
+    const index_t ldb = b_.getSizeL();
+    const index_t ldc = c_.getSizeL();
+
+    const index_t a_size = trans_a ? m * lda : k * lda;
+    const index_t b_size = trans_b ? ldb * k : n * ldb;
+    const index_t c_size = ldc * n;
+
+    auto packed_a = scratch_acc.localAcc.get_pointer();
+    auto packed_b = packed_a + block_rows * block_depth;
+
+    const index_t blocks_per_col = (m - 1) / block_rows + 1;
+    const index_t blocks = get_workgroup_cluster();
+    for (index_t block = id.get_group(0); block < blocks * batch_size_;
+         block += id.get_group_range(0)) {
+      const index_t batch = block / blocks;
+      const index_t row = (block % blocks % blocks_per_col) * block_rows;
+      const index_t col = (block % blocks / blocks_per_col) * block_cols;
+      const index_t mc = cl::sycl::min(block_rows, m - row);
+      const index_t nc = cl::sycl::min(block_cols, n - col);
+
+      auto ptr_A = a_.get_pointer() + batch * a_size;
+      auto ptr_B = b_.get_pointer() + batch * b_size;
+      auto ptr_C = c_.get_pointer() + batch * c_size + row + col * ldc;
+
+      // The first panel also applies beta, so it runs even when k is zero
+      for (index_t depth = 0; depth == 0 || depth < k;
+           depth += block_depth) {
+        const index_t kc = cl::sycl::min(block_depth, k - depth);
+        pack_a(ptr_A, lda, row, depth, mc, kc, packed_a);
+        pack_b(ptr_B, ldb, depth, col, kc, nc, packed_b);
+        for (index_t j = 0; j < nc; j += item_cols) {
+          for (index_t i = 0; i < mc; i += item_rows) {
+            compute_tile(packed_a + i * block_depth, packed_b + j * block_depth,
+                         kc, ptr_C + i + j * ldc, ldc,
+                         cl::sycl::min(item_rows, mc - i),
+                         cl::sycl::min(item_cols, nc - j), depth == 0);
+          }
+        }
+      }
+    }
+  }
+
+  void bind(cl::sycl::handler &h) {
+    a_.bind(h);
+    b_.bind(h);
+    c_.bind(h);
+  }
+  void adjust_access_displacement() {
+    a_.adjust_access_displacement();
+    b_.adjust_access_displacement();
+    c_.adjust_access_displacement();
+  }
+
+ private:
+  /*!
+   * @brief Packs the mc x kc block of A starting at (row, depth) into panels of
+   * item_rows rows. Element (i, p) of a panel is stored at p * item_rows + i,
+   * and the rows past mc are padded with zeros.
+   */
+  template <typename InputPointerType, typename ScratchPointerType>
+  SYCL_BLAS_INLINE void pack_a(InputPointerType A, const index_t &lda,
+                               const index_t &row, const index_t &depth,
+                               const index_t &mc, const index_t &kc,
+                               ScratchPointerType packed) const noexcept {
+    for (index_t i = 0; i < mc; i += item_rows) {
+      auto panel = packed + i * block_depth;
+      for (index_t p = 0; p < kc; ++p) {
+#pragma unroll
+        for (index_t r = 0; r < item_rows; ++r) {
+          const index_t a_row = row + i + r;
+          const index_t a_col = depth + p;
+          panel[p * item_rows + r] =
+              (i + r < mc) ? A[trans_a ? a_col + a_row * lda
+                                       : a_row + a_col * lda]
+                           : element_t{0};
+        }
+      }
+    }
+  }
+
+  /*!
+   * @brief Packs the kc x nc block of B starting at (depth, col) into panels of
+   * item_cols columns. Element (p, j) of a panel is stored at
+   * p * item_cols + j, and the columns past nc are padded with zeros.
+   */
+  template <typename InputPointerType, typename ScratchPointerType>
+  SYCL_BLAS_INLINE void pack_b(InputPointerType B, const index_t &ldb,
+                               const index_t &depth, const index_t &col,
+                               const index_t &kc, const index_t &nc,
+                               ScratchPointerType packed) const noexcept {
+    for (index_t j = 0; j < nc; j += item_cols) {
+      auto panel = packed + j * block_depth;
+      for (index_t p = 0; p < kc; ++p) {
+#pragma unroll
+        for (index_t c = 0; c < item_cols; ++c) {
+          const index_t b_row = depth + p;
+          const index_t b_col = col + j + c;
+          panel[p * item_cols + c] =
+              (j + c < nc) ? B[trans_b ? b_col + b_row * ldb
+                                       : b_row + b_col * ldb]
+                           : element_t{0};
+        }
+      }
+    }
+  }
+
+  /*!
+   * @brief Micro-kernel: multiplies a packed panel of A by a packed panel of
+   * B in registers and accumulates the result into C. On the first panel C is
+   * scaled by beta, on the next ones the result is added to C.
+   */
+  template <typename ScratchPointerType, typename OutputPointerType>
+  SYCL_BLAS_INLINE void compute_tile(ScratchPointerType panel_a,
+                                     ScratchPointerType panel_b,
+                                     const index_t &kc, OutputPointerType C,
+                                     const index_t &ldc, const index_t &mr,
+                                     const index_t &nr,
+                                     const bool first) const noexcept {
+    vector_t reg_res[item_cols][item_packets];
+#pragma unroll
+    for (index_t c = 0; c < item_cols; ++c) {
+#pragma unroll
+      for (index_t v = 0; v < item_packets; ++v) {
+        reg_res[c][v] = vector_t(element_t{0});
+      }
+    }
+
+    for (index_t p = 0; p < kc; ++p) {
+      vector_t reg_a[item_packets];
+#pragma unroll
+      for (index_t v = 0; v < item_packets; ++v) {
+        reg_a[v].template load<address_t::local_space>(
+            0, cl::sycl::multi_ptr<const element_t, address_t::local_space>(
+                   panel_a + p * item_rows + v * packet_size));
+      }
+#pragma unroll
+      for (index_t c = 0; c < item_cols; ++c) {
+        const vector_t reg_b(panel_b[p * item_cols + c]);
+#pragma unroll
+        for (index_t v = 0; v < item_packets; ++v) {
+          reg_res[c][v] += reg_a[v] * reg_b;
+        }
+      }
+    }
+
+    const bool scale_c = first && !is_beta_zero;
+    const bool add_c = !first;
+    if (mr == item_rows) {
+      for (index_t c = 0; c < nr; ++c) {
+#pragma unroll
+        for (index_t v = 0; v < item_packets; ++v) {
+          auto out_ptr = C + c * ldc + v * packet_size;
+          vector_t out = reg_res[c][v] * vector_t(alpha_);
+          if (scale_c || add_c) {
+            vector_t reg_c;
+            reg_c.template load<address_t::global_space>(
+                0, cl::sycl::multi_ptr<const element_t,
+                                       address_t::global_space>(out_ptr));
+            out += add_c ? reg_c : reg_c * vector_t(beta_);
+          }
+          out.template store<address_t::global_space>(
+              0, cl::sycl::multi_ptr<element_t, address_t::global_space>(
+                     out_ptr));
+        }
+      }
+    } else {
+      for (index_t c = 0; c < nr; ++c) {
+        element_t reg_out[item_rows];
+#pragma unroll
+        for (index_t v = 0; v < item_packets; ++v) {
+          reg_res[c][v].template store<address_t::private_space>(
+              0, cl::sycl::multi_ptr<element_t, address_t::private_space>(
+                     reg_out + v * packet_size));
+        }
+        for (index_t r = 0; r < mr; ++r) {
+          const element_t res = alpha_ * reg_out[r];
+          auto &out = C[r + c * ldc];
+          out = add_c ? out + res : scale_c ? res + beta_ * out : res;
+        }
+      }
+    }
+  }
+};
+
+}  // namespace blas
+
+#endif  // SYCL_BLAS_BLAS3_CACHE_BLOCKED_GEMM_HPP
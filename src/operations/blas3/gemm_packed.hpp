@@ -0,0 +1,219 @@
+/***************************************************************************
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename gemm_packed.hpp
+ *
+ **************************************************************************/
+
+
+#ifndef SYCL_BLAS_BLAS3_GEMM_PACKED_HPP
+#define SYCL_BLAS_BLAS3_GEMM_PACKED_HPP
+
+#include "operations/blas3_trees.h"
+#include "views/view.h"
+
+#include <CL/sycl.hpp>
+
+namespace blas {
+
+template <int PanelCols, bool TransB, typename input_t, typename output_t>
+SYCL_BLAS_INLINE GemmPackB<PanelCols, TransB, input_t, output_t>::GemmPackB(
+    input_t B, output_t packed, index_t k, index_t n)
+    : b_(B), packed_(packed), k_(k), n_(n) {}
+
+template <int PanelCols, bool TransB, typename input_t, typename output_t>
+SYCL_BLAS_INLINE
+    typename GemmPackB<PanelCols, TransB, input_t, output_t>::index_t
+    GemmPackB<PanelCols, TransB, input_t, output_t>::get_packed_size(
+        index_t k, index_t n) {
+  return ((n - 1) / panel_cols + 1) * panel_cols * k;
+}
+
+template <int PanelCols, bool TransB, typename input_t, typename output_t>
+SYCL_BLAS_INLINE
+    typename GemmPackB<PanelCols, TransB, input_t, output_t>::index_t
+    GemmPackB<PanelCols, TransB, input_t, output_t>::get_size() const {
+  return get_packed_size(k_, n_);
+}
+
+template <int PanelCols, bool TransB, typename input_t, typename output_t>
+SYCL_BLAS_INLINE bool
+GemmPackB<PanelCols, TransB, input_t, output_t>::valid_thread(
+    cl::sycl::nd_item<1> id) const {
+  return static_cast<index_t>(id.get_global_id(0)) < get_size();
+}
+
+template <int PanelCols, bool TransB, typename input_t, typename output_t>
+SYCL_BLAS_INLINE void GemmPackB<PanelCols, TransB, input_t, output_t>::eval(
+    cl::sycl::nd_item<1> id) noexcept {
+  const index_t idx = id.get_global_id(0);
+  const index_t panel_size = k_ * panel_cols;
+  const index_t k = (idx % panel_size) / panel_cols;
+  const index_t col = (idx / panel_size) * panel_cols + idx % panel_cols;
+  const index_t ldb = b_.getSizeL();
+  auto B = b_.get_pointer();
+  packed_.get_pointer()[idx] =
+      col < n_ ? B[TransB ? col + k * ldb : k + col * ldb] : value_t{0};
+}
+
+template <int PanelCols, bool TransB, typename input_t, typename output_t>
+SYCL_BLAS_INLINE void GemmPackB<PanelCols, TransB, input_t, output_t>::bind(
+    cl::sycl::handler& h) {
+  b_.bind(h);
+  packed_.bind(h);
+}
+
+template <int PanelCols, bool TransB, typename input_t, typename output_t>
+SYCL_BLAS_INLINE void GemmPackB<PanelCols, TransB, input_t,
+                                output_t>::adjust_access_displacement() {
+  b_.adjust_access_displacement();
+  packed_.adjust_access_displacement();
+}
+
+template <int ItemRows, int PanelCols, bool TransA, typename input_t,
+          typename output_t>
+SYCL_BLAS_INLINE
+GemmPacked<ItemRows, PanelCols, TransA, input_t, output_t>::GemmPacked(
+    input_t A, input_t packed_B, output_t C, value_t alpha, value_t beta,
+    index_t wg_rows, index_t wg_cols)
+    : a_(A),
+      packed_b_(packed_B),
+      c_(C),
+      alpha_(alpha),
+      beta_(beta),
+      wg_rows_(wg_rows),
+      wg_cols_(wg_cols) {}
+
+template <int ItemRows, int PanelCols, bool TransA, typename input_t,
+          typename output_t>
+SYCL_BLAS_INLINE cl::sycl::nd_range<1>
+GemmPacked<ItemRows, PanelCols, TransA, input_t, output_t>::get_nd_range()
+    const {
+  const index_t tiles_m =
+      (c_.get_size_row() - 1) / (item_rows * wg_rows_) + 1;
+  const index_t tiles_n =
+      (c_.get_size_col() - 1) / (panel_cols * wg_cols_) + 1;
+  const size_t local_size = wg_rows_ * wg_cols_;
+  const size_t num_groups = tiles_m * tiles_n;
+  return cl::sycl::nd_range<1>(cl::sycl::range<1>(num_groups * local_size),
+                               cl::sycl::range<1>(local_size));
+}
+
+template <int ItemRows, int PanelCols, bool TransA, typename input_t,
+          typename output_t>
+SYCL_BLAS_INLINE bool
+GemmPacked<ItemRows, PanelCols, TransA, input_t, output_t>::valid_thread(
+    cl::sycl::nd_item<1>) const {
+  return true;
+}
+
+template <int ItemRows, int PanelCols, bool TransA, typename input_t,
+          typename output_t>
+SYCL_BLAS_INLINE void
+GemmPacked<ItemRows, PanelCols, TransA, input_t, output_t>::eval(
+    cl::sycl::nd_item<1> id) noexcept {
+  using address_t = cl::sycl::access::address_space;
+  using packet_t = cl::sycl::vec<value_t, PanelCols>;
+
+  const index_t m = c_.get_size_row();
+  const index_t n = c_.get_size_col();
+  const index_t k = a_.get_size_col();
+  const index_t lda = a_.getSizeL();
+  const index_t ldc = c_.getSizeL();
+
+  const index_t tiles_m = (m - 1) / (item_rows * wg_rows_) + 1;
+  const index_t tile = id.get_group(0);
+  const index_t local_id = id.get_local_id(0);
+  const index_t row0 =
+      (tile % tiles_m) * item_rows * wg_rows_ + local_id % wg_rows_;
+  const index_t panel = (tile / tiles_m) * wg_cols_ + local_id / wg_rows_;
+  const index_t col0 = panel * panel_cols;
+  if (col0 >= n) {
+    return;
+  }
+
+  auto A = a_.get_pointer();
+  auto B = packed_b_.get_pointer() + panel * k * panel_cols;
+  auto C = c_.get_pointer();
+
+  packet_t reg_res[item_rows];
+#pragma unroll
+  for (index_t i = 0; i < item_rows; ++i) {
+    reg_res[i] = packet_t(value_t{0});
+  }
+  for (index_t p = 0; p < k; ++p) {
+    // The panels are padded, so the row of the panel is always complete
+    packet_t reg_b;
+    reg_b.template load<address_t::global_space>(
+        0, cl::sycl::multi_ptr<const value_t, address_t::global_space>(
+               B + p * panel_cols));
+#pragma unroll
+    for (index_t i = 0; i < item_rows; ++i) {
+      const index_t row = row0 + i * wg_rows_;
+      const value_t a =
+          row < m ? A[TransA ? p + row * lda : row + p * lda] : value_t{0};
+      reg_res[i] += packet_t(a) * reg_b;
+    }
+  }
+
+#pragma unroll
+  for (index_t i = 0; i < item_rows; ++i) {
+    const index_t row = row0 + i * wg_rows_;
+    if (row < m) {
+      value_t res[panel_cols];
+      reg_res[i].template store<address_t::private_space>(
+          0, cl::sycl::multi_ptr<value_t, address_t::private_space>(res));
+#pragma unroll
+      for (index_t j = 0; j < panel_cols; ++j) {
+        const index_t col = col0 + j;
+        if (col < n) {
+          // when C is uninitialized the element of the C can be NaN, and
+          // Nan*0 will be NaN
+          auto& out = C[row + col * ldc];
+          out = beta_ == value_t{0} ? alpha_ * res[j]
+                                    : alpha_ * res[j] + beta_ * out;
+        }
+      }
+    }
+  }
+}
+
+template <int ItemRows, int PanelCols, bool TransA, typename input_t,
+          typename output_t>
+SYCL_BLAS_INLINE void
+GemmPacked<ItemRows, PanelCols, TransA, input_t, output_t>::bind(
+    cl::sycl::handler& h) {
+  a_.bind(h);
+  packed_b_.bind(h);
+  c_.bind(h);
+}
+
+template <int ItemRows, int PanelCols, bool TransA, typename input_t,
+          typename output_t>
+SYCL_BLAS_INLINE void GemmPacked<ItemRows, PanelCols, TransA, input_t,
+                                 output_t>::adjust_access_displacement() {
+  a_.adjust_access_displacement();
+  packed_b_.adjust_access_displacement();
+  c_.adjust_access_displacement();
+}
+
+}  // namespace blas
+
+#endif  // SYCL_BLAS_BLAS3_GEMM_PACKED_HPP
@@ -0,0 +1,327 @@
+/***************************************************************************
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename gemm_specialized.hpp
+ *
+ **************************************************************************/
+
+#ifndef SYCL_BLAS_BLAS3_GEMM_SPECIALIZED_HPP
+#define SYCL_BLAS_BLAS3_GEMM_SPECIALIZED_HPP
+
+#include "operations/blas3_trees.h"
+#include "views/view.h"
+
+#include <CL/sycl.hpp>
+#include <cstdint>
+
+namespace blas {
+
+#if SYCL_BLAS_SPEC_CONSTANTS
+/*!
+ * @brief Specialization constant identifiers of the GemmSpecParams fields.
+ * Sizes are held as 64 bit integers whatever the index type.
+ */
+namespace gemm_spec {
+constexpr cl::sycl::specialization_id<std::int64_t> m;
+constexpr cl::sycl::specialization_id<std::int64_t> n;
+constexpr cl::sycl::specialization_id<std::int64_t> k;
+constexpr cl::sycl::specialization_id<std::int64_t> lda;
+constexpr cl::sycl::specialization_id<std::int64_t> ldb;
+constexpr cl::sycl::specialization_id<std::int64_t> ldc;
+constexpr cl::sycl::specialization_id<std::int64_t> wg_rows;
+constexpr cl::sycl::specialization_id<std::int64_t> wg_cols;
+constexpr cl::sycl::specialization_id<bool> alpha_one;
+constexpr cl::sycl::specialization_id<bool> beta_zero;
+}  // namespace gemm_spec
+#endif
+
+template <int ItemRows, int ItemCols, bool TransA, bool TransB,
+          typename input_t, typename output_t>
+SYCL_BLAS_INLINE
+GemmSpecialized<ItemRows, ItemCols, TransA, TransB, input_t, output_t>::
+    GemmSpecialized(input_t A, input_t B, output_t C, value_t alpha,
+                    value_t beta, index_t batch_size, index_t wg_rows,
+                    index_t wg_cols)
+    : a_(A),
+      b_(B),
+      c_(C),
+      alpha_(alpha),
+      beta_(beta),
+      batch_size_(batch_size),
+      params_{a_.get_size_row(),
+              b_.get_size_col(),
+              a_.get_size_col(),
+              a_.getSizeL(),
+              b_.getSizeL(),
+              c_.getSizeL(),
+              wg_rows,
+              wg_cols,
+              alpha == value_t{1},
+              beta == value_t{0}} {}
+
+template <int ItemRows, int ItemCols, bool TransA, bool TransB,
+          typename input_t, typename output_t>
+SYCL_BLAS_INLINE typename GemmSpecialized<ItemRows, ItemCols, TransA, TransB,
+                                          input_t, output_t>::index_t
+GemmSpecialized<ItemRows, ItemCols, TransA, TransB, input_t,
+                output_t>::get_num_tiles(const params_t& params) {
+  const index_t tile_rows = item_rows * params.wg_rows;
+  const index_t tile_cols = item_cols * params.wg_cols;
+  return ((params.m - 1) / tile_rows + 1) * ((params.n - 1) / tile_cols + 1);
+}
+
+template <int ItemRows, int ItemCols, bool TransA, bool TransB,
+          typename input_t, typename output_t>
+SYCL_BLAS_INLINE typename GemmSpecialized<ItemRows, ItemCols, TransA, TransB,
+                                          input_t, output_t>::index_t
+GemmSpecialized<ItemRows, ItemCols, TransA, TransB, input_t, output_t>::
+    get_local_memory_size(const params_t& params) {
+  return block_depth *
+         (item_rows * params.wg_rows + item_cols * params.wg_cols);
+}
+
+template <int ItemRows, int ItemCols, bool TransA, bool TransB,
+          typename input_t, typename output_t>
+SYCL_BLAS_INLINE cl::sycl::nd_range<1>
+GemmSpecialized<ItemRows, ItemCols, TransA, TransB, input_t,
+                output_t>::get_nd_range() const {
+  const size_t local_size = params_.wg_rows * params_.wg_cols;
+  const size_t num_groups = get_num_tiles(params_) * batch_size_;
+  return cl::sycl::nd_range<1>(cl::sycl::range<1>(num_groups * local_size),
+                               cl::sycl::range<1>(local_size));
+}
+
+template <int ItemRows, int ItemCols, bool TransA, bool TransB,
+          typename input_t, typename output_t>
+SYCL_BLAS_INLINE typename GemmSpecialized<ItemRows, ItemCols, TransA, TransB,
+                                          input_t, output_t>::index_t
+GemmSpecialized<ItemRows, ItemCols, TransA, TransB, input_t,
+                output_t>::get_local_memory_size() const {
+  return get_local_memory_size(params_);
+}
+
+template <int ItemRows, int ItemCols, bool TransA, bool TransB,
+          typename input_t, typename output_t>
+SYCL_BLAS_INLINE bool
+GemmSpecialized<ItemRows, ItemCols, TransA, TransB, input_t,
+                output_t>::valid_thread(cl::sycl::nd_item<1>) const {
+  return true;
+}
+
+/*!
+ * @brief Computes the item_rows x item_cols elements of C of a work item.
+ *
+ * The tile of op(A) is kept column major in local memory and the tile of
+ * op(B) row major, so that at each step k the work items of a work group read
+ * consecutive elements of op(A) and broadcast elements of op(B). The loads
+ * walk the global matrices along their leading dimension.
+ */
+template <int ItemRows, int ItemCols, bool TransA, bool TransB,
+          typename input_t, typename output_t>
+template <typename local_memory_t>
+SYCL_BLAS_INLINE void
+GemmSpecialized<ItemRows, ItemCols, TransA, TransB, input_t, output_t>::eval(
+    local_memory_t local_mem, cl::sycl::nd_item<1> id,
+    const params_t& p) noexcept {
+  const index_t num_tiles = get_num_tiles(p);
+  const index_t batch = id.get_group(0) / num_tiles;
+  const index_t tile = id.get_group(0) % num_tiles;
+  const index_t tile_rows = item_rows * p.wg_rows;
+  const index_t tile_cols = item_cols * p.wg_cols;
+  const index_t tiles_m = (p.m - 1) / tile_rows + 1;
+  const index_t tile_row0 = (tile % tiles_m) * tile_rows;
+  const index_t tile_col0 = (tile / tiles_m) * tile_cols;
+
+  const index_t local_id = id.get_local_id(0);
+  const index_t local_size = p.wg_rows * p.wg_cols;
+  const index_t item_row0 = local_id % p.wg_rows;
+  const index_t item_col0 = local_id / p.wg_rows;
+
+  const index_t a_size = TransA ? p.m * p.lda : p.k * p.lda;
+  const index_t b_size = TransB ? p.k * p.ldb : p.n * p.ldb;
+  const index_t c_size = p.n * p.ldc;
+  auto A = a_.get_pointer() + batch * a_size;
+  auto B = b_.get_pointer() + batch * b_size;
+  auto C = c_.get_pointer() + batch * c_size;
+
+  // tile_rows x block_depth column major, then block_depth x tile_cols row
+  // major
+  value_t* local_a = local_mem.localAcc.get_pointer();
+  value_t* local_b = local_a + tile_rows * block_depth;
+
+  value_t reg_res[item_rows][item_cols] = {};
+  for (index_t k0 = 0; k0 < p.k; k0 += block_depth) {
+    for (index_t l = local_id; l < tile_rows * block_depth; l += local_size) {
+      // Consecutive work items follow the leading dimension of A
+      const index_t r = TransA ? l / block_depth : l % tile_rows;
+      const index_t kk = TransA ? l % block_depth : l / tile_rows;
+      const index_t row = tile_row0 + r;
+      const index_t k = k0 + kk;
+      local_a[r + kk * tile_rows] =
+          (row < p.m && k < p.k)
+              ? A[TransA ? k + row * p.lda : row + k * p.lda]
+              : value_t{0};
+    }
+    for (index_t l = local_id; l < tile_cols * block_depth; l += local_size) {
+      // Consecutive work items follow the leading dimension of B
+      const index_t c = TransB ? l % tile_cols : l / block_depth;
+      const index_t kk = TransB ? l / tile_cols : l % block_depth;
+      const index_t col = tile_col0 + c;
+      const index_t k = k0 + kk;
+      local_b[c + kk * tile_cols] =
+          (col < p.n && k < p.k)
+              ? B[TransB ? col + k * p.ldb : k + col * p.ldb]
+              : value_t{0};
+    }
+    id.barrier(cl::sycl::access::fence_space::local_space);
+
+#pragma unroll
+    for (index_t kk = 0; kk < block_depth; ++kk) {
+      value_t reg_a[item_rows];
+      value_t reg_b[item_cols];
+#pragma unroll
+      for (index_t i = 0; i < item_rows; ++i) {
+        reg_a[i] = local_a[item_row0 + i * p.wg_rows + kk * tile_rows];
+      }
+#pragma unroll
+      for (index_t j = 0; j < item_cols; ++j) {
+        reg_b[j] = local_b[item_col0 + j * p.wg_cols + kk * tile_cols];
+      }
+#pragma unroll
+      for (index_t j = 0; j < item_cols; ++j) {
+#pragma unroll
+        for (index_t i = 0; i < item_rows; ++i) {
+          reg_res[i][j] = cl::sycl::mad(reg_a[i], reg_b[j], reg_res[i][j]);
+        }
+      }
+    }
+    // The tiles are overwritten by the next block
+    id.barrier(cl::sycl::access::fence_space::local_space);
+  }
+
+#pragma unroll
+  for (index_t j = 0; j < item_cols; ++j) {
+    const index_t col = tile_col0 + item_col0 + j * p.wg_cols;
+#pragma unroll
+    for (index_t i = 0; i < item_rows; ++i) {
+      const index_t row = tile_row0 + item_row0 + i * p.wg_rows;
+      if (row < p.m && col < p.n) {
+        const value_t res =
+            p.alpha_one ? reg_res[i][j] : alpha_ * reg_res[i][j];
+        // when C is uninitialized the element of the C can be NaN, and Nan*0
+        // will be NaN
+        C[row + col * p.ldc] =
+            p.beta_zero ? res : res + beta_ * C[row + col * p.ldc];
+      }
+    }
+  }
+}
+
+template <int ItemRows, int ItemCols, bool TransA, bool TransB,
+          typename input_t, typename output_t>
+template <typename local_memory_t>
+SYCL_BLAS_INLINE void
+GemmSpecialized<ItemRows, ItemCols, TransA, TransB, input_t, output_t>::eval(
+    local_memory_t local_mem, cl::sycl::nd_item<1> id) noexcept {
+  eval(local_mem, id, params_);
+}
+
+template <int ItemRows, int ItemCols, bool TransA, bool TransB,
+          typename input_t, typename output_t>
+SYCL_BLAS_INLINE void GemmSpecialized<ItemRows, ItemCols, TransA, TransB,
+                                      input_t, output_t>::
+    set_spec_constants(cl::sycl::handler& h) const {
+#if SYCL_BLAS_SPEC_CONSTANTS
+  h.template set_specialization_constant<gemm_spec::m>(params_.m);
+  h.template set_specialization_constant<gemm_spec::n>(params_.n);
+  h.template set_specialization_constant<gemm_spec::k>(params_.k);
+  h.template set_specialization_constant<gemm_spec::lda>(params_.lda);
+  h.template set_specialization_constant<gemm_spec::ldb>(params_.ldb);
+  h.template set_specialization_constant<gemm_spec::ldc>(params_.ldc);
+  h.template set_specialization_constant<gemm_spec::wg_rows>(params_.wg_rows);
+  h.template set_specialization_constant<gemm_spec::wg_cols>(params_.wg_cols);
+  h.template set_specialization_constant<gemm_spec::alpha_one>(
+      params_.alpha_one);
+  h.template set_specialization_constant<gemm_spec::beta_zero>(
+      params_.beta_zero);
+#endif
+}
+
+template <int ItemRows, int ItemCols, bool TransA, bool TransB,
+          typename input_t, typename output_t>
+SYCL_BLAS_INLINE void
+GemmSpecialized<ItemRows, ItemCols, TransA, TransB, input_t, output_t>::bind(
+    cl::sycl::handler& h) {
+  a_.bind(h);
+  b_.bind(h);
+  c_.bind(h);
+}
+
+template <int ItemRows, int ItemCols, bool TransA, bool TransB,
+          typename input_t, typename output_t>
+SYCL_BLAS_INLINE void GemmSpecialized<ItemRows, ItemCols, TransA, TransB,
+                                      input_t,
+                                      output_t>::adjust_access_displacement() {
+  a_.adjust_access_displacement();
+  b_.adjust_access_displacement();
+  c_.adjust_access_displacement();
+}
+
+template <typename gemm_t, typename local_memory_t>
+struct GemmSpecializedFunctor {
+  using index_t = typename gemm_t::index_t;
+  gemm_t t_;
+  local_memory_t local_mem_;
+  SYCL_BLAS_INLINE GemmSpecializedFunctor(gemm_t t, local_memory_t local_mem)
+      : t_(t), local_mem_(local_mem) {}
+#if SYCL_BLAS_SPEC_CONSTANTS
+  SYCL_BLAS_INLINE void operator()(cl::sycl::nd_item<1> id,
+                                   cl::sycl::kernel_handler kh) const {
+    typename gemm_t::params_t params;
+    params.m = kh.template get_specialization_constant<gemm_spec::m>();
+    params.n = kh.template get_specialization_constant<gemm_spec::n>();
+    params.k = kh.template get_specialization_constant<gemm_spec::k>();
+    params.lda = kh.template get_specialization_constant<gemm_spec::lda>();
+    params.ldb = kh.template get_specialization_constant<gemm_spec::ldb>();
+    params.ldc = kh.template get_specialization_constant<gemm_spec::ldc>();
+    params.wg_rows =
+        kh.template get_specialization_constant<gemm_spec::wg_rows>();
+    params.wg_cols =
+        kh.template get_specialization_constant<gemm_spec::wg_cols>();
+    params.alpha_one =
+        kh.template get_specialization_constant<gemm_spec::alpha_one>();
+    params.beta_zero =
+        kh.template get_specialization_constant<gemm_spec::beta_zero>();
+    gemm_t& non_const_t = *const_cast<gemm_t*>(&t_);
+    non_const_t.adjust_access_displacement();
+    non_const_t.eval(local_mem_, id, params);
+  }
+#else
+  SYCL_BLAS_INLINE void operator()(cl::sycl::nd_item<1> id) const {
+    gemm_t& non_const_t = *const_cast<gemm_t*>(&t_);
+    non_const_t.adjust_access_displacement();
+    non_const_t.eval(local_mem_, id);
+  }
+#endif
+};
+
+}  // namespace blas
+
+#endif  // SYCL_BLAS_BLAS3_GEMM_SPECIALIZED_HPP
@@ -0,0 +1,97 @@
+/***************************************************************************
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename syrk.hpp
+ *
+ **************************************************************************/
+
+#ifndef SYCL_BLAS_BLAS3_SYRK_HPP
+#define SYCL_BLAS_BLAS3_SYRK_HPP
+
+#include "operations/blas3_trees.h"
+#include "views/view.h"
+
+#include <CL/sycl.hpp>
+
+namespace blas {
+
+template <bool Upper, typename lhs_t, typename rhs_t>
+SYCL_BLAS_INLINE DiagonalBlocksUpdate<Upper, lhs_t, rhs_t>::DiagonalBlocksUpdate(
+    lhs_t& lhs, rhs_t& rhs, value_t beta, index_t blockSize)
+    : lhs_(lhs), rhs_(rhs), beta_(beta), blockSize_(blockSize) {}
+
+template <bool Upper, typename lhs_t, typename rhs_t>
+SYCL_BLAS_INLINE typename DiagonalBlocksUpdate<Upper, lhs_t, rhs_t>::index_t
+DiagonalBlocksUpdate<Upper, lhs_t, rhs_t>::get_size() const {
+  return rhs_.get_size();
+}
+
+template <bool Upper, typename lhs_t, typename rhs_t>
+SYCL_BLAS_INLINE bool DiagonalBlocksUpdate<Upper, lhs_t, rhs_t>::valid_thread(
+    cl::sycl::nd_item<1> ndItem) const {
+  return ndItem.get_global_id(0) < get_size();
+}
+
+template <bool Upper, typename lhs_t, typename rhs_t>
+SYCL_BLAS_INLINE typename DiagonalBlocksUpdate<Upper, lhs_t, rhs_t>::value_t
+DiagonalBlocksUpdate<Upper, lhs_t, rhs_t>::eval(index_t i) {
+  const index_t blockElems = blockSize_ * blockSize_;
+  const index_t block = i / blockElems;
+  const index_t row = i % blockSize_;
+  const index_t col = (i % blockElems) / blockSize_;
+  const index_t lhsRow = block * blockSize_ + row;
+  const index_t lhsCol = block * blockSize_ + col;
+  const bool inTriangle = Upper ? (row <= col) : (row >= col);
+  value_t val = value_t{0};
+  if (inTriangle && lhsRow < lhs_.get_size_row() &&
+      lhsCol < lhs_.get_size_col()) {
+    val = rhs_.template eval<true>(i);
+    // beta == 0 must not propagate NaNs from the output
+    if (beta_ != value_t{0}) {
+      val = cl::sycl::mad(beta_, lhs_.eval(lhsRow, lhsCol), val);
+    }
+    lhs_.eval(lhsRow, lhsCol) = val;
+  }
+  return val;
+}
+
+template <bool Upper, typename lhs_t, typename rhs_t>
+SYCL_BLAS_INLINE typename DiagonalBlocksUpdate<Upper, lhs_t, rhs_t>::value_t
+DiagonalBlocksUpdate<Upper, lhs_t, rhs_t>::eval(cl::sycl::nd_item<1> ndItem) {
+  return eval(ndItem.get_global_id(0));
+}
+
+template <bool Upper, typename lhs_t, typename rhs_t>
+SYCL_BLAS_INLINE void DiagonalBlocksUpdate<Upper, lhs_t, rhs_t>::bind(
+    cl::sycl::handler& h) {
+  lhs_.bind(h);
+  rhs_.bind(h);
+}
+
+template <bool Upper, typename lhs_t, typename rhs_t>
+SYCL_BLAS_INLINE void
+DiagonalBlocksUpdate<Upper, lhs_t, rhs_t>::adjust_access_displacement() {
+  lhs_.adjust_access_displacement();
+  rhs_.adjust_access_displacement();
+}
+
+}  // namespace blas
+
+#endif  // SYCL_BLAS_BLAS3_SYRK_HPP
@@ -0,0 +1,115 @@
+/***************************************************************************
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename trmm.hpp
+ *
+ **************************************************************************/
+
+#ifndef SYCL_BLAS_BLAS3_TRMM_HPP
+#define SYCL_BLAS_BLAS3_TRMM_HPP
+
+#include "operations/blas3_trees.h"
+#include "views/view.h"
+
+#include <CL/sycl.hpp>
+
+namespace blas {
+
+template <bool Symmetric, bool Upper, bool UnitDiag, typename lhs_t,
+          typename rhs_t>
+SYCL_BLAS_INLINE DiagonalBlocksExpand<Symmetric, Upper, UnitDiag, lhs_t,
+                                      rhs_t>::DiagonalBlocksExpand(
+    lhs_t& lhs, rhs_t& rhs, index_t blockSize)
+    : lhs_(lhs), rhs_(rhs), blockSize_(blockSize) {}
+
+template <bool Symmetric, bool Upper, bool UnitDiag, typename lhs_t,
+          typename rhs_t>
+SYCL_BLAS_INLINE
+    typename DiagonalBlocksExpand<Symmetric, Upper, UnitDiag, lhs_t,
+                                  rhs_t>::index_t
+    DiagonalBlocksExpand<Symmetric, Upper, UnitDiag, lhs_t, rhs_t>::get_size()
+        const {
+  return lhs_.get_size();
+}
+
+template <bool Symmetric, bool Upper, bool UnitDiag, typename lhs_t,
+          typename rhs_t>
+SYCL_BLAS_INLINE bool
+DiagonalBlocksExpand<Symmetric, Upper, UnitDiag, lhs_t, rhs_t>::valid_thread(
+    cl::sycl::nd_item<1> ndItem) const {
+  return ndItem.get_global_id(0) < get_size();
+}
+
+template <bool Symmetric, bool Upper, bool UnitDiag, typename lhs_t,
+          typename rhs_t>
+SYCL_BLAS_INLINE typename DiagonalBlocksExpand<Symmetric, Upper, UnitDiag,
+                                               lhs_t, rhs_t>::value_t
+DiagonalBlocksExpand<Symmetric, Upper, UnitDiag, lhs_t, rhs_t>::eval(
+    index_t i) {
+  const index_t blockElems = blockSize_ * blockSize_;
+  const index_t blockStart = (i / blockElems) * blockSize_;
+  const index_t row = blockStart + i % blockSize_;
+  const index_t col = blockStart + (i % blockElems) / blockSize_;
+  const index_t size = rhs_.get_size_row();
+  const bool isStored = Upper ? (row <= col) : (row >= col);
+
+  value_t val = value_t{0};
+  if (row < size && col < size) {
+    if (row == col && UnitDiag) {
+      val = value_t{1};
+    } else if (isStored) {
+      val = rhs_.eval(row, col);
+    } else if (Symmetric) {
+      val = rhs_.eval(col, row);
+    }
+  }
+  lhs_.template eval<true>(i) = val;
+  return val;
+}
+
+template <bool Symmetric, bool Upper, bool UnitDiag, typename lhs_t,
+          typename rhs_t>
+SYCL_BLAS_INLINE typename DiagonalBlocksExpand<Symmetric, Upper, UnitDiag,
+                                               lhs_t, rhs_t>::value_t
+DiagonalBlocksExpand<Symmetric, Upper, UnitDiag, lhs_t, rhs_t>::eval(
+    cl::sycl::nd_item<1> ndItem) {
+  return eval(ndItem.get_global_id(0));
+}
+
+template <bool Symmetric, bool Upper, bool UnitDiag, typename lhs_t,
+          typename rhs_t>
+SYCL_BLAS_INLINE void
+DiagonalBlocksExpand<Symmetric, Upper, UnitDiag, lhs_t, rhs_t>::bind(
+    cl::sycl::handler& h) {
+  lhs_.bind(h);
+  rhs_.bind(h);
+}
+
+template <bool Symmetric, bool Upper, bool UnitDiag, typename lhs_t,
+          typename rhs_t>
+SYCL_BLAS_INLINE void DiagonalBlocksExpand<Symmetric, Upper, UnitDiag, lhs_t,
+                                           rhs_t>::adjust_access_displacement() {
+  lhs_.adjust_access_displacement();
+  rhs_.adjust_access_displacement();
+}
+
+}  // namespace blas
+
+#endif  // SYCL_BLAS_BLAS3_TRMM_HPP
@@ -32,8 +32,15 @@ namespace blas {
 
 template <bool UnitDiag, bool Upper, int BlockSize, typename matrix_t>
 SYCL_BLAS_INLINE DiagonalBlocksInverter<UnitDiag, Upper, BlockSize, matrix_t>::
-    DiagonalBlocksInverter(matrix_t& A, matrix_t& invA)
-    : A_(A), invA_(invA), N_(A_.get_size_col()), lda_(A_.getSizeL()) {}
+    DiagonalBlocksInverter(matrix_t& A, matrix_t& invA, index_t batchSize,
+                           index_t strideA, index_t strideInvA)
+    : A_(A),
+      invA_(invA),
+      N_(A_.get_size_col()),
+      lda_(A_.getSizeL()),
+      batchSize_(batchSize),
+      strideA_(strideA),
+      strideInvA_(strideInvA) {}
 
 template <bool UnitDiag, bool Upper, int BlockSize, typename matrix_t>
 SYCL_BLAS_INLINE bool
@@ -62,12 +69,19 @@ template <typename local_memory_t>
 SYCL_BLAS_INLINE void
 DiagonalBlocksInverter<UnitDiag, Upper, BlockSize, matrix_t>::eval(
     local_memory_t localMem, cl::sycl::nd_item<1> item) noexcept {
-  auto A = A_.get_data().get_pointer() + A_.get_access_displacement();
-  auto invA = invA_.get_data().get_pointer() + invA_.get_access_displacement();
+  // Work groups are laid out batch by batch, each batch covering all the
+  // diagonal blocks of one matrix
+  const index_t blocksPerBatch =
+      (N_ + internalBlockSize - 1) / internalBlockSize;
+  const index_t batchIndex = item.get_group(0) / blocksPerBatch;
+  auto A = A_.get_data().get_pointer() + A_.get_access_displacement() +
+           batchIndex * strideA_;
+  auto invA = invA_.get_data().get_pointer() +
+              invA_.get_access_displacement() + batchIndex * strideInvA_;
   value_t* local = localMem.localAcc.get_pointer();
 
   const index_t i = item.get_local_id(0);
-  const index_t blockIndex = item.get_group(0);
+  const index_t blockIndex = item.get_group(0) % blocksPerBatch;
 
   // Sets the offset for this particular block in the source and destination
   // matrices
@@ -145,6 +159,237 @@ DiagonalBlocksInverter<UnitDiag, Upper, BlockSize, matrix_t>::eval(
   }
 }
 
+template <bool UnitDiag, bool Lower, int MaxSize, typename matrix_a_t,
+          typename matrix_b_t>
+SYCL_BLAS_INLINE
+TrsmBatchedSmall<UnitDiag, Lower, MaxSize, matrix_a_t, matrix_b_t>::
+    TrsmBatchedSmall(matrix_a_t& A, matrix_b_t& B, value_t alpha, bool isLeft,
+                     bool transA, index_t M, index_t N, index_t strideA,
+                     index_t strideB, index_t batchSize)
+    : A_(A),
+      B_(B),
+      alpha_(alpha),
+      isLeft_(isLeft),
+      transA_(transA),
+      K_(isLeft ? M : N),
+      numRhs_(isLeft ? N : M),
+      lda_(A_.getSizeL()),
+      ldb_(B_.getSizeL()),
+      strideA_(strideA),
+      strideB_(strideB),
+      batchSize_(batchSize) {}
+
+template <bool UnitDiag, bool Lower, int MaxSize, typename matrix_a_t,
+          typename matrix_b_t>
+SYCL_BLAS_INLINE bool
+TrsmBatchedSmall<UnitDiag, Lower, MaxSize, matrix_a_t, matrix_b_t>::
+    valid_thread(cl::sycl::nd_item<1> id) const {
+  return true;
+}
+
+template <bool UnitDiag, bool Lower, int MaxSize, typename matrix_a_t,
+          typename matrix_b_t>
+SYCL_BLAS_INLINE void
+TrsmBatchedSmall<UnitDiag, Lower, MaxSize, matrix_a_t, matrix_b_t>::bind(
+    cl::sycl::handler& cgh) {
+  A_.bind(cgh);
+  B_.bind(cgh);
+}
+
+template <bool UnitDiag, bool Lower, int MaxSize, typename matrix_a_t,
+          typename matrix_b_t>
+SYCL_BLAS_INLINE void TrsmBatchedSmall<UnitDiag, Lower, MaxSize, matrix_a_t,
+                                       matrix_b_t>::adjust_access_displacement() {
+  A_.adjust_access_displacement();
+  B_.adjust_access_displacement();
+}
+
+template <bool UnitDiag, bool Lower, int MaxSize, typename matrix_a_t,
+          typename matrix_b_t>
+template <typename local_memory_t>
+SYCL_BLAS_INLINE void
+TrsmBatchedSmall<UnitDiag, Lower, MaxSize, matrix_a_t, matrix_b_t>::eval(
+    local_memory_t localMem, cl::sycl::nd_item<1> item) noexcept {
+  const index_t batchIndex = item.get_group(0);
+  auto A = A_.get_data().get_pointer() + A_.get_access_displacement() +
+           batchIndex * strideA_;
+  auto B = B_.get_data().get_pointer() + B_.get_access_displacement() +
+           batchIndex * strideB_;
+  value_t* local = localMem.localAcc.get_pointer();
+
+  const index_t localId = item.get_local_id(0);
+  const index_t localSize = item.get_local_range(0);
+
+  // Loads the triangle of the system matrix into local memory. Elements outside
+  // of the triangle are never read from A and the diagonal holds its
+  // reciprocal so that the substitution only multiplies
+  for (index_t idx = localId; idx < K_ * K_; idx += localSize) {
+    const index_t row = idx % K_;
+    const index_t col = idx / K_;
+    value_t val = value_t{0};
+    if (row == col) {
+      val = UnitDiag ? value_t{1} : value_t{1} / A[row + row * lda_];
+    } else if (Lower ? (row > col) : (row < col)) {
+      val = transA_ ? A[col + row * lda_] : A[row + col * lda_];
+    }
+    local[row + col * max_size] = val;
+  }
+  item.barrier(cl::sycl::access::fence_space::local_space);
+
+  // Each right hand side is a column of B on the left side and a row of B on
+  // the right side
+  const index_t elemInc = isLeft_ ? 1 : ldb_;
+  const index_t rhsInc = isLeft_ ? ldb_ : 1;
+  for (index_t rhs = localId; rhs < numRhs_; rhs += localSize) {
+    auto b = B + rhs * rhsInc;
+    value_t x[max_size];
+    for (index_t i = 0; i < K_; ++i) {
+      x[i] = alpha_ * b[i * elemInc];
+    }
+    if (Lower) {
+      for (index_t i = 0; i < K_; ++i) {
+        value_t sum = x[i];
+        for (index_t k = 0; k < i; ++k) {
+          sum = cl::sycl::mad(-local[i + k * max_size], x[k], sum);
+        }
+        x[i] = sum * local[i + i * max_size];
+      }
+    } else {
+      for (index_t i = K_ - 1; i >= 0; --i) {
+        value_t sum = x[i];
+        for (index_t k = i + 1; k < K_; ++k) {
+          sum = cl::sycl::mad(-local[i + k * max_size], x[k], sum);
+        }
+        x[i] = sum * local[i + i * max_size];
+      }
+    }
+    for (index_t i = 0; i < K_; ++i) {
+      b[i * elemInc] = x[i];
+    }
+  }
+}
+
+template <bool TransA, bool TransB, int BlockSize, typename matrix_a_t,
+          typename matrix_b_t, typename matrix_c_t>
+SYCL_BLAS_INLINE
+TrsmBatchedGemm<TransA, TransB, BlockSize, matrix_a_t, matrix_b_t,
+                matrix_c_t>::TrsmBatchedGemm(matrix_a_t& A, matrix_b_t& B,
+                                             matrix_c_t& C, value_t alpha,
+                                             value_t beta, index_t M,
+                                             index_t N, index_t K,
+                                             index_t strideA, index_t strideB,
+                                             index_t strideC,
+                                             index_t batchSize)
+    : A_(A),
+      B_(B),
+      C_(C),
+      alpha_(alpha),
+      beta_(beta),
+      M_(M),
+      N_(N),
+      K_(K),
+      lda_(A_.getSizeL()),
+      ldb_(B_.getSizeL()),
+      ldc_(C_.getSizeL()),
+      strideA_(strideA),
+      strideB_(strideB),
+      strideC_(strideC),
+      batchSize_(batchSize) {}
+
+template <bool TransA, bool TransB, int BlockSize, typename matrix_a_t,
+          typename matrix_b_t, typename matrix_c_t>
+SYCL_BLAS_INLINE bool TrsmBatchedGemm<TransA, TransB, BlockSize, matrix_a_t,
+                                      matrix_b_t, matrix_c_t>::
+    valid_thread(cl::sycl::nd_item<1> id) const {
+  return true;
+}
+
+template <bool TransA, bool TransB, int BlockSize, typename matrix_a_t,
+          typename matrix_b_t, typename matrix_c_t>
+SYCL_BLAS_INLINE void TrsmBatchedGemm<TransA, TransB, BlockSize, matrix_a_t,
+                                      matrix_b_t, matrix_c_t>::
+    bind(cl::sycl::handler& cgh) {
+  A_.bind(cgh);
+  B_.bind(cgh);
+  C_.bind(cgh);
+}
+
+template <bool TransA, bool TransB, int BlockSize, typename matrix_a_t,
+          typename matrix_b_t, typename matrix_c_t>
+SYCL_BLAS_INLINE void TrsmBatchedGemm<TransA, TransB, BlockSize, matrix_a_t,
+                                      matrix_b_t, matrix_c_t>::
+    adjust_access_displacement() {
+  A_.adjust_access_displacement();
+  B_.adjust_access_displacement();
+  C_.adjust_access_displacement();
+}
+
+template <bool TransA, bool TransB, int BlockSize, typename matrix_a_t,
+          typename matrix_b_t, typename matrix_c_t>
+template <typename local_memory_t>
+SYCL_BLAS_INLINE void TrsmBatchedGemm<TransA, TransB, BlockSize, matrix_a_t,
+                                      matrix_b_t, matrix_c_t>::
+    eval(local_memory_t localMem, cl::sycl::nd_item<1> item) noexcept {
+  // Work groups are laid out batch by batch, each batch covering all the
+  // tiles of one matrix C, column of tiles by column of tiles
+  const index_t tilesM = (M_ + block_size - 1) / block_size;
+  const index_t tilesN = (N_ + block_size - 1) / block_size;
+  const index_t batchIndex = item.get_group(0) / (tilesM * tilesN);
+  const index_t tileIndex = item.get_group(0) % (tilesM * tilesN);
+  const index_t row0 = (tileIndex % tilesM) * block_size;
+  const index_t col0 = (tileIndex / tilesM) * block_size;
+  auto A = A_.get_data().get_pointer() + A_.get_access_displacement() +
+           batchIndex * strideA_;
+  auto B = B_.get_data().get_pointer() + B_.get_access_displacement() +
+           batchIndex * strideB_;
+  auto C = C_.get_data().get_pointer() + C_.get_access_displacement() +
+           batchIndex * strideC_;
+  // op(A) is kept column major and op(B) row major, padded to avoid bank
+  // conflicts when it is read by columns
+  value_t* localA = localMem.localAcc.get_pointer();
+  value_t* localB = localA + block_size * block_size;
+  constexpr index_t ldLocalB = block_size + 1;
+
+  // Consecutive work items read consecutive elements of the stored matrices
+  const index_t localId = item.get_local_id(0);
+  const index_t r = localId % block_size;
+  const index_t c = localId / block_size;
+  if (!TransA) {
+    localA[r + c * block_size] = (row0 + r < M_ && c < K_)
+                                     ? A[(row0 + r) + c * lda_]
+                                     : value_t{0};
+  } else {
+    localA[c + r * block_size] = (row0 + c < M_ && r < K_)
+                                     ? A[r + (row0 + c) * lda_]
+                                     : value_t{0};
+  }
+  if (!TransB) {
+    localB[c + r * ldLocalB] = (r < K_ && col0 + c < N_)
+                                   ? B[r + (col0 + c) * ldb_]
+                                   : value_t{0};
+  } else {
+    localB[r + c * ldLocalB] = (col0 + r < N_ && c < K_)
+                                   ? B[(col0 + r) + c * ldb_]
+                                   : value_t{0};
+  }
+
+  // This barrier is mandatory to be sure the data is on the shared memory
+  item.barrier(cl::sycl::access::fence_space::local_space);
+
+  const index_t row = row0 + r;
+  const index_t col = col0 + c;
+  if (row < M_ && col < N_) {
+    value_t sum = value_t{0};
+    for (index_t k = 0; k < K_; ++k) {
+      sum = cl::sycl::mad(localA[r + k * block_size],
+                          localB[c + k * ldLocalB], sum);
+    }
+    value_t& out = C[row + col * ldc_];
+    out = (beta_ == value_t{0}) ? alpha_ * sum
+                                : cl::sycl::mad(beta_, out, alpha_ * sum);
+  }
+}
+
 }  // namespace blas
 
 #endif  // SYCL_BLAS_BLAS3_TRSM_HPP
@@ -25,12 +25,17 @@
 #ifndef SYCL_BLAS_BLAS3_TREES_HPP
 #define SYCL_BLAS_BLAS3_TREES_HPP
 
+#include "blas3/gemm_cache_blocked.hpp"
 #include "blas3/gemm_interleaved.hpp"
 #include "blas3/gemm_local.hpp"
 #include "blas3/gemm_local_joint_matrix.hpp"
 #include "blas3/gemm_no_local_full_vec.hpp"
 #include "blas3/gemm_no_local_partial_vec.hpp"
+#include "blas3/gemm_packed.hpp"
 #include "blas3/gemm_partial_local.hpp"
 #include "blas3/gemm_ref.hpp"
+#include "blas3/gemm_specialized.hpp"
+#include "blas3/syrk.hpp"
+#include "blas3/trmm.hpp"
 #include "blas3/trsm.hpp"
 #endif  // SYCL_BLAS_BLAS3_TREES_HPP
@@ -27,8 +27,10 @@
 
 #include "blas_meta.h"
 #include "operations/extension/reduction.h"
+#include "operations/subgroup_reduction.hpp"
 #include "views/view.h"
 #include <CL/sycl.hpp>
+#include <algorithm>
 #include <string>
 namespace blas {
 
@@ -146,6 +148,48 @@ Reduction<operator_t, params_t, input_t, output_t>::reduce(
   }
 }
 
+/*!
+ * @brief Reduction across the work group when evaluated with sub-group
+ * memory. The work items of a sub-group that share a preserved element are
+ * reduced with shuffles, so only one partial result per sub-group and
+ * preserved element goes through local memory.
+ */
+template <typename operator_t, typename params_t, typename input_t,
+          typename output_t>
+template <typename local_ptr_t>
+SYCL_BLAS_INLINE void
+Reduction<operator_t, params_t, input_t, output_t>::reduce_sub_groups(
+    local_ptr_t scratch_ptr, cl::sycl::nd_item<1> id, index_t preserve_local_id,
+    index_t reduce_local_id, index_t global_preserve_id, index_t out_offset,
+    element_t accumulator) noexcept {
+  constexpr index_t preserve = params_t::get_local_thread_size_preserve();
+  constexpr index_t reduce = params_t::get_local_thread_size_reduce();
+  constexpr index_t stride = preserve + params_t::use_bank_offset();
+  const index_t sg_size = get_sub_group_size(id);
+  // Local ids sharing a preserved element are consecutive when reducing the
+  // inner dimension and preserve apart when reducing the outer one
+  const index_t first_mask = params_t::is_outer_dim() ? preserve : index_t(1);
+  const index_t run = params_t::is_outer_dim()
+                          ? std::max(index_t(1), sg_size / preserve)
+                          : std::min(reduce, sg_size);
+  accumulator = reduce_sub_group<operator_t>(id, accumulator, first_mask,
+                                             first_mask * run);
+  if (reduce_local_id % run == 0) {
+    scratch_ptr[preserve_local_id + (reduce_local_id / run) * stride] =
+        accumulator;
+  }
+  id.barrier(cl::sycl::access::fence_space::local_space);
+
+  // Write result to the output vector
+  if (reduce_local_id == 0 && (global_preserve_id < num_elems_to_preserve_)) {
+    for (index_t i = 1; i < reduce / run; i++) {
+      accumulator = operator_t::eval(
+          accumulator, scratch_ptr[preserve_local_id + i * stride]);
+    }
+    out_.template eval<true>(out_offset + global_preserve_id) = accumulator;
+  }
+}
+
 /*!
  * @brief The main implementation of the Reduction kernel
  */
@@ -186,6 +230,12 @@ SYCL_BLAS_INLINE void Reduction<operator_t, params_t, input_t, output_t>::eval(
   reduce(global_reduce_id, global_preserve_id, accumulator);
 
   accumulator = operator_t::get_final_value(accumulator, num_elems_to_reduce_);
+  if (is_subgroup_memory<local_memory_t>::value &&
+      subgroup_reducible<element_t>::value) {
+    reduce_sub_groups(scratch_ptr, id, preserve_local_id, reduce_local_id,
+                      global_preserve_id, out_offset, accumulator);
+    return;
+  }
   const index_t scratch_idx =
       preserve_local_id +
       reduce_local_id * (params_t::get_local_thread_size_preserve() +
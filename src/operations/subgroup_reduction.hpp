@@ -0,0 +1,224 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename subgroup_reduction.hpp
+ *
+ **************************************************************************/
+
+#ifndef SYCL_BLAS_SUBGROUP_REDUCTION_HPP
+#define SYCL_BLAS_SUBGROUP_REDUCTION_HPP
+
+#include "blas_meta.h"
+#include "operations/blas_operators.hpp"
+#include "sb_handle/kernel_constructor.h"
+#include <CL/sycl.hpp>
+#include <type_traits>
+
+namespace blas {
+
+/*!
+ * @brief Whether a tree is evaluated with the local memory of the
+ * using_local_memory::subgroup mode, in which case its reductions combine the
+ * values of each sub-group before going through local memory.
+ */
+template <typename local_memory_t>
+struct is_subgroup_memory : std::false_type {};
+
+template <typename value_t>
+struct is_subgroup_memory<LocalMemory<value_t, using_local_memory::subgroup>>
+    : std::true_type {};
+
+/*!
+ * @brief Whether values of the given type can be exchanged with sub-group
+ * collectives. Other types keep the local memory tree.
+ */
+template <typename value_t>
+struct subgroup_reducible
+    : std::integral_constant<bool, SYCL_BLAS_SUBGROUPS &&
+                                       std::is_arithmetic<value_t>::value> {};
+
+namespace internal {
+
+/*!
+ * @brief Reduction of a value across the work items of a sub-group.
+ * Non-specialised case for the types that are not subgroup_reducible; the
+ * trees never call it, it only keeps their sub-group path compiling.
+ */
+template <typename operator_t, typename value_t,
+          bool reducible = subgroup_reducible<value_t>::value>
+struct SubGroupReducer {
+  static SYCL_BLAS_INLINE value_t reduce(cl::sycl::nd_item<1>, value_t val) {
+    return val;
+  }
+
+  template <typename index_t>
+  static SYCL_BLAS_INLINE value_t reduce(cl::sycl::nd_item<1>, value_t val,
+                                         index_t, index_t) {
+    return val;
+  }
+};
+
+#if SYCL_BLAS_SUBGROUPS
+/*!
+ * @brief Sub-group reductions exchanging values with permute_group_by_xor,
+ * which supports any associative and commutative operator.
+ */
+template <typename operator_t, typename value_t>
+struct SubGroupButterfly {
+  /*!
+   * @brief Butterfly reduction over the lanes whose ids only differ in the
+   * bits [first_mask, end_mask). Every participating lane gets the result.
+   */
+  template <typename index_t>
+  static SYCL_BLAS_INLINE value_t reduce(cl::sycl::nd_item<1> ndItem,
+                                         value_t val, index_t first_mask,
+                                         index_t end_mask) {
+    auto sg = ndItem.get_sub_group();
+    for (index_t mask = first_mask; mask < end_mask; mask <<= 1) {
+      val = operator_t::eval(val,
+                             cl::sycl::permute_group_by_xor(sg, val, mask));
+    }
+    return val;
+  }
+
+  static SYCL_BLAS_INLINE value_t reduce(cl::sycl::nd_item<1> ndItem,
+                                         value_t val) {
+    const uint32_t sg_size = ndItem.get_sub_group().get_local_range()[0];
+    return reduce(ndItem, val, uint32_t(1), sg_size);
+  }
+};
+
+template <typename operator_t, typename value_t>
+struct SubGroupReducer<operator_t, value_t, true>
+    : SubGroupButterfly<operator_t, value_t> {};
+
+/*!
+ * @brief Sums go through reduce_over_group, which the backends map to their
+ * native sub-group reduction.
+ */
+template <typename value_t>
+struct SubGroupReducer<AddOperator, value_t, true>
+    : SubGroupButterfly<AddOperator, value_t> {
+  using SubGroupButterfly<AddOperator, value_t>::reduce;
+
+  static SYCL_BLAS_INLINE value_t reduce(cl::sycl::nd_item<1> ndItem,
+                                         value_t val) {
+    return cl::sycl::reduce_over_group(ndItem.get_sub_group(), val,
+                                       cl::sycl::plus<value_t>());
+  }
+};
+#endif
+
+}  // namespace internal
+
+/*!
+ * @brief Reduces the values of the work items of a sub-group.
+ */
+template <typename operator_t, typename value_t>
+SYCL_BLAS_INLINE value_t reduce_sub_group(cl::sycl::nd_item<1> ndItem,
+                                          value_t val) {
+  return internal::SubGroupReducer<operator_t, value_t>::reduce(ndItem, val);
+}
+
+/*!
+ * @brief Reduces the values of the lanes of a sub-group whose ids only
+ * differ in the bits [first_mask, end_mask), both powers of two.
+ */
+template <typename operator_t, typename value_t, typename index_t>
+SYCL_BLAS_INLINE value_t reduce_sub_group(cl::sycl::nd_item<1> ndItem,
+                                          value_t val, index_t first_mask,
+                                          index_t end_mask) {
+  return internal::SubGroupReducer<operator_t, value_t>::reduce(
+      ndItem, val, first_mask, end_mask);
+}
+
+/*!
+ * @brief Number of work items of the sub-groups of a work group.
+ */
+SYCL_BLAS_INLINE size_t get_sub_group_size(cl::sycl::nd_item<1> ndItem) {
+#if SYCL_BLAS_SUBGROUPS
+  return ndItem.get_sub_group().get_max_local_range()[0];
+#else
+  return 1;
+#endif
+}
+
+/*!
+ * @brief Number of sub-groups of a work group.
+ */
+SYCL_BLAS_INLINE size_t get_num_sub_groups(cl::sycl::nd_item<1> ndItem) {
+#if SYCL_BLAS_SUBGROUPS
+  return ndItem.get_sub_group().get_group_range()[0];
+#else
+  return ndItem.get_local_range(0);
+#endif
+}
+
+/*!
+ * @brief Reduces the values of a sub-group and lets its first work item
+ * store the result in scratch[offset + sub-group id].
+ */
+template <typename operator_t, typename local_memory_t, typename value_t,
+          typename index_t>
+SYCL_BLAS_INLINE void store_sub_group_reduction(local_memory_t scratch,
+                                                cl::sycl::nd_item<1> ndItem,
+                                                value_t val, index_t offset) {
+#if SYCL_BLAS_SUBGROUPS
+  auto sg = ndItem.get_sub_group();
+  val = reduce_sub_group<operator_t>(ndItem, val);
+  if (sg.get_local_id()[0] == 0) {
+    scratch[offset + index_t(sg.get_group_id()[0])] = val;
+  }
+#else
+  scratch[offset + index_t(ndItem.get_local_id(0))] = val;
+#endif
+}
+
+/*!
+ * @brief Reduces the values of a work group with one barrier: each sub-group
+ * reduces its values, the leaders write them to scratch and the first
+ * sub-group combines them. The result is only valid in local id 0.
+ * @param scratch Local memory holding at least one value per sub-group.
+ * @param init_val Identity of the operator.
+ */
+template <typename operator_t, typename local_memory_t, typename value_t>
+SYCL_BLAS_INLINE value_t reduce_work_group(local_memory_t scratch,
+                                           cl::sycl::nd_item<1> ndItem,
+                                           value_t val, value_t init_val) {
+  const size_t local_id = ndItem.get_local_id(0);
+  const size_t sg_size = get_sub_group_size(ndItem);
+  const size_t num_sg = get_num_sub_groups(ndItem);
+  store_sub_group_reduction<operator_t>(scratch, ndItem, val, size_t(0));
+  // This barrier is mandatory to be sure the data is on the shared memory
+  ndItem.barrier(cl::sycl::access::fence_space::local_space);
+  if (local_id < sg_size) {
+    val = init_val;
+    for (size_t i = local_id; i < num_sg; i += sg_size) {
+      val = operator_t::eval(val, scratch[i]);
+    }
+    val = reduce_sub_group<operator_t>(ndItem, val);
+  }
+  return val;
+}
+
+}  // namespace blas
+
+#endif  // SYCL_BLAS_SUBGROUP_REDUCTION_HPP
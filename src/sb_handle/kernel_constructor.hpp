@@ -82,11 +82,11 @@ struct LocalMemory<value_t, using_local_memory::disabled> {
 };
 /*!
 @brief A struct for containing a local accessor if shared memory is enabled.
-Specialised case for using_local_memory == subgroup, which contains a subgroup
-local accessor.
+Specialised case for using_local_memory == subgroup, which contains a local
+accessor holding one partial result per sub-group. Trees evaluated with it
+reduce within each sub-group first, see operations/subgroup_reduction.hpp.
 @tparam value_t Value type of the accessor.
 */
-#ifdef __COMPUTECPP__
 template <typename value_t>
 struct LocalMemory<value_t, using_local_memory::subgroup> {
   /*!
@@ -96,26 +96,25 @@ struct LocalMemory<value_t, using_local_memory::subgroup> {
   @param cgh SYCL command group handler.
   */
   SYCL_BLAS_INLINE LocalMemory(size_t size, cl::sycl::handler &cgh)
-      : subgroupAcc(cl::sycl::range<1>(size), cgh) {}
+      : localAcc(cl::sycl::range<1>(size), cgh) {}
 
   /*!
-  @brief Subscript operator that forwards on to the subgroup accessor subscript
+  @brief Subscript operator that forwards on to the local accessor subscript
   operator.
   @param id SYCL id.
-  @return Reference to an element of the subgroup accessor.
+  @return Reference to an element of the local accessor.
   */
   SYCL_BLAS_INLINE value_t &operator[](cl::sycl::id<1> id) {
-    return subgroupAcc[id];
+    return localAcc[id];
   }
 
   /*!
-  @brief subgroup accessor.
+  @brief Local accessor.
   */
   cl::sycl::accessor<value_t, 1, cl::sycl::access::mode::read_write,
-                     cl::sycl::access::target::subgroup_local>
-      subgroupAcc;
+                     cl::sycl::access::target::local>
+      localAcc;
 };
-#endif
 
 /*!
 @brief Template struct for containing an eval function, which uses shared memory
@@ -27,11 +27,13 @@
 #define SYCL_BLAS_HANDLE_HPP
 
 #include <algorithm>
+#include <iostream>
 
 #include "blas_meta.h"
 #include "operations/blas1_trees.hpp"
 #include "operations/blas2_trees.hpp"
 #include "operations/blas_operators.hpp"
+#include "operations/subgroup_reduction.hpp"
 #include "sb_handle/kernel_constructor.h"
 #include "sb_handle/sycl_blas_handle.h"
 #include "sycl_blas_helper.h"
@@ -49,6 +51,7 @@ inline typename SB_Handle::event_t SB_Handle::execute(expression_tree_t t) {
   auto nWG = (_N + localSize - 1) / localSize;
   auto globalSize = nWG * localSize;
 
+  counters_.add_kernels(1);
   return {execute_tree<using_local_memory::disabled>(get_queue(), t, localSize,
                                                      globalSize, 0)};
 };
@@ -63,6 +66,7 @@ inline typename SB_Handle::event_t SB_Handle::execute(expression_tree_t t,
   auto _N = t.get_size();
   auto nWG = (_N + localSize - 1) / localSize;
   auto globalSize = nWG * localSize;
+  counters_.add_kernels(1);
   return {execute_tree<using_local_memory::disabled>(q_, t, localSize,
                                                      globalSize, 0)};
 };
@@ -75,6 +79,7 @@ template <typename expression_tree_t, typename index_t>
 inline typename SB_Handle::event_t SB_Handle::execute(expression_tree_t t,
                                                       index_t localSize,
                                                       index_t globalSize) {
+  counters_.add_kernels(1);
   return {execute_tree<using_local_memory::disabled>(q_, t, localSize,
                                                      globalSize, 0)};
 }
@@ -88,10 +93,43 @@ inline typename SB_Handle::event_t SB_Handle::execute(expression_tree_t t,
                                                       index_t localSize,
                                                       index_t globalSize,
                                                       index_t shMem) {
+  counters_.add_kernels(1);
   return {execute_tree<using_local_memory::enabled>(q_, t, localSize,
                                                     globalSize, shMem)};
 }
 
+template <typename expression_tree_t>
+inline cl::sycl::event SB_Handle::execute_reduction_tree(
+    expression_tree_t t, size_t localSize, size_t globalSize, size_t shMem) {
+  // Only value types the sub-group collectives handle get a second kernel
+  return execute_reduction_tree(
+      t, localSize, globalSize, shMem,
+      subgroup_reducible<typename expression_tree_t::value_t>{});
+}
+
+template <typename expression_tree_t>
+inline cl::sycl::event SB_Handle::execute_reduction_tree(
+    expression_tree_t t, size_t localSize, size_t globalSize, size_t shMem,
+    std::true_type) {
+  if (subGroupSize_ != 0 && localSize % subGroupSize_ == 0) {
+    counters_.add_kernels(1);
+    return execute_tree<using_local_memory::subgroup>(q_, t, localSize,
+                                                      globalSize, shMem);
+  }
+  counters_.add_kernels(1);
+  return execute_tree<using_local_memory::enabled>(q_, t, localSize,
+                                                   globalSize, shMem);
+}
+
+template <typename expression_tree_t>
+inline cl::sycl::event SB_Handle::execute_reduction_tree(
+    expression_tree_t t, size_t localSize, size_t globalSize, size_t shMem,
+    std::false_type) {
+  counters_.add_kernels(1);
+  return execute_tree<using_local_memory::enabled>(q_, t, localSize,
+                                                   globalSize, shMem);
+}
+
 /*!
  * @brief Applies a reduction to a tree.
  */
@@ -111,8 +149,10 @@ inline typename SB_Handle::event_t SB_Handle::execute(
 
   // Two accessors to local memory
   auto sharedSize = ((nWG < localSize) ? localSize : nWG);
-  auto shMem1 = make_sycl_iterator_buffer<typename lhs_t::value_t>(sharedSize);
-  auto shMem2 = make_sycl_iterator_buffer<typename lhs_t::value_t>(sharedSize);
+  auto shMem1 = internal::make_scratch_buffer<typename lhs_t::value_t>(
+      *this, sharedSize);
+  auto shMem2 = internal::make_scratch_buffer<typename lhs_t::value_t>(
+      *this, sharedSize);
 
   auto opShMem1 = lhs_t(
       shMem1.template get_range_accessor<cl::sycl::access::mode::read_write>(),
@@ -129,15 +169,15 @@ inline typename SB_Handle::event_t SB_Handle::execute(
       // THE FIRST CASE USES THE ORIGINAL BINARY/TERNARY FUNCTION
       auto localTree = expression_tree_t(((nWG == 1) ? lhs : opShMem1), rhs,
                                          localSize, globalSize);
-      event.push_back(execute_tree<using_local_memory::enabled>(
-          q_, localTree, localSize, globalSize, sharedSize));
+      event.push_back(execute_reduction_tree(localTree, localSize, globalSize,
+                                             sharedSize));
     } else {
       // THE OTHER CASES ALWAYS USE THE BINARY FUNCTION
       auto localTree = AssignReduction<operator_t, lhs_t, lhs_t>(
           ((nWG == 1) ? lhs : (even ? opShMem2 : opShMem1)),
           (even ? opShMem1 : opShMem2), localSize, globalSize);
-      event.push_back(execute_tree<using_local_memory::enabled>(
-          q_, localTree, localSize, globalSize, sharedSize));
+      event.push_back(execute_reduction_tree(localTree, localSize, globalSize,
+                                             sharedSize));
     }
     _N = nWG;
     nWG = (_N + (2 * localSize) - 1) / (2 * localSize);
@@ -147,6 +187,34 @@ inline typename SB_Handle::event_t SB_Handle::execute(
   return event;
 }
 
+/*!
+ * @brief Executes a Vectorized tree on at most a few work groups per compute
+ * unit, each work item looping over the elements.
+ */
+template <int vector_size, typename tree_t>
+inline typename SB_Handle::event_t SB_Handle::execute(
+    Vectorized<vector_size, tree_t> t) {
+  using index_t = typename Vectorized<vector_size, tree_t>::index_t;
+  const auto rng = t.get_nd_range(index_t(get_work_group_size()),
+                                  index_t(get_num_compute_units()));
+  counters_.add_kernels(1);
+  return {execute_tree<using_local_memory::disabled>(
+      q_, t, rng.get_local_range()[0], rng.get_global_range()[0], 0)};
+}
+
+/*!
+ * @brief Executes a GemvRow tree, whose rows are reduced across the work
+ * group.
+ */
+template <int interLoop, bool Lower, bool Diag, bool Upper, bool Unit,
+          typename lhs_t, typename matrix_t, typename vector_t,
+          typename index_t>
+inline typename SB_Handle::event_t SB_Handle::execute(
+    GemvRow<interLoop, Lower, Diag, Upper, Unit, lhs_t, matrix_t, vector_t> t,
+    index_t localSize, index_t globalSize, index_t shMem) {
+  return {execute_reduction_tree(t, localSize, globalSize, shMem)};
+}
+
 /*!
  * @brief Applies a reduction to a tree, receiving a scratch
  * BufferIterator.
@@ -179,15 +247,15 @@ inline typename SB_Handle::event_t SB_Handle::execute(
       // THE FIRST CASE USES THE ORIGINAL BINARY/TERNARY FUNCTION
       auto localTree = expression_tree_t(((nWG == 1) ? lhs : opShMem1), rhs,
                                          localSize, globalSize);
-      event.push_back(execute_tree<using_local_memory::enabled>(
-          q_, localTree, localSize, globalSize, sharedSize));
+      event.push_back(execute_reduction_tree(localTree, localSize, globalSize,
+                                             sharedSize));
     } else {
       // THE OTHER CASES ALWAYS USE THE BINARY FUNCTION
       auto localTree = AssignReduction<operator_t, lhs_t, lhs_t>(
           ((nWG == 1) ? lhs : (even ? opShMem2 : opShMem1)),
           (even ? opShMem1 : opShMem2), localSize, globalSize);
-      event.push_back(execute_tree<using_local_memory::enabled>(
-          q_, localTree, localSize, globalSize, sharedSize));
+      event.push_back(execute_reduction_tree(localTree, localSize, globalSize,
+                                             sharedSize));
     }
     _N = nWG;
     nWG = (_N + (2 * localSize) - 1) / (2 * localSize);
@@ -212,6 +280,7 @@ inline typename SB_Handle::event_t SB_Handle::execute(
            TransA, TransB, element_t, is_beta_zero, GemmMemoryType,
            GemmAlgorithm, GemmVectorization, VectorSize, BatchType, UseJointMatrix>;
   auto rng = gemm_tree.get_nd_range(SB_Handle::get_num_compute_units());
+  counters_.add_kernels(1);
   return {execute_tree<
       Choose<GemmMemoryType == static_cast<int>(gemm_memory_t::local), int,
             using_local_memory::enabled, using_local_memory::disabled>::type>(
@@ -219,6 +288,35 @@ inline typename SB_Handle::event_t SB_Handle::execute(
       gemm_t::local_memory_size)};
 }
 
+/* Gemm specialized at JIT time */
+template <int ItemRows, int ItemCols, bool TransA, bool TransB,
+          typename input_t, typename output_t>
+inline typename SB_Handle::event_t SB_Handle::execute(
+    GemmSpecialized<ItemRows, ItemCols, TransA, TransB, input_t, output_t>
+        gemm_tree) {
+  using gemm_t =
+      GemmSpecialized<ItemRows, ItemCols, TransA, TransB, input_t, output_t>;
+  using local_memory_t =
+      LocalMemory<typename gemm_t::value_t, using_local_memory::enabled>;
+  const auto rng = gemm_tree.get_nd_range();
+  const auto local_memory_size = gemm_tree.get_local_memory_size();
+  cl::sycl::event ev;
+  try {
+    auto cg1 = [=](cl::sycl::handler& h) mutable {
+      gemm_tree.bind(h);
+      gemm_tree.set_spec_constants(h);
+      local_memory_t local_mem(local_memory_size, h);
+      h.parallel_for(rng, GemmSpecializedFunctor<gemm_t, local_memory_t>(
+                              gemm_tree, local_mem));
+    };
+    counters_.add_kernels(1);
+    ev = q_.submit(cg1);
+  } catch (cl::sycl::exception e) {
+    std::cerr << e.what() << std::endl;
+  }
+  return {ev};
+}
+
 /* Tall and skinny Gemm */
 template <typename input_t, typename output_t, bool DoubleBuffer, bool NbcA,
           bool NbcB, int ClSize, typename tile_type, bool TransA, bool TransB,
@@ -257,7 +355,8 @@ inline typename SB_Handle::event_t SB_Handle::execute(
 
   /* First step: partial gemm */
   /* Create the cube buffer that will hold the output of the partial gemm */
-  auto cube_buffer = make_sycl_iterator_buffer<element_t>(rows * cols * depth);
+  auto cube_buffer =
+      internal::make_scratch_buffer<element_t>(*this, rows * cols * depth);
 
   /* Create a first matrix view used for the partial gemm */
   auto cube_gemm =
@@ -291,7 +390,8 @@ inline typename SB_Handle::event_t SB_Handle::execute(
   /* Otherwise we reduce to a temporary buffer */
   else {
     /* Create a temporary buffer to hold alpha * A * B */
-    auto temp_buffer = make_sycl_iterator_buffer<element_t>(rows * cols);
+    auto temp_buffer =
+        internal::make_scratch_buffer<element_t>(*this, rows * cols);
     auto temp = make_matrix_view<col_major>(temp_buffer, rows, cols, rows);
 
     /* Execute the reduction */
@@ -327,6 +427,7 @@ inline typename SB_Handle::event_t SB_Handle::execute(
         gemm_partial) {
   auto gemm_partial_range =
       gemm_partial.get_nd_range(SB_Handle::get_num_compute_units());
+  counters_.add_kernels(1);
   return {execute_tree<
       Choose<GemmMemoryType == static_cast<int>(gemm_memory_t::local), int,
              using_local_memory::enabled, using_local_memory::disabled>::type>(
@@ -342,9 +443,9 @@ inline typename SB_Handle::event_t SB_Handle::execute(
     Reduction<operator_t, params_t, input_t, output_t> reduction) {
   auto step_range = reduction.get_nd_range(SB_Handle::get_num_compute_units());
 
-  return {execute_tree<using_local_memory::enabled>(
-      q_, reduction, step_range.get_local_range()[0],
-      step_range.get_global_range()[0], params_t::get_local_memory_size())};
+  return {execute_reduction_tree(reduction, step_range.get_local_range()[0],
+                                 step_range.get_global_range()[0],
+                                 params_t::get_local_memory_size())};
 }
 
 }  // namespace blas
@@ -27,6 +27,7 @@
 #define SYCL_BLAS_VIEW_SYCL_HPP
 
 #include <CL/sycl.hpp>
+#include <cstdint>
 
 #include "blas_meta.h"
 #include "container/sycl_iterator.h"
@@ -181,6 +182,35 @@ struct VectorView<
     return *(ptr_ + indx);
   }
 
+  /**** PACKETS ****/
+  // Whether packets of vector_size elements can be loaded and stored with
+  // vector instructions: contiguous elements and an aligned first element.
+  template <int vector_size>
+  SYCL_BLAS_INLINE bool is_packet_aligned() const {
+    const auto address = reinterpret_cast<std::uintptr_t>(get_pointer());
+    return stride_ == 1 && address % (vector_size * sizeof(scalar_t)) == 0;
+  }
+
+  template <int vector_size>
+  SYCL_BLAS_INLINE cl::sycl::vec<scalar_t, vector_size> eval_packet(
+      index_t i) const {
+    using address_t = cl::sycl::access::address_space;
+    cl::sycl::vec<scalar_t, vector_size> packet;
+    packet.template load<address_t::global_space>(
+        0, cl::sycl::multi_ptr<const scalar_t, address_t::global_space>(
+               get_pointer() + i));
+    return packet;
+  }
+
+  template <int vector_size>
+  SYCL_BLAS_INLINE void store_packet(
+      index_t i, const cl::sycl::vec<scalar_t, vector_size> &packet) {
+    using address_t = cl::sycl::access::address_space;
+    packet.template store<address_t::global_space>(
+        0, cl::sycl::multi_ptr<scalar_t, address_t::global_space>(
+               get_pointer() + i));
+  }
+
   SYCL_BLAS_INLINE void bind(cl::sycl::handler &h) { h.require(data_); }
   SYCL_BLAS_INLINE void adjust_access_displacement() {
     ptr_ = data_.get_pointer() + disp_;
@@ -258,13 +288,11 @@ struct MatrixView<
   /**** EVALUATING ***/
 
   SYCL_BLAS_INLINE scalar_t &eval(index_t i, index_t j) {
-    return ((layout::is_col_major()) ? *(ptr_ + i + sizeL_ * j)
-                                     : *(ptr_ + j + sizeL_ * i));
+    return *(ptr_ + layout::offset(i, j, sizeR_, sizeL_));
   }
 
   SYCL_BLAS_INLINE scalar_t eval(index_t i, index_t j) const noexcept {
-    return ((layout::is_col_major()) ? *(ptr_ + i + sizeL_ * j)
-                                     : *(ptr_ + j + sizeL_ * i));
+    return *(ptr_ + layout::offset(i, j, sizeR_, sizeL_));
   }
 
   template <bool use_as_ptr = false>
@@ -76,7 +76,7 @@ const auto combi =
 #else
 template <typename scalar_t>
 const auto combi =
-    ::testing::Combine(::testing::Values(11, 1002),            // size
+    ::testing::Combine(::testing::Values(11, 1002, 262147),    // size
                        ::testing::Values<scalar_t>(0.0, 1.5),  // alpha
                        ::testing::Values(1, 4),                // incX
                        ::testing::Values(1, 3)                 // incY
@@ -26,17 +26,18 @@
 #include "blas_test.hpp"
 
 template <typename scalar_t>
-using combination_t = std::tuple<int, int, int>;
+using combination_t = std::tuple<int, int, int, int>;
 
 template <typename scalar_t>
 void run_test(const combination_t<scalar_t> combi) {
   index_t size;
   index_t incX;
   index_t incY;
-  std::tie(size, incX, incY) = combi;
+  index_t offsetX;
+  std::tie(size, incX, incY, offsetX) = combi;
 
-  // Input vector
-  std::vector<scalar_t> x_v(size * incX);
+  // Input vector, starting offsetX elements into the buffer
+  std::vector<scalar_t> x_v(offsetX + size * incX);
   fill_random(x_v);
 
   // Output vector
@@ -44,17 +45,19 @@ void run_test(const combination_t<scalar_t> combi) {
   std::vector<scalar_t> y_cpu_v(size * incY, 10.0);
 
   // Reference implementation
-  reference_blas::copy(size, x_v.data(), incX, y_cpu_v.data(), incY);
+  reference_blas::copy(size, x_v.data() + offsetX, incX, y_cpu_v.data(),
+                       incY);
 
   // SYCL implementation
   auto q = make_queue();
   blas::SB_Handle sb_handle(q);
 
   // Iterators
-  auto gpu_x_v = blas::make_sycl_iterator_buffer<scalar_t>(x_v, size * incX);
+  auto gpu_x_v =
+      blas::make_sycl_iterator_buffer<scalar_t>(x_v, offsetX + size * incX);
   auto gpu_y_v = blas::make_sycl_iterator_buffer<scalar_t>(y_v, size * incY);
 
-  _copy(sb_handle, size, gpu_x_v, incX, gpu_y_v, incY);
+  _copy(sb_handle, size, gpu_x_v + offsetX, incX, gpu_y_v, incY);
   auto event = blas::helper::copy_to_host(sb_handle.get_queue(), gpu_y_v,
                                           y_v.data(), size * incY);
   sb_handle.wait(event);
@@ -69,21 +72,23 @@ template <typename scalar_t>
 const auto combi = ::testing::Combine(::testing::Values(11, 65, 1002,
                                                         1002400),  // size
                                       ::testing::Values(1, 4),     // incX
-                                      ::testing::Values(1, 3)      // incY
+                                      ::testing::Values(1, 3),     // incY
+                                      ::testing::Values(0, 1)      // offsetX
 );
 #else
 template <typename scalar_t>
 const auto combi = ::testing::Combine(::testing::Values(11, 1002),  // size
                                       ::testing::Values(1, 4),      // incX
-                                      ::testing::Values(1, 3)       // incY
+                                      ::testing::Values(1, 3),      // incY
+                                      ::testing::Values(0, 1)       // offsetX
 );
 #endif
 
 template <class T>
 static std::string generate_name(
     const ::testing::TestParamInfo<combination_t<T>>& info) {
-  int size, incX, incY;
-  BLAS_GENERATE_NAME(info.param, size, incX, incY);
+  int size, incX, incY, offsetX;
+  BLAS_GENERATE_NAME(info.param, size, incX, incY, offsetX);
 }
 
 BLAS_REGISTER_TEST_ALL(Copy, combination_t, combi, generate_name);
@@ -0,0 +1,181 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas1_rot_batched_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+template <typename scalar_t>
+using combination_t = std::tuple<int, int, int>;
+
+template <typename scalar_t>
+void run_rotg_test(int size, int inc) {
+  std::vector<scalar_t> a_v(size * inc);
+  std::vector<scalar_t> b_v(size * inc);
+  std::vector<scalar_t> c_v(size * inc);
+  std::vector<scalar_t> s_v(size * inc);
+  fill_random(a_v);
+  fill_random(b_v);
+
+  auto q = make_queue();
+  blas::SB_Handle sb_handle(q);
+  auto a_gpu = blas::make_sycl_iterator_buffer<scalar_t>(a_v, a_v.size());
+  auto b_gpu = blas::make_sycl_iterator_buffer<scalar_t>(b_v, b_v.size());
+  auto c_gpu = blas::make_sycl_iterator_buffer<scalar_t>(c_v.size());
+  auto s_gpu = blas::make_sycl_iterator_buffer<scalar_t>(s_v.size());
+  auto event = _rotg_batched(sb_handle, size, a_gpu, inc, b_gpu, inc, c_gpu,
+                             inc, s_gpu, inc);
+  sb_handle.wait(event);
+
+  std::vector<scalar_t> a_out(a_v.size());
+  std::vector<scalar_t> b_out(b_v.size());
+  auto event1 = blas::helper::copy_to_host(sb_handle.get_queue(), a_gpu,
+                                           a_out.data(), a_out.size());
+  auto event2 = blas::helper::copy_to_host(sb_handle.get_queue(), b_gpu,
+                                           b_out.data(), b_out.size());
+  auto event3 = blas::helper::copy_to_host(sb_handle.get_queue(), c_gpu,
+                                           c_v.data(), c_v.size());
+  auto event4 = blas::helper::copy_to_host(sb_handle.get_queue(), s_gpu,
+                                           s_v.data(), s_v.size());
+  sb_handle.wait({event1, event2, event3, event4});
+
+  for (int i = 0; i < size * inc; i += inc) {
+    scalar_t a_ref = a_v[i];
+    scalar_t b_ref = b_v[i];
+    scalar_t c_ref;
+    scalar_t s_ref;
+    reference_blas::rotg(&a_ref, &b_ref, &c_ref, &s_ref);
+    ASSERT_TRUE(utils::almost_equal(a_out[i], a_ref));
+    ASSERT_TRUE(utils::almost_equal(b_out[i], b_ref));
+    ASSERT_TRUE(utils::almost_equal(c_v[i], c_ref));
+    ASSERT_TRUE(utils::almost_equal(s_v[i], s_ref));
+
+    /* The host-scalar rotg computes the same rotation without the device */
+    scalar_t a = a_v[i];
+    scalar_t b = b_v[i];
+    scalar_t c;
+    scalar_t s;
+    _rotg(sb_handle, a, b, c, s);
+    ASSERT_TRUE(utils::almost_equal(a, a_ref));
+    ASSERT_TRUE(utils::almost_equal(b, b_ref));
+    ASSERT_TRUE(utils::almost_equal(c, c_ref));
+    ASSERT_TRUE(utils::almost_equal(s, s_ref));
+  }
+}
+
+template <typename scalar_t>
+void run_rotmg_test(int size, int inc, int param_stride) {
+  constexpr int param_size = 5;
+  std::vector<scalar_t> d1_v(size * inc);
+  std::vector<scalar_t> d2_v(size * inc);
+  std::vector<scalar_t> x1_v(size * inc);
+  std::vector<scalar_t> y1_v(size * inc);
+  std::vector<scalar_t> param_v((size - 1) * param_stride + param_size);
+  fill_random_with_range(d1_v, scalar_t{1}, scalar_t{4});
+  fill_random_with_range(d2_v, scalar_t{1}, scalar_t{4});
+  fill_random_with_range(x1_v, scalar_t{1}, scalar_t{4});
+  fill_random(y1_v);
+
+  auto q = make_queue();
+  blas::SB_Handle sb_handle(q);
+  auto d1_gpu = blas::make_sycl_iterator_buffer<scalar_t>(d1_v, d1_v.size());
+  auto d2_gpu = blas::make_sycl_iterator_buffer<scalar_t>(d2_v, d2_v.size());
+  auto x1_gpu = blas::make_sycl_iterator_buffer<scalar_t>(x1_v, x1_v.size());
+  auto y1_gpu = blas::make_sycl_iterator_buffer<scalar_t>(y1_v, y1_v.size());
+  auto param_gpu =
+      blas::make_sycl_iterator_buffer<scalar_t>(param_v, param_v.size());
+  auto event =
+      _rotmg_batched(sb_handle, size, d1_gpu, inc, d2_gpu, inc, x1_gpu, inc,
+                     y1_gpu, inc, param_gpu, param_stride);
+  sb_handle.wait(event);
+
+  std::vector<scalar_t> d1_out(d1_v.size());
+  std::vector<scalar_t> d2_out(d2_v.size());
+  std::vector<scalar_t> x1_out(x1_v.size());
+  std::vector<scalar_t> param_out(param_v.size());
+  auto event1 = blas::helper::copy_to_host(sb_handle.get_queue(), d1_gpu,
+                                           d1_out.data(), d1_out.size());
+  auto event2 = blas::helper::copy_to_host(sb_handle.get_queue(), d2_gpu,
+                                           d2_out.data(), d2_out.size());
+  auto event3 = blas::helper::copy_to_host(sb_handle.get_queue(), x1_gpu,
+                                           x1_out.data(), x1_out.size());
+  auto event4 = blas::helper::copy_to_host(sb_handle.get_queue(), param_gpu,
+                                           param_out.data(), param_out.size());
+  sb_handle.wait({event1, event2, event3, event4});
+
+  for (int i = 0; i < size; ++i) {
+    /* The host-scalar rotmg computes the same transformation without the
+     * device */
+    scalar_t d1 = d1_v[i * inc];
+    scalar_t d2 = d2_v[i * inc];
+    scalar_t x1 = x1_v[i * inc];
+    scalar_t param[param_size];
+    _rotmg(sb_handle, d1, d2, x1, y1_v[i * inc], param);
+    ASSERT_TRUE(utils::almost_equal(d1_out[i * inc], d1));
+    ASSERT_TRUE(utils::almost_equal(d2_out[i * inc], d2));
+    ASSERT_TRUE(utils::almost_equal(x1_out[i * inc], x1));
+    ASSERT_EQ(param_out[i * param_stride], param[0]);
+    for (int j = 1; j < param_size; ++j) {
+      ASSERT_TRUE(utils::almost_equal(param_out[i * param_stride + j],
+                                      param[j]));
+    }
+
+    /* The inputs are positive and well scaled, so that the outputs match the
+     * reference without its implementation defined cases */
+    scalar_t d1_ref = d1_v[i * inc];
+    scalar_t d2_ref = d2_v[i * inc];
+    scalar_t x1_ref = x1_v[i * inc];
+    scalar_t y1_ref = y1_v[i * inc];
+    scalar_t param_ref[param_size];
+    reference_blas::rotmg(&d1_ref, &d2_ref, &x1_ref, &y1_ref, param_ref);
+    ASSERT_TRUE(utils::almost_equal(d1, d1_ref));
+    ASSERT_TRUE(utils::almost_equal(d2, d2_ref));
+    ASSERT_TRUE(utils::almost_equal(x1, x1_ref));
+    ASSERT_EQ(param[0], param_ref[0]);
+  }
+}
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  int size, inc, param_stride;
+  std::tie(size, inc, param_stride) = combi;
+
+  run_rotg_test<scalar_t>(size, inc);
+  run_rotmg_test<scalar_t>(size, inc, param_stride);
+}
+
+template <typename scalar_t>
+const auto combi =
+    ::testing::Combine(::testing::Values(1, 17, 1023),  // size
+                       ::testing::Values(1, 3),         // inc
+                       ::testing::Values(5, 8)          // param_stride
+    );
+
+template <class T>
+static std::string generate_name(
+    const ::testing::TestParamInfo<combination_t<T>>& info) {
+  int size, inc, param_stride;
+  BLAS_GENERATE_NAME(info.param, size, inc, param_stride);
+}
+
+BLAS_REGISTER_TEST_ALL(RotBatched, combination_t, combi, generate_name);
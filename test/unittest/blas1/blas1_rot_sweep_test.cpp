@@ -0,0 +1,170 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas1_rot_sweep_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+
+template <typename scalar_t>
+using combination_t = std::tuple<int, int, char, char, char>;
+
+/* Element pos of a line of the column major matrix with m rows, the lines
+ * being the rows for side 'l' and the columns for side 'r' */
+template <typename scalar_t>
+scalar_t& get_element(std::vector<scalar_t>& a, int m, char side, int line,
+                      int pos) {
+  return side == 'l' ? a[pos * m + line] : a[line * m + pos];
+}
+
+template <typename scalar_t>
+void rotate(std::vector<scalar_t>& a, int m, int n, char side, int p, int q,
+            scalar_t c, scalar_t s) {
+  const int size = side == 'l' ? n : m;
+  for (int i = 0; i < size; ++i) {
+    scalar_t& x = get_element(a, m, side, p, i);
+    scalar_t& y = get_element(a, m, side, q, i);
+    const scalar_t x_val = x;
+    x = c * x_val + s * y;
+    y = c * y - s * x_val;
+  }
+}
+
+template <typename scalar_t>
+void fill_rotations(std::vector<scalar_t>& c, std::vector<scalar_t>& s) {
+  for (size_t i = 0; i < c.size(); ++i) {
+    const scalar_t theta = random_scalar(scalar_t{-3}, scalar_t{3});
+    c[i] = std::cos(theta);
+    s[i] = std::sin(theta);
+  }
+}
+
+template <typename scalar_t>
+void run_rot_batched_test(int m, int n, char side) {
+  const int num_lines = side == 'l' ? m : n;
+  const int batch_size = num_lines / 2;
+  if (batch_size == 0) {
+    return;
+  }
+  std::vector<scalar_t> a_m(m * n);
+  std::vector<scalar_t> c_v(batch_size);
+  std::vector<scalar_t> s_v(batch_size);
+  fill_random(a_m);
+  fill_rotations(c_v, s_v);
+
+  // Disjoint pairs of rows or columns in a random order
+  std::vector<index_t> pairs(num_lines);
+  std::iota(pairs.begin(), pairs.end(), index_t{0});
+  std::shuffle(pairs.begin(), pairs.end(), std::mt19937{42});
+  pairs.resize(2 * batch_size);
+
+  std::vector<scalar_t> a_ref = a_m;
+  for (int k = 0; k < batch_size; ++k) {
+    rotate(a_ref, m, n, side, pairs[2 * k], pairs[2 * k + 1], c_v[k], s_v[k]);
+  }
+
+  auto q = make_queue();
+  blas::SB_Handle sb_handle(q);
+  auto a_gpu = blas::make_sycl_iterator_buffer<scalar_t>(a_m, a_m.size());
+  auto c_gpu = blas::make_sycl_iterator_buffer<scalar_t>(c_v, c_v.size());
+  auto s_gpu = blas::make_sycl_iterator_buffer<scalar_t>(s_v, s_v.size());
+  auto pairs_gpu =
+      blas::make_sycl_iterator_buffer<index_t>(pairs, pairs.size());
+  auto event = _rot_batched(sb_handle, side, m, n, batch_size, a_gpu, m, c_gpu,
+                            s_gpu, pairs_gpu);
+  sb_handle.wait(event);
+
+  auto event_copy = blas::helper::copy_to_host(sb_handle.get_queue(), a_gpu,
+                                               a_m.data(), a_m.size());
+  sb_handle.wait(event_copy);
+
+  ASSERT_TRUE(utils::compare_vectors(a_m, a_ref));
+}
+
+template <typename scalar_t>
+void run_lasr_test(int m, int n, char side, char pivot, char direct) {
+  const int z = side == 'l' ? m : n;
+  if (z < 2) {
+    return;
+  }
+  std::vector<scalar_t> a_m(m * n);
+  std::vector<scalar_t> c_v(z - 1);
+  std::vector<scalar_t> s_v(z - 1);
+  fill_random(a_m);
+  fill_rotations(c_v, s_v);
+
+  std::vector<scalar_t> a_ref = a_m;
+  for (int step = 0; step < z - 1; ++step) {
+    const int j = direct == 'f' ? step : z - 2 - step;
+    const int p = pivot == 't' ? 0 : j;
+    const int q = pivot == 'b' ? z - 1 : j + 1;
+    rotate(a_ref, m, n, side, p, q, c_v[j], s_v[j]);
+  }
+
+  auto q = make_queue();
+  blas::SB_Handle sb_handle(q);
+  auto a_gpu = blas::make_sycl_iterator_buffer<scalar_t>(a_m, a_m.size());
+  auto c_gpu = blas::make_sycl_iterator_buffer<scalar_t>(c_v, c_v.size());
+  auto s_gpu = blas::make_sycl_iterator_buffer<scalar_t>(s_v, s_v.size());
+  auto event =
+      _lasr(sb_handle, side, pivot, direct, m, n, c_gpu, s_gpu, a_gpu, m);
+  sb_handle.wait(event);
+
+  auto event_copy = blas::helper::copy_to_host(sb_handle.get_queue(), a_gpu,
+                                               a_m.data(), a_m.size());
+  sb_handle.wait(event_copy);
+
+  ASSERT_TRUE(utils::compare_vectors(a_m, a_ref));
+}
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  int m, n;
+  char side, pivot, direct;
+  std::tie(m, n, side, pivot, direct) = combi;
+
+  run_rot_batched_test<scalar_t>(m, n, side);
+  run_lasr_test<scalar_t>(m, n, side, pivot, direct);
+}
+
+template <typename scalar_t>
+const auto combi =
+    ::testing::Combine(::testing::Values(1, 33, 70),       // m
+                       ::testing::Values(5, 65),           // n
+                       ::testing::Values('l', 'r'),        // side
+                       ::testing::Values('v', 't', 'b'),   // pivot
+                       ::testing::Values('f', 'b')         // direct
+    );
+
+template <class T>
+static std::string generate_name(
+    const ::testing::TestParamInfo<combination_t<T>>& info) {
+  int m, n;
+  char side, pivot, direct;
+  BLAS_GENERATE_NAME(info.param, m, n, side, pivot, direct);
+}
+
+BLAS_REGISTER_TEST_ALL(RotSweep, combination_t, combi, generate_name);
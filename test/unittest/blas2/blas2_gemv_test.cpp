@@ -26,7 +26,8 @@
 #include "blas_test.hpp"
 
 template <typename T>
-using combination_t = std::tuple<int, int, T, T, bool, int, int, int>;
+using combination_t =
+    std::tuple<int, int, T, T, bool, int, int, int, bool, bool>;
 
 template <typename scalar_t>
 void run_test(const combination_t<scalar_t> combi) {
@@ -38,7 +39,10 @@ void run_test(const combination_t<scalar_t> combi) {
   index_t incX;
   index_t incY;
   index_t lda_mul;
-  std::tie(m, n, alpha, beta, trans, incX, incY, lda_mul) = combi;
+  bool const_input;
+  bool row_major;
+  std::tie(m, n, alpha, beta, trans, incX, incY, lda_mul, const_input,
+           row_major) = combi;
 
   const char* t_str = trans ? "t" : "n";
 
@@ -62,6 +66,17 @@ void run_test(const combination_t<scalar_t> combi) {
   reference_blas::gemv(t_str, m, n, alpha, a_m.data(), lda_mul * m, x_v.data(),
                        incX, beta, y_v_cpu.data(), incY);
 
+  if (row_major) {
+    // Same matrix, stored row by row with a leading dimension of lda_mul * n
+    std::vector<scalar_t> a_m_row_major(a_size);
+    for (int i = 0; i < m; ++i) {
+      for (int j = 0; j < n; ++j) {
+        a_m_row_major[i * lda_mul * n + j] = a_m[i + j * lda_mul * m];
+      }
+    }
+    a_m = a_m_row_major;
+  }
+
   auto q = make_queue();
   blas::SB_Handle sb_handle(q);
   auto m_a_gpu = blas::make_sycl_iterator_buffer<scalar_t>(a_m, a_size);
@@ -70,8 +85,19 @@ void run_test(const combination_t<scalar_t> combi) {
       blas::make_sycl_iterator_buffer<scalar_t>(y_v_gpu_result, y_size);
 
   // SYCLGEMV
-  _gemv(sb_handle, *t_str, m, n, alpha, m_a_gpu, lda_mul * m, v_x_gpu, incX,
-        beta, v_y_gpu, incY);
+  if (row_major) {
+    _gemv(sb_handle, blas::access_layout::row_major, *t_str, m, n, alpha,
+          m_a_gpu, lda_mul * n, v_x_gpu, incX, beta, v_y_gpu, incY);
+  } else if (const_input) {
+    // Read-only inputs run the kernels instantiated for mutable buffers
+    blas::BufferIterator<const scalar_t> m_a_const(m_a_gpu);
+    blas::BufferIterator<const scalar_t> v_x_const(v_x_gpu);
+    _gemv(sb_handle, *t_str, m, n, alpha, m_a_const, lda_mul * m, v_x_const,
+          incX, beta, v_y_gpu, incY);
+  } else {
+    _gemv(sb_handle, *t_str, m, n, alpha, m_a_gpu, lda_mul * m, v_x_gpu, incX,
+          beta, v_y_gpu, incY);
+  }
   auto event = blas::helper::copy_to_host(sb_handle.get_queue(), v_y_gpu,
                                           y_v_gpu_result.data(), y_size);
   sb_handle.wait(event);
@@ -90,7 +116,9 @@ const auto combi =
                        ::testing::Values(true, false),              // trans
                        ::testing::Values(1, 2),                     // incX
                        ::testing::Values(1, 3),                     // incY
-                       ::testing::Values(1, 2)                      // lda_mul
+                       ::testing::Values(1, 2),                     // lda_mul
+                       ::testing::Values(false, true),  // const_input
+                       ::testing::Values(false, true)   // row_major
     );
 #else
 // For the purpose of travis and other slower platforms, we need a faster test
@@ -104,7 +132,9 @@ const auto combi =
                        ::testing::Values(false, true),         // trans
                        ::testing::Values(2),                   // incX
                        ::testing::Values(3),                   // incY
-                       ::testing::Values(2)                    // lda_mul
+                       ::testing::Values(2),                   // lda_mul
+                       ::testing::Values(false, true),         // const_input
+                       ::testing::Values(false, true)          // row_major
     );
 #endif
 
@@ -113,8 +143,9 @@ static std::string generate_name(
     const ::testing::TestParamInfo<combination_t<T>>& info) {
   int m, n, incX, incY, ldaMul;
   T alpha, beta;
-  bool trans;
-  BLAS_GENERATE_NAME(info.param, m, n, alpha, beta, trans, incX, incY, ldaMul);
+  bool trans, constInput, rowMajor;
+  BLAS_GENERATE_NAME(info.param, m, n, alpha, beta, trans, incX, incY, ldaMul,
+                     constInput, rowMajor);
 }
 
 BLAS_REGISTER_TEST_ALL(Gemv, combination_t, combi, generate_name);
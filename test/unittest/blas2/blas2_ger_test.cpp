@@ -26,7 +26,7 @@
 #include "blas_test.hpp"
 
 template <typename scalar_t>
-using combination_t = std::tuple<int, int, scalar_t, int, int, int>;
+using combination_t = std::tuple<int, int, scalar_t, int, int, int, bool>;
 
 template <typename scalar_t>
 void run_test(const combination_t<scalar_t> combi) {
@@ -36,8 +36,11 @@ void run_test(const combination_t<scalar_t> combi) {
   index_t incX;
   index_t incY;
   scalar_t alpha;
-  std::tie(m, n, alpha, incX, incY, lda_mul) = combi;
+  bool row_major;
+  std::tie(m, n, alpha, incX, incY, lda_mul, row_major) = combi;
   index_t lda = m * lda_mul;
+  // Row-major A is stored in a buffer of the same size, row by row
+  index_t lda_row_major = n * lda_mul;
 
   // Input matrix
   std::vector<scalar_t> a_v(m * incX);
@@ -62,12 +65,28 @@ void run_test(const combination_t<scalar_t> combi) {
       blas::make_sycl_iterator_buffer<scalar_t>(c_m_gpu_result, lda * n);
 
   // SYCLger
-  _ger(sb_handle, m, n, alpha, v_a_gpu, incX, v_b_gpu, incY, m_c_gpu, lda);
+  if (row_major) {
+    _ger(sb_handle, blas::access_layout::row_major, m, n, alpha, v_a_gpu, incX,
+         v_b_gpu, incY, m_c_gpu, lda_row_major);
+  } else {
+    _ger(sb_handle, m, n, alpha, v_a_gpu, incX, v_b_gpu, incY, m_c_gpu, lda);
+  }
 
   auto event = blas::helper::copy_to_host(sb_handle.get_queue(), m_c_gpu,
                                           c_m_gpu_result.data(), lda * n);
   sb_handle.wait(event);
 
+  if (row_major) {
+    // Back to column-major storage for the comparison
+    std::vector<scalar_t> c_m_col_major(lda * n, scalar_t(10));
+    for (int i = 0; i < m; ++i) {
+      for (int j = 0; j < n; ++j) {
+        c_m_col_major[i + j * lda] = c_m_gpu_result[i * lda_row_major + j];
+      }
+    }
+    c_m_gpu_result = c_m_col_major;
+  }
+
   const bool isAlmostEqual = utils::compare_vectors(c_m_gpu_result, c_m_cpu);
   ASSERT_TRUE(isAlmostEqual);
 }
@@ -80,7 +99,8 @@ const auto combi =
                        ::testing::Values<scalar_t>(0.0, 1.0, 1.5),  // alpha
                        ::testing::Values(1, 2),                     // incX
                        ::testing::Values(1, 3),                     // incY
-                       ::testing::Values(1, 2)                      // lda_mul
+                       ::testing::Values(1, 2),                     // lda_mul
+                       ::testing::Values(false, true)  // row_major
     );
 #else
 // For the purpose of travis and other slower platforms, we need a faster test
@@ -91,7 +111,8 @@ const auto combi =
                        ::testing::Values<scalar_t>(0.0, 1.5),  // alpha
                        ::testing::Values(2),                   // incX
                        ::testing::Values(3),                   // incY
-                       ::testing::Values(2)                    // lda_mul
+                       ::testing::Values(2),                   // lda_mul
+                       ::testing::Values(false, true)          // row_major
     );
 #endif
 
@@ -100,7 +121,8 @@ static std::string generate_name(
     const ::testing::TestParamInfo<combination_t<T>>& info) {
   int m, n, incX, incY, ldaMul;
   T alpha;
-  BLAS_GENERATE_NAME(info.param, m, n, alpha, incX, incY, ldaMul);
+  bool rowMajor;
+  BLAS_GENERATE_NAME(info.param, m, n, alpha, incX, incY, ldaMul, rowMajor);
 }
 
 BLAS_REGISTER_TEST_ALL(Ger, combination_t, combi, generate_name);
@@ -0,0 +1,89 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas2_gerk_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+template <typename scalar_t>
+using combination_t = std::tuple<int, int, int, scalar_t, int>;
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  index_t m;
+  index_t n;
+  index_t k;
+  scalar_t alpha;
+  index_t ld_mul;
+  std::tie(m, n, k, alpha, ld_mul) = combi;
+  const index_t ldx = m * ld_mul;
+  const index_t ldy = n * ld_mul;
+  const index_t lda = m * ld_mul;
+
+  std::vector<scalar_t> x_m(ldx * k);
+  std::vector<scalar_t> y_m(ldy * k);
+  std::vector<scalar_t> a_m(lda * n);
+  fill_random(x_m);
+  fill_random(y_m);
+  fill_random(a_m);
+  std::vector<scalar_t> a_cpu = a_m;
+
+  // The rank-k update is the sum of k rank-1 updates
+  for (index_t p = 0; p < k; ++p) {
+    reference_blas::ger(m, n, alpha, x_m.data() + p * ldx, 1,
+                        y_m.data() + p * ldy, 1, a_cpu.data(), lda);
+  }
+
+  auto q = make_queue();
+  blas::SB_Handle sb_handle(q);
+  auto x_gpu = blas::make_sycl_iterator_buffer<scalar_t>(x_m, x_m.size());
+  auto y_gpu = blas::make_sycl_iterator_buffer<scalar_t>(y_m, y_m.size());
+  auto a_gpu = blas::make_sycl_iterator_buffer<scalar_t>(a_m, a_m.size());
+
+  _gerk(sb_handle, m, n, k, alpha, x_gpu, ldx, y_gpu, ldy, a_gpu, lda);
+
+  auto event = blas::helper::copy_to_host(sb_handle.get_queue(), a_gpu,
+                                          a_m.data(), a_m.size());
+  sb_handle.wait(event);
+
+  ASSERT_TRUE(utils::compare_vectors(a_m, a_cpu));
+}
+
+template <typename scalar_t>
+const auto combi =
+    ::testing::Combine(::testing::Values(11, 257, 1023),       // m
+                       ::testing::Values(14, 1010),            // n
+                       ::testing::Values(1, 3, 9),             // k
+                       ::testing::Values<scalar_t>(0.0, 1.5),  // alpha
+                       ::testing::Values(1, 2)                 // ld_mul
+    );
+
+template <class T>
+static std::string generate_name(
+    const ::testing::TestParamInfo<combination_t<T>>& info) {
+  int m, n, k, ldMul;
+  T alpha;
+  BLAS_GENERATE_NAME(info.param, m, n, k, alpha, ldMul);
+}
+
+BLAS_REGISTER_TEST_ALL(Gerk, combination_t, combi, generate_name);
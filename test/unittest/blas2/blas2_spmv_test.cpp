@@ -0,0 +1,114 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas2_spmv_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+template <typename T>
+using combination_t = std::tuple<char, int, T, T, int, int>;
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  char uplo;
+  index_t n;
+  scalar_t alpha;
+  scalar_t beta;
+  index_t incX;
+  index_t incY;
+  std::tie(uplo, n, alpha, beta, incX, incY) = combi;
+
+  const int64_t a_size = static_cast<int64_t>(n) * (n + 1) / 2;
+  int x_size = 1 + (n - 1) * incX;
+  int y_size = 1 + (n - 1) * incY;
+
+  // Input packed matrix
+  std::vector<scalar_t> a_p(a_size, 10.0);
+  // Input Vector
+  std::vector<scalar_t> x_v(x_size, 10.0);
+  // output Vector
+  std::vector<scalar_t> y_v_gpu_result(y_size, scalar_t(10.0));
+  // output system vector
+  std::vector<scalar_t> y_v_cpu(y_size, scalar_t(10.0));
+
+  fill_random(a_p);
+  fill_random(x_v);
+
+  // SYSTEM SPMV
+  reference_blas::spmv(&uplo, n, alpha, a_p.data(), x_v.data(), incX, beta,
+                       y_v_cpu.data(), incY);
+
+  auto q = make_queue();
+  blas::SB_Handle sb_handle(q);
+  auto m_a_gpu = blas::make_sycl_iterator_buffer<scalar_t>(a_p, a_size);
+  auto v_x_gpu = blas::make_sycl_iterator_buffer<scalar_t>(x_v, x_size);
+  auto v_y_gpu =
+      blas::make_sycl_iterator_buffer<scalar_t>(y_v_gpu_result, y_size);
+
+  // SYCLSPMV
+  _spmv(sb_handle, uplo, n, alpha, m_a_gpu, v_x_gpu, incX, beta, v_y_gpu,
+        incY);
+
+  auto event = blas::helper::copy_to_host(sb_handle.get_queue(), v_y_gpu,
+                                          y_v_gpu_result.data(), y_size);
+  sb_handle.wait(event);
+
+  const bool isAlmostEqual = utils::compare_vectors(y_v_gpu_result, y_v_cpu);
+  ASSERT_TRUE(isAlmostEqual);
+}
+
+#ifdef STRESS_TESTING
+// n = 46341 is the first size where j * (j + 1) no longer fits in 32 bits in
+// the offset of the packed columns
+template <typename scalar_t>
+const auto combi =
+    ::testing::Combine(::testing::Values('u', 'l'),                  // uplo
+                       ::testing::Values(14, 63, 257, 1010, 46341),  // n
+                       ::testing::Values<scalar_t>(0.0, 1.0, 1.5),   // alpha
+                       ::testing::Values<scalar_t>(0.0, 1.0, 1.5),   // beta
+                       ::testing::Values(1, 2),                      // incX
+                       ::testing::Values(1, 3)                       // incY
+    );
+#else
+// For the purpose of travis and other slower platforms, we need a faster test
+template <typename scalar_t>
+const auto combi =
+    ::testing::Combine(::testing::Values('u', 'l'),            // uplo
+                       ::testing::Values(14, 1010),            // n
+                       ::testing::Values<scalar_t>(1.5),       // alpha
+                       ::testing::Values<scalar_t>(0.0, 1.5),  // beta
+                       ::testing::Values(2),                   // incX
+                       ::testing::Values(3)                    // incY
+    );
+#endif
+
+template <class T>
+static std::string generate_name(
+    const ::testing::TestParamInfo<combination_t<T>>& info) {
+  char uplo;
+  int n, incX, incY;
+  T alpha, beta;
+  BLAS_GENERATE_NAME(info.param, uplo, n, alpha, beta, incX, incY);
+}
+
+BLAS_REGISTER_TEST_ALL(Spmv, combination_t, combi, generate_name);
@@ -0,0 +1,99 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas2_spr_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+template <typename T>
+using combination_t = std::tuple<char, int, T, int>;
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  char uplo;
+  index_t n;
+  scalar_t alpha;
+  index_t incX;
+  std::tie(uplo, n, alpha, incX) = combi;
+
+  const int64_t a_size = static_cast<int64_t>(n) * (n + 1) / 2;
+  int x_size = 1 + (n - 1) * incX;
+
+  // Input vector
+  std::vector<scalar_t> x_v(x_size);
+  fill_random(x_v);
+
+  // Output packed matrix
+  std::vector<scalar_t> a_p(a_size, 7.0);
+  std::vector<scalar_t> a_cpu_p(a_size, 7.0);
+
+  // SYSTEM SPR
+  reference_blas::spr(&uplo, n, alpha, x_v.data(), incX, a_cpu_p.data());
+
+  auto q = make_queue();
+  blas::SB_Handle sb_handle(q);
+  auto x_v_gpu = blas::make_sycl_iterator_buffer<scalar_t>(x_v, x_size);
+  auto a_p_gpu = blas::make_sycl_iterator_buffer<scalar_t>(a_p, a_size);
+
+  // SYCLSPR
+  _spr(sb_handle, uplo, n, alpha, x_v_gpu, incX, a_p_gpu);
+
+  auto event = blas::helper::copy_to_host(sb_handle.get_queue(), a_p_gpu,
+                                          a_p.data(), a_size);
+  sb_handle.wait(event);
+
+  const bool isAlmostEqual = utils::compare_vectors(a_p, a_cpu_p);
+  ASSERT_TRUE(isAlmostEqual);
+}
+
+#ifdef STRESS_TESTING
+// n = 23171 is the first size where 8 * p + 1 no longer fits in 32 bits when
+// the packed index p is mapped back to its column
+template <typename scalar_t>
+const auto combi = ::testing::Combine(
+    ::testing::Values('u', 'l'),                        // UPLO
+    ::testing::Values(14, 63, 257, 1010, 2025, 23171),  // n
+    ::testing::Values<scalar_t>(0.0, 1.0, 1.5),         // alpha
+    ::testing::Values(1, 2)                             // incX
+);
+#else
+// For the purpose of travis and other slower platforms, we need a faster test
+template <typename scalar_t>
+const auto combi =
+    ::testing::Combine(::testing::Values('u', 'l'),       // UPLO
+                       ::testing::Values(14, 1010),       // n
+                       ::testing::Values<scalar_t>(1.5),  // alpha
+                       ::testing::Values(2)               // incX
+    );
+#endif
+
+template <class T>
+static std::string generate_name(
+    const ::testing::TestParamInfo<combination_t<T>>& info) {
+  char uplo;
+  int n, incX;
+  T alpha;
+  BLAS_GENERATE_NAME(info.param, uplo, n, alpha, incX);
+}
+
+BLAS_REGISTER_TEST_ALL(Spr, combination_t, combi, generate_name);
@@ -0,0 +1,106 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas2_tbmv_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+template <typename scalar_t>
+using combination_t = std::tuple<char, char, char, int, int, int, int>;
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  char uplo;
+  char trans;
+  char diag;
+  index_t n;
+  index_t k;
+  index_t incX;
+  index_t lda_mul;
+  std::tie(uplo, trans, diag, n, k, incX, lda_mul) = combi;
+  index_t lda = (k + 1) * lda_mul;
+  int x_size = 1 + (n - 1) * incX;
+
+  // Input band matrix
+  std::vector<scalar_t> a_m(lda * n);
+  fill_random(a_m);
+
+  // Output Vector
+  std::vector<scalar_t> x_v(x_size);
+  fill_random(x_v);
+  std::vector<scalar_t> x_cpu_v(x_v);
+
+  // SYSTEM TBMV
+  reference_blas::tbmv(&uplo, &trans, &diag, n, k, a_m.data(), lda,
+                       x_cpu_v.data(), incX);
+
+  auto q = make_queue();
+  blas::SB_Handle sb_handle(q);
+  auto a_m_gpu = blas::make_sycl_iterator_buffer<scalar_t>(a_m, lda * n);
+  auto x_v_gpu = blas::make_sycl_iterator_buffer<scalar_t>(x_v, x_size);
+
+  // SYCLTBMV
+  _tbmv(sb_handle, uplo, trans, diag, n, k, a_m_gpu, lda, x_v_gpu, incX);
+
+  auto event = blas::helper::copy_to_host(sb_handle.get_queue(), x_v_gpu,
+                                          x_v.data(), x_size);
+  sb_handle.wait(event);
+
+  const bool isAlmostEqual = utils::compare_vectors(x_v, x_cpu_v);
+  ASSERT_TRUE(isAlmostEqual);
+}
+
+#ifdef STRESS_TESTING
+template <typename scalar_t>
+const auto combi =
+    ::testing::Combine(::testing::Values('u', 'l'),                 // UPLO
+                       ::testing::Values('n', 't'),                 // TRANS
+                       ::testing::Values('u', 'n'),                 // DIAG
+                       ::testing::Values(14, 63, 257, 1010, 2025),  // n
+                       ::testing::Values(1, 4, 9),                  // k
+                       ::testing::Values(1, 2),                     // incX
+                       ::testing::Values(1, 2)                      // lda_mul
+    );
+#else
+// For the purpose of travis and other slower platforms, we need a faster test
+template <typename scalar_t>
+const auto combi =
+    ::testing::Combine(::testing::Values('u', 'l'),  // UPLO
+                       ::testing::Values('n', 't'),  // TRANS
+                       ::testing::Values('u', 'n'),  // DIAG
+                       ::testing::Values(2025),      // n
+                       ::testing::Values(3),         // k
+                       ::testing::Values(2),         // incX
+                       ::testing::Values(2)          // lda_mul
+    );
+#endif
+
+template <class T>
+static std::string generate_name(
+    const ::testing::TestParamInfo<combination_t<T>>& info) {
+  char upl0, trans, diag;
+  int n, k, incX, ldaMul;
+  BLAS_GENERATE_NAME(info.param, upl0, trans, diag, n, k, incX, ldaMul);
+}
+
+BLAS_REGISTER_TEST_ALL(Tbmv, combination_t, combi, generate_name);
@@ -0,0 +1,102 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas2_tpmv_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+template <typename scalar_t>
+using combination_t = std::tuple<char, char, char, int, int>;
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  char uplo;
+  char trans;
+  char diag;
+  index_t n;
+  index_t incX;
+  std::tie(uplo, trans, diag, n, incX) = combi;
+  const int64_t a_size = static_cast<int64_t>(n) * (n + 1) / 2;
+  int x_size = 1 + (n - 1) * incX;
+
+  // Input packed matrix
+  std::vector<scalar_t> a_p(a_size);
+  fill_random(a_p);
+
+  // Output Vector
+  std::vector<scalar_t> x_v(x_size);
+  fill_random(x_v);
+  std::vector<scalar_t> x_cpu_v(x_v);
+
+  // SYSTEM TPMV
+  reference_blas::tpmv(&uplo, &trans, &diag, n, a_p.data(), x_cpu_v.data(),
+                       incX);
+
+  auto q = make_queue();
+  blas::SB_Handle sb_handle(q);
+  auto a_p_gpu = blas::make_sycl_iterator_buffer<scalar_t>(a_p, a_size);
+  auto x_v_gpu = blas::make_sycl_iterator_buffer<scalar_t>(x_v, x_size);
+
+  // SYCLTPMV
+  _tpmv(sb_handle, uplo, trans, diag, n, a_p_gpu, x_v_gpu, incX);
+
+  auto event = blas::helper::copy_to_host(sb_handle.get_queue(), x_v_gpu,
+                                          x_v.data(), x_size);
+  sb_handle.wait(event);
+
+  const bool isAlmostEqual = utils::compare_vectors(x_v, x_cpu_v);
+  ASSERT_TRUE(isAlmostEqual);
+}
+
+#ifdef STRESS_TESTING
+// n = 46341 is the first size where j * (j + 1) no longer fits in 32 bits in
+// the offset of the packed columns
+template <typename scalar_t>
+const auto combi = ::testing::Combine(
+    ::testing::Values('u', 'l'),                        // UPLO
+    ::testing::Values('n', 't'),                        // TRANS
+    ::testing::Values('u', 'n'),                        // DIAG
+    ::testing::Values(14, 63, 257, 1010, 2025, 46341),  // n
+    ::testing::Values(1, 2)                             // incX
+);
+#else
+// For the purpose of travis and other slower platforms, we need a faster test
+template <typename scalar_t>
+const auto combi =
+    ::testing::Combine(::testing::Values('u', 'l'),  // UPLO
+                       ::testing::Values('n', 't'),  // TRANS
+                       ::testing::Values('u', 'n'),  // DIAG
+                       ::testing::Values(2025),      // n
+                       ::testing::Values(2)          // incX
+    );
+#endif
+
+template <class T>
+static std::string generate_name(
+    const ::testing::TestParamInfo<combination_t<T>>& info) {
+  char upl0, trans, diag;
+  int n, incX;
+  BLAS_GENERATE_NAME(info.param, upl0, trans, diag, n, incX);
+}
+
+BLAS_REGISTER_TEST_ALL(Tpmv, combination_t, combi, generate_name);
@@ -0,0 +1,115 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas2_trsv_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+template <typename scalar_t>
+using combination_t = std::tuple<char, char, char, int, int, int, scalar_t>;
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  char uplo;
+  char trans;
+  char diag;
+  index_t n;
+  index_t incX;
+  index_t lda_mul;
+  scalar_t unused_value;
+  std::tie(uplo, trans, diag, n, incX, lda_mul, unused_value) = combi;
+  index_t lda = n * lda_mul;
+  int x_size = 1 + (n - 1) * incX;
+
+  // Input triangular matrix, the other triangle holding unused_value
+  std::vector<scalar_t> a_m(lda * n);
+  const scalar_t diag_value =
+      diag == 'u' ? scalar_t{1} : random_scalar(scalar_t{1}, scalar_t{10});
+  fill_trsm_matrix(a_m, n, lda, uplo, diag_value, unused_value);
+
+  // Right-hand side, overwritten with the solution
+  std::vector<scalar_t> x_v(x_size);
+  fill_random(x_v);
+  std::vector<scalar_t> x_cpu_v(x_v);
+
+  // SYSTEM TRSV
+  reference_blas::trsv(&uplo, &trans, &diag, n, a_m.data(), lda,
+                       x_cpu_v.data(), incX);
+
+  auto q = make_queue();
+  blas::SB_Handle sb_handle(q);
+  auto a_m_gpu = blas::make_sycl_iterator_buffer<scalar_t>(a_m, lda * n);
+  auto x_v_gpu = blas::make_sycl_iterator_buffer<scalar_t>(x_v, x_size);
+
+  // SYCLTRSV
+  _trsv(sb_handle, uplo, trans, diag, n, a_m_gpu, lda, x_v_gpu, incX);
+
+  auto event = blas::helper::copy_to_host(sb_handle.get_queue(), x_v_gpu,
+                                          x_v.data(), x_size);
+  sb_handle.wait(event);
+
+  const bool isAlmostEqual = utils::compare_vectors(x_v, x_cpu_v);
+  ASSERT_TRUE(isAlmostEqual);
+}
+
+static constexpr double NaN = std::numeric_limits<double>::quiet_NaN();
+
+#ifdef STRESS_TESTING
+template <typename scalar_t>
+const auto combi =
+    ::testing::Combine(::testing::Values('u', 'l'),              // UPLO
+                       ::testing::Values('n', 't'),              // TRANS
+                       ::testing::Values('u', 'n'),              // DIAG
+                       ::testing::Values(7, 32, 63, 257, 1027),  // n
+                       ::testing::Values(1, 2),                  // incX
+                       ::testing::Values(1, 2),                  // lda_mul
+                       ::testing::Values<scalar_t>(0.0, NaN)     // unused
+    );
+#else
+// For the purpose of travis and other slower platforms, we need a faster test
+template <typename scalar_t>
+const auto combi =
+    ::testing::Combine(::testing::Values('u', 'l'),         // UPLO
+                       ::testing::Values('n', 't'),         // TRANS
+                       ::testing::Values('u', 'n'),         // DIAG
+                       ::testing::Values(7, 257),           // n
+                       ::testing::Values(2),                // incX
+                       ::testing::Values(2),                // lda_mul
+                       ::testing::Values<scalar_t>(NaN)     // unused
+    );
+#endif
+
+// unused is a value that will be placed in the other triangle of the matrix
+// and is not meant to be accessed by the trsv implementation
+
+template <class T>
+static std::string generate_name(
+    const ::testing::TestParamInfo<combination_t<T>>& info) {
+  char upl0, trans, diag;
+  int n, incX, ldaMul;
+  T unusedValue;
+  BLAS_GENERATE_NAME(info.param, upl0, trans, diag, n, incX, ldaMul,
+                     unusedValue);
+}
+
+BLAS_REGISTER_TEST_ALL(Trsv, combination_t, combi, generate_name);
@@ -0,0 +1,121 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas3_gemm_model_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+#include <sstream>
+
+template <typename scalar_t>
+using combination_t = std::tuple<int, int, int, char, char>;
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  int m, n, k;
+  char transa, transb;
+  std::tie(m, n, k, transa, transb) = combi;
+
+  const int lda = transa == 'n' ? m : k;
+  const int ldb = transb == 'n' ? k : n;
+  const int ldc = m;
+  std::vector<scalar_t> a_m(m * k);
+  std::vector<scalar_t> b_m(k * n);
+  std::vector<scalar_t> c_m(m * n);
+  fill_random(a_m);
+  fill_random(b_m);
+  fill_random(c_m);
+  std::vector<scalar_t> c_m_cpu = c_m;
+  const char ta_str[2] = {transa, '\0'};
+  const char tb_str[2] = {transb, '\0'};
+  reference_blas::gemm(ta_str, tb_str, m, n, k, scalar_t(1.5), a_m.data(),
+                       lda, b_m.data(), ldb, scalar_t(0.5), c_m_cpu.data(),
+                       ldc);
+
+  auto q = make_queue();
+  blas::SB_Handle sb_handle(q);
+  blas::GemmModel model(sb_handle.get_num_compute_units(),
+                        sb_handle.get_work_group_size(), 1000, 100);
+  sb_handle.set_gemm_model(&model);
+  const auto configs = blas::get_gemm_model_configs(
+      sb_handle.get_tuning_target(), sizeof(scalar_t));
+  const blas::GemmShape shape{m, n, k, 1, sizeof(scalar_t), false};
+
+  // Every configuration the model can pick is the one launched and computes
+  // the same product, and the last run lets the model choose
+  const int num_runs = static_cast<int>(configs.size()) + 1;
+  for (int config = 0; config < num_runs; ++config) {
+    const bool forced = config < num_runs - 1;
+    model.set_forced_config(forced ? config : -1);
+    auto a_gpu = blas::make_sycl_iterator_buffer<scalar_t>(a_m, a_m.size());
+    auto b_gpu = blas::make_sycl_iterator_buffer<scalar_t>(b_m, b_m.size());
+    auto c_gpu = blas::make_sycl_iterator_buffer<scalar_t>(c_m, c_m.size());
+    _gemm(sb_handle, transa, transb, m, n, k, scalar_t(1.5), a_gpu, lda, b_gpu,
+          ldb, scalar_t(0.5), c_gpu, ldc);
+#ifndef NAIVE_GEMM
+    if (!configs.empty()) {
+      ASSERT_EQ(sb_handle.get_gemm_config(),
+                forced ? config : model.select(configs, shape));
+    }
+#endif
+    std::vector<scalar_t> c_m_gpu(m * n);
+    auto event = blas::helper::copy_to_host(sb_handle.get_queue(), c_gpu,
+                                            c_m_gpu.data(), c_m_gpu.size());
+    sb_handle.wait(event);
+    ASSERT_TRUE(utils::compare_vectors(c_m_gpu, c_m_cpu));
+  }
+  sb_handle.set_gemm_model(nullptr);
+
+  // The calibrated coefficients survive a write and a read
+  for (const auto& config : configs) {
+    model.set_coefficients(config.name, {1000, 0.5, 0.25});
+  }
+  std::stringstream written, rewritten;
+  model.write(written);
+  blas::GemmModel read_model(sb_handle.get_num_compute_units(),
+                             sb_handle.get_work_group_size(), 1000, 100);
+  read_model.read(written);
+  read_model.write(rewritten);
+  ASSERT_EQ(written.str(), rewritten.str());
+  for (const auto& config : configs) {
+    ASSERT_EQ(model.predict(config, shape), read_model.predict(config, shape));
+  }
+}
+
+template <typename scalar_t>
+const auto combi = ::testing::Combine(::testing::Values(7, 64, 513),  // m
+                                      ::testing::Values(5, 300),      // n
+                                      ::testing::Values(3, 129),      // k
+                                      ::testing::Values('n', 't'),  // transa
+                                      ::testing::Values('n', 't')   // transb
+);
+
+template <class T>
+static std::string generate_name(
+    const ::testing::TestParamInfo<combination_t<T>>& info) {
+  int m, n, k;
+  char transa, transb;
+  BLAS_GENERATE_NAME(info.param, m, n, k, transa, transb);
+}
+
+BLAS_REGISTER_TEST_ALL(GemmModel, combination_t, combi, generate_name);
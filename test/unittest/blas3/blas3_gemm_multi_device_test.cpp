@@ -0,0 +1,129 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *
+ *  @filename blas3_gemm_multi_device_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+template <typename scalar_t>
+using combination_t = std::tuple<int, int, int, int, int, int, char, char,
+                                 scalar_t, scalar_t>;
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  index_t num_queues;
+  index_t offset;
+  index_t batch;
+  index_t m;
+  index_t n;
+  index_t k;
+  char transa;
+  char transb;
+  scalar_t alpha;
+  scalar_t beta;
+  std::tie(num_queues, offset, batch, m, n, k, transa, transb, alpha, beta) =
+      combi;
+
+  const char ta_str[2] = {transa, '\0'};
+  const char tb_str[2] = {transb, '\0'};
+
+  const index_t lda = (transa != 'n') ? k : m;
+  const index_t ldb = (transb != 'n') ? n : k;
+  const index_t ldc = m;
+
+  const index_t stride_a = m * k;
+  const index_t stride_b = k * n;
+  const index_t stride_c = m * n;
+  const index_t size_a = stride_a * batch + offset;
+  const index_t size_b = stride_b * batch + offset;
+  const index_t size_c = stride_c * batch + offset;
+
+  std::vector<scalar_t> a_m(size_a);
+  std::vector<scalar_t> b_m(size_b);
+  std::vector<scalar_t> c_m_gpu(size_c);
+
+  fill_random(a_m);
+  fill_random(b_m);
+  fill_random(c_m_gpu);
+  std::vector<scalar_t> c_m_cpu = c_m_gpu;
+
+  for (index_t i = 0; i < batch; ++i) {
+    reference_blas::gemm(ta_str, tb_str, m, n, k, alpha,
+                         a_m.data() + i * stride_a + offset, lda,
+                         b_m.data() + i * stride_b + offset, ldb, beta,
+                         c_m_cpu.data() + i * stride_c + offset, ldc);
+  }
+
+  // Several queues sharing the context and device of the test queue
+  auto q = make_queue();
+  std::vector<cl::sycl::queue> queues;
+  for (index_t i = 0; i < num_queues; ++i) {
+    queues.emplace_back(q.get_context(), q.get_device());
+  }
+  blas::MultiSB_Handle multi_handle(queues);
+  auto m_a_gpu = blas::make_sycl_iterator_buffer<scalar_t>(a_m, size_a);
+  auto m_b_gpu = blas::make_sycl_iterator_buffer<scalar_t>(b_m, size_b);
+  auto m_c_gpu = blas::make_sycl_iterator_buffer<scalar_t>(c_m_gpu, size_c);
+
+  auto gemm_events =
+      (batch == 1)
+          ? _gemm(multi_handle, transa, transb, m, n, k, alpha,
+                  m_a_gpu + offset, lda, m_b_gpu + offset, ldb, beta,
+                  m_c_gpu + offset, ldc)
+          : _gemm_batched(multi_handle, transa, transb, m, n, k, alpha,
+                          m_a_gpu + offset, lda, m_b_gpu + offset, ldb, beta,
+                          m_c_gpu + offset, ldc, batch);
+  multi_handle.wait(gemm_events);
+
+  auto event = blas::helper::copy_to_host(q, m_c_gpu, c_m_gpu.data(), size_c);
+  multi_handle.wait(event);
+
+  ASSERT_TRUE(utils::compare_vectors(c_m_gpu, c_m_cpu));
+}
+
+template <typename scalar_t>
+const auto combi =
+    ::testing::Combine(::testing::Values(1, 2, 3),             // num_queues
+                       ::testing::Values(0, 33),               // offset
+                       ::testing::Values(1, 5),                // batch
+                       ::testing::Values(11, 64),              // m
+                       ::testing::Values(1, 13, 255),          // n
+                       ::testing::Values(17, 64),              // k
+                       ::testing::Values('n', 't'),            // transa
+                       ::testing::Values('n', 't'),            // transb
+                       ::testing::Values<scalar_t>(1.5),       // alpha
+                       ::testing::Values<scalar_t>(0.0, 0.5)   // beta
+    );
+
+template <class T>
+static std::string generate_name(
+    const ::testing::TestParamInfo<combination_t<T>>& info) {
+  int num_queues, offset, batch, m, n, k;
+  char transa, transb;
+  T alpha, beta;
+  BLAS_GENERATE_NAME(info.param, num_queues, offset, batch, m, n, k, transa,
+                     transb, alpha, beta);
+}
+
+BLAS_REGISTER_TEST_ALL(GemmMultiDevice, combination_t, combi, generate_name);
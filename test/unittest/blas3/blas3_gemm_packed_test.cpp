@@ -0,0 +1,134 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *
+ *  @filename blas3_gemm_packed_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+template <typename scalar_t>
+using combination_t = std::tuple<int, int, int, int, char, char, scalar_t,
+                                 scalar_t, int, int, int>;
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  index_t offset;
+  index_t m;
+  index_t n;
+  index_t k;
+  char transa;
+  char transb;
+  scalar_t alpha;
+  scalar_t beta;
+  index_t lda_mul;
+  index_t ldb_mul;
+  index_t ldc_mul;
+  std::tie(offset, m, n, k, transa, transb, alpha, beta, lda_mul, ldb_mul,
+           ldc_mul) = combi;
+
+  const char ta_str[2] = {transa, '\0'};
+  const char tb_str[2] = {transb, '\0'};
+
+  const index_t lda = ((transa != 'n') ? k : m) * lda_mul;
+  const index_t ldb = ((transb != 'n') ? n : k) * ldb_mul;
+  const index_t ldc = m * ldc_mul;
+
+  const index_t size_a = m * k * lda_mul + offset;
+  const index_t size_b = k * n * ldb_mul + offset;
+  const index_t size_c = m * n * ldc_mul + offset;
+  const index_t size_packed = blas::_gemm_packed_b_size(k, n);
+
+  // Two products sharing the same B, which is only packed once
+  std::vector<scalar_t> a_m_0(size_a);
+  std::vector<scalar_t> a_m_1(size_a);
+  std::vector<scalar_t> b_m(size_b);
+  std::vector<scalar_t> c_m_gpu_0(size_c);
+  std::vector<scalar_t> c_m_gpu_1(size_c);
+
+  fill_random(a_m_0);
+  fill_random(a_m_1);
+  fill_random(b_m);
+  fill_random(c_m_gpu_0);
+  fill_random(c_m_gpu_1);
+  std::vector<scalar_t> c_m_cpu_0 = c_m_gpu_0;
+  std::vector<scalar_t> c_m_cpu_1 = c_m_gpu_1;
+
+  reference_blas::gemm(ta_str, tb_str, m, n, k, alpha, a_m_0.data() + offset,
+                       lda, b_m.data() + offset, ldb, beta,
+                       c_m_cpu_0.data() + offset, ldc);
+  reference_blas::gemm(ta_str, tb_str, m, n, k, alpha, a_m_1.data() + offset,
+                       lda, b_m.data() + offset, ldb, beta,
+                       c_m_cpu_1.data() + offset, ldc);
+
+  auto q = make_queue();
+  blas::SB_Handle sb_handle(q);
+  auto m_a_gpu_0 = blas::make_sycl_iterator_buffer<scalar_t>(a_m_0, size_a);
+  auto m_a_gpu_1 = blas::make_sycl_iterator_buffer<scalar_t>(a_m_1, size_a);
+  auto m_b_gpu = blas::make_sycl_iterator_buffer<scalar_t>(b_m, size_b);
+  auto m_packed_gpu = blas::make_sycl_iterator_buffer<scalar_t>(size_packed);
+  auto m_c_gpu_0 = blas::make_sycl_iterator_buffer<scalar_t>(c_m_gpu_0, size_c);
+  auto m_c_gpu_1 = blas::make_sycl_iterator_buffer<scalar_t>(c_m_gpu_1, size_c);
+
+  _gemm_pack_b(sb_handle, transb, k, n, m_b_gpu + offset, ldb, m_packed_gpu);
+  _gemm_packed(sb_handle, transa, m, n, k, alpha, m_a_gpu_0 + offset, lda,
+               m_packed_gpu, beta, m_c_gpu_0 + offset, ldc);
+  _gemm_packed(sb_handle, transa, m, n, k, alpha, m_a_gpu_1 + offset, lda,
+               m_packed_gpu, beta, m_c_gpu_1 + offset, ldc);
+
+  auto event_0 = blas::helper::copy_to_host(sb_handle.get_queue(), m_c_gpu_0,
+                                            c_m_gpu_0.data(), size_c);
+  auto event_1 = blas::helper::copy_to_host(sb_handle.get_queue(), m_c_gpu_1,
+                                            c_m_gpu_1.data(), size_c);
+  sb_handle.wait(event_0);
+  sb_handle.wait(event_1);
+
+  ASSERT_TRUE(utils::compare_vectors(c_m_gpu_0, c_m_cpu_0));
+  ASSERT_TRUE(utils::compare_vectors(c_m_gpu_1, c_m_cpu_1));
+}
+
+template <typename scalar_t>
+const auto combi =
+    ::testing::Combine(::testing::Values(0, 33),               // offset
+                       ::testing::Values(1, 11, 64, 257),      // m
+                       ::testing::Values(1, 4, 13, 255),       // n
+                       ::testing::Values(1, 17, 511),          // k
+                       ::testing::Values('n', 't'),            // transa
+                       ::testing::Values('n', 't'),            // transb
+                       ::testing::Values<scalar_t>(1.0, 1.5),  // alpha
+                       ::testing::Values<scalar_t>(0.0, 0.5),  // beta
+                       ::testing::Values(1, 2),                // lda_mul
+                       ::testing::Values(1, 3),                // ldb_mul
+                       ::testing::Values(1)                    // ldc_mul
+    );
+
+template <class T>
+static std::string generate_name(
+    const ::testing::TestParamInfo<combination_t<T>>& info) {
+  int offset, m, n, k, ldaMul, ldbMul, ldcMul;
+  char transa, transb;
+  T alpha, beta;
+  BLAS_GENERATE_NAME(info.param, offset, m, n, k, transa, transb, alpha, beta,
+                     ldaMul, ldbMul, ldcMul);
+}
+
+BLAS_REGISTER_TEST_ALL(GemmPacked, combination_t, combi, generate_name);
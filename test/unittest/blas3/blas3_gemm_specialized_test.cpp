@@ -0,0 +1,141 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *
+ *  @filename blas3_gemm_specialized_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas3_gemm_common.hpp"
+#include "blas_test.hpp"
+
+template <typename scalar_t>
+inline void verify_gemm_specialized(
+    const gemm_arguments_t<scalar_t> arguments) {
+  index_t offset;
+  index_t batch;
+  index_t m;
+  index_t n;
+  index_t k;
+  char transa;
+  char transb;
+  scalar_t alpha;
+  scalar_t beta;
+  index_t lda_mul;
+  index_t ldb_mul;
+  index_t ldc_mul;
+  gemm_batch_type_t batch_type;
+  std::tie(offset, batch, m, n, k, transa, transb, alpha, beta, lda_mul,
+           ldb_mul, ldc_mul, batch_type) = arguments;
+
+  const char ta_str[2] = {transa, '\0'};
+  const char tb_str[2] = {transb, '\0'};
+
+  auto q = make_queue();
+  blas::SB_Handle sb_handle(q);
+
+  const index_t lda = ((transa != 'n') ? k : m) * lda_mul;
+  const index_t ldb = ((transb != 'n') ? n : k) * ldb_mul;
+  const index_t ldc = m * ldc_mul;
+
+  const index_t size_a = m * k * lda_mul;
+  const index_t size_b = k * n * ldb_mul;
+  const index_t size_c = m * n * ldc_mul;
+
+  const index_t buffer_size_a = batch * size_a + offset;
+  const index_t buffer_size_b = batch * size_b + offset;
+  const index_t buffer_size_c = batch * size_c + offset;
+
+  std::vector<scalar_t> a_m(buffer_size_a);
+  std::vector<scalar_t> b_m(buffer_size_b);
+  std::vector<scalar_t> c_m_gpu(buffer_size_c);
+
+  fill_random(a_m);
+  fill_random(b_m);
+  fill_random(c_m_gpu);
+  std::vector<scalar_t> c_m_cpu = c_m_gpu;
+
+  // Use system blas to create a reference output
+  for (int i = 0; i < batch; ++i) {
+    reference_blas::gemm(ta_str, tb_str, m, n, k, alpha,
+                         a_m.data() + i * size_a + offset, lda,
+                         b_m.data() + i * size_b + offset, ldb, beta,
+                         c_m_cpu.data() + i * size_c + offset, ldc);
+  }
+
+  auto m_a_gpu = blas::make_sycl_iterator_buffer<scalar_t>(a_m, buffer_size_a);
+  auto m_b_gpu = blas::make_sycl_iterator_buffer<scalar_t>(b_m, buffer_size_b);
+  auto m_c_gpu =
+      blas::make_sycl_iterator_buffer<scalar_t>(c_m_gpu, buffer_size_c);
+
+  // SYCL BLAS GEMM specialized at JIT time
+  _gemm_specialized(sb_handle, transa, transb, m, n, k, alpha,
+                    m_a_gpu + offset, lda, m_b_gpu + offset, ldb, beta,
+                    m_c_gpu + offset, ldc, batch);
+
+  auto event = blas::helper::copy_to_host(sb_handle.get_queue(), m_c_gpu,
+                                          c_m_gpu.data(), buffer_size_c);
+  sb_handle.wait(event);
+
+  const bool isAlmostEqual = utils::compare_vectors(c_m_gpu, c_m_cpu);
+  ASSERT_TRUE(isAlmostEqual);
+}
+
+template <typename scalar_t>
+const auto SmallShapes = ::testing::Combine(
+    ::testing::Values(0, 33),                      // offset
+    ::testing::Values(1, 3),                       // batch
+    ::testing::Values(1, 11, 16, 63),              // m
+    ::testing::Values(1, 11, 16, 63),              // n
+    ::testing::Values(1, 17),                      // k
+    ::testing::Values('n', 't'),                   // transa
+    ::testing::Values('n', 't'),                   // transb
+    ::testing::Values<scalar_t>(1.0, 1.5),         // alpha
+    ::testing::Values<scalar_t>(0.0, 1.5),         // beta
+    ::testing::Values(1),                          // lda_mul
+    ::testing::Values(1),                          // ldb_mul
+    ::testing::Values(1),                          // ldc_mul
+    ::testing::Values(gemm_batch_type_t::strided)  // batch_type
+);
+BLAS_REGISTER_TEST_CUSTOM_NAME(GemmSpecialized, GemmSpecializedSmallShapes,
+                               verify_gemm_specialized, gemm_arguments_t,
+                               SmallShapes, generate_name);
+
+template <typename scalar_t>
+const auto LargeShapesLDMultiplied = ::testing::Combine(
+    ::testing::Values(0),                          // offset
+    ::testing::Values(1),                          // batch
+    ::testing::Values(253, 511),                   // m
+    ::testing::Values(257, 511),                   // n
+    ::testing::Values(1023),                       // k
+    ::testing::Values('n', 't'),                   // transa
+    ::testing::Values('n', 't'),                   // transb
+    ::testing::Values<scalar_t>(1.5),              // alpha
+    ::testing::Values<scalar_t>(0.5),              // beta
+    ::testing::Values(2),                          // lda_mul
+    ::testing::Values(3),                          // ldb_mul
+    ::testing::Values(4),                          // ldc_mul
+    ::testing::Values(gemm_batch_type_t::strided)  // batch_type
+);
+BLAS_REGISTER_TEST_CUSTOM_NAME(GemmSpecialized,
+                               GemmSpecializedLargeShapesLDMultiplied,
+                               verify_gemm_specialized, gemm_arguments_t,
+                               LargeShapesLDMultiplied, generate_name);
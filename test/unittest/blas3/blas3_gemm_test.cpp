@@ -133,3 +133,94 @@ const auto LargeBetaNonZeroLDMatch = ::testing::Combine(
     ::testing::Values(gemm_batch_type_t::strided)  // batch_type
 );
 GENERATE_GEMM_TEST(Gemm, LargeBetaNonZeroLDMatch);
+
+/**
+ * Row-major GEMM: the operands are the row-major copies of the column-major
+ * matrices of the reference, and the result is compared with the transposed
+ * reference. The batch and offset arguments are not used.
+ */
+template <typename scalar_t>
+inline void verify_gemm_row_major(const gemm_arguments_t<scalar_t> arguments) {
+  index_t offset;
+  index_t batch;
+  index_t m;
+  index_t n;
+  index_t k;
+  char transa;
+  char transb;
+  scalar_t alpha;
+  scalar_t beta;
+  index_t lda_mul;
+  index_t ldb_mul;
+  index_t ldc_mul;
+  gemm_batch_type_t batch_type;
+  std::tie(offset, batch, m, n, k, transa, transb, alpha, beta, lda_mul,
+           ldb_mul, ldc_mul, batch_type) = arguments;
+
+  const char ta_str[2] = {transa, '\0'};
+  const char tb_str[2] = {transb, '\0'};
+
+  // Stored shapes of A and B
+  const index_t rows_a = (transa != 'n') ? k : m;
+  const index_t cols_a = (transa != 'n') ? m : k;
+  const index_t rows_b = (transb != 'n') ? n : k;
+  const index_t cols_b = (transb != 'n') ? k : n;
+
+  std::vector<scalar_t> a_m(rows_a * cols_a);
+  std::vector<scalar_t> b_m(rows_b * cols_b);
+  std::vector<scalar_t> c_m(m * n);
+  fill_random(a_m);
+  fill_random(b_m);
+  fill_random(c_m);
+  std::vector<scalar_t> c_m_cpu = c_m;
+  reference_blas::gemm(ta_str, tb_str, m, n, k, alpha, a_m.data(), rows_a,
+                       b_m.data(), rows_b, beta, c_m_cpu.data(), m);
+
+  // Leading dimensions are now the steps between rows
+  const index_t lda = cols_a * lda_mul;
+  const index_t ldb = cols_b * ldb_mul;
+  const index_t ldc = n * ldc_mul;
+  auto a_row_major = to_row_major(a_m, rows_a, cols_a, rows_a, lda);
+  auto b_row_major = to_row_major(b_m, rows_b, cols_b, rows_b, ldb);
+  auto c_row_major = to_row_major(c_m, m, n, m, ldc);
+  const auto c_row_major_cpu = to_row_major(c_m_cpu, m, n, m, ldc);
+
+  auto q = make_queue();
+  blas::SB_Handle sb_handle(q);
+  auto m_a_gpu =
+      blas::make_sycl_iterator_buffer<scalar_t>(a_row_major, rows_a * lda);
+  auto m_b_gpu =
+      blas::make_sycl_iterator_buffer<scalar_t>(b_row_major, rows_b * ldb);
+  auto m_c_gpu =
+      blas::make_sycl_iterator_buffer<scalar_t>(c_row_major, m * ldc);
+
+  _gemm(sb_handle, blas::access_layout::row_major, transa, transb, m, n, k,
+        alpha, m_a_gpu, lda, m_b_gpu, ldb, beta, m_c_gpu, ldc);
+
+  auto event = blas::helper::copy_to_host(sb_handle.get_queue(), m_c_gpu,
+                                          c_row_major.data(), m * ldc);
+  sb_handle.wait(event);
+
+  const bool isAlmostEqual =
+      utils::compare_vectors(c_row_major, c_row_major_cpu);
+  ASSERT_TRUE(isAlmostEqual);
+}
+
+template <typename scalar_t>
+const auto RowMajor = ::testing::Combine(
+    ::testing::Values(0),                          // offset
+    ::testing::Values(1),                          // batch
+    ::testing::Values(11, 63),                     // m
+    ::testing::Values(16, 65),                     // n
+    ::testing::Values(17, 33),                     // k
+    ::testing::Values('n', 't'),                   // transa
+    ::testing::Values('n', 't'),                   // transb
+    ::testing::Values<scalar_t>(1.5),              // alpha
+    ::testing::Values<scalar_t>(0.0, 0.5),         // beta
+    ::testing::Values(1, 2),                       // lda_mul
+    ::testing::Values(1, 3),                       // ldb_mul
+    ::testing::Values(1, 2),                       // ldc_mul
+    ::testing::Values(gemm_batch_type_t::strided)  // batch_type
+);
+BLAS_REGISTER_TEST_CUSTOM_NAME(Gemm, GemmRowMajor, verify_gemm_row_major,
+                               gemm_arguments_t, RowMajor, generate_name);
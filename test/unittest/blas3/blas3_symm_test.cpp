@@ -0,0 +1,118 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+template <typename scalar_t>
+using combination_t =
+    std::tuple<int, int, char, char, scalar_t, scalar_t, int, int, scalar_t>;
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  index_t m;
+  index_t n;
+  char side;
+  char uplo;
+  scalar_t alpha;
+  scalar_t beta;
+  index_t ldaMul;
+  index_t ldbcMul;
+  scalar_t unusedValue;
+  std::tie(m, n, side, uplo, alpha, beta, ldaMul, ldbcMul, unusedValue) =
+      combi;
+
+  const char side_str[2] = {side, '\0'};
+  const char uplo_str[2] = {uplo, '\0'};
+
+  const index_t k = side == 'l' ? m : n;
+  const index_t lda = k * ldaMul;
+  const index_t ldb = m * ldbcMul;
+  const index_t ldc = m * ldbcMul;
+
+  const index_t sizeA = k * lda;
+  const index_t sizeB = n * ldb;
+  const index_t sizeC = n * ldc;
+
+  std::vector<scalar_t> A(sizeA);
+  std::vector<scalar_t> B(sizeB);
+  std::vector<scalar_t> C(sizeC);
+  fill_random(A);
+  fill_random(B);
+  fill_random(C);
+
+  // The triangle that is not stored must never be read
+  for (index_t j = 0; j < k; ++j) {
+    for (index_t i = 0; i < k; ++i) {
+      if ((uplo == 'u' && i > j) || (uplo == 'l' && i < j)) {
+        A[i + j * lda] = unusedValue;
+      }
+    }
+  }
+
+  std::vector<scalar_t> cpu_C = C;
+  reference_blas::symm(side_str, uplo_str, m, n, alpha, A.data(), lda,
+                       B.data(), ldb, beta, cpu_C.data(), ldc);
+
+  auto q = make_queue();
+  blas::SB_Handle sb_handle(q);
+  auto a_gpu = blas::make_sycl_iterator_buffer<scalar_t>(A, sizeA);
+  auto b_gpu = blas::make_sycl_iterator_buffer<scalar_t>(B, sizeB);
+  auto c_gpu = blas::make_sycl_iterator_buffer<scalar_t>(C, sizeC);
+
+  _symm(sb_handle, side, uplo, m, n, alpha, a_gpu, lda, b_gpu, ldb, beta,
+        c_gpu, ldc);
+
+  auto event = blas::helper::copy_to_host<scalar_t>(sb_handle.get_queue(),
+                                                    c_gpu, C.data(), sizeC);
+  sb_handle.wait(event);
+
+  const bool isAlmostEqual = utils::compare_vectors(C, cpu_C);
+  ASSERT_TRUE(isAlmostEqual);
+}
+
+static constexpr double NaN = std::numeric_limits<double>::quiet_NaN();
+
+template <typename scalar_t>
+const auto combi =
+    ::testing::Combine(::testing::Values(7, 65, 513),          // m
+                       ::testing::Values(7, 65, 513),          // n
+                       ::testing::Values('l', 'r'),            // side
+                       ::testing::Values('l', 'u'),            // uplo
+                       ::testing::Values<scalar_t>(1.5),       // alpha
+                       ::testing::Values<scalar_t>(0.0, 0.5),  // beta
+                       ::testing::Values(1, 2),                // lda_mul
+                       ::testing::Values(1, 2),                // ldbc_mul
+                       ::testing::Values<scalar_t>(0.0, NaN)   // unused
+    );
+
+template <class T>
+static std::string generate_name(
+    const ::testing::TestParamInfo<combination_t<T>>& info) {
+  int m, n, ldaMul, ldbcMul;
+  char side, uplo;
+  T alpha, beta, unusedValue;
+  BLAS_GENERATE_NAME(info.param, m, n, side, uplo, alpha, beta, ldaMul,
+                     ldbcMul, unusedValue);
+}
+
+BLAS_REGISTER_TEST_ALL(Symm, combination_t, combi, generate_name);
@@ -0,0 +1,104 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+template <typename scalar_t>
+using combination_t =
+    std::tuple<int, int, char, char, scalar_t, scalar_t, int, int>;
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  index_t n;
+  index_t k;
+  char uplo;
+  char trans;
+  scalar_t alpha;
+  scalar_t beta;
+  index_t ldabMul;
+  index_t ldcMul;
+  std::tie(n, k, uplo, trans, alpha, beta, ldabMul, ldcMul) = combi;
+
+  const char uplo_str[2] = {uplo, '\0'};
+  const char trans_str[2] = {trans, '\0'};
+
+  // k = 0 only scales C, A still needs a valid leading dimension and buffer
+  const index_t lda = std::max<index_t>((trans == 'n' ? n : k) * ldabMul, 1);
+  const index_t ldb = lda;
+  const index_t ldc = n * ldcMul;
+
+  const index_t sizeA = std::max<index_t>(lda * (trans == 'n' ? k : n), 1);
+  const index_t sizeB = sizeA;
+  const index_t sizeC = ldc * n;
+
+  std::vector<scalar_t> A(sizeA);
+  std::vector<scalar_t> B(sizeB);
+  std::vector<scalar_t> C(sizeC);
+  fill_random(A);
+  fill_random(B);
+  fill_random(C);
+
+  std::vector<scalar_t> cpu_C = C;
+  reference_blas::syr2k(uplo_str, trans_str, n, k, alpha, A.data(), lda,
+                        B.data(), ldb, beta, cpu_C.data(), ldc);
+
+  auto q = make_queue();
+  blas::SB_Handle sb_handle(q);
+  auto a_gpu = blas::make_sycl_iterator_buffer<scalar_t>(A, sizeA);
+  auto b_gpu = blas::make_sycl_iterator_buffer<scalar_t>(B, sizeB);
+  auto c_gpu = blas::make_sycl_iterator_buffer<scalar_t>(C, sizeC);
+
+  _syr2k(sb_handle, uplo, trans, n, k, alpha, a_gpu, lda, b_gpu, ldb, beta,
+         c_gpu, ldc);
+
+  auto event = blas::helper::copy_to_host<scalar_t>(sb_handle.get_queue(),
+                                                    c_gpu, C.data(), sizeC);
+  sb_handle.wait(event);
+
+  const bool isAlmostEqual = utils::compare_vectors(C, cpu_C);
+  ASSERT_TRUE(isAlmostEqual);
+}
+
+template <typename scalar_t>
+const auto combi =
+    ::testing::Combine(::testing::Values(7, 64, 65, 513),      // n
+                       ::testing::Values(0, 3, 63, 257),       // k
+                       ::testing::Values('u', 'l'),            // uplo
+                       ::testing::Values('n', 't'),            // trans
+                       ::testing::Values<scalar_t>(1.5),       // alpha
+                       ::testing::Values<scalar_t>(0.0, 0.5),  // beta
+                       ::testing::Values(1, 2),                // ldab_mul
+                       ::testing::Values(1, 2)                 // ldc_mul
+    );
+
+template <class T>
+static std::string generate_name(
+    const ::testing::TestParamInfo<combination_t<T>>& info) {
+  int n, k, ldabMul, ldcMul;
+  char uplo, trans;
+  T alpha, beta;
+  BLAS_GENERATE_NAME(info.param, n, k, uplo, trans, alpha, beta, ldabMul,
+                     ldcMul);
+}
+
+BLAS_REGISTER_TEST_ALL(Syr2k, combination_t, combi, generate_name);
@@ -113,3 +113,88 @@ static std::string generate_name(
 }
 
 BLAS_REGISTER_TEST_ALL(Trsm, combination_t, combi, generate_name);
+
+template <typename scalar_t>
+using row_major_combination_t =
+    std::tuple<int, int, char, char, char, char, int, int>;
+
+/**
+ * Row-major TRSM: A and B are the row-major copies of the column-major
+ * matrices of the reference, and the solution is compared with the transposed
+ * reference.
+ */
+template <typename scalar_t>
+void run_row_major_test(const row_major_combination_t<scalar_t> combi) {
+  index_t m;
+  index_t n;
+  char trans;
+  char side;
+  char diag;
+  char uplo;
+  index_t ldaMul;
+  index_t ldbMul;
+  std::tie(m, n, trans, side, diag, uplo, ldaMul, ldbMul) = combi;
+
+  const int k = side == 'l' ? m : n;
+  const scalar_t alpha{2};
+
+  std::vector<scalar_t> A(k * k);
+  std::vector<scalar_t> B(m * n);
+  const scalar_t diagValue =
+      diag == 'u' ? scalar_t{1} : random_scalar(scalar_t{1}, scalar_t{10});
+  fill_trsm_matrix(A, k, k, uplo, diagValue, scalar_t{0});
+  fill_random(B);
+  std::vector<scalar_t> cpu_B = B;
+  reference_blas::trsm(&side, &uplo, &trans, &diag, m, n, alpha, A.data(), k,
+                       cpu_B.data(), m);
+
+  // Leading dimensions are now the steps between rows
+  const index_t lda = k * ldaMul;
+  const index_t ldb = n * ldbMul;
+  auto A_row_major = to_row_major(A, k, k, k, lda);
+  auto B_row_major = to_row_major(B, m, n, m, ldb);
+  const auto cpu_B_row_major = to_row_major(cpu_B, m, n, m, ldb);
+
+  auto q = make_queue();
+  blas::SB_Handle sb_handle(q);
+  auto a_gpu = blas::make_sycl_iterator_buffer<scalar_t>(A_row_major,
+                                                          A_row_major.size());
+  auto b_gpu = blas::make_sycl_iterator_buffer<scalar_t>(B_row_major,
+                                                          B_row_major.size());
+
+  _trsm(sb_handle, blas::access_layout::row_major, side, uplo, trans, diag, m,
+        n, alpha, a_gpu, lda, b_gpu, ldb);
+
+  auto event = blas::helper::copy_to_host<scalar_t>(
+      sb_handle.get_queue(), b_gpu, B_row_major.data(), B_row_major.size());
+  sb_handle.wait(event);
+
+  const bool isAlmostEqual =
+      utils::compare_vectors(cpu_B_row_major, B_row_major);
+  ASSERT_TRUE(isAlmostEqual);
+}
+
+template <typename scalar_t>
+const auto row_major_combi =
+    ::testing::Combine(::testing::Values(7, 75),     // m
+                       ::testing::Values(7, 75),     // n
+                       ::testing::Values('n', 't'),  // trans
+                       ::testing::Values('l', 'r'),  // side
+                       ::testing::Values('u', 'n'),  // diag
+                       ::testing::Values('l', 'u'),  // uplo
+                       ::testing::Values(1, 2),      // lda_mul
+                       ::testing::Values(1, 2)       // ldb_mul
+    );
+
+template <class T>
+static std::string generate_row_major_name(
+    const ::testing::TestParamInfo<row_major_combination_t<T>>& info) {
+  int m, n, ldaMul, ldbMul;
+  char trans, side, diag, uplo;
+  BLAS_GENERATE_NAME(info.param, m, n, trans, side, diag, uplo, ldaMul,
+                     ldbMul);
+}
+
+BLAS_REGISTER_TEST_CUSTOM_NAME(Trsm, TrsmRowMajor, run_row_major_test,
+                               row_major_combination_t, row_major_combi,
+                               generate_row_major_name);
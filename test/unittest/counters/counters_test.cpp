@@ -0,0 +1,110 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename counters_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+#include <sstream>
+
+template <typename scalar_t>
+using combination_t = std::tuple<int, int>;
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  int m, n;
+  std::tie(m, n) = combi;
+
+  std::vector<scalar_t> a_m(m * m);
+  std::vector<scalar_t> b_m(m * n);
+  std::vector<scalar_t> x_v(m);
+  fill_random(b_m);
+  fill_random(x_v);
+  fill_trsm_matrix(a_m, m, m, 'l');
+
+  auto q = make_queue();
+  blas::SB_Handle sb_handle(q);
+  auto a_gpu = blas::make_sycl_iterator_buffer<scalar_t>(a_m, a_m.size());
+  auto b_gpu = blas::make_sycl_iterator_buffer<scalar_t>(b_m, b_m.size());
+  auto x_gpu = blas::make_sycl_iterator_buffer<scalar_t>(x_v, x_v.size());
+
+  _trsm(sb_handle, 'l', 'l', 'n', 'n', m, n, scalar_t(1), a_gpu, m, b_gpu, m);
+  _dot(sb_handle, m, x_gpu, 1, x_gpu, 1);
+  _dot(sb_handle, m, x_gpu, 1, x_gpu, 1);
+  sb_handle.wait();
+
+  const blas::Counters& counters = sb_handle.get_counters();
+  const auto trsm = counters.get("trsm");
+  const auto dot = counters.get("dot_return");
+  const auto other = counters.get("other");
+  if (!blas::Counters::enabled()) {
+    ASSERT_EQ(counters.get_total().calls, 0u);
+    ASSERT_EQ(counters.get_total().kernels, 0u);
+    ASSERT_EQ(counters.get_total().waits, 0u);
+    return;
+  }
+
+  // TRSM inverts the diagonal blocks into a scratch buffer before its GEMMs
+  ASSERT_EQ(trsm.calls, 1u);
+  ASSERT_GT(trsm.kernels, 1u);
+  ASSERT_GE(trsm.scratch_allocations, 1u);
+  ASSERT_GE(trsm.scratch_bytes, trsm.scratch_allocations * sizeof(scalar_t));
+  ASSERT_EQ(trsm.copies, 0u);
+
+  // Each synchronous DOT allocates its result, copies it back and waits
+  ASSERT_EQ(dot.calls, 2u);
+  ASSERT_GE(dot.kernels, 2u);
+  ASSERT_GE(dot.scratch_allocations, 2u);
+  ASSERT_GE(dot.scratch_bytes, 2 * sizeof(scalar_t));
+  ASSERT_EQ(dot.copies, 2u);
+  ASSERT_EQ(dot.copy_bytes, 2 * sizeof(scalar_t));
+  ASSERT_EQ(dot.waits, 2u);
+
+  // The wait of the application is outside of any routine
+  ASSERT_EQ(other.calls, 0u);
+  ASSERT_EQ(other.waits, 1u);
+
+  std::stringstream csv;
+  counters.write(csv);
+  ASSERT_NE(csv.str().find("\ndot_return,2,"), std::string::npos);
+
+  sb_handle.get_counters().reset();
+  ASSERT_EQ(counters.get_total().calls, 0u);
+  ASSERT_EQ(counters.get_total().kernels, 0u);
+  ASSERT_EQ(counters.get_total().waits, 0u);
+}
+
+template <typename scalar_t>
+const auto combi = ::testing::Combine(::testing::Values(7, 64),  // m
+                                      ::testing::Values(5, 33)   // n
+);
+
+template <class T>
+static std::string generate_name(
+    const ::testing::TestParamInfo<combination_t<T>>& info) {
+  int m, n;
+  BLAS_GENERATE_NAME(info.param, m, n);
+}
+
+BLAS_REGISTER_TEST_ALL(Counters, combination_t, combi, generate_name);
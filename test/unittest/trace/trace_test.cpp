@@ -0,0 +1,115 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename trace_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+#include <sstream>
+
+template <typename scalar_t>
+using combination_t = std::tuple<int, int, int>;
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  int m, n, offset;
+  std::tie(m, n, offset) = combi;
+
+  std::vector<scalar_t> a_m(m * m);
+  std::vector<scalar_t> b_m(m * n);
+  std::vector<scalar_t> c_m(offset + m * n);
+  std::vector<scalar_t> x_v(m);
+  fill_random(b_m);
+  fill_random(x_v);
+  fill_trsm_matrix(a_m, m, m, 'l');
+
+  auto q = make_queue();
+  blas::SB_Handle sb_handle(q);
+  auto a_gpu = blas::make_sycl_iterator_buffer<scalar_t>(a_m, a_m.size());
+  auto b_gpu = blas::make_sycl_iterator_buffer<scalar_t>(b_m, b_m.size());
+  auto c_gpu = blas::make_sycl_iterator_buffer<scalar_t>(c_m, c_m.size());
+  auto x_gpu = blas::make_sycl_iterator_buffer<scalar_t>(x_v, x_v.size());
+
+  blas::Trace trace;
+  sb_handle.set_trace(&trace);
+  _gemm(sb_handle, 'n', 't', m, n, m, scalar_t(2), a_gpu, m, b_gpu, n,
+        scalar_t(0), c_gpu + offset, m);
+  _gemv(sb_handle, 'n', m, m, scalar_t(1), a_gpu, m, x_gpu, 1, scalar_t(1),
+        c_gpu + offset, 1);
+  _trsm(sb_handle, 'l', 'l', 'n', 'n', m, n, scalar_t(1), a_gpu, m,
+        c_gpu + offset, m);
+  sb_handle.set_trace(nullptr);
+  auto event = _gemm(sb_handle, 'n', 'n', m, n, m, scalar_t(1), a_gpu, m,
+                     b_gpu, m, scalar_t(0), c_gpu, m);
+  sb_handle.wait(event);
+
+  // The buffers are numbered in the order the trace first sees them
+  const auto& buffers = trace.get_buffers();
+  ASSERT_EQ(buffers.size(), size_t(4));
+  const std::vector<std::ptrdiff_t> counts{m * m, m * n, offset + m * n, m};
+  for (size_t i = 0; i < buffers.size(); ++i) {
+    ASSERT_EQ(buffers[i].element_size, sizeof(scalar_t));
+    ASSERT_EQ(buffers[i].count, counts[i]);
+  }
+
+  const auto& calls = trace.get_calls();
+  ASSERT_EQ(calls.size(), size_t(3));
+  ASSERT_EQ(calls[0].routine, "gemm");
+  ASSERT_EQ(calls[0].options, "nt");
+  ASSERT_EQ(calls[0].sizes, (std::vector<std::int64_t>{m, n, m, m, n, m}));
+  ASSERT_EQ(calls[0].scalars, (std::vector<double>{2, 0}));
+  ASSERT_EQ(calls[1].routine, "gemv");
+  ASSERT_EQ(calls[2].routine, "trsm");
+  ASSERT_EQ(calls[2].options, "llnn");
+
+  // The three calls alias A and the block of C
+  const std::vector<std::vector<size_t>> ids{{0, 1, 2}, {0, 3, 2}, {0, 2}};
+  for (size_t i = 0; i < calls.size(); ++i) {
+    ASSERT_EQ(calls[i].operands.size(), ids[i].size());
+    for (size_t j = 0; j < ids[i].size(); ++j) {
+      ASSERT_EQ(calls[i].operands[j].buffer, ids[i][j]);
+      ASSERT_EQ(calls[i].operands[j].offset,
+                std::ptrdiff_t(ids[i][j] == 2 ? offset : 0));
+    }
+  }
+
+  std::stringstream written, rewritten;
+  trace.write(written);
+  blas::Trace::read(written).write(rewritten);
+  ASSERT_EQ(written.str(), rewritten.str());
+}
+
+template <typename scalar_t>
+const auto combi = ::testing::Combine(::testing::Values(7, 64),  // m
+                                      ::testing::Values(5, 33),  // n
+                                      ::testing::Values(0, 16)   // offset
+);
+
+template <class T>
+static std::string generate_name(
+    const ::testing::TestParamInfo<combination_t<T>>& info) {
+  int m, n, offset;
+  BLAS_GENERATE_NAME(info.param, m, n, offset);
+}
+
+BLAS_REGISTER_TEST_ALL(Trace, combination_t, combi, generate_name);